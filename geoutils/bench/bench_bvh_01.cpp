@@ -0,0 +1,393 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * bench_bvh_01.cpp                GeoUtils benchmark: Bounding box
+ *                                 hierarchies.
+ * =========================================================================
+ *
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ *
+ * GeoUtils - Ionflux' Geometry Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+ *
+ * ========================================================================== */
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include "ifobject/IFObject.hpp"
+#include "geoutils/constants.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Range3.hpp"
+#include "geoutils/Line3.hpp"
+#include "geoutils/Mesh.hpp"
+#include "geoutils/Face.hpp"
+#include "geoutils/Clock.hpp"
+#include "geoutils/SplitSet.hpp"
+#include "geoutils/BoundingBox.hpp"
+#include "geoutils/BoxBoundsTree.hpp"
+#include "geoutils/GeoUtilsError.hpp"
+
+using namespace Ionflux::GeoUtils;
+
+// Name of the benchmark.
+const std::string BENCH_NAME = "Bounding box hierarchies";
+// Default output file.
+const std::string DEFAULT_OUTPUT_FILE = "bench_bvh_01.json";
+
+// Number of rays cast for each hierarchy.
+const unsigned int NUM_RAYS = 10000;
+// Seed for the ray generator.
+const unsigned int RAY_SEED = 4711;
+// Number of split candidates per axis for BoundingBox::split().
+const unsigned int NUM_SPLITS_PER_AXIS = 3;
+// Minimum number of items per box for BoundingBox::split().
+const unsigned int SPLIT_MIN_ITEMS = 4;
+
+// Synthetic scene.
+struct Scene
+{
+    // Name.
+    std::string name;
+    // Mesh type ("grid" or "fiber").
+    std::string meshType;
+    // Mesh parameters.
+    unsigned int param0;
+    unsigned int param1;
+};
+
+// Benchmark result.
+struct BenchResult
+{
+    // Benchmark name.
+    std::string name;
+    // Scene name.
+    std::string scene;
+    // Number of items processed.
+    unsigned int numItems;
+    // Item unit.
+    std::string itemUnit;
+    // Time (seconds).
+    double time;
+    // Number of bounding boxes in the hierarchy.
+    unsigned int numBoxes;
+    // Peak resident set size of the process (kilobytes).
+    long peakRSS;
+};
+
+typedef std::vector<BenchResult> BenchResultVector;
+
+long getPeakRSS()
+{
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0)
+        return 0;
+    return ru.ru_maxrss;
+}
+
+void addResult(BenchResultVector& target, const std::string& name,
+    const std::string& scene, unsigned int numItems,
+    const std::string& itemUnit, double time, unsigned int numBoxes)
+{
+    BenchResult r0;
+    r0.name = name;
+    r0.scene = scene;
+    r0.numItems = numItems;
+    r0.itemUnit = itemUnit;
+    r0.time = time;
+    r0.numBoxes = numBoxes;
+    r0.peakRSS = getPeakRSS();
+    target.push_back(r0);
+    double tp = 0.;
+    if (time > 0.)
+        tp = numItems / time;
+    std::cout << "    " << std::left << std::setw(20) << name
+        << std::right << std::setw(10) << numItems << " "
+        << std::left << std::setw(6) << itemUnit << std::right
+        << " in " << std::fixed << std::setprecision(6) << time
+        << " secs (" << std::setprecision(1) << tp << " " << itemUnit
+        << "/sec, " << numBoxes << " boxes)" << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield);
+}
+
+Mesh* createSceneMesh(const Scene& scene)
+{
+    Mesh* m0 = 0;
+    if (scene.meshType == "grid")
+        m0 = Mesh::grid(scene.param0, scene.param1);
+    else
+    if (scene.meshType == "fiber")
+        m0 = Mesh::fiber(scene.param0, scene.param1, 1., 0.1);
+    if (m0 == 0)
+        throw GeoUtilsError("Unknown mesh type: " + scene.meshType);
+    m0->makeTris();
+    m0->update(true, false);
+    return m0;
+}
+
+double getRandom()
+{
+    return static_cast<double>(::rand()) / RAND_MAX;
+}
+
+/* Create random rays through the bounds of the mesh. The same rays are
+   used for each hierarchy so the query results can be compared. */
+void createRays(const Range3& bounds, unsigned int numRays,
+    std::vector<Line3>& target)
+{
+    ::srand(RAY_SEED);
+    Vector3 l0 = bounds.getRMin();
+    Vector3 e0 = bounds.getExtent();
+    for (unsigned int i = 0; i < numRays; i++)
+    {
+        Vector3 p0(l0.getX0() + getRandom() * e0.getX0(),
+            l0.getX1() + getRandom() * e0.getX1(),
+            l0.getX2() + getRandom() * e0.getX2());
+        Vector3 u0(2. * getRandom() - 1., 2. * getRandom() - 1.,
+            2. * getRandom() - 1.);
+        if (u0.norm() < 0.01)
+            u0 = Vector3::E_Z;
+        target.push_back(Line3(p0 - 10. * u0, u0.normalize()));
+    }
+}
+
+BoundingBox* createRoot(Mesh* m0, Ionflux::ObjectBase::IFObject& mm)
+{
+    BoundingBox* b0 = BoundingBox::create();
+    mm.addLocalRef(b0);
+    unsigned int numFaces = m0->getNumFaces();
+    for (unsigned int i = 0; i < numFaces; i++)
+        b0->addItem(m0->getFace(i));
+    return b0;
+}
+
+unsigned int getNumBoxes(BoundingBox* b0)
+{
+    BoundingBoxSet bs0;
+    b0->getBoundingBoxes(bs0);
+    return bs0.size();
+}
+
+unsigned int castRays(BoundingBox* b0, std::vector<Line3>& rays)
+{
+    unsigned int numHits = 0;
+    for (unsigned int i = 0; i < rays.size(); i++)
+    {
+        BoxBoundsItemSet r0 = b0->getItemsOnRay(rays[i]);
+        numHits += r0.size();
+    }
+    return numHits;
+}
+
+unsigned int castRays(BoxBoundsTree* t0, std::vector<Line3>& rays)
+{
+    unsigned int numHits = 0;
+    BoxBoundsItemVector r0;
+    for (unsigned int i = 0; i < rays.size(); i++)
+    {
+        r0.clear();
+        numHits += t0->getItemsOnRay(rays[i], r0);
+    }
+    return numHits;
+}
+
+void runScene(const Scene& scene, BenchResultVector& results)
+{
+    Ionflux::ObjectBase::IFObject mm;
+    Clock clock0;
+    std::cout << "  Scene '" << scene.name << "'..." << std::endl;
+    Mesh* m0 = createSceneMesh(scene);
+    mm.addLocalRef(m0);
+    unsigned int numFaces = m0->getNumFaces();
+    std::vector<Line3> rays;
+    createRays(m0->getBounds(), NUM_RAYS, rays);
+    // BoundingBox::split()
+    BoundingBox* b0 = createRoot(m0, mm);
+    SplitSet* sp0 = SplitSet::create();
+    mm.addLocalRef(sp0);
+    sp0->addSplits(AXIS_X, NUM_SPLITS_PER_AXIS);
+    sp0->addSplits(AXIS_Y, NUM_SPLITS_PER_AXIS);
+    sp0->addSplits(AXIS_Z, NUM_SPLITS_PER_AXIS);
+    clock0.start();
+    b0->split(*sp0, true, SPLIT_MIN_ITEMS, 0, 0, DEFAULT_TOLERANCE, true);
+    clock0.stop();
+    unsigned int nb0 = getNumBoxes(b0);
+    addResult(results, "split", scene.name, numFaces, "faces",
+        clock0.getElapsedTime(), nb0);
+    clock0.start();
+    unsigned int nh0 = castRays(b0, rays);
+    clock0.stop();
+    addResult(results, "split:rays", scene.name, rays.size(), "rays",
+        clock0.getElapsedTime(), nb0);
+    // BoundingBox::splitSAH(), single thread
+    BoundingBox* b1 = createRoot(m0, mm);
+    clock0.start();
+    b1->splitSAH(DEFAULT_SAH_MAX_LEAF_ITEMS, DEFAULT_SAH_NUM_BINS, 0, 1);
+    clock0.stop();
+    unsigned int nb1 = getNumBoxes(b1);
+    addResult(results, "splitSAH:1", scene.name, numFaces, "faces",
+        clock0.getElapsedTime(), nb1);
+    // BoundingBox::splitSAH(), all processors
+    BoundingBox* b2 = createRoot(m0, mm);
+    clock0.start();
+    b2->splitSAH();
+    clock0.stop();
+    unsigned int nb2 = getNumBoxes(b2);
+    addResult(results, "splitSAH", scene.name, numFaces, "faces",
+        clock0.getElapsedTime(), nb2);
+    clock0.start();
+    unsigned int nh2 = castRays(b2, rays);
+    clock0.stop();
+    addResult(results, "splitSAH:rays", scene.name, rays.size(), "rays",
+        clock0.getElapsedTime(), nb2);
+    // BoxBoundsTree::update()
+    BoxBoundsTree* t2 = BoxBoundsTree::create();
+    mm.addLocalRef(t2);
+    clock0.start();
+    t2->update(b2);
+    clock0.stop();
+    unsigned int nn2 = t2->getNumNodes();
+    addResult(results, "tree", scene.name, numFaces, "faces",
+        clock0.getElapsedTime(), nn2);
+    clock0.start();
+    unsigned int nh3 = castRays(t2, rays);
+    clock0.stop();
+    addResult(results, "tree:rays", scene.name, rays.size(), "rays",
+        clock0.getElapsedTime(), nn2);
+    std::cout << "    (" << numFaces << " faces, " << nh0 << "/" << nh2
+        << "/" << nh3 << " ray hits)" << std::endl;
+    if ((nh0 != nh2) 
+        || (nh0 != nh3))
+    {
+        std::ostringstream status;
+        status << "Ray query results differ for scene '" << scene.name
+            << "' (split: " << nh0 << ", splitSAH: " << nh2 
+            << ", tree: " << nh3 << ").";
+        throw GeoUtilsError(status.str());
+    }
+}
+
+std::string getResultsJSON(const BenchResultVector& results,
+    const std::vector<Scene>& scenes)
+{
+    std::ostringstream status;
+    status << std::setprecision(9);
+    status << "{" << std::endl
+        << "    \"benchmark\": \"bench_bvh_01\"," << std::endl
+        << "    \"numRays\": " << NUM_RAYS << "," << std::endl
+        << "    \"scenes\": [";
+    for (unsigned int i = 0; i < scenes.size(); i++)
+    {
+        const Scene& s0 = scenes[i];
+        if (i > 0)
+            status << ",";
+        status << std::endl << "        {\"name\": \"" << s0.name
+            << "\", \"mesh\": \"" << s0.meshType << "\", \"params\": ["
+            << s0.param0 << ", " << s0.param1 << "]}";
+    }
+    status << std::endl << "    ]," << std::endl
+        << "    \"results\": [";
+    for (unsigned int i = 0; i < results.size(); i++)
+    {
+        const BenchResult& r0 = results[i];
+        double tp = 0.;
+        if (r0.time > 0.)
+            tp = r0.numItems / r0.time;
+        if (i > 0)
+            status << ",";
+        status << std::endl << "        {\"name\": \"" << r0.name
+            << "\", \"scene\": \"" << r0.scene << "\", \"items\": "
+            << r0.numItems << ", \"unit\": \"" << r0.itemUnit
+            << "\", \"time\": " << r0.time << ", \"throughput\": " << tp
+            << ", \"numBoxes\": " << r0.numBoxes << ", \"peakRSS\": "
+            << r0.peakRSS << "}";
+    }
+    status << std::endl << "    ]," << std::endl
+        << "    \"peakRSS\": " << getPeakRSS() << std::endl
+        << "}" << std::endl;
+    return status.str();
+}
+
+int main(int argc, char* argv[])
+{
+    std::cout << "GeoUtils benchmark: " << BENCH_NAME << std::endl;
+    std::string outputFile = DEFAULT_OUTPUT_FILE;
+    if (argc > 1)
+        outputFile = argv[1];
+
+    std::vector<Scene> scenes;
+    Scene s0;
+    s0.meshType = "grid";
+    unsigned int gridSubDivs[] = { 16, 64, 256 };
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        std::ostringstream name0;
+        name0 << "grid_" << gridSubDivs[i];
+        s0.name = name0.str();
+        s0.param0 = gridSubDivs[i];
+        s0.param1 = gridSubDivs[i];
+        scenes.push_back(s0);
+    }
+    s0.meshType = "fiber";
+    unsigned int fiberSubDivs[] = { 16, 64, 256 };
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        std::ostringstream name0;
+        name0 << "fiber_" << fiberSubDivs[i];
+        s0.name = name0.str();
+        s0.param0 = fiberSubDivs[i];
+        s0.param1 = fiberSubDivs[i];
+        scenes.push_back(s0);
+    }
+
+    BenchResultVector results;
+    try
+    {
+        for (unsigned int i = 0; i < scenes.size(); i++)
+            runScene(scenes[i], results);
+    } catch (GeoUtilsError& e)
+    {
+        std::cout << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "  Writing results to '" << outputFile << "'..."
+        << std::endl;
+
+    std::ofstream f0;
+    f0.open(outputFile.c_str(), std::ios_base::out);
+    if (!f0)
+    {
+        std::cout << "Could not open output file: " << outputFile
+            << std::endl;
+        return 1;
+    }
+    f0 << getResultsJSON(results, scenes);
+
+	std::cout << "All done!" << std::endl;
+	return 0;
+}
+
+/** \file bench_bvh_01.cpp
+ * \brief GeoUtils benchmark: Bounding box hierarchies.
+ */
@@ -147,6 +147,19 @@ class Array
 		 */
 		virtual std::string getString() const;
 		
+		/** Get instance transforms.
+		 *
+		 * Get the offsets for the specified number of elements. The offsets are
+		 * stored as separate arrays in the target. Since elements are not
+		 * scaled by the array, the scale factors and scaling centers of the
+		 * target are cleared. Existing data in the target is replaced.
+		 *
+		 * \param numItems Number of elements.
+		 * \param target Where to store the instance transforms.
+		 */
+		virtual void getInstanceTransforms(unsigned int numItems,
+		Ionflux::GeoUtils::InstanceTransforms& target);
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
@@ -65,6 +65,12 @@ class BatchClassInfo
  * coordinate index is set with the coordinate (normalized to [0..1]) 
  * instead of the regular value. ParamControl objects on which no 
  * coordinate index is set are called with the regular (normalized) value.
+ * If the number of threads is not 1 and the processor node is 
+ * thread-safe, the input groups are processed concurrently by clones of 
+ * the processor node (see processParallel()). Processor nodes that write 
+ * to a target shared by all clones, such as Render, WritePNG, WriteSVG or 
+ * LoadSVG, are not thread-safe, so their input groups are always processed 
+ * serially.
  */
 class Batch
 : public Ionflux::GeoUtils::TransformNodes::TransformNode
@@ -74,6 +80,8 @@ class Batch
 	protected:
 		/// Source node for the processor node.
 		Ionflux::GeoUtils::TransformNodes::Source* source;
+		/// Total parameter version of the processor node at the last update.
+		unsigned int processorParamVersion;
 		/// Processor node.
 		Ionflux::GeoUtils::TransformNodes::TransformNode* processor;
 		/// Vector of parameter controls.
@@ -82,6 +90,8 @@ class Batch
 		unsigned int processorInputID;
 		/// Vector of dimensions.
 		std::vector<unsigned int> dimensions;
+		/// Number of threads for processing (0 = number of processors).
+		unsigned int numThreads;
 		
 		/** Update parameter controls.
 		 *
@@ -108,6 +118,49 @@ class Batch
 		 */
 		virtual void process();
 		
+		/** Get parameter control inputs.
+		 *
+		 * Get the input values for the parameter controls of this node for the
+		 * specified sequence index. One value is added to the target vector for
+		 * each parameter control, in the order of the parameter controls.
+		 *
+		 * \param index Sequence index.
+		 * \param target Where to store the input values.
+		 */
+		virtual void getControlInputs(unsigned int index,
+		Ionflux::ObjectBase::DoubleVector& target);
+		
+		/** Process inputs (parallel).
+		 *
+		 * Process the input groups using several threads. Each thread updates a
+		 * clone of the processor node (see TransformNode::createClone()), so
+		 * the input groups can be processed concurrently. The parameter
+		 * controls are applied to the clones, which is only possible if all
+		 * parameter controls refer to the processor node or to nodes within the
+		 * processor node. The output groups are added in input order, so the
+		 * result is the same as for a serial update. The clones do not get
+		 * targets of their own, so this must only be used if the processor
+		 * node is thread-safe.
+		 *
+		 * \param numThreads Number of threads.
+		 *
+		 * \return \c true if the input groups have been processed, \c false if
+		 * they cannot be processed in parallel.
+		 */
+		virtual bool processParallel(unsigned int numThreads);
+		
+		/** Process inputs (task).
+		 *
+		 * Process input groups from the batch update state using the processor
+		 * clone of the task until all input groups have been processed or an
+		 * error occurs. This can be used as a thread start function.
+		 *
+		 * \param taskArg Batch update task.
+		 *
+		 * \return Always 0.
+		 */
+		static void* processTask(void* taskArg);
+		
 	public:
 		/// Input ID: first.
 		static const unsigned int INPUT_FIRST;
@@ -160,6 +213,36 @@ class Batch
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node updates its processor node and parameter controls, so it is
+		 * never updated concurrently with other nodes.
+		 *
+		 * \return \c false.
+		 */
+		virtual bool isThreadSafe() const;
+		
+		/** Dirty check.
+		 *
+		 * Check whether the outputs of the node need to be updated. In addition
+		 * to the checks done by TransformNode::isDirty(), this is the case if a
+		 * parameter of the processor node or of one of its internal nodes has
+		 * changed since the last update.
+		 *
+		 * \return \c true if the node needs to be updated, \c false otherwise.
+		 */
+		virtual bool isDirty() const;
+		
+		/** Get total parameter version.
+		 *
+		 * Get the parameter version of the node, including the total parameter
+		 * version of the processor node.
+		 *
+		 * \return Total parameter version.
+		 */
+		virtual unsigned int getTotalParamVersion() const;
+		
 		/** Add parameter controls.
 		 *
 		 * Add parameter controls.
@@ -385,6 +468,23 @@ class Batch
 		 * Clear all dimensions.
 		 */
 		virtual void clearDimensions();
+		
+		/** Get number of threads for processing (0 = number of processors).
+		 *
+		 * \return Current value of number of threads for processing (0 = 
+		 * number of processors).
+		 */
+		virtual unsigned int getNumThreads() const;
+		
+		/** Set number of threads for processing (0 = number of processors).
+		 *
+		 * Set new value of number of threads for processing (0 = number of 
+		 * processors).
+		 *
+		 * \param newNumThreads New value of number of threads for processing
+		 * (0 = number of processors).
+		 */
+		virtual void setNumThreads(unsigned int newNumThreads);
 };
 
 }
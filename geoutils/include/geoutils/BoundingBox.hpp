@@ -70,6 +70,162 @@ class BoundingBox
 		/// Parent.
 		Ionflux::GeoUtils::BoundingBox* parent;
 		
+		/** Get surface area.
+		 *
+		 * Get the surface area of the axis aligned box with the specified lower
+		 * and upper bounds.
+		 *
+		 * \param lower Lower bounds.
+		 * \param upper Upper bounds.
+		 *
+		 * \return Surface area.
+		 */
+		static double getSAHArea(const double* lower, const double* upper);
+		
+		/** Get surface area heuristic split.
+		 *
+		 * Find the split of the specified range of item records that minimizes
+		 * the surface area heuristic and partition the item records
+		 * accordingly. The item centers are sorted into numBins bins along each
+		 * axis and each bin boundary is evaluated as a split candidate. If all
+		 * item centers coincide, the range is split in half. The return value
+		 * is the index of the first item record of the upper partition, or \c
+		 * first if the range cannot be split.
+		 *
+		 * \param sahItems Item records.
+		 * \param first Index of the first item.
+		 * \param last Index after the last item.
+		 * \param numBins Number of bins.
+		 *
+		 * \return Index of the first item record of the upper partition.
+		 */
+		virtual unsigned int getSAHSplit(Ionflux::GeoUtils::SAHItemVector&
+		sahItems, unsigned int first, unsigned int last, unsigned int numBins);
+		
+		/** Build surface area heuristic hierarchy.
+		 *
+		 * Build a bounding box hierarchy from the specified range of item
+		 * records, using the bounding box as the root. The bounding box must be
+		 * empty. If the range contains more than maxLeafItems items and the
+		 * maximum level has not been reached, the range is split using the
+		 * surface area heuristic and the child boxes are built recursively.
+		 * Otherwise, the items are added to the bounding box directly.
+		 *
+		 * \param sahItems Item records.
+		 * \param first Index of the first item.
+		 * \param last Index after the last item.
+		 * \param numBins Number of bins.
+		 * \param maxLeafItems Maximum number of items per leaf.
+		 * \param maxLevel Maximum split depth.
+		 * \param splitLevel Current split level.
+		 * \param parallelDepth Number of levels that may be built in parallel.
+		 */
+		virtual void buildSAH(Ionflux::GeoUtils::SAHItemVector& sahItems,
+		unsigned int first, unsigned int last, unsigned int numBins, unsigned
+		int maxLeafItems, unsigned int maxLevel, unsigned int splitLevel,
+		unsigned int parallelDepth);
+		
+		/** Build surface area heuristic child boxes.
+		 *
+		 * Build two child bounding boxes from the specified ranges of item
+		 * records. If parallelDepth is greater than zero and the ranges contain
+		 * enough items, the lower child box is built in a separate thread.
+		 *
+		 * \param sahItems Item records.
+		 * \param first Index of the first item.
+		 * \param mid Index of the first item of the upper range.
+		 * \param last Index after the last item.
+		 * \param numBins Number of bins.
+		 * \param maxLeafItems Maximum number of items per leaf.
+		 * \param maxLevel Maximum split depth.
+		 * \param splitLevel Current split level.
+		 * \param parallelDepth Number of levels that may be built in parallel.
+		 *
+		 * \return Child boxes.
+		 */
+		virtual Ionflux::GeoUtils::BoundingBoxPair
+		buildSAHChildren(Ionflux::GeoUtils::SAHItemVector& sahItems, unsigned
+		int first, unsigned int mid, unsigned int last, unsigned int numBins,
+		unsigned int maxLeafItems, unsigned int maxLevel, unsigned int
+		splitLevel, unsigned int parallelDepth);
+		
+		/** Build surface area heuristic hierarchy (task).
+		 *
+		 * Build a surface area heuristic hierarchy for the specified task. This
+		 * can be used as a thread start function. Errors are recorded in the
+		 * task.
+		 *
+		 * \param taskArg Surface area heuristic build task.
+		 *
+		 * \return Thread result.
+		 */
+		static void* buildSAHTask(void* taskArg);
+		
+		/** Get items surface area.
+		 *
+		 * Get the surface area of the bounds of the items contained in the
+		 * bounding box. If \c exclude is specified, that item is left out. If
+		 * \c include is specified, that item is added. This can be used to
+		 * evaluate the effect of exchanging items without modifying the
+		 * hierarchy.
+		 *
+		 * \param exclude Item to be excluded.
+		 * \param include Item to be included.
+		 *
+		 * \return Surface area.
+		 */
+		virtual double getItemsArea(Ionflux::GeoUtils::BoxBoundsItem* exclude =
+		0, Ionflux::GeoUtils::BoxBoundsItem* include = 0) const;
+		
+		/** Refit bounds.
+		 *
+		 * Update the bounds of the bounding box according to the items it
+		 * contains. Unlike update(), this does not update the parent of the
+		 * bounding box.
+		 */
+		virtual void refitBounds();
+		
+		/** Refit (implementation).
+		 *
+		 * Refit the bounds of the bounding box and all child bounding boxes
+		 * bottom-up. If \c updateItems is \c true, the bounds of each leaf item
+		 * are updated exactly once.
+		 *
+		 * \param updateItems Update leaf item bounds.
+		 *
+		 * \return Total surface area of the bounding boxes.
+		 */
+		virtual double refitImpl(bool updateItems);
+		
+		/** Update levels.
+		 *
+		 * Set the level of the bounding box and update the levels of all child
+		 * bounding boxes accordingly.
+		 *
+		 * \param newLevel Level.
+		 */
+		virtual void updateLevels(int newLevel);
+		
+		/** Rotate node.
+		 *
+		 * Find the exchange of an item of a child bounding box with another
+		 * item of the bounding box that reduces the surface area of the child
+		 * bounding box the most, and perform that exchange. The bounds of the
+		 * bounding box itself are not changed by a rotation.
+		 *
+		 * \return \c true if a rotation has been performed, \c false otherwise.
+		 */
+		virtual bool rotateNode();
+		
+		/** Rotate (implementation).
+		 *
+		 * Perform rotations for all child bounding boxes, and then for the
+		 * bounding box itself.
+		 *
+		 * \return Number of rotations.
+		 */
+		virtual unsigned int rotateImpl();
+		
 	public:
 		/// Class information instance.
 		static const BoundingBoxClassInfo boundingBoxClassInfo;
@@ -278,6 +434,88 @@ class BoundingBox
 		Ionflux::GeoUtils::DEFAULT_TOLERANCE, bool preferLongestAxis = false, 
 		double longestAxisTolerance = 0.1);
 		
+		/** Split bounding box (surface area heuristic).
+		 *
+		 * Split the bounding box recursively using the surface area heuristic.
+		 * The item centers are sorted into numBins bins along each axis, and
+		 * each box is split at the bin boundary that minimizes the surface
+		 * areas of the resulting boxes, weighted by the number of items they
+		 * contain. Boxes are split until they contain at most maxLeafItems
+		 * items or maxLevel is reached. Subtrees are built in parallel using up
+		 * to numThreads threads. If numThreads is 0, the number of available
+		 * processors is used. The items must not be modified while the
+		 * hierarchy is built. The resulting hierarchy has the same structure as
+		 * one created by split(), so it can be used with all of the query
+		 * functions. If the split is successful, the split result contains the
+		 * two bounding boxes which are the new items contained in the bounding
+		 * box. The success flag of the split result will be set to \c false if
+		 * the box does not contain more than maxLeafItems items or if maxLevel
+		 * is reached.
+		 *
+		 * \param maxLeafItems Maximum number of items per leaf.
+		 * \param numBins Number of bins.
+		 * \param maxLevel Maximum split depth.
+		 * \param numThreads Number of threads.
+		 *
+		 * \return Split result.
+		 */
+		virtual Ionflux::GeoUtils::SplitResult splitSAH(unsigned int
+		maxLeafItems = Ionflux::GeoUtils::DEFAULT_SAH_MAX_LEAF_ITEMS, unsigned
+		int numBins = Ionflux::GeoUtils::DEFAULT_SAH_NUM_BINS, unsigned int
+		maxLevel = 0, unsigned int numThreads = 0);
+		
+		/** Refit.
+		 *
+		 * Refit the bounding box hierarchy after the items have moved. The
+		 * bounds of all bounding boxes are recomputed bottom-up, without
+		 * changing the structure of the hierarchy, which takes linear time in
+		 * the number of items. If \c updateItems is \c true, updateBounds() is
+		 * called exactly once for each leaf item. Refitting makes the bounds of
+		 * the hierarchy less tight as the items move. If \c refArea is greater
+		 * than zero, it is used as the reference surface area of the hierarchy
+		 * (usually the result of getTotalArea() after the hierarchy has been
+		 * built). If the total surface area after refitting exceeds \c refArea
+		 * by more than a factor of \c maxAreaRatio, up to \c maxPasses passes
+		 * of tree rotations are performed to restore the quality of the
+		 * hierarchy.
+		 *
+		 * \param updateItems Update leaf item bounds.
+		 * \param refArea Reference surface area.
+		 * \param maxAreaRatio Maximum surface area ratio.
+		 * \param maxPasses Maximum number of rotation passes.
+		 *
+		 * \return Total surface area of the bounding boxes.
+		 */
+		virtual double refit(bool updateItems = true, double refArea = 0.,
+		double maxAreaRatio = Ionflux::GeoUtils::DEFAULT_REFIT_MAX_AREA_RATIO,
+		unsigned int maxPasses = 1);
+		
+		/** Rotate.
+		 *
+		 * Perform tree rotations to improve the quality of the hierarchy. In
+		 * each pass, every bounding box (starting with the leaves) may exchange
+		 * one item with an item of a child bounding box if this reduces the
+		 * surface area of the child bounding box. Passes are performed until no
+		 * rotation is possible or \c maxPasses is reached. If \c maxPasses is
+		 * 0, the number of passes is not limited. The leaf items contained in
+		 * the hierarchy are not changed by rotations.
+		 *
+		 * \param maxPasses Maximum number of passes.
+		 *
+		 * \return Number of rotations.
+		 */
+		virtual unsigned int rotate(unsigned int maxPasses = 1);
+		
+		/** Get total surface area.
+		 *
+		 * Get the sum of the surface areas of the bounding box and all child
+		 * bounding boxes. This is a measure of the quality of the hierarchy for
+		 * queries (lower is better).
+		 *
+		 * \return Total surface area.
+		 */
+		virtual double getTotalArea() const;
+		
 		/** Get items above plane.
 		 *
 		 * Get the items which are above the specified plane (in direction of 
@@ -88,6 +88,28 @@ class BoxBoundsItem
 		/// Face vector.
 		std::vector<Ionflux::GeoUtils::Polygon3*> bFaces;
 		
+		/** Get line interval.
+		 *
+		 * Get the parameter interval in which the specified line lies within
+		 * the bounding box, using a slab test. The bounding box is extended by
+		 * the tolerance on each side. If the line intersects the box, the
+		 * interval is stored in \c tNear and \c tFar, in units of the line
+		 * direction vector.
+		 *
+		 * \param line Line.
+		 * \param tNear Where to store the line parameter at which the line
+		 * enters the box.
+		 * \param tFar Where to store the line parameter at which the line
+		 * leaves the box.
+		 * \param t Tolerance.
+		 *
+		 * \return \c true if the line intersects the bounding box, \c false
+		 * otherwise.
+		 */
+		virtual bool getLineInterval(const Ionflux::GeoUtils::Line3& line,
+		double& tNear, double& tFar, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE) const;
+		
 	public:
 		/// Class information instance.
 		static const BoxBoundsItemClassInfo boxBoundsItemClassInfo;
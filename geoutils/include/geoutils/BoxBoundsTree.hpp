@@ -0,0 +1,470 @@
+#ifndef IONFLUX_GEOUTILS_BOXBOUNDSTREE
+#define IONFLUX_GEOUTILS_BOXBOUNDSTREE
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * BoxBoundsTree.hpp               Box bounds tree (header).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Line3;
+class Sphere3;
+class BoxBoundsItem;
+class BoundingBox;
+
+/// Class information for class BoxBoundsTree.
+class BoxBoundsTreeClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		BoxBoundsTreeClassInfo();
+		/// Destructor.
+		virtual ~BoxBoundsTreeClassInfo();
+};
+
+/** Box bounds tree.
+ * \ingroup geoutils
+ *
+ * A flattened bounding box hierarchy for fast spatial queries. The tree
+ * is built from a BoundingBox hierarchy. Each node has up to four child
+ * slots, which are tested together, and nodes are stored in a contiguous
+ * array which is traversed using a stack. Leaf items are stored with
+ * their bounds, so the inner check of an item is only called if its
+ * bounds are intersected. Query results are appended to a vector
+ * provided by the caller. Unlike the BoundingBox hierarchy, the tree
+ * does not track changes to the items, so it has to be updated whenever
+ * the hierarchy or the items change.
+ */
+class BoxBoundsTree
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+		
+	protected:
+		/// Nodes.
+		Ionflux::GeoUtils::BoxBoundsTreeNodeVector nodes;
+		/// Leaf items.
+		Ionflux::GeoUtils::BoxBoundsItemVector items;
+		/// Leaf item bounds (lower x, y, z, upper x, y, z for each item).
+		std::vector<float> itemBounds;
+		/// Depth.
+		unsigned int depth;
+		/// Tolerance.
+		double tolerance;
+		
+		/** Convert lower bound.
+		 *
+		 * Convert a lower bound to single precision. The result is rounded
+		 * down, so the bounds remain conservative.
+		 *
+		 * \param v Value.
+		 *
+		 * \return Lower bound.
+		 */
+		static float toFloatLower(double v);
+		
+		/** Convert upper bound.
+		 *
+		 * Convert an upper bound to single precision. The result is rounded up,
+		 * so the bounds remain conservative.
+		 *
+		 * \param v Value.
+		 *
+		 * \return Upper bound.
+		 */
+		static float toFloatUpper(double v);
+		
+		/** Update item bounds.
+		 *
+		 * Update the stored bounds of the leaf item with the specified index.
+		 * The bounds are extended by the tolerance of the tree.
+		 *
+		 * \param itemIndex Item index.
+		 */
+		virtual void updateItemBounds(unsigned int itemIndex);
+		
+		/** Add item record.
+		 *
+		 * Add a leaf item and its bounds to the tree.
+		 *
+		 * \param item Item.
+		 */
+		virtual void addItemRecord(Ionflux::GeoUtils::BoxBoundsItem* item);
+		
+		/** Get build slots.
+		 *
+		 * Get the build slots for the contents of a bounding box. Each child
+		 * bounding box is added as a separate slot. Leaf items are collected in
+		 * a single slot.
+		 *
+		 * \param box Bounding box.
+		 * \param target Where to store the slots.
+		 */
+		virtual void getSlots(Ionflux::GeoUtils::BoundingBox* box,
+		Ionflux::GeoUtils::BoxBoundsTreeSlotVector& target);
+		
+		/** Expand build slots.
+		 *
+		 * Replace bounding box slots by the slots of their contents while the
+		 * total number of slots does not exceed the width of a node. Bounding
+		 * boxes with a larger surface area are expanded first. This collapses a
+		 * binary hierarchy into a hierarchy with four children per node.
+		 *
+		 * \param slots Slots.
+		 */
+		virtual void expandSlots(Ionflux::GeoUtils::BoxBoundsTreeSlotVector&
+		slots);
+		
+		/** Get node bounds.
+		 *
+		 * Get the bounds of all child slots of a node.
+		 *
+		 * \param nodeIndex Node index.
+		 * \param lower Where to store the lower bounds.
+		 * \param upper Where to store the upper bounds.
+		 */
+		virtual void getNodeBounds(int nodeIndex, float* lower, float* upper)
+		const;
+		
+		/** Get item range bounds.
+		 *
+		 * Get the bounds of a range of items.
+		 *
+		 * \param first Index of the first item.
+		 * \param num Number of items.
+		 * \param lower Where to store the lower bounds.
+		 * \param upper Where to store the upper bounds.
+		 */
+		virtual void getItemRangeBounds(unsigned int first, unsigned int num,
+		float* lower, float* upper) const;
+		
+		/** Build node.
+		 *
+		 * Build a node from a set of build slots. Bounding box slots are
+		 * expanded until the node is filled. If there are more slots than fit
+		 * into a node, the slots are distributed over intermediate nodes.
+		 *
+		 * \param slots Slots.
+		 * \param nodeDepth Depth of the node.
+		 *
+		 * \return Node index.
+		 */
+		virtual int buildNode(Ionflux::GeoUtils::BoxBoundsTreeSlotVector& slots,
+		unsigned int nodeDepth);
+		
+		/** Cast ray.
+		 *
+		 * Cast a ray or line through the tree. Child slots are tested against
+		 * the ray four at a time. Leaf items are tested against their bounds
+		 * first, and the inner ray or line check of an item is only called if
+		 * the bounds are intersected. If the query is
+		 * BOX_BOUNDS_TREE_QUERY_ALL, all intersected items are added to the
+		 * target vector. If the query is BOX_BOUNDS_TREE_QUERY_FIRST, the tree
+		 * is traversed front to back, and the intersected item with the closest
+		 * bounds is returned. If the query is BOX_BOUNDS_TREE_QUERY_ANY, the
+		 * first intersected item that is found is returned.
+		 *
+		 * \param ray Ray.
+		 * \param line Test for intersection with a line instead of a ray.
+		 * \param query Query type.
+		 * \param target Where to store the items.
+		 * \param t Tolerance.
+		 *
+		 * \return Intersected item, or 0 if no item is intersected.
+		 */
+		virtual Ionflux::GeoUtils::BoxBoundsItem* castRay(const
+		Ionflux::GeoUtils::Line3& ray, bool line,
+		Ionflux::GeoUtils::BoxBoundsTreeQueryID query,
+		Ionflux::GeoUtils::BoxBoundsItemVector* target, double t);
+		
+	public:
+		/// Class information instance.
+		static const BoxBoundsTreeClassInfo boxBoundsTreeClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+		
+		/** Constructor.
+		 *
+		 * Construct new BoxBoundsTree object.
+		 */
+		BoxBoundsTree();
+		
+		/** Constructor.
+		 *
+		 * Construct new BoxBoundsTree object.
+		 *
+		 * \param other Other object.
+		 */
+		BoxBoundsTree(const Ionflux::GeoUtils::BoxBoundsTree& other);
+		
+		/** Destructor.
+		 *
+		 * Destruct BoxBoundsTree object.
+		 */
+		virtual ~BoxBoundsTree();
+		
+		/** Clear.
+		 *
+		 * Remove all nodes and items from the tree.
+		 */
+		virtual void clear();
+		
+		/** Update.
+		 *
+		 * Build the tree from a bounding box hierarchy. Existing nodes and
+		 * items are removed. The bounds of the tree are extended by the
+		 * specified tolerance. The tree does not track changes to the bounding
+		 * box hierarchy, so it has to be updated if the hierarchy or the items
+		 * change.
+		 *
+		 * \param root Bounding box hierarchy root.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of nodes.
+		 */
+		virtual unsigned int update(Ionflux::GeoUtils::BoundingBox* root, double
+		t = Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Refit.
+		 *
+		 * Update the bounds of the tree after the leaf items have moved. The
+		 * structure of the tree is not changed, and the bounds of all nodes are
+		 * recomputed bottom-up, which takes linear time in the number of items.
+		 * If \c updateItems is \c true, updateBounds() is called exactly once
+		 * for each leaf item. Refitting makes the bounds of the tree less tight
+		 * as the items move, so the tree should be updated from a (refitted)
+		 * bounding box hierarchy from time to time.
+		 *
+		 * \param updateItems Update leaf item bounds.
+		 */
+		virtual void refit(bool updateItems = true);
+		
+		/** Get items on ray.
+		 *
+		 * Get the leaf items which intersect the specified ray. The items are
+		 * appended to the target vector.
+		 *
+		 * \param ray Ray.
+		 * \param target Where to store the items.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of items that have been added.
+		 */
+		virtual unsigned int getItemsOnRay(const Ionflux::GeoUtils::Line3& ray,
+		Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get items on line.
+		 *
+		 * Get the leaf items which intersect the specified line. The items are
+		 * appended to the target vector.
+		 *
+		 * \param line Line.
+		 * \param target Where to store the items.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of items that have been added.
+		 */
+		virtual unsigned int getItemsOnLine(const Ionflux::GeoUtils::Line3&
+		line, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get first item on ray.
+		 *
+		 * Get the closest leaf item which intersects the specified ray. Since
+		 * leaf items do not provide the distance of an intersection, the item
+		 * with the closest bounds entry point among the intersected items is
+		 * returned.
+		 *
+		 * \param ray Ray.
+		 * \param t Tolerance.
+		 *
+		 * \return Closest intersected item, or 0 if no item is intersected.
+		 */
+		virtual Ionflux::GeoUtils::BoxBoundsItem* getFirstItemOnRay(const
+		Ionflux::GeoUtils::Line3& ray, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get any item on ray.
+		 *
+		 * Get a leaf item which intersects the specified ray. The traversal
+		 * stops at the first intersected item, so this is the fastest way to
+		 * check whether a ray is blocked.
+		 *
+		 * \param ray Ray.
+		 * \param t Tolerance.
+		 *
+		 * \return Intersected item, or 0 if no item is intersected.
+		 */
+		virtual Ionflux::GeoUtils::BoxBoundsItem* getAnyItemOnRay(const
+		Ionflux::GeoUtils::Line3& ray, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get items in sphere.
+		 *
+		 * Get the leaf items which are contained in or intersect the specified
+		 * sphere. The items are appended to the target vector. Unlike
+		 * BoundingBox::getItemsInSphere(), only leaf items are returned, even
+		 * if a bounding box is completely contained in the sphere.
+		 *
+		 * \param sphere Sphere.
+		 * \param target Where to store the items.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of items that have been added.
+		 */
+		virtual unsigned int getItemsInSphere(const Ionflux::GeoUtils::Sphere3&
+		sphere, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get items in box.
+		 *
+		 * Get the leaf items which are contained in or intersect the specified
+		 * box. The items are appended to the target vector. Unlike
+		 * BoundingBox::getItemsInBox(), only leaf items are returned, even if a
+		 * bounding box is completely contained in the box.
+		 *
+		 * \param box Box.
+		 * \param target Where to store the items.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of items that have been added.
+		 */
+		virtual unsigned int getItemsInBox(Ionflux::GeoUtils::BoxBoundsItem&
+		box, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get number of nodes.
+		 *
+		 * Get the number of nodes in the tree.
+		 *
+		 * \return Number of nodes.
+		 */
+		virtual unsigned int getNumNodes() const;
+		
+		/** Get number of items.
+		 *
+		 * Get the number of leaf items in the tree.
+		 *
+		 * \return Number of items.
+		 */
+		virtual unsigned int getNumItems() const;
+		
+		/** Get item.
+		 *
+		 * Get the leaf item with the specified index.
+		 *
+		 * \param elementIndex Element index.
+		 *
+		 * \return Leaf item at specified index.
+		 */
+		virtual Ionflux::GeoUtils::BoxBoundsItem* getItem(unsigned int
+		elementIndex) const;
+		
+		/** Get depth.
+		 *
+		 * Get the maximum depth of the nodes in the tree.
+		 *
+		 * \return Depth.
+		 */
+		virtual unsigned int getDepth() const;
+		
+		/** Get string representation of value.
+		 *
+		 * Get a string representation of the value of the object.
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getValueString() const;
+		
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::GeoUtils::BoxBoundsTree& operator=(const
+		Ionflux::GeoUtils::BoxBoundsTree& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::GeoUtils::BoxBoundsTree* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::GeoUtils::BoxBoundsTree*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::GeoUtils::BoxBoundsTree*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+/** \file BoxBoundsTree.hpp
+ * \brief Box bounds tree (header).
+ */
+#endif
@@ -55,9 +55,10 @@ class CacheClassInfo
 /** Transform node: Cache.
  * \ingroup geoutils
  *
- * Provides a copy of the input group as its output group until the 
+ * Provides an instance of the input group as its output group until the 
  * inputCache is cleared by an explicit call (cleanup() does not clean the 
- * input cache for a Cache node).
+ * input cache for a Cache node). Items of the cached group are copied only 
+ * if the output group is modified.
  */
 class Cache
 : public Ionflux::GeoUtils::TransformNodes::TransformNode
@@ -119,6 +120,16 @@ class Cache
 		 */
 		virtual std::string getString() const;
 		
+		/** Shared items check.
+		 *
+		 * Check whether the output groups of the node may share items with
+		 * other groups. The output group is an instance of the cached group, so
+		 * it always shares items.
+		 *
+		 * \return \c true if output groups may share items, \c false otherwise.
+		 */
+		virtual bool sharesItems() const;
+		
 		/** Clean up.
 		 *
 		 * Clean up resources created by the node during an update operation.
@@ -56,7 +56,8 @@ class CloneClassInfo
  * \ingroup geoutils
  *
  * Create a number of duplicates of the input group, which are added as 
- * output groups.
+ * output groups. The duplicates are instances of the input group that 
+ * share its items (see TransformableGroup::instance()).
  */
 class Clone
 : public Ionflux::GeoUtils::TransformNodes::TransformNode
@@ -124,6 +125,16 @@ class Clone
 		 */
 		virtual std::string getString() const;
 		
+		/** Shared items check.
+		 *
+		 * Check whether the output groups of the node may share items with
+		 * other groups. The clones are instances of the input group, so they
+		 * always share items.
+		 *
+		 * \return \c true if output groups may share items, \c false otherwise.
+		 */
+		virtual bool sharesItems() const;
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
@@ -0,0 +1,533 @@
+#ifndef IONFLUX_GEOUTILS_COMPACTMESH
+#define IONFLUX_GEOUTILS_COMPACTMESH
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * CompactMesh.hpp                 Compact mesh (header).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Vector;
+class Vector3;
+class Mesh;
+
+/// Class information for class CompactMesh.
+class CompactMeshClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		CompactMeshClassInfo();
+		/// Destructor.
+		virtual ~CompactMeshClassInfo();
+};
+
+/** Compact mesh.
+ * \ingroup geoutils
+ *
+ * A mesh stored in flat arrays: vertex positions (x, y, z for each
+ * vertex), face vertex indices, face offsets, edge vertex indices and
+ * attribute channels. Attribute channels hold one element per face
+ * vertex, in the same order as the face vertex indices, and correspond
+ * to the face data entries of the faces of a Mesh. A compact mesh needs
+ * much less memory than a Mesh, which allocates an object for each
+ * vertex and face, and the arrays can be accessed directly. Compact
+ * meshes can be converted to and from meshes without loss of data.
+ */
+class CompactMesh
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+		
+	protected:
+		/// Vertex positions (x, y, z for each vertex).
+		Ionflux::ObjectBase::DoubleVector positions;
+		/// Face vertex indices.
+		Ionflux::ObjectBase::UIntVector indices;
+		/// Face offsets (into the face vertex indices).
+		Ionflux::ObjectBase::UIntVector faceOffsets;
+		/// Edge vertex indices (two for each edge).
+		Ionflux::ObjectBase::UIntVector edgeIndices;
+		/// Attribute channels.
+		Ionflux::GeoUtils::CompactMeshChannelVector channels;
+		/// Number of exported buffer references.
+		unsigned int numBufferRefs;
+		
+		/** Create vector.
+		 *
+		 * Create a vector with the specified number of components from an array
+		 * of component values. A Vector2, Vector3 or Vector4 is created if the
+		 * number of components matches, otherwise a VectorN is created. The
+		 * caller is responsible for managing the new vector.
+		 *
+		 * \param numComponents Number of components.
+		 * \param data Component values.
+		 *
+		 * \return New vector.
+		 */
+		static Ionflux::GeoUtils::Vector* createVector(unsigned int
+		numComponents, const double* data);
+		
+		/** Check face index.
+		 *
+		 * Check whether the specified face index is valid. An exception is
+		 * thrown if the index is out of bounds.
+		 *
+		 * \param faceIndex Face index.
+		 * \param source Source function.
+		 */
+		void checkFaceIndex(unsigned int faceIndex, const std::string& source)
+		const;
+		
+		/** Check channel index.
+		 *
+		 * Check whether the specified channel index is valid. An exception is
+		 * thrown if the index is out of bounds.
+		 *
+		 * \param channelIndex Channel index.
+		 * \param source Source function.
+		 */
+		void checkChannelIndex(unsigned int channelIndex, const std::string&
+		source) const;
+		
+		/** Check buffer references.
+		 *
+		 * Check whether the data of the object can be reallocated. An exception
+		 * is thrown if the data is referenced by an exported buffer.
+		 *
+		 * \param source Source function.
+		 */
+		void checkBufferRefs(const std::string& source) const;
+		
+	public:
+		/// Class information instance.
+		static const CompactMeshClassInfo compactMeshClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+		
+		/** Constructor.
+		 *
+		 * Construct new CompactMesh object.
+		 */
+		CompactMesh();
+		
+		/** Constructor.
+		 *
+		 * Construct new CompactMesh object.
+		 *
+		 * \param other Other object.
+		 */
+		CompactMesh(const Ionflux::GeoUtils::CompactMesh& other);
+		
+		/** Destructor.
+		 *
+		 * Destruct CompactMesh object.
+		 */
+		virtual ~CompactMesh();
+		
+		/** Clear.
+		 *
+		 * Remove all vertices, faces, edges and attribute channels.
+		 */
+		virtual void clear();
+		
+		/** Initialize from mesh.
+		 *
+		 * Initialize the compact mesh from a mesh. Existing data is replaced.
+		 * Vertex positions, faces and edges are copied, and the face data of
+		 * each face is copied to one attribute channel per face data entry. If
+		 * the mesh has a transformation, it is applied to the vertex positions.
+		 * An exception is thrown if the faces of the mesh do not all have the
+		 * same face data layout (i.e. the same sequence of face data types and
+		 * vector dimensions), or if an edge does not have exactly two vertices.
+		 *
+		 * \param mesh Mesh.
+		 */
+		virtual void initFromMesh(Ionflux::GeoUtils::Mesh& mesh);
+		
+		/** Get mesh.
+		 *
+		 * Create vertices, faces and edges in the target mesh from the compact
+		 * mesh. The target mesh is cleared and a new vertex source is assigned
+		 * to it. If \c copyChannels is set to \c true, each attribute channel
+		 * is copied to a face data entry of each face. Converting a mesh to a
+		 * compact mesh and back yields the same vertex positions, faces, face
+		 * data and edges.
+		 *
+		 * \param target Where to store the mesh.
+		 * \param copyChannels Copy attribute channels to face data.
+		 */
+		virtual void getMesh(Ionflux::GeoUtils::Mesh& target, bool copyChannels
+		= true) const;
+		
+		/** Initialize from arrays.
+		 *
+		 * Initialize the mesh from arrays of vertex positions (x, y, z for each
+		 * vertex), face vertex indices and face offsets (offset of the first
+		 * face vertex index for each face, followed by the total number of
+		 * indices). The arrays are swapped into the mesh, so they are empty
+		 * after the call. Channels and edges are removed. This is intended for
+		 * loaders that build the arrays in bulk.
+		 *
+		 * \param newPositions Vertex positions.
+		 * \param newIndices Face vertex indices.
+		 * \param newFaceOffsets Face offsets.
+		 */
+		virtual void initFromArrays(Ionflux::ObjectBase::DoubleVector&
+		newPositions, Ionflux::ObjectBase::UIntVector& newIndices,
+		Ionflux::ObjectBase::UIntVector& newFaceOffsets);
+		
+		/** Add vertex.
+		 *
+		 * Add a vertex to the compact mesh.
+		 *
+		 * \param x X coordinate.
+		 * \param y Y coordinate.
+		 * \param z Z coordinate.
+		 *
+		 * \return Index of the new vertex.
+		 */
+		virtual unsigned int addVertex(double x, double y, double z);
+		
+		/** Add face.
+		 *
+		 * Add a face to the compact mesh. The attribute channels are extended
+		 * with zero elements for the vertices of the new face.
+		 *
+		 * \param faceVertices Vertex indices.
+		 *
+		 * \return Index of the new face.
+		 */
+		virtual unsigned int addFace(const Ionflux::ObjectBase::UIntVector&
+		faceVertices);
+		
+		/** Add edge.
+		 *
+		 * Add an edge to the compact mesh.
+		 *
+		 * \param v0 Vertex index (0).
+		 * \param v1 Vertex index (1).
+		 *
+		 * \return Index of the new edge.
+		 */
+		virtual unsigned int addEdge(unsigned int v0, unsigned int v1);
+		
+		/** Add attribute channel.
+		 *
+		 * Add an attribute channel to the compact mesh. The channel has one
+		 * element for each face vertex. The elements for existing faces are
+		 * initialized to zero.
+		 *
+		 * \param dataType Face data type.
+		 * \param numComponents Number of components per element.
+		 *
+		 * \return Index of the new channel.
+		 */
+		virtual unsigned int addChannel(Ionflux::GeoUtils::FaceDataTypeID
+		dataType, unsigned int numComponents);
+		
+		/** Find attribute channel.
+		 *
+		 * Find the attribute channel with the specified face data type. If
+		 * there are several channels with that type, \c index selects one of
+		 * them.
+		 *
+		 * \param dataType Face data type.
+		 * \param index Index of the channel among the channels with the face
+		 * data type.
+		 *
+		 * \return Channel index, or -1 if the channel does not exist.
+		 */
+		virtual int findChannel(Ionflux::GeoUtils::FaceDataTypeID dataType,
+		unsigned int index = 0) const;
+		
+		/** Get number of vertices.
+		 *
+		 * Get the number of vertices.
+		 *
+		 * \return Number of vertices.
+		 */
+		virtual unsigned int getNumVertices() const;
+		
+		/** Get number of faces.
+		 *
+		 * Get the number of faces.
+		 *
+		 * \return Number of faces.
+		 */
+		virtual unsigned int getNumFaces() const;
+		
+		/** Get number of face vertices.
+		 *
+		 * Get the number of vertices of the specified face.
+		 *
+		 * \param faceIndex Face index.
+		 *
+		 * \return Number of face vertices.
+		 */
+		virtual unsigned int getNumFaceVertices(unsigned int faceIndex) const;
+		
+		/** Get number of indices.
+		 *
+		 * Get the number of face vertex indices, i.e. the total number of
+		 * vertices of all faces.
+		 *
+		 * \return Number of indices.
+		 */
+		virtual unsigned int getNumIndices() const;
+		
+		/** Get number of edges.
+		 *
+		 * Get the number of edges.
+		 *
+		 * \return Number of edges.
+		 */
+		virtual unsigned int getNumEdges() const;
+		
+		/** Get number of attribute channels.
+		 *
+		 * Get the number of attribute channels.
+		 *
+		 * \return Number of attribute channels.
+		 */
+		virtual unsigned int getNumChannels() const;
+		
+		/** Get vertex.
+		 *
+		 * Get the position of the specified vertex.
+		 *
+		 * \param vertexIndex Vertex index.
+		 *
+		 * \return Vertex position.
+		 */
+		virtual Ionflux::GeoUtils::Vector3 getVertex(unsigned int vertexIndex)
+		const;
+		
+		/** Get face.
+		 *
+		 * Get the vertex indices of the specified face. The vertex indices are
+		 * appended to the target vector.
+		 *
+		 * \param faceIndex Face index.
+		 * \param target Where to store the vertex indices.
+		 *
+		 * \return Number of vertex indices that have been added.
+		 */
+		virtual unsigned int getFace(unsigned int faceIndex,
+		Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get attribute channel data type.
+		 *
+		 * Get the face data type of the specified attribute channel.
+		 *
+		 * \param channelIndex Channel index.
+		 *
+		 * \return Face data type.
+		 */
+		virtual Ionflux::GeoUtils::FaceDataTypeID getChannelDataType(unsigned
+		int channelIndex) const;
+		
+		/** Get attribute channel number of components.
+		 *
+		 * Get the number of components per element of the specified attribute
+		 * channel.
+		 *
+		 * \param channelIndex Channel index.
+		 *
+		 * \return Number of components.
+		 */
+		virtual unsigned int getChannelNumComponents(unsigned int channelIndex)
+		const;
+		
+		/** Tri-mesh check.
+		 *
+		 * Check whether all faces of the compact mesh are triangles.
+		 *
+		 * \return \c true if the compact mesh is a tri-mesh, \c false
+		 * otherwise.
+		 */
+		virtual bool isTriMesh() const;
+		
+		/** Get position data.
+		 *
+		 * Get a pointer to the vertex positions (x, y, z for each vertex). The
+		 * pointer is valid until the compact mesh is modified or destroyed.
+		 *
+		 * \return Pointer to the position, or 0 if there is no data.
+		 */
+		virtual const double* getPositionData() const;
+		
+		/** Get index data.
+		 *
+		 * Get a pointer to the face vertex indices. The pointer is valid until
+		 * the compact mesh is modified or destroyed.
+		 *
+		 * \return Pointer to the index, or 0 if there is no data.
+		 */
+		virtual const unsigned int* getIndexData() const;
+		
+		/** Get face offset data.
+		 *
+		 * Get a pointer to the face offsets (offset of the first face vertex
+		 * index for each face, followed by the total number of face vertex
+		 * indices). The pointer is valid until the compact mesh is modified or
+		 * destroyed.
+		 *
+		 * \return Pointer to the face offset, or 0 if there is no data.
+		 */
+		virtual const unsigned int* getFaceOffsetData() const;
+		
+		/** Get edge index data.
+		 *
+		 * Get a pointer to the edge vertex indices (two for each edge). The
+		 * pointer is valid until the compact mesh is modified or destroyed.
+		 *
+		 * \return Pointer to the edge index, or 0 if there is no data.
+		 */
+		virtual const unsigned int* getEdgeIndexData() const;
+		
+		/** Get attribute channel data.
+		 *
+		 * Get a pointer to the data of the specified attribute channel. The
+		 * pointer is valid until the compact mesh is modified or destroyed.
+		 *
+		 * \param channelIndex Channel index.
+		 *
+		 * \return Pointer to the channel data, or 0 if there is no data.
+		 */
+		virtual const double* getChannelData(unsigned int channelIndex) const;
+		
+		/** Add buffer reference.
+		 *
+		 * Record that the data of the object is referenced by an exported
+		 * buffer. The data cannot be reallocated until the reference is
+		 * removed.
+		 */
+		virtual void addBufferRef();
+		
+		/** Remove buffer reference.
+		 *
+		 * Record that an exported buffer no longer references the data of the
+		 * object.
+		 */
+		virtual void removeBufferRef();
+		
+		/** Get number of buffer references.
+		 *
+		 * Get the number of exported buffers that reference the data of the
+		 * object.
+		 *
+		 * \return Number of buffer references.
+		 */
+		virtual unsigned int getNumBufferRefs() const;
+		
+		/** Write to OBJ file.
+		 *
+		 * Write the compact mesh to an OBJ file. The output is the same as that
+		 * of Mesh::writeOBJ() for the corresponding mesh.
+		 *
+		 * \param ioCtx I/O context.
+		 * \param precision Coordinate precision.
+		 * \param smoothShading Smooth shading.
+		 */
+		virtual void writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx, unsigned
+		int precision = 6, bool smoothShading = false);
+		
+		/** Get string representation of value.
+		 *
+		 * Get a string representation of the value of the object.
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getValueString() const;
+		
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::GeoUtils::CompactMesh& operator=(const
+		Ionflux::GeoUtils::CompactMesh& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::GeoUtils::CompactMesh* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::GeoUtils::CompactMesh*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::GeoUtils::CompactMesh*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+/** \file CompactMesh.hpp
+ * \brief Compact mesh (header).
+ */
+#endif
@@ -62,6 +62,8 @@ class DuplicateClassInfo
  * [0...1], where the input and output element indices are mapped to those 
  * intervals according to how many elements exist for input and output. If 
  * no mapping function is specified, source elements are selected in order.
+ * The duplicates share the source element until they are modified by 
+ * another node.
  */
 class Duplicate
 : public Ionflux::GeoUtils::TransformNodes::TransformNode
@@ -134,6 +136,26 @@ class Duplicate
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node is thread-safe unless it uses a mapping function, since
+		 * mappings may have shared state (such as a random number generator).
+		 *
+		 * \return \c true if the node is thread-safe, \c false otherwise.
+		 */
+		virtual bool isThreadSafe() const;
+		
+		/** Shared items check.
+		 *
+		 * Check whether the output groups of the node may share items with
+		 * other groups. Duplicated elements are shared, so this is always the
+		 * case.
+		 *
+		 * \return \c true if output groups may share items, \c false otherwise.
+		 */
+		virtual bool sharesItems() const;
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
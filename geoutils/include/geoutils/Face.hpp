@@ -143,6 +143,16 @@ class Face
 		 */
 		virtual void update();
 		
+		/** Update from bounds.
+		 *
+		 * Update the state of the face using bounds that have already been
+		 * calculated (see NFace::updateFromBounds()).
+		 *
+		 * \param newBounds Bounds.
+		 */
+		virtual void updateFromBounds(const Ionflux::GeoUtils::Range3&
+		newBounds);
+		
 		/** Clear tangent space.
 		 *
 		 * Clear the tangent space vectors.
@@ -163,6 +173,14 @@ class Face
 		 */
 		virtual void setFaceVertexNormals(bool flip0 = false);
 		
+		/** Set vertex normals.
+		 *
+		 * Set the vertex normals for the face to the specified normal vector.
+		 *
+		 * \param normal normal vector.
+		 */
+		virtual void setVertexNormals(const Ionflux::GeoUtils::Vector3& normal);
+		
 		/** Set vertex colors.
 		 *
 		 * Set the vertex colors for the face to the specified color vector.
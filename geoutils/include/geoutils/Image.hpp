@@ -34,6 +34,8 @@
 #include "geoutils/Range3.hpp"
 #include "geoutils/Vector3.hpp"
 #include "geoutils/Polygon3Set.hpp"
+#include "geoutils/Line3.hpp"
+#include "geoutils/Sphere3.hpp"
 #include "geoutils/SVG.hpp"
 #include "altjira/Drawable.hpp"
 #include "geoutils/TransformableObject.hpp"
@@ -82,6 +84,87 @@ Ionflux::GeoUtils::TransformableObject
 		 */
 		virtual void recalculateBounds();
 		
+		/** Rasterize polygons (task).
+		 *
+		 * Fill tiles from the rasterization state until all tiles have been
+		 * filled. This can be used as a thread start function.
+		 *
+		 * \param taskArg Rasterization state.
+		 *
+		 * \return Thread result.
+		 */
+		static void* rasterizeTask(void* taskArg);
+		
+		/** Rasterize tile.
+		 *
+		 * Fill a tile with the polygons that overlap it. Each polygon is
+		 * rasterized to the coverage buffer and then composited onto the pixels
+		 * of the tile, in drawing order.
+		 *
+		 * \param state Rasterization state.
+		 * \param tile Tile.
+		 * \param coverage Coverage buffer.
+		 */
+		static void rasterizeTile(const Ionflux::GeoUtils::RasterUpdate& state,
+		const Ionflux::GeoUtils::RasterTile& tile,
+		Ionflux::ObjectBase::DoubleVector& coverage);
+		
+		/** Add raster edge.
+		 *
+		 * Add the signed area covered by a polygon edge to the coverage buffer
+		 * of a tile. Coordinates are relative to the tile. Parts of the edge to
+		 * the left or right of the tile are clamped to the tile border, so the
+		 * coverage of each pixel is the sum of the buffer values up to and
+		 * including the pixel.
+		 *
+		 * \param coverage Coverage buffer.
+		 * \param stride Row stride of the coverage buffer.
+		 * \param width Tile width.
+		 * \param height Tile height.
+		 * \param x0 Start point (X).
+		 * \param y0 Start point (Y).
+		 * \param x1 End point (X).
+		 * \param y1 End point (Y).
+		 */
+		static void addRasterEdge(Ionflux::ObjectBase::DoubleVector& coverage,
+		unsigned int stride, unsigned int width, unsigned int height, double x0,
+		double y0, double x1, double y1);
+		
+		/** Clip ray parameter interval.
+		 *
+		 * Clip the parameter interval of a ray component against a slab. The
+		 * interval is narrowed to the part of the ray where the coordinate is
+		 * between the slab bounds. Returns \c false if the remaining interval
+		 * is empty.
+		 *
+		 * \param p Ray origin coordinate.
+		 * \param u Ray direction coordinate.
+		 * \param bMin Lower slab bound.
+		 * \param bMax Upper slab bound.
+		 * \param s0 Start of the parameter interval.
+		 * \param s1 End of the parameter interval.
+		 *
+		 * \return \c true if the interval is not empty, \c false otherwise.
+		 */
+		static bool clipRaySlab(double p, double u, double bMin, double bMax,
+		double& s0, double& s1);
+		
+		/** Add pixel span.
+		 *
+		 * Add a span containing the pixels of the specified row whose column
+		 * index is within the specified range. The range is clipped to the
+		 * image. Nothing is added if the clipped range is empty.
+		 *
+		 * \param target Where to store the pixel spans.
+		 * \param y Row.
+		 * \param xMin Minimum column index.
+		 * \param xMax Maximum column index.
+		 *
+		 * \return Number of pixels in the span.
+		 */
+		virtual unsigned int addPixelSpan(Ionflux::GeoUtils::PixelSpanVector&
+		target, unsigned int y, double xMin, double xMax);
+		
 	public:
 		/// tangent vectors for the 9 neighbouring pixel directions.
 		static const Ionflux::GeoUtils::Vector3 TANGENT_VECTORS[3][3];
@@ -165,6 +248,33 @@ Ionflux::GeoUtils::TransformableObject
 		Ionflux::GeoUtils::AxisID axis = Ionflux::GeoUtils::AXIS_Y, bool 
 		closePath = true, int originX = 0, int originY = 0);
 		
+		/** Rasterize polygons.
+		 *
+		 * Rasterize polygons directly to the image pixels. This is an
+		 * alternative to drawPolygons() that does not use cairo. The polygons
+		 * are projected and sorted into tiles of the specified size. The tiles
+		 * are then filled in parallel by an anti-aliased scanline rasterizer,
+		 * using the fill color and fill opacity of the element styles. Polygons
+		 * are composited in order within each tile. Strokes are not rendered.
+		 * Unlike drawPolygons(), the function does not require a drawing
+		 * operation to be in progress, and the drawing transformations are not
+		 * applied. The origin is by default translated to the center of the
+		 * image. If \c numThreads is 0, one thread per processor will be used.
+		 *
+		 * \param polygons Polygons.
+		 * \param styles Element styles.
+		 * \param axis Projection axis.
+		 * \param originX Coordinate origin (X).
+		 * \param originY Coordinate origin (Y).
+		 * \param numThreads Number of threads.
+		 * \param tileSize Tile size.
+		 */
+		virtual void rasterizePolygons(Ionflux::GeoUtils::Polygon3Set& 
+		polygons, const Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0, 
+		Ionflux::GeoUtils::AxisID axis = Ionflux::GeoUtils::AXIS_Y, int 
+		originX = 0, int originY = 0, unsigned int numThreads = 0, unsigned 
+		int tileSize = Ionflux::GeoUtils::DEFAULT_RASTER_TILE_SIZE);
+		
 		/** Draw SVG object.
 		 *
 		 * Draw an SVG object to the image. The origin is by default 
@@ -312,8 +422,11 @@ Ionflux::GeoUtils::TransformableObject
 		/** Get pixel AABB tree.
 		 *
 		 * Get an AABB tree containing references to the image pixels. The 
-		 * pixel items will be stored as voxels of size 1 in in the target 
-		 * bounding box.
+		 * pixel items will be stored as voxels of size 1 in in the target
+		 * bounding box. This creates one object per pixel. Use the pixel
+		 * span queries (getPixelSpansOnRay(), getPixelSpansInSphere(),
+		 * getPixelSpansInBox(), getPixelSpansInPolygon()) to find pixels
+		 * without creating a tree.
 		 *
 		 * \param target target bounding box.
 		 */
@@ -332,6 +445,94 @@ Ionflux::GeoUtils::TransformableObject
 		const Ionflux::Altjira::Color& color = Ionflux::Altjira::Color::BLUE, 
 		const Ionflux::Altjira::ColorBlender* blender = 0);
 		
+		/** Get pixel spans on ray.
+		 *
+		 * Get spans of the pixels which are intersected by the specified ray.
+		 * Pixels are treated as voxels of size 1, in the same way as by
+		 * getPixelTree(), and the spans contain the same pixels as a ray query
+		 * on the pixel tree. The spans are computed directly from the pixel
+		 * grid, so no per-pixel objects are created. The ray is specified as a
+		 * line, where the ray is supposed to start at point \c P and have
+		 * direction \c U.
+		 *
+		 * \param ray Ray.
+		 * \param target Where to store the pixel spans.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of pixels in the spans.
+		 */
+		virtual unsigned int getPixelSpansOnRay(const Ionflux::GeoUtils::Line3&
+		ray, Ionflux::GeoUtils::PixelSpanVector& target, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get pixel spans in sphere.
+		 *
+		 * Get spans of the pixels which intersect the specified sphere. Pixels
+		 * are treated as voxels of size 1, in the same way as by
+		 * getPixelTree(), and the spans contain the same pixels as a sphere
+		 * query on the pixel tree. The spans are computed directly from the
+		 * pixel grid, so no per-pixel objects are created.
+		 *
+		 * \param sphere Sphere.
+		 * \param target Where to store the pixel spans.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of pixels in the spans.
+		 */
+		virtual unsigned int getPixelSpansInSphere(const
+		Ionflux::GeoUtils::Sphere3& sphere, Ionflux::GeoUtils::PixelSpanVector&
+		target, double t = Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get pixel spans in box.
+		 *
+		 * Get spans of the pixels which intersect the specified box. Pixels are
+		 * treated as voxels of size 1, in the same way as by getPixelTree(),
+		 * and the spans contain the same pixels as a box query on the pixel
+		 * tree. The spans are computed directly from the pixel grid, so no
+		 * per-pixel objects are created.
+		 *
+		 * \param box Box.
+		 * \param target Where to store the pixel spans.
+		 * \param t Tolerance.
+		 *
+		 * \return Number of pixels in the spans.
+		 */
+		virtual unsigned int getPixelSpansInBox(const
+		Ionflux::GeoUtils::BoxBoundsItem& box,
+		Ionflux::GeoUtils::PixelSpanVector& target, double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+		
+		/** Get pixel spans in polygon.
+		 *
+		 * Get spans of the pixels whose center is inside the specified polygon.
+		 * The polygon is projected onto the image plane along the Z axis, and
+		 * the even-odd rule is used to determine the inside of the polygon.
+		 * Pixel centers on a left or top edge are considered inside, pixel
+		 * centers on a right or bottom edge are considered outside, so pixels
+		 * are not covered twice by adjacent polygons.
+		 *
+		 * \param polygon Polygon.
+		 * \param target Where to store the pixel spans.
+		 *
+		 * \return Number of pixels in the spans.
+		 */
+		virtual unsigned int getPixelSpansInPolygon(Ionflux::GeoUtils::Polygon3&
+		polygon, Ionflux::GeoUtils::PixelSpanVector& target);
+		
+		/** Mark pixel spans.
+		 *
+		 * Mark the pixels in the specified pixel spans. This is equivalent to
+		 * markPixels() for the pixels in the spans.
+		 *
+		 * \param spans Pixel spans.
+		 * \param color Color.
+		 * \param blender Color blender.
+		 */
+		virtual void markPixelSpans(const Ionflux::GeoUtils::PixelSpanVector&
+		spans, const Ionflux::Altjira::Color& color =
+		Ionflux::Altjira::Color::BLUE, const Ionflux::Altjira::ColorBlender*
+		blender = 0);
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
@@ -124,6 +124,26 @@ class Iterate
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node updates its input node repeatedly, so it is never updated
+		 * concurrently with other nodes.
+		 *
+		 * \return \c false.
+		 */
+		virtual bool isThreadSafe() const;
+		
+		/** Dirty check.
+		 *
+		 * Check whether the outputs of the node need to be updated. Since the
+		 * node updates its source node itself, this is also the case if the
+		 * source node needs to be updated.
+		 *
+		 * \return \c true if the node needs to be updated, \c false otherwise.
+		 */
+		virtual bool isDirty() const;
+		
 		/** Update inputs.
 		 *
 		 * Update the inputs of the node. Each input node is updated only 
@@ -124,6 +124,16 @@ class LoadSVG
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node uses the SVG loader, which is not thread-safe, so it is
+		 * never updated concurrently with other nodes.
+		 *
+		 * \return \c false.
+		 */
+		virtual bool isThreadSafe() const;
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
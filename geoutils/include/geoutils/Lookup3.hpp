@@ -154,6 +154,23 @@ class Lookup3
 		virtual Ionflux::GeoUtils::Vector3 call(Ionflux::Mapping::MappingValue 
 		value) const;
 		
+		/** Evaluate the mapping (batch).
+		 *
+		 * Evaluate the mapping with each of the specified parameters and store
+		 * the components of the resulting vectors in the target vectors, which
+		 * are resized to the number of parameters. The entries are looked up
+		 * directly, without a call per parameter.
+		 *
+		 * \param values Values.
+		 * \param targetX Where to store the X components.
+		 * \param targetY Where to store the Y components.
+		 * \param targetZ Where to store the Z components.
+		 */
+		virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+		values, Ionflux::ObjectBase::DoubleVector& targetX,
+		Ionflux::ObjectBase::DoubleVector& targetY,
+		Ionflux::ObjectBase::DoubleVector& targetZ) const;
+		
 		/** Get string representation.
 		 *
 		 * Get a string representation of the object
@@ -71,6 +71,14 @@ Ionflux::GeoUtils::TransformableObject
 	private:
 		
 	protected:
+		/// Face normals (x, y, z for each face).
+		Ionflux::ObjectBase::DoubleVector faceNormals;
+		/// Face tangents (x, y, z for each face).
+		Ionflux::ObjectBase::DoubleVector faceTangents;
+		/// Face binormals (x, y, z for each face).
+		Ionflux::ObjectBase::DoubleVector faceBinormals;
+		/// Face bounds (minimum and maximum for x, y and z for each face).
+		Ionflux::ObjectBase::DoubleVector faceBounds;
 		/// Vertex source.
 		Ionflux::GeoUtils::Vertex3Set* vertexSource;
 		/// Face vector.
@@ -84,6 +92,46 @@ Ionflux::GeoUtils::TransformableObject
 		 */
 		virtual void recalculateBounds();
 		
+		/** Check face geometry.
+		 *
+		 * Check whether the face geometry is available for the face with the
+		 * specified index. An exception is thrown if the face geometry is not
+		 * available.
+		 *
+		 * \param faceIndex Face index.
+		 * \param source Source (for error messages).
+		 */
+		void checkFaceGeometry(unsigned int faceIndex, const std::string&
+		source) const;
+		
+		/** Calculate geometry.
+		 *
+		 * Calculate the vertex bounds for the vertex range and the bounds and
+		 * tangent space for the face range of the specified task. The face
+		 * geometry is stored in the face geometry arrays, which must have been
+		 * allocated for all faces. The face geometry is calculated directly
+		 * from the vertex coordinates, without considering the transformations
+		 * of the vertex source or the faces. The tangent space is the same as
+		 * that calculated by Face::getTangent(), Face::getBinormal() and
+		 * Face::getNormal(). The tangent space of faces with less than three
+		 * vertices is set to zero.
+		 *
+		 * \param task Mesh update task.
+		 */
+		virtual void calculateGeometry(Ionflux::GeoUtils::MeshUpdateTask& task);
+		
+		/** Update (task).
+		 *
+		 * Calculate the geometry for the vertex and face ranges specified by
+		 * the task. This can be used as a thread start function. Errors are
+		 * recorded in the task.
+		 *
+		 * \param taskArg Mesh update task.
+		 *
+		 * \return Thread result.
+		 */
+		static void* updateTask(void* taskArg);
+		
 	public:
 		/// Default ID.
 		static const std::string DEFAULT_ID;
@@ -159,13 +207,138 @@ Ionflux::GeoUtils::TransformableObject
 		
 		/** Update.
 		 *
-		 * Update all state according to the faces of the mesh.
+		 * Update all state according to the faces of the mesh. If \c
+		 * updateFaces is \c true, the faces and the face geometry arrays are
+		 * updated using updateGeometry(). Otherwise, the face geometry arrays
+		 * are cleared.
 		 *
 		 * \param updateFaces update faces.
 		 * \param updateEdges update edges.
 		 */
 		virtual void update(bool updateFaces = true, bool updateEdges = true);
 		
+		/** Update geometry.
+		 *
+		 * Update the bounds of the mesh, the bounds of all faces and the face
+		 * geometry arrays (face normals, tangents, binormals and bounds) in a
+		 * single pass over the mesh. The work is split between several threads
+		 * if the mesh has at least MESH_UPDATE_PARALLEL_MIN_FACES faces. The
+		 * face geometry arrays are reused across updates. Faces that are
+		 * transformed, or whose vertex source is transformed, are updated
+		 * individually. This is called by update().
+		 *
+		 * \param numThreads Number of threads (0 = number of processors).
+		 */
+		virtual void updateGeometry(unsigned int numThreads = 0);
+		
+		/** Clear face geometry.
+		 *
+		 * Clear the face geometry arrays.
+		 */
+		virtual void clearFaceGeometry();
+		
+		/** Face geometry check.
+		 *
+		 * Check whether the face geometry arrays are available for all faces.
+		 * The face geometry arrays are filled by updateGeometry() and reflect
+		 * the state of the vertices and faces at the time of the last update.
+		 *
+		 * \return \c true if the face geometry is available, \c false
+		 * otherwise.
+		 */
+		virtual bool hasFaceGeometry() const;
+		
+		/** Get face normal.
+		 *
+		 * Get the normal of the face with the specified index from the face
+		 * geometry arrays. An exception is thrown if the face geometry is not
+		 * available.
+		 *
+		 * \param faceIndex Face index.
+		 *
+		 * \return Normal vector.
+		 */
+		virtual Ionflux::GeoUtils::Vector3 getFaceNormal(unsigned int faceIndex)
+		const;
+		
+		/** Get face tangent.
+		 *
+		 * Get the tangent of the face with the specified index from the face
+		 * geometry arrays. An exception is thrown if the face geometry is not
+		 * available.
+		 *
+		 * \param faceIndex Face index.
+		 *
+		 * \return Tangent vector.
+		 */
+		virtual Ionflux::GeoUtils::Vector3 getFaceTangent(unsigned int
+		faceIndex) const;
+		
+		/** Get face binormal.
+		 *
+		 * Get the binormal of the face with the specified index from the face
+		 * geometry arrays. An exception is thrown if the face geometry is not
+		 * available.
+		 *
+		 * \param faceIndex Face index.
+		 *
+		 * \return Binormal vector.
+		 */
+		virtual Ionflux::GeoUtils::Vector3 getFaceBinormal(unsigned int
+		faceIndex) const;
+		
+		/** Get face bounds.
+		 *
+		 * Get the bounds of the face with the specified index from the face
+		 * geometry arrays. An exception is thrown if the face geometry is not
+		 * available.
+		 *
+		 * \param faceIndex Face index.
+		 *
+		 * \return Bounds.
+		 */
+		virtual Ionflux::GeoUtils::Range3 getFaceBounds(unsigned int faceIndex)
+		const;
+		
+		/** Get face normals data.
+		 *
+		 * Get a pointer to the face normals (x, y, z for each face). The
+		 * pointer is valid until the face geometry is updated or cleared. If
+		 * the face geometry is not available, 0 is returned.
+		 *
+		 * \return Face normals data.
+		 */
+		virtual const double* getFaceNormalData() const;
+		
+		/** Get face tangents data.
+		 *
+		 * Get a pointer to the face tangents (x, y, z for each face). The
+		 * pointer is valid until the face geometry is updated or cleared. If
+		 * the face geometry is not available, 0 is returned.
+		 *
+		 * \return Face tangents data.
+		 */
+		virtual const double* getFaceTangentData() const;
+		
+		/** Get face binormals data.
+		 *
+		 * Get a pointer to the face binormals (x, y, z for each face). The
+		 * pointer is valid until the face geometry is updated or cleared. If
+		 * the face geometry is not available, 0 is returned.
+		 *
+		 * \return Face binormals data.
+		 */
+		virtual const double* getFaceBinormalData() const;
+		
+		/** Update bounds.
+		 *
+		 * Update the bounds of the mesh according to its vertices. Unlike
+		 * update(), this does not update the faces and edges of the mesh. If
+		 * the mesh does not have a vertex source, the bounds are updated
+		 * according to the center and radius vector.
+		 */
+		virtual void updateBounds();
+		
 		/** Clear.
 		 *
 		 * Removes all items and resets state.
@@ -324,7 +497,8 @@ Ionflux::GeoUtils::TransformableObject
 		/** Apply transformations.
 		 *
 		 * Apply transformations that have been accumulated in the 
-		 * transformation matrices.
+		 * transformation matrices. The face geometry arrays are cleared, so 
+		 * the mesh needs to be updated before they can be used again.
 		 *
 		 * \param recursive Apply transformations recursively.
 		 */
@@ -499,7 +673,9 @@ Ionflux::GeoUtils::TransformableObject
 		
 		/** Set face vertex normals.
 		 *
-		 * Set the vertex normals for all faces to the face normal.
+		 * Set the vertex normals for all faces to the face normal. The face
+		 * normals are taken from the face geometry arrays, which are updated
+		 * first if they are not available.
 		 *
 		 * \param flip0 flip normals.
 		 */
@@ -533,7 +709,10 @@ Ionflux::GeoUtils::TransformableObject
 		/** Create edges.
 		 *
 		 * Create the unique edges defined by the mesh faces and add them to 
-		 * the mesh. Any existing edges will be cleared.
+		 * the mesh. Any existing edges will be cleared. Edges are found using
+		 * a MeshAdjacency, so this takes time linear in the number of face 
+		 * vertices. Edges are created in order of their first occurrence, 
+		 * with the orientation of the first face that references them.
 		 *
 		 * \return Number of new edges that were generated.
 		 */
@@ -547,6 +726,25 @@ Ionflux::GeoUtils::TransformableObject
 		 */
 		virtual void merge(Ionflux::GeoUtils::Mesh& other);
 		
+		/** Weld vertices.
+		 *
+		 * Merge vertices that are within the specified distance of each other.
+		 * Vertices are processed in order, and each vertex that has not been
+		 * merged yet absorbs all other remaining vertices within the distance.
+		 * The vertex indices of faces and edges are remapped to the remaining
+		 * vertices. Faces are not removed, even if some of their vertices have
+		 * been merged into one. Neighboring vertices are found using a
+		 * VertexTree, so welding takes O(n log n) time for evenly distributed
+		 * vertices.
+		 *
+		 * \param t Tolerance.
+		 * \param numThreads Number of threads for building the vertex tree.
+		 *
+		 * \return Number of vertices that have been removed.
+		 */
+		virtual unsigned int weld(double t =
+		Ionflux::GeoUtils::DEFAULT_TOLERANCE, unsigned int numThreads = 0);
+		
 		/** Write OBJ data.
 		 *
 		 * Write OBJ data for the mesh.
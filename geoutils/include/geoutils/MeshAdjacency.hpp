@@ -0,0 +1,644 @@
+#ifndef IONFLUX_GEOUTILS_MESHADJACENCY
+#define IONFLUX_GEOUTILS_MESHADJACENCY
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * MeshAdjacency.hpp               Mesh adjacency (header).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Mesh;
+class CompactMesh;
+
+/// Class information for class MeshAdjacency.
+class MeshAdjacencyClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		MeshAdjacencyClassInfo();
+		/// Destructor.
+		virtual ~MeshAdjacencyClassInfo();
+};
+
+/** Mesh adjacency.
+ * \ingroup geoutils
+ *
+ * Half-edge adjacency data for the faces of a mesh. There is one
+ * half-edge for each face vertex. The half-edges of each face are
+ * numbered consecutively, so the next and previous half-edges and the
+ * face of a half-edge can be determined without storing them explicitly.
+ * Half-edges are matched to undirected edges using hash tables, in
+ * parallel for large meshes. The adjacency data supports queries for
+ * face neighbors, vertex stars and one-rings, boundary loops and
+ * non-manifold edges. All data is stored in flat arrays.
+ */
+class MeshAdjacency
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+		
+	protected:
+		/// Number of vertices.
+		unsigned int numVertices;
+		/// Source vertices of the half-edges (face vertex indices).
+		Ionflux::ObjectBase::UIntVector indices;
+		/// Face offsets (index of the first half-edge of each face).
+		Ionflux::ObjectBase::UIntVector faceOffsets;
+		/// Faces of the half-edges.
+		Ionflux::ObjectBase::UIntVector halfEdgeFaces;
+		/// Edges of the half-edges.
+		Ionflux::ObjectBase::UIntVector halfEdgeEdges;
+		/// Twin half-edges.
+		Ionflux::ObjectBase::UIntVector twins;
+		/// Edge offsets (into the half-edges of edges).
+		Ionflux::ObjectBase::UIntVector edgeOffsets;
+		/// Half-edges of edges.
+		Ionflux::ObjectBase::UIntVector edgeHalfEdges;
+		/// Vertex offsets (into the half-edges of vertices).
+		Ionflux::ObjectBase::UIntVector vertexOffsets;
+		/// Half-edges starting at each vertex.
+		Ionflux::ObjectBase::UIntVector vertexHalfEdges;
+		
+		/** Get next half-edge.
+		 *
+		 * Get the next half-edge within the face of the half-edge. The
+		 * half-edge index is not checked.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Half-edge index.
+		 */
+		unsigned int nextHalfEdge(unsigned int halfEdgeIndex) const;
+		
+		/** Get edge hash.
+		 *
+		 * Get the hash value of the undirected edge of a half-edge. Both
+		 * half-edges of an edge have the same hash value.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Hash value.
+		 */
+		unsigned int getEdgeHash(unsigned int halfEdgeIndex) const;
+		
+		/** Same edge check.
+		 *
+		 * Check whether two half-edges belong to the same undirected edge.
+		 *
+		 * \param h0 Half-edge index (0).
+		 * \param h1 Half-edge index (1).
+		 *
+		 * \return \c true if the half-edges belong to the same edge, \c false
+		 * otherwise.
+		 */
+		bool isSameEdge(unsigned int h0, unsigned int h1) const;
+		
+		/** Match edges.
+		 *
+		 * Match the half-edges of one partition to edges. Each half-edge is
+		 * assigned to a partition by its edge hash value, so all half-edges of
+		 * an edge are in the same partition and partitions can be matched
+		 * independently. The half-edges of the partition are inserted into an
+		 * open addressing hash table in order, and the representative (i.e. the
+		 * first) half-edge of the edge is stored for each half-edge.
+		 *
+		 * \param part Partition.
+		 * \param numParts Number of partitions.
+		 * \param hashes Edge hash values.
+		 * \param reps Where to store the representative half-edges.
+		 */
+		virtual void matchEdges(unsigned int part, unsigned int numParts, const
+		Ionflux::ObjectBase::UIntVector& hashes,
+		Ionflux::ObjectBase::UIntVector& reps) const;
+		
+		/** Match edges (task).
+		 *
+		 * Match the half-edges of the partition specified by the task to edges.
+		 * This can be used as a thread start function. Errors are recorded in
+		 * the task.
+		 *
+		 * \param taskArg Mesh adjacency match task.
+		 *
+		 * \return Thread result.
+		 */
+		static void* matchTask(void* taskArg);
+		
+		/** Build adjacency.
+		 *
+		 * Build the adjacency data from the face vertex indices and face
+		 * offsets. Half-edges are matched to edges in parallel for large
+		 * meshes.
+		 *
+		 * \param numThreads Number of threads (0 = number of processors).
+		 */
+		virtual void build(unsigned int numThreads);
+		
+		/** Check half-edge index.
+		 *
+		 * Check whether the specified half-edge index is valid. An exception is
+		 * thrown if the index is out of bounds.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 * \param source Source function.
+		 */
+		void checkHalfEdgeIndex(unsigned int halfEdgeIndex, const std::string&
+		source) const;
+		
+		/** Check edge index.
+		 *
+		 * Check whether the specified edge index is valid. An exception is
+		 * thrown if the index is out of bounds.
+		 *
+		 * \param edgeIndex Edge index.
+		 * \param source Source function.
+		 */
+		void checkEdgeIndex(unsigned int edgeIndex, const std::string& source)
+		const;
+		
+		/** Check face index.
+		 *
+		 * Check whether the specified face index is valid. An exception is
+		 * thrown if the index is out of bounds.
+		 *
+		 * \param faceIndex Face index.
+		 * \param source Source function.
+		 */
+		void checkFaceIndex(unsigned int faceIndex, const std::string& source)
+		const;
+		
+		/** Check vertex index.
+		 *
+		 * Check whether the specified vertex index is valid. An exception is
+		 * thrown if the index is out of bounds.
+		 *
+		 * \param vertexIndex Vertex index.
+		 * \param source Source function.
+		 */
+		void checkVertexIndex(unsigned int vertexIndex, const std::string&
+		source) const;
+		
+		/** Add unique value.
+		 *
+		 * Append a value to the target vector if it is not contained in the
+		 * range of the vector that starts at the specified offset.
+		 *
+		 * \param target Target vector.
+		 * \param offset Offset.
+		 * \param value Value.
+		 *
+		 * \return \c true if the value has been added, \c false otherwise.
+		 */
+		static bool addUnique(Ionflux::ObjectBase::UIntVector& target, unsigned
+		int offset, unsigned int value);
+		
+	public:
+		/// Class information instance.
+		static const MeshAdjacencyClassInfo meshAdjacencyClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+		
+		/** Constructor.
+		 *
+		 * Construct new MeshAdjacency object.
+		 */
+		MeshAdjacency();
+		
+		/** Constructor.
+		 *
+		 * Construct new MeshAdjacency object.
+		 *
+		 * \param other Other object.
+		 */
+		MeshAdjacency(const Ionflux::GeoUtils::MeshAdjacency& other);
+		
+		/** Destructor.
+		 *
+		 * Destruct MeshAdjacency object.
+		 */
+		virtual ~MeshAdjacency();
+		
+		/** Clear.
+		 *
+		 * Clear all adjacency data.
+		 */
+		virtual void clear();
+		
+		/** Update.
+		 *
+		 * Update the adjacency data from the faces of a mesh. There is one
+		 * half-edge for each face vertex, which starts at that vertex. Edges
+		 * are numbered in the order in which they first occur in the faces.
+		 * Faces that are null are treated as faces without vertices. The
+		 * adjacency data does not track changes to the mesh, so it has to be
+		 * updated whenever the faces of the mesh change.
+		 *
+		 * \param mesh Mesh.
+		 * \param numThreads Number of threads (0 = number of processors).
+		 *
+		 * \return Number of edges.
+		 */
+		virtual unsigned int update(const Ionflux::GeoUtils::Mesh& mesh,
+		unsigned int numThreads = 0);
+		
+		/** Update (compact mesh).
+		 *
+		 * Update the adjacency data from the faces of a compact mesh. See
+		 * update(const Mesh&, unsigned int) for details.
+		 *
+		 * \param mesh Compact mesh.
+		 * \param numThreads Number of threads (0 = number of processors).
+		 *
+		 * \return Number of edges.
+		 */
+		virtual unsigned int update(const Ionflux::GeoUtils::CompactMesh& mesh,
+		unsigned int numThreads = 0);
+		
+		/** Get number of vertices.
+		 *
+		 * Get the number of vertices.
+		 *
+		 * \return Number of vertices.
+		 */
+		virtual unsigned int getNumVertices() const;
+		
+		/** Get number of faces.
+		 *
+		 * Get the number of faces.
+		 *
+		 * \return Number of faces.
+		 */
+		virtual unsigned int getNumFaces() const;
+		
+		/** Get number of half-edges.
+		 *
+		 * Get the number of half-edges.
+		 *
+		 * \return Number of half-edges.
+		 */
+		virtual unsigned int getNumHalfEdges() const;
+		
+		/** Get number of edges.
+		 *
+		 * Get the number of edges.
+		 *
+		 * \return Number of edges.
+		 */
+		virtual unsigned int getNumEdges() const;
+		
+		/** Get half-edge source vertex.
+		 *
+		 * Get the vertex at which the half-edge starts.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Vertex index.
+		 */
+		virtual unsigned int getHalfEdgeSource(unsigned int halfEdgeIndex)
+		const;
+		
+		/** Get half-edge target vertex.
+		 *
+		 * Get the vertex at which the half-edge ends.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Vertex index.
+		 */
+		virtual unsigned int getHalfEdgeTarget(unsigned int halfEdgeIndex)
+		const;
+		
+		/** Get next half-edge.
+		 *
+		 * Get the next half-edge within the face of the half-edge.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Half-edge index.
+		 */
+		virtual unsigned int getNextHalfEdge(unsigned int halfEdgeIndex) const;
+		
+		/** Get previous half-edge.
+		 *
+		 * Get the previous half-edge within the face of the half-edge.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Half-edge index.
+		 */
+		virtual unsigned int getPrevHalfEdge(unsigned int halfEdgeIndex) const;
+		
+		/** Get twin half-edge.
+		 *
+		 * Get the other half-edge of the edge of the half-edge. Boundary and
+		 * non-manifold edges do not have twin half-edges.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Half-edge index, or \c HALF_EDGE_NONE if the half-edge does
+		 * not have a twin.
+		 */
+		virtual unsigned int getTwin(unsigned int halfEdgeIndex) const;
+		
+		/** Get half-edge face.
+		 *
+		 * Get the face of the half-edge.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Face index.
+		 */
+		virtual unsigned int getHalfEdgeFace(unsigned int halfEdgeIndex) const;
+		
+		/** Get half-edge edge.
+		 *
+		 * Get the edge of the half-edge.
+		 *
+		 * \param halfEdgeIndex Half-edge index.
+		 *
+		 * \return Edge index.
+		 */
+		virtual unsigned int getHalfEdgeEdge(unsigned int halfEdgeIndex) const;
+		
+		/** Get face half-edge.
+		 *
+		 * Get the first half-edge of a face. The half-edges of a face are
+		 * numbered consecutively, starting with the half-edge that starts at
+		 * the first vertex of the face.
+		 *
+		 * \param faceIndex Face index.
+		 *
+		 * \return Half-edge index.
+		 */
+		virtual unsigned int getFaceHalfEdge(unsigned int faceIndex) const;
+		
+		/** Get edge half-edge.
+		 *
+		 * Get a half-edge of an edge. Index 0 selects the half-edge that occurs
+		 * first in the faces, which also determines the orientation of the
+		 * edge.
+		 *
+		 * \param edgeIndex Edge index.
+		 * \param index Index of the half-edge within the edge.
+		 *
+		 * \return Half-edge index.
+		 */
+		virtual unsigned int getEdgeHalfEdge(unsigned int edgeIndex, unsigned
+		int index = 0) const;
+		
+		/** Get number of edge faces.
+		 *
+		 * Get the number of faces that share an edge, i.e. the number of
+		 * half-edges of the edge.
+		 *
+		 * \param edgeIndex Edge index.
+		 *
+		 * \return Number of faces.
+		 */
+		virtual unsigned int getEdgeNumFaces(unsigned int edgeIndex) const;
+		
+		/** Boundary edge check.
+		 *
+		 * Check whether an edge is a boundary edge, i.e. whether it belongs to
+		 * exactly one face.
+		 *
+		 * \param edgeIndex Edge index.
+		 *
+		 * \return \c true if the edge is a boundary edge, \c false otherwise.
+		 */
+		virtual bool isBoundaryEdge(unsigned int edgeIndex) const;
+		
+		/** Non-manifold edge check.
+		 *
+		 * Check whether an edge is a non-manifold edge, i.e. whether it is
+		 * shared by more than two faces.
+		 *
+		 * \param edgeIndex Edge index.
+		 *
+		 * \return \c true if the edge is a non-manifold edge, \c false
+		 * otherwise.
+		 */
+		virtual bool isNonManifoldEdge(unsigned int edgeIndex) const;
+		
+		/** Get edge faces.
+		 *
+		 * Get the faces that share an edge. The face indices are appended to
+		 * the target vector.
+		 *
+		 * \param edgeIndex Edge index.
+		 * \param target Where to store the face indices.
+		 *
+		 * \return Number of faces that have been added.
+		 */
+		virtual unsigned int getEdgeFaces(unsigned int edgeIndex,
+		Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get face neighbors.
+		 *
+		 * Get the faces that share an edge with the specified face. Each
+		 * neighbor face is appended to the target vector once, in the order of
+		 * the edges of the face.
+		 *
+		 * \param faceIndex Face index.
+		 * \param target Where to store the face indices.
+		 *
+		 * \return Number of faces that have been added.
+		 */
+		virtual unsigned int getFaceNeighbors(unsigned int faceIndex,
+		Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get vertex half-edges.
+		 *
+		 * Get the half-edges that start at the specified vertex. The half-edge
+		 * indices are appended to the target vector.
+		 *
+		 * \param vertexIndex Vertex index.
+		 * \param target Where to store the half-edge indices.
+		 *
+		 * \return Number of half-edges that have been added.
+		 */
+		virtual unsigned int getVertexHalfEdges(unsigned int vertexIndex,
+		Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get vertex faces.
+		 *
+		 * Get the faces that contain the specified vertex (the vertex star).
+		 * Each face is appended to the target vector once.
+		 *
+		 * \param vertexIndex Vertex index.
+		 * \param target Where to store the face indices.
+		 *
+		 * \return Number of faces that have been added.
+		 */
+		virtual unsigned int getVertexFaces(unsigned int vertexIndex,
+		Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get vertex neighbors.
+		 *
+		 * Get the vertices that share an edge with the specified vertex (the
+		 * one-ring). Each vertex is appended to the target vector once.
+		 *
+		 * \param vertexIndex Vertex index.
+		 * \param target Where to store the vertex indices.
+		 *
+		 * \return Number of vertices that have been added.
+		 */
+		virtual unsigned int getVertexNeighbors(unsigned int vertexIndex,
+		Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get boundary edges.
+		 *
+		 * Get the edges that belong to exactly one face. The edge indices are
+		 * appended to the target vector.
+		 *
+		 * \param target Where to store the edge indices.
+		 *
+		 * \return Number of edges that have been added.
+		 */
+		virtual unsigned int getBoundaryEdges(Ionflux::ObjectBase::UIntVector&
+		target) const;
+		
+		/** Get non-manifold edges.
+		 *
+		 * Get the edges that are shared by more than two faces. The edge
+		 * indices are appended to the target vector.
+		 *
+		 * \param target Where to store the edge indices.
+		 *
+		 * \return Number of edges that have been added.
+		 */
+		virtual unsigned int
+		getNonManifoldEdges(Ionflux::ObjectBase::UIntVector& target) const;
+		
+		/** Get boundary loops.
+		 *
+		 * Get the boundary loops of the mesh. Boundary loops are formed by
+		 * following the boundary half-edges from vertex to vertex. The vertex
+		 * indices of each loop are appended to \c target, and the offset of the
+		 * first vertex of each loop within \c target is appended to \c offsets.
+		 * A loop may be an open chain if the boundary passes through a
+		 * non-manifold vertex or edge.
+		 *
+		 * \param target Where to store the vertex indices.
+		 * \param offsets Where to store the loop offsets.
+		 *
+		 * \return Number of loops that have been added.
+		 */
+		virtual unsigned int getBoundaryLoops(Ionflux::ObjectBase::UIntVector&
+		target, Ionflux::ObjectBase::UIntVector& offsets) const;
+		
+		/** Closed check.
+		 *
+		 * Check whether the mesh is closed, i.e. whether it does not have
+		 * boundary edges.
+		 *
+		 * \return \c true if the mesh is closed, \c false otherwise.
+		 */
+		virtual bool isClosed() const;
+		
+		/** Manifold check.
+		 *
+		 * Check whether no edge of the mesh is shared by more than two faces.
+		 *
+		 * \return \c true if the mesh is manifold, \c false otherwise.
+		 */
+		virtual bool isManifold() const;
+		
+		/** Get string representation of value.
+		 *
+		 * Get a string representation of the value of the object.
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getValueString() const;
+		
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::GeoUtils::MeshAdjacency& operator=(const
+		Ionflux::GeoUtils::MeshAdjacency& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::GeoUtils::MeshAdjacency* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::GeoUtils::MeshAdjacency*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::GeoUtils::MeshAdjacency*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+/** \file MeshAdjacency.hpp
+ * \brief Mesh adjacency (header).
+ */
+#endif
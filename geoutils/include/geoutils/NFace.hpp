@@ -185,6 +185,27 @@ Ionflux::GeoUtils::TransformableObject
 		 */
 		virtual void update();
 		
+		/** Update bounds.
+		 *
+		 * Update the bounds of the face according to its vertices. Unlike
+		 * update(), this does not affect any other state of the face. If the
+		 * face does not have vertices, the bounds are updated according to the
+		 * center and radius vector.
+		 */
+		virtual void updateBounds();
+		
+		/** Update from bounds.
+		 *
+		 * Update the state of the N-face using bounds that have already been
+		 * calculated, for example by Mesh::updateGeometry(). Unlike update(),
+		 * this does not create the polygon for the N-face. The bounds must take
+		 * into account the transformations of the vertex source and the N-face.
+		 *
+		 * \param newBounds Bounds.
+		 */
+		virtual void updateFromBounds(const Ionflux::GeoUtils::Range3&
+		newBounds);
+		
 		/** Clear polygon.
 		 *
 		 * Clear the face polygon.
@@ -538,6 +559,17 @@ Ionflux::GeoUtils::TransformableObject
 		 */
 		virtual void applyVertexIndexOffset(int offset);
 		
+		/** Apply vertex index map.
+		 *
+		 * Replace each vertex index of the face by the entry of the map at that
+		 * index. Vertex indices that are not covered by the map are left
+		 * unchanged.
+		 *
+		 * \param indexMap Vertex index map.
+		 */
+		virtual void applyVertexIndexMap(const Ionflux::ObjectBase::UIntVector&
+		indexMap);
+		
 		/** Get triangle faces.
 		 *
 		 * Create triangles for a triangle or quad N-face. The new faces are 
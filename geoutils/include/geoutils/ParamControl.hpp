@@ -130,6 +130,18 @@ class ParamControl
 		 */
 		virtual void call(Ionflux::Mapping::MappingValue value) const;
 		
+		/** Get parameter value.
+		 *
+		 * Get the value that the parameter controlled by the object is set to
+		 * if the object is called with the specified value.
+		 *
+		 * \param value Value.
+		 *
+		 * \return Parameter value.
+		 */
+		virtual Ionflux::Mapping::MappingValue
+		getValue(Ionflux::Mapping::MappingValue value) const;
+		
 		/** Call.
 		 *
 		 * Update the parameter controlled by the object using the specified 
@@ -0,0 +1,409 @@
+#ifndef IONFLUX_GEOUTILS_PROFILER
+#define IONFLUX_GEOUTILS_PROFILER
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * Profiler.hpp                    Transform node profiler (header).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include <pthread.h>
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+#include "geoutils/Clock.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+namespace TransformNodes
+{
+
+/// Class information for class Profiler.
+class ProfilerClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		ProfilerClassInfo();
+		/// Destructor.
+		virtual ~ProfilerClassInfo();
+};
+
+/** Transform node profiler.
+ * \ingroup geoutils
+ *
+ * A profiler records the updates of transform nodes. Each node that has
+ * a profiler set reports the start and end of its updates to the
+ * profiler, which aggregates, for each node, the number of calls, the
+ * inclusive time, the exclusive time (the inclusive time minus the time
+ * spent in nested updates on the same thread), the number of input and
+ * output items, and the size of the output objects (not including
+ * memory allocated by the objects). A transform graph sets its profiler
+ * on all of its nodes when it is updated, so setting a profiler on the
+ * graph is enough to profile a complete graph.
+ * The profiler also records each update as an event, so the results can
+ * be written as a JSON report or as a trace event file that can be
+ * loaded into the Chrome trace viewer. The profiler can be used by
+ * several threads at once, but the results should only be queried after
+ * the profiled updates have finished.
+ */
+class Profiler
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+		
+	protected:
+		/// Timer.
+		Ionflux::GeoUtils::Clock timer;
+		/// Start time.
+		double startTime;
+		/// Node profiles.
+		Ionflux::GeoUtils::TransformNodeProfileVector profiles;
+		/// Profile index for each node.
+		std::map<Ionflux::GeoUtils::TransformNodes::TransformNode*, unsigned int> profileMap;
+		/// Events.
+		Ionflux::GeoUtils::TransformProfilerEventVector events;
+		/// Thread records.
+		Ionflux::GeoUtils::TransformProfilerThreadVector threads;
+		/// Mutex.
+		pthread_mutex_t mutex;
+		
+		/** Get time.
+		 *
+		 * Get the current time relative to the start time of the profiler.
+		 *
+		 * \return Time (seconds).
+		 */
+		double getTime();
+		
+		/** Get thread index.
+		 *
+		 * Get the index of the thread record for the calling thread. A new
+		 * thread record is created if the calling thread does not have one yet.
+		 * The caller must hold the mutex.
+		 *
+		 * \return Thread index.
+		 */
+		unsigned int getThreadIndex();
+		
+		/** Find open event.
+		 *
+		 * Find the innermost open event for the specified node on the stack of
+		 * a thread. The caller must hold the mutex.
+		 *
+		 * \param thread Thread record.
+		 * \param node Transform node.
+		 *
+		 * \return Stack position of the event, or -1 if there is no open event
+		 * for the node.
+		 */
+		int findOpenEvent(const Ionflux::GeoUtils::TransformProfilerThread&
+		thread, Ionflux::GeoUtils::TransformNodes::TransformNode* node);
+		
+		/** Get group memory size.
+		 *
+		 * Get the estimated memory size of a group, including the items of the
+		 * group and of all nested groups. Only the size of the objects
+		 * themselves is taken into account, not the size of memory they
+		 * allocate.
+		 *
+		 * \param group Transformable group.
+		 *
+		 * \return Memory size (bytes).
+		 */
+		static Ionflux::ObjectBase::UInt64
+		getGroupMemSize(Ionflux::GeoUtils::TransformableGroup* group);
+		
+		/** Get JSON string.
+		 *
+		 * Get a quoted JSON string literal for the specified string.
+		 *
+		 * \param source Source string.
+		 *
+		 * \return JSON string literal.
+		 */
+		static std::string getJSONString(const std::string& source);
+		
+	public:
+		/// Class information instance.
+		static const ProfilerClassInfo profilerClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+		
+		/** Constructor.
+		 *
+		 * Construct new Profiler object.
+		 */
+		Profiler();
+		
+		/** Constructor.
+		 *
+		 * Construct new Profiler object.
+		 *
+		 * \param other Other object.
+		 */
+		Profiler(const Ionflux::GeoUtils::TransformNodes::Profiler& other);
+		
+		/** Destructor.
+		 *
+		 * Destruct Profiler object.
+		 */
+		virtual ~Profiler();
+		
+		/** Clear.
+		 *
+		 * Clear all profiles and events and restart the profiler.
+		 */
+		virtual void clear();
+		
+		/** Begin update.
+		 *
+		 * Record the start of an update of the specified node by the calling
+		 * thread.
+		 *
+		 * \param node Transform node.
+		 */
+		virtual void begin(Ionflux::GeoUtils::TransformNodes::TransformNode*
+		node);
+		
+		/** End update.
+		 *
+		 * Record the end of an update of the specified node by the calling
+		 * thread and add the event to the profile of the node. Events that have
+		 * been started by the calling thread after the update of the node and
+		 * are still open have been aborted by an exception. They are closed
+		 * without being added to the profiles.
+		 *
+		 * \param node Transform node.
+		 * \param numInputItems Number of input items.
+		 */
+		virtual void end(Ionflux::GeoUtils::TransformNodes::TransformNode* node,
+		Ionflux::ObjectBase::UInt64 numInputItems = 0);
+		
+		/** Cancel update.
+		 *
+		 * Close the open event for an update of the specified node by the
+		 * calling thread, as well as all events that have been started after
+		 * it, without adding them to the profiles. This should be called if an
+		 * update has been aborted by an exception. Nothing happens if there is
+		 * no open event for the node.
+		 *
+		 * \param node Transform node.
+		 */
+		virtual void cancel(Ionflux::GeoUtils::TransformNodes::TransformNode*
+		node);
+		
+		/** Remove node.
+		 *
+		 * Remove the specified node from the profiler. The profile of the node
+		 * is kept, but it is no longer associated with the node, so a node that
+		 * is created later at the same address gets a profile of its own. This
+		 * is called by a node that is destroyed or that switches to another
+		 * profiler. Nothing happens if there is no profile for the node.
+		 *
+		 * \param node Transform node.
+		 */
+		virtual void
+		removeNode(Ionflux::GeoUtils::TransformNodes::TransformNode* node);
+		
+		/** Get number of profiles.
+		 *
+		 * Get the number of node profiles.
+		 *
+		 * \return Number of profiles.
+		 */
+		virtual unsigned int getNumProfiles() const;
+		
+		/** Get profile.
+		 *
+		 * Get the node profile with the specified index.
+		 *
+		 * \param index Profile index.
+		 *
+		 * \return Node profile.
+		 */
+		virtual Ionflux::GeoUtils::TransformNodeProfile getProfile(unsigned int
+		index) const;
+		
+		/** Find profile.
+		 *
+		 * Find the profile for the specified node.
+		 *
+		 * \param node Transform node.
+		 *
+		 * \return Profile index, or -1 if there is no profile for the node.
+		 */
+		virtual int
+		findProfile(Ionflux::GeoUtils::TransformNodes::TransformNode* node)
+		const;
+		
+		/** Get number of events.
+		 *
+		 * Get the number of events.
+		 *
+		 * \return Number of events.
+		 */
+		virtual unsigned int getNumEvents() const;
+		
+		/** Get event.
+		 *
+		 * Get the event with the specified index. Events are ordered by start
+		 * time for each thread.
+		 *
+		 * \param index Event index.
+		 *
+		 * \return Event.
+		 */
+		virtual Ionflux::GeoUtils::TransformProfilerEvent getEvent(unsigned int
+		index) const;
+		
+		/** Get number of threads.
+		 *
+		 * Get the number of threads that have recorded events.
+		 *
+		 * \return Number of threads.
+		 */
+		virtual unsigned int getNumThreads() const;
+		
+		/** Get summary.
+		 *
+		 * Get a table of the node profiles, ordered by decreasing exclusive
+		 * time. If \c maxProfiles is not zero, only the first \c maxProfiles
+		 * profiles are included.
+		 *
+		 * \param maxProfiles Maximum number of profiles.
+		 *
+		 * \return Summary.
+		 */
+		virtual std::string getSummary(unsigned int maxProfiles = 0) const;
+		
+		/** Get JSON report.
+		 *
+		 * Get the node profiles as a JSON document. Times are in seconds.
+		 *
+		 * \return JSON document.
+		 */
+		virtual std::string getJSON() const;
+		
+		/** Write JSON report.
+		 *
+		 * Write the node profiles as a JSON document to a file.
+		 *
+		 * \param fileName File name.
+		 */
+		virtual void writeJSON(const std::string& fileName) const;
+		
+		/** Get trace.
+		 *
+		 * Get the events as a document in the trace event format that is used
+		 * by the Chrome trace viewer (chrome://tracing). Each closed event is
+		 * written as a complete event, with times in microseconds. Events that
+		 * are still open are not included.
+		 *
+		 * \return Trace document.
+		 */
+		virtual std::string getTrace() const;
+		
+		/** Write trace.
+		 *
+		 * Write the events as a document in the trace event format (see
+		 * getTrace()) to a file.
+		 *
+		 * \param fileName File name.
+		 */
+		virtual void writeTrace(const std::string& fileName) const;
+		
+		/** Get string representation of value.
+		 *
+		 * Get a string representation of the value of the object.
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getValueString() const;
+		
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::GeoUtils::TransformNodes::Profiler& operator=(const
+		Ionflux::GeoUtils::TransformNodes::Profiler& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::GeoUtils::TransformNodes::Profiler* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::GeoUtils::TransformNodes::Profiler*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::GeoUtils::TransformNodes::Profiler*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+}
+
+/** \file Profiler.hpp
+ * \brief Transform node profiler (header).
+ */
+#endif
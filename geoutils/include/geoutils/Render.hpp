@@ -82,6 +82,10 @@ class Render
 		unsigned int originY;
 		/// Background color.
 		Ionflux::Altjira::Color backgroundColor;
+		/// Render backend.
+		Ionflux::GeoUtils::RenderBackendID backend;
+		/// Number of threads for the scanline backend (0 = number of processors).
+		unsigned int numThreads;
 		
 		/** Process inputs.
 		 *
@@ -152,6 +156,16 @@ class Render
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node renders to an image, so it is never updated concurrently
+		 * with other nodes.
+		 *
+		 * \return \c false.
+		 */
+		virtual bool isThreadSafe() const;
+		
 		/** Add styles.
 		 *
 		 * Add styles for rendering.
@@ -362,6 +376,38 @@ class Render
 		 */
 		virtual void setBackgroundColor(const Ionflux::Altjira::Color& 
 		newBackgroundColor);
+		
+		/** Get render backend.
+		 *
+		 * \return Current value of render backend.
+		 */
+		virtual Ionflux::GeoUtils::RenderBackendID getBackend() const;
+		
+		/** Set render backend.
+		 *
+		 * Set new value of render backend.
+		 *
+		 * \param newBackend New value of render backend.
+		 */
+		virtual void setBackend(Ionflux::GeoUtils::RenderBackendID 
+		newBackend);
+		
+		/** Get number of threads for the scanline backend (0 = number of processors).
+		 *
+		 * \return Current value of number of threads for the scanline backend 
+		 * (0 = number of processors).
+		 */
+		virtual unsigned int getNumThreads() const;
+		
+		/** Set number of threads for the scanline backend (0 = number of processors).
+		 *
+		 * Set new value of number of threads for the scanline backend (0 = 
+		 * number of processors).
+		 *
+		 * \param newNumThreads New value of number of threads for the scanline 
+		 * backend (0 = number of processors).
+		 */
+		virtual void setNumThreads(unsigned int newNumThreads);
 };
 
 }
@@ -0,0 +1,378 @@
+#ifndef IONFLUX_GEOUTILS_SVGWRITER
+#define IONFLUX_GEOUTILS_SVGWRITER
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * SVGWriter.hpp                   SVG writer (header).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include <iostream>
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Polygon3;
+class Polygon3Set;
+
+/// Class information for class SVGWriter.
+class SVGWriterClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		SVGWriterClassInfo();
+		/// Destructor.
+		virtual ~SVGWriterClassInfo();
+};
+
+/** SVG writer.
+ * \ingroup geoutils
+ *
+ * A streaming writer for SVG images. Polygons are formatted into a
+ * reusable buffer that is written to the output stream in large chunks,
+ * which avoids building the complete document in memory. Coordinates are
+ * formatted with a fixed number of decimal places. Optionally,
+ * consecutive polygons with the same style can be coalesced into a
+ * single path element.
+ */
+class SVGWriter
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+		
+	protected:
+		/// Output buffer.
+		std::string buffer;
+		/// Footer.
+		std::string footer;
+		/// Number of polygons written.
+		unsigned int numPolygons;
+		/// Number of decimal places for coordinates.
+		unsigned int precision;
+		/// Coalesce paths.
+		bool coalescePaths;
+		/// Element ID prefix.
+		std::string elementIDPrefix;
+		/// Projection axis.
+		Ionflux::GeoUtils::AxisID axis;
+		/// Shape type.
+		Ionflux::GeoUtils::SVGShapeType shapeType;
+		/// Close path.
+		bool closePath;
+		
+		/** Append number.
+		 *
+		 * Append a number with the specified number of decimal places to the
+		 * target string. The number is formatted by appendDouble(), so it is 
+		 * rounded like printf() (with ties to even). Trailing zeros of the 
+		 * fractional part and the sign of values that are rounded to zero are
+		 * omitted.
+		 *
+		 * \param target Where to store the formatted number.
+		 * \param value Value.
+		 * \param precision Number of decimal places.
+		 */
+		static void appendNumber(std::string& target, double value, unsigned int
+		precision);
+		
+		/** Append element start.
+		 *
+		 * Append the start of an SVG element, up to and including the opening
+		 * quote of the coordinate data attribute, to the buffer.
+		 *
+		 * \param attrs Element attributes.
+		 * \param elementIndex Element index.
+		 * \param elementShapeType Shape type.
+		 */
+		virtual void appendElementStart(const std::string& attrs, unsigned int
+		elementIndex, Ionflux::GeoUtils::SVGShapeType elementShapeType);
+		
+		/** Append polygon.
+		 *
+		 * Append the coordinate data for a polygon to the buffer.
+		 *
+		 * \param polygon Polygon.
+		 * \param axisX Axis for the SVG X coordinate.
+		 * \param axisY Axis for the SVG Y coordinate.
+		 * \param elementShapeType Shape type.
+		 */
+		virtual void appendPolygon(Ionflux::GeoUtils::Polygon3& polygon,
+		Ionflux::GeoUtils::AxisID axisX, Ionflux::GeoUtils::AxisID axisY,
+		Ionflux::GeoUtils::SVGShapeType elementShapeType);
+		
+		/** Flush buffer.
+		 *
+		 * Write the buffer to the output stream if it has reached the flush
+		 * threshold, or unconditionally if \c force is set.
+		 *
+		 * \param target Output stream.
+		 * \param force Flush regardless of the buffer size.
+		 */
+		virtual void flushBuffer(std::ostream& target, bool force = false);
+		
+	public:
+		/// Class information instance.
+		static const SVGWriterClassInfo sVGWriterClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+		
+		/** Constructor.
+		 *
+		 * Construct new SVGWriter object.
+		 */
+		SVGWriter();
+		
+		/** Constructor.
+		 *
+		 * Construct new SVGWriter object.
+		 *
+		 * \param other Other object.
+		 */
+		SVGWriter(const Ionflux::GeoUtils::SVGWriter& other);
+		
+		/** Destructor.
+		 *
+		 * Destruct SVGWriter object.
+		 */
+		virtual ~SVGWriter();
+		
+		/** Write header.
+		 *
+		 * Write the part of the SVG template preceding the data tag to the
+		 * output stream. The part following the data tag is retained for
+		 * writeFooter(). This also resets the element counter.
+		 *
+		 * \param target Output stream.
+		 * \param width Width.
+		 * \param height Height.
+		 * \param originX Origin (X).
+		 * \param originY Origin (Y).
+		 * \param svgTemplate SVG template.
+		 */
+		virtual void writeHeader(std::ostream& target, unsigned int width =
+		1000, unsigned int height = 1000, int originX = 500, int originY = 500,
+		const std::string& svgTemplate = Ionflux::GeoUtils::SVG_TEMPLATE);
+		
+		/** Write polygons.
+		 *
+		 * Write SVG elements for the polygons in the set to the output stream.
+		 * Styles are assigned to the polygons cyclically. If no styles are
+		 * specified, the default style is used. Element IDs continue from
+		 * previous calls since the last call to writeHeader().
+		 *
+		 * \param target Output stream.
+		 * \param polygons Polygons.
+		 * \param styles Shape styles.
+		 */
+		virtual void writePolygons(std::ostream& target,
+		Ionflux::GeoUtils::Polygon3Set& polygons, const
+		Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0);
+		
+		/** Write footer.
+		 *
+		 * Flush the buffer and write the part of the SVG template following the
+		 * data tag to the output stream.
+		 *
+		 * \param target Output stream.
+		 */
+		virtual void writeFooter(std::ostream& target);
+		
+		/** Write file.
+		 *
+		 * Write an SVG image containing the polygons in the set to a file.
+		 *
+		 * \param fileName File name.
+		 * \param polygons Polygons.
+		 * \param styles Shape styles.
+		 * \param width Width.
+		 * \param height Height.
+		 * \param originX Origin (X).
+		 * \param originY Origin (Y).
+		 * \param svgTemplate SVG template.
+		 */
+		virtual void writeFile(const std::string& fileName,
+		Ionflux::GeoUtils::Polygon3Set& polygons, const
+		Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0, unsigned int width =
+		1000, unsigned int height = 1000, int originX = 500, int originY = 500,
+		const std::string& svgTemplate = Ionflux::GeoUtils::SVG_TEMPLATE);
+		
+		/** Get string representation.
+		 *
+		 * Get a string representation of the object
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getString() const;
+		
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::GeoUtils::SVGWriter& operator=(const
+		Ionflux::GeoUtils::SVGWriter& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::GeoUtils::SVGWriter* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::GeoUtils::SVGWriter*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::GeoUtils::SVGWriter*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+		
+		/** Get number of decimal places for coordinates.
+		 *
+		 * \return Current value of number of decimal places for coordinates.
+		 */
+		virtual unsigned int getPrecision() const;
+		
+		/** Set number of decimal places for coordinates.
+		 *
+		 * Set new value of number of decimal places for coordinates.
+		 *
+		 * \param newPrecision New value of number of decimal places for
+		 * coordinates.
+		 */
+		virtual void setPrecision(unsigned int newPrecision);
+		
+		/** Get coalesce paths.
+		 *
+		 * \return Current value of coalesce paths.
+		 */
+		virtual bool getCoalescePaths() const;
+		
+		/** Set coalesce paths.
+		 *
+		 * Set new value of coalesce paths.
+		 *
+		 * \param newCoalescePaths New value of coalesce paths.
+		 */
+		virtual void setCoalescePaths(bool newCoalescePaths);
+		
+		/** Get element ID prefix.
+		 *
+		 * \return Current value of element ID prefix.
+		 */
+		virtual std::string getElementIDPrefix() const;
+		
+		/** Set element ID prefix.
+		 *
+		 * Set new value of element ID prefix.
+		 *
+		 * \param newElementIDPrefix New value of element ID prefix.
+		 */
+		virtual void setElementIDPrefix(const std::string& newElementIDPrefix);
+		
+		/** Get projection axis.
+		 *
+		 * \return Current value of projection axis.
+		 */
+		virtual Ionflux::GeoUtils::AxisID getAxis() const;
+		
+		/** Set projection axis.
+		 *
+		 * Set new value of projection axis.
+		 *
+		 * \param newAxis New value of projection axis.
+		 */
+		virtual void setAxis(Ionflux::GeoUtils::AxisID newAxis);
+		
+		/** Get shape type.
+		 *
+		 * \return Current value of shape type.
+		 */
+		virtual Ionflux::GeoUtils::SVGShapeType getShapeType() const;
+		
+		/** Set shape type.
+		 *
+		 * Set new value of shape type.
+		 *
+		 * \param newShapeType New value of shape type.
+		 */
+		virtual void setShapeType(Ionflux::GeoUtils::SVGShapeType newShapeType);
+		
+		/** Get close path.
+		 *
+		 * \return Current value of close path.
+		 */
+		virtual bool getClosePath() const;
+		
+		/** Set close path.
+		 *
+		 * Set new value of close path.
+		 *
+		 * \param newClosePath New value of close path.
+		 */
+		virtual void setClosePath(bool newClosePath);
+};
+
+}
+
+}
+
+/** \file SVGWriter.hpp
+ * \brief SVG writer (header).
+ */
+#endif
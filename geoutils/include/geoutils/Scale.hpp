@@ -160,6 +160,17 @@ class Scale
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node is thread-safe unless it uses an index or distance function,
+		 * since mappings may have shared state (such as a random number
+		 * generator).
+		 *
+		 * \return \c true if the node is thread-safe, \c false otherwise.
+		 */
+		virtual bool isThreadSafe() const;
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
@@ -192,6 +192,33 @@ class Scatter
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node is thread-safe unless it uses offset or element scale
+		 * functions, since mappings may have shared state (such as a random
+		 * number generator).
+		 *
+		 * \return \c true if the node is thread-safe, \c false otherwise.
+		 */
+		virtual bool isThreadSafe() const;
+		
+		/** Get instance transforms.
+		 *
+		 * Get the transformations for the elements of the specified group. Each
+		 * mapping is evaluated for all elements at once, and the offsets, scale
+		 * factors and scaling centers are stored as separate arrays in the
+		 * target. The result is the same as translating each element by its
+		 * offset and then scaling it around its center. Existing data in the
+		 * target is replaced.
+		 *
+		 * \param source Source group.
+		 * \param target Where to store the instance transforms.
+		 */
+		virtual void
+		getInstanceTransforms(Ionflux::GeoUtils::TransformableGroup& source,
+		Ionflux::GeoUtils::InstanceTransforms& target);
+		
 		/** Create offset lookup table.
 		 *
 		 * Create an offset lookup table suitable for use with the scatter 
@@ -70,6 +70,10 @@ class TransformGraph
 	private:
 		
 	protected:
+		/// Number of node updates done by the last update.
+		unsigned int numNodeUpdates;
+		/// Number of node updates eliminated by the last update.
+		unsigned int numEliminatedUpdates;
 		/// Vector of input node specifications.
 		std::vector<Ionflux::GeoUtils::TransformNodes::InputNodeSpec> inputs;
 		/// Vector of output groups.
@@ -82,6 +86,10 @@ class TransformGraph
 		Ionflux::GeoUtils::TransformNodes::TransformNode* source;
 		/// Drain node.
 		Ionflux::GeoUtils::TransformNodes::TransformNode* drain;
+		/// Number of threads for updates (0 = number of processors).
+		unsigned int numThreads;
+		/// Incremental update flag.
+		bool incremental;
 		
 		/** Process inputs.
 		 *
@@ -89,6 +97,94 @@ class TransformGraph
 		 */
 		virtual void process();
 		
+		/** Update nodes (parallel).
+		 *
+		 * Update the specified nodes using a pool of threads. Each node is
+		 * updated as soon as all of its input nodes that are part of the
+		 * schedule have been updated. Every thread has its own queue of nodes
+		 * that are ready for update. A thread that updates the last input of a
+		 * node adds the node to its own queue and takes the next node from the
+		 * back of that queue, so consumers tend to be updated by the thread
+		 * that has just updated their inputs. A thread that runs out of nodes
+		 * steals the oldest node from the queue of another thread. Thread-safe
+		 * nodes (see TransformNode::isThreadSafe()) may be updated by any
+		 * thread, while nodes that are not thread-safe are updated one at a
+		 * time by the calling thread. Nodes that depend on a node which shares
+		 * items between output groups (see TransformNode::sharesItems()) are
+		 * also updated by the calling thread. Since every consumer of an output
+		 * group that is shared by several consumers gets a copy of its own, and
+		 * nodes process their inputs in input order, the result does not depend
+		 * on the order in which nodes are updated. The pending consumers of
+		 * each node must have been set up before calling this function (see
+		 * update()).
+		 *
+		 * \param schedule Nodes (in topological order).
+		 * \param numThreads Number of threads.
+		 *
+		 * \return Number of nodes that have been processed.
+		 */
+		virtual unsigned int updateParallel(const
+		Ionflux::GeoUtils::TransformNodeVector& schedule, unsigned int
+		numThreads);
+		
+		/** Push node.
+		 *
+		 * Add a node that is ready for update to the queue of the specified
+		 * thread. Nodes that have to be updated by the calling thread are added
+		 * to the serial queue instead. Threads that are waiting for nodes are
+		 * notified.
+		 *
+		 * \param state Update state.
+		 * \param threadIndex Thread index.
+		 * \param nodeIndex Node index.
+		 */
+		static void pushNode(Ionflux::GeoUtils::TransformGraphUpdate& state,
+		unsigned int threadIndex, unsigned int nodeIndex);
+		
+		/** Pop node.
+		 *
+		 * Take a node that is ready for update from the back of the queue of
+		 * the specified thread. If that queue is empty, the oldest node from
+		 * the queue of another thread is taken instead.
+		 *
+		 * \param state Update state.
+		 * \param threadIndex Thread index.
+		 * \param nodeIndex Where to store the node index.
+		 *
+		 * \return \c true if a node was found, \c false otherwise.
+		 */
+		static bool popNode(Ionflux::GeoUtils::TransformGraphUpdate& state,
+		unsigned int threadIndex, unsigned int& nodeIndex);
+		
+		/** Update nodes.
+		 *
+		 * Update nodes that are ready for update until all nodes have been
+		 * updated or an error occurs. For an incremental update, nodes that do
+		 * not need to be updated are skipped. When a node has been updated, its
+		 * consumers are added to the queue of the thread as soon as all of
+		 * their inputs are available (see pushNode()), and the outputs of input
+		 * nodes that have more than one consumer are cleared once all of their
+		 * consumers have been updated (unless the update is incremental).
+		 * Errors are recorded in the update state.
+		 *
+		 * \param state Update state.
+		 * \param threadIndex Thread index. The calling thread has index 0 and
+		 * also updates nodes that are not thread-safe.
+		 */
+		static void updateNodes(Ionflux::GeoUtils::TransformGraphUpdate& state,
+		unsigned int threadIndex);
+		
+		/** Update nodes (task).
+		 *
+		 * Update nodes that are ready for update (see updateNodes()). This can
+		 * be used as a thread start function.
+		 *
+		 * \param taskArg Transform graph update task.
+		 *
+		 * \return Always 0.
+		 */
+		static void* updateTask(void* taskArg);
+		
 	public:
 		/// Index of the last node.
 		static const unsigned int NODE_INDEX_LAST;
@@ -297,17 +393,132 @@ class TransformGraph
 		
 		/** Update.
 		 *
-		 * Update the outputs of the node. This updates all inputs and checks 
-		 * the loop counter to make sure the maximum number of loop iterations
-		 * is not exceeded. It clears the output groups and calls process() to
-		 * do the actual processing of the inputs. Note that a transform node 
-		 * does not have outputs unless update() has been called and finished 
-		 * processing at least once. Outputs are considered a cache rather 
-		 * than state of the object (they are also not copied when using an 
-		 * assignment or copy constructor). See the spec for details.
+		 * Update the outputs of the graph. The nodes of the graph are updated
+		 * in topological order (see getSchedule()), so each node is processed
+		 * exactly once per update, no matter how many paths lead from the node
+		 * to the drain node. Output groups of a node are kept until all of its
+		 * consumers have been updated, and consumers other than the last get a
+		 * copy of the output groups. Input nodes that are not part of the
+		 * graph are updated once before the nodes of the graph, unless the
+		 * graph itself is scheduled. If the number of threads is not 1, nodes
+		 * that do not depend on each other are updated concurrently (see
+		 * updateParallel()). If the incremental update flag is set, the
+		 * outputs of all nodes are kept between updates, and only nodes that
+		 * need to be updated (see TransformNode::isDirty()) are processed.
+		 * Changing a parameter of a node thus only causes the node and the
+		 * nodes that depend on it to be updated. Nodes that are not updated
+		 * are counted as eliminated updates. The number of node updates, as
+		 * well as the number of updates that have been eliminated compared to
+		 * updating the drain node recursively, can be queried after the update
+		 * using getNumNodeUpdates() and getNumEliminatedUpdates().
 		 */
 		virtual void update();
 		
+		/** Get schedule.
+		 *
+		 * Get the nodes of the graph that are connected to the drain node in
+		 * topological order, that is, each node appears after all of its input
+		 * nodes that are part of the graph. Input nodes that are not part of
+		 * the graph are not added to the schedule. An exception is thrown if
+		 * the graph contains a loop.
+		 *
+		 * \param target Where to store the nodes.
+		 */
+		virtual void getSchedule(Ionflux::GeoUtils::TransformNodeVector&
+		target);
+		
+		/** Get number of node updates.
+		 *
+		 * Get the number of node updates done by the last update of the graph.
+		 *
+		 * \return Number of node updates.
+		 */
+		virtual unsigned int getNumNodeUpdates() const;
+		
+		/** Get number of eliminated updates.
+		 *
+		 * Get the number of node updates that have been eliminated by the last
+		 * update of the graph, compared to updating the drain node recursively.
+		 *
+		 * \return Number of eliminated updates.
+		 */
+		virtual unsigned int getNumEliminatedUpdates() const;
+		
+		/** Thread safety check.
+		 *
+		 * Check whether the graph can be updated concurrently with other nodes.
+		 * The graph is thread-safe if all of its nodes are thread-safe.
+		 *
+		 * \return \c true if the graph is thread-safe, \c false otherwise.
+		 */
+		virtual bool isThreadSafe() const;
+		
+		/** Shared items check.
+		 *
+		 * Check whether the output groups of the graph may share items with
+		 * other groups. This is the case if any node of the graph shares items.
+		 *
+		 * \return \c true if output groups may share items, \c false otherwise.
+		 */
+		virtual bool sharesItems() const;
+		
+		/** Create clone.
+		 *
+		 * Create a clone of the graph that can be updated independently of the
+		 * graph. Each node of the graph is cloned (see
+		 * TransformNode::createClone()), and the connections between the nodes
+		 * are replicated for the clones. Inputs that refer to nodes outside of
+		 * the graph are kept. The graph, its nodes and their clones are added
+		 * to the node map. The clone is a new object which must be managed by
+		 * the caller.
+		 *
+		 * \param nodeMap Map of nodes to their clones.
+		 *
+		 * \return Clone of the graph.
+		 */
+		virtual Ionflux::GeoUtils::TransformNodes::TransformNode*
+		createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap) const;
+		
+		/** Remap inputs.
+		 *
+		 * Redirect each input of the graph that refers to a node in the node
+		 * map to the node it is mapped to. The inputs of the graph are the
+		 * inputs of the source node.
+		 *
+		 * \param nodeMap Map of nodes to their clones.
+		 */
+		virtual void remapInputs(const Ionflux::GeoUtils::TransformNodeMap&
+		nodeMap);
+		
+		/** Dirty check.
+		 *
+		 * Check whether the outputs of the graph need to be updated. This is
+		 * the case if the graph has never been updated, if the drain node has
+		 * no outputs, if the parameter version of the graph has changed or if
+		 * any node of the graph needs to be updated.
+		 *
+		 * \return \c true if the graph needs to be updated, \c false otherwise.
+		 */
+		virtual bool isDirty() const;
+		
+		/** Get total parameter version.
+		 *
+		 * Get the parameter version of the graph, including the total parameter
+		 * versions of the nodes of the graph.
+		 *
+		 * \return Total parameter version.
+		 */
+		virtual unsigned int getTotalParamVersion() const;
+		
+		/** Set profiler.
+		 *
+		 * Set the profiler of the graph and of all nodes of the graph.
+		 *
+		 * \param newProfiler Profiler.
+		 */
+		virtual void setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler*
+		newProfiler);
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
@@ -665,6 +876,37 @@ class TransformGraph
 		 */
 		virtual void setDrain(Ionflux::GeoUtils::TransformNodes::TransformNode* 
 		newDrain);
+		
+		/** Get number of threads for updates (0 = number of processors).
+		 *
+		 * \return Current value of number of threads for updates (0 = number 
+		 * of processors).
+		 */
+		virtual unsigned int getNumThreads() const;
+		
+		/** Set number of threads for updates (0 = number of processors).
+		 *
+		 * Set new value of number of threads for updates (0 = number of 
+		 * processors).
+		 *
+		 * \param newNumThreads New value of number of threads for updates (0 =
+		 * number of processors).
+		 */
+		virtual void setNumThreads(unsigned int newNumThreads);
+		
+		/** Get incremental update flag.
+		 *
+		 * \return Current value of incremental update flag.
+		 */
+		virtual bool getIncremental() const;
+		
+		/** Set incremental update flag.
+		 *
+		 * Set new value of incremental update flag.
+		 *
+		 * \param newIncremental New value of incremental update flag.
+		 */
+		virtual void setIncremental(bool newIncremental);
 };
 
 }
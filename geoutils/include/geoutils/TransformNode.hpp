@@ -81,6 +81,12 @@ class TransformNode
 		bool debugExpand;
 		/// Input group cache.
 		Ionflux::GeoUtils::TransformableGroupVector inputCache;
+		/// Parameter version at the last update.
+		unsigned int lastParamVersion;
+		/// Input node specifications at the last update.
+		Ionflux::GeoUtils::InputNodeSpecVector lastInputs;
+		/// Update counters of the input nodes at the last update.
+		Ionflux::ObjectBase::UIntVector lastInputVersions;
 		/// Vector of input node specifications.
 		std::vector<Ionflux::GeoUtils::TransformNodes::InputNodeSpec> inputs;
 		/// Vector of output groups.
@@ -91,6 +97,14 @@ class TransformNode
 		unsigned int maxNumInputs;
 		/// Update counter.
 		unsigned int updateCounter;
+		/// Scheduled update flag.
+		bool scheduled;
+		/// Number of scheduled consumers that have not yet processed the outputs.
+		unsigned int pendingConsumers;
+		/// Parameter version.
+		unsigned int paramVersion;
+		/// Profiler.
+		Ionflux::GeoUtils::TransformNodes::Profiler* profiler;
 		
 		/** Process inputs.
 		 *
@@ -99,6 +113,62 @@ class TransformNode
 		 */
 		virtual void process();
 		
+		/** Update versions.
+		 *
+		 * Record the current parameter version, the input node specifications
+		 * and the update counters of the input nodes. This is called by
+		 * update() after the inputs have been processed.
+		 */
+		virtual void updateVersions();
+		
+		/** Get number of input items.
+		 *
+		 * Get the total number of items in the input groups that are 
+		 * currently in the input cache.
+		 *
+		 * \return Number of input items.
+		 */
+		virtual unsigned int getNumInputItems() const;
+		
+		/** Get copy mutex.
+		 *
+		 * Get the mutex that serializes copying and releasing input groups
+		 * while nodes are updated concurrently (see
+		 * TransformGraph::updateParallel()). Copies of items may share data
+		 * with the original items, such as the vertex source of a polygon, so
+		 * the reference counts of the shared data must not be modified by
+		 * several threads at the same time.
+		 *
+		 * \return Copy mutex.
+		 */
+		static pthread_mutex_t* getCopyMutex();
+		
+		/** Duplicate input group.
+		 *
+		 * Create a copy of an input group. If the update of the node has been
+		 * scheduled, the copy is created while holding the copy mutex (see
+		 * getCopyMutex()), since other consumers of the group may be updated at
+		 * the same time.
+		 *
+		 * \param group Input group.
+		 *
+		 * \return Copy of the input group.
+		 */
+		virtual Ionflux::GeoUtils::TransformableGroup*
+		duplicateInput(Ionflux::GeoUtils::TransformableGroup& group);
+		
+		/** Copy item vertices.
+		 *
+		 * Give each polygon and mesh within the group (including nested groups)
+		 * its own copy of its vertex source. This should be used for copies of
+		 * groups that are handed to another thread, since the reference counts
+		 * of shared vertex sources are not synchronized.
+		 *
+		 * \param group Group.
+		 */
+		static void copyItemVertices(Ionflux::GeoUtils::TransformableGroup&
+		group);
+		
 	public:
 		/// Default maximum loop count.
 		static const unsigned int DEFAULT_LOOP_MAX;
@@ -167,21 +237,30 @@ class TransformNode
 		
 		/** Clear input group cache.
 		 *
-		 * Clear the input group cache.
+		 * Clear the input group cache. If the update of the node has been
+		 * scheduled, the input groups are released while holding the copy
+		 * mutex (see getCopyMutex()).
 		 */
 		virtual void clearInputCache();
 		
 		/** Update inputs.
 		 *
-		 * Update the inputs of the node. Each input node is updated only 
-		 * once, no matter how many of its outputs are connected to this node.
+		 * Update the inputs of the node. Each input node is updated only once,
+		 * no matter how many of its outputs are connected to this node. If the
+		 * update of the node has been scheduled (see
+		 * TransformGraph::update()), the input nodes are not updated, since
+		 * they have already been updated by the scheduler. Output groups of
+		 * input nodes that still have other pending consumers are duplicated
+		 * before they are added to the input cache, because nodes may modify
+		 * their input groups.
 		 */
 		virtual void updateInputs();
 		
 		/** Clear input Groups.
 		 *
-		 * Clear the input groups, that is the output groups of the input 
-		 * nodes.
+		 * Clear the input groups, that is the output groups of the input
+		 * nodes. The outputs of input nodes that still have other pending
+		 * consumers are kept until the last consumer has been updated.
 		 */
 		virtual void clearInputGroups();
 		
@@ -193,14 +272,17 @@ class TransformNode
 		
 		/** Update.
 		 *
-		 * Update the outputs of the node. This updates all inputs and checks 
+		 * Update the outputs of the node. This updates all inputs and checks
 		 * the loop counter to make sure the maximum number of loop iterations
 		 * is not exceeded. It clears the output groups and calls process() to
-		 * do the actual processing of the inputs. Note that a transform node 
-		 * does not have outputs unless update() has been called and finished 
-		 * processing at least once. Outputs are considered a cache rather 
-		 * than state of the object (they are also not copied when using an 
-		 * assignment or copy constructor). See the spec for details.
+		 * do the actual processing of the inputs. Note that a transform node
+		 * does not have outputs unless update() has been called and finished
+		 * processing at least once. Outputs are considered a cache rather than
+		 * state of the object (they are also not copied when using an
+		 * assignment or copy constructor). The parameter version and the
+		 * update counters of the input nodes are recorded after processing
+		 * (see isDirty()). If a profiler is set, the update is reported to the
+		 * profiler. See the spec for details.
 		 */
 		virtual void update();
 		
@@ -212,6 +294,90 @@ class TransformNode
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes
+		 * by a parallel graph update (see TransformGraph::update()). A
+		 * thread-safe node must not modify any state that is shared with other
+		 * nodes, apart from its own outputs and the input groups it has been
+		 * given. Nodes that are not thread-safe are updated one at a time by
+		 * the thread that updates the graph.
+		 *
+		 * \return \c true if the node is thread-safe, \c false otherwise.
+		 */
+		virtual bool isThreadSafe() const;
+		
+		/** Shared items check.
+		 *
+		 * Check whether the output groups of the node may share items with
+		 * other groups (see TransformableGroup::instance()). Shared items are
+		 * reference counted without synchronization, so a parallel graph update
+		 * does not update nodes that depend on such a node concurrently.
+		 *
+		 * \return \c true if output groups may share items, \c false otherwise.
+		 */
+		virtual bool sharesItems() const;
+		
+		/** Create clone.
+		 *
+		 * Create a clone of the node that can be updated independently of the
+		 * node. The clone is a copy of the node (see copy()). The node and its
+		 * clone are added to the node map, and inputs of the clone that refer
+		 * to nodes which have already been cloned are redirected to the clones
+		 * of these nodes (see remapInputs()). The clone is a new object which
+		 * must be managed by the caller.
+		 *
+		 * \param nodeMap Map of nodes to their clones.
+		 *
+		 * \return Clone of the node.
+		 */
+		virtual Ionflux::GeoUtils::TransformNodes::TransformNode*
+		createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap) const;
+		
+		/** Remap inputs.
+		 *
+		 * Redirect each input of the node that refers to a node in the node map
+		 * to the node it is mapped to.
+		 *
+		 * \param nodeMap Map of nodes to their clones.
+		 */
+		virtual void remapInputs(const Ionflux::GeoUtils::TransformNodeMap&
+		nodeMap);
+		
+		/** Touch.
+		 *
+		 * Mark the parameters of the node as changed by incrementing the
+		 * parameter version. The property setters of transform nodes, and thus
+		 * setParam(), do this automatically. If a node depends on state that is
+		 * changed in other ways, for example a mapping that is modified after
+		 * it has been assigned to the node, touch() should be called so the
+		 * node is updated by an incremental graph update (see
+		 * TransformGraph::update()).
+		 */
+		virtual void touch();
+		
+		/** Dirty check.
+		 *
+		 * Check whether the outputs of the node need to be updated. This is the
+		 * case if the node has never been updated, has no outputs, or if the
+		 * parameter version, the input node specifications or the update
+		 * counter of any input node have changed since the last update.
+		 *
+		 * \return \c true if the node needs to be updated, \c false otherwise.
+		 */
+		virtual bool isDirty() const;
+		
+		/** Get total parameter version.
+		 *
+		 * Get the parameter version of the node, including the parameter
+		 * versions of any nodes that are used internally by the node. The total
+		 * parameter version changes whenever a parameter of the node or of one
+		 * of its internal nodes changes.
+		 *
+		 * \return Total parameter version.
+		 */
+		virtual unsigned int getTotalParamVersion() const;
+		
 		/** Get debugging information.
 		 *
 		 * Get a representation of the node and its contents that is usable 
@@ -468,6 +634,67 @@ class TransformNode
 		 * \param newUpdateCounter New value of update counter.
 		 */
 		virtual void setUpdateCounter(unsigned int newUpdateCounter);
+		
+		/** Get scheduled update flag.
+		 *
+		 * \return Current value of scheduled update flag.
+		 */
+		virtual bool getScheduled() const;
+		
+		/** Set scheduled update flag.
+		 *
+		 * Set new value of scheduled update flag.
+		 *
+		 * \param newScheduled New value of scheduled update flag.
+		 */
+		virtual void setScheduled(bool newScheduled);
+		
+		/** Get number of scheduled consumers that have not yet processed the outputs.
+		 *
+		 * \return Current value of number of scheduled consumers that have not 
+		 * yet processed the outputs.
+		 */
+		virtual unsigned int getPendingConsumers() const;
+		
+		/** Set number of scheduled consumers that have not yet processed the outputs.
+		 *
+		 * Set new value of number of scheduled consumers that have not yet 
+		 * processed the outputs.
+		 *
+		 * \param newPendingConsumers New value of number of scheduled 
+		 * consumers that have not yet processed the outputs.
+		 */
+		virtual void setPendingConsumers(unsigned int newPendingConsumers);
+		
+		/** Get parameter version.
+		 *
+		 * \return Current value of parameter version.
+		 */
+		virtual unsigned int getParamVersion() const;
+		
+		/** Set parameter version.
+		 *
+		 * Set new value of parameter version.
+		 *
+		 * \param newParamVersion New value of parameter version.
+		 */
+		virtual void setParamVersion(unsigned int newParamVersion);
+		
+		/** Get profiler.
+		 *
+		 * \return Current value of profiler.
+		 */
+		virtual Ionflux::GeoUtils::TransformNodes::Profiler* getProfiler() 
+		const;
+		
+		/** Set profiler.
+		 *
+		 * Set new value of profiler.
+		 *
+		 * \param newProfiler New value of profiler.
+		 */
+		virtual void setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler* 
+		newProfiler);
 };
 
 }
@@ -73,6 +73,8 @@ class TransformableGroup
 	protected:
 		/// Item vector.
 		std::vector<Ionflux::GeoUtils::TransformableObject*> items;
+		/// Shared items.
+		Ionflux::GeoUtils::SharedItemMap sharedItems;
 		
 		/** Recalculate bounds.
 		 *
@@ -80,6 +82,25 @@ class TransformableGroup
 		 */
 		virtual void recalculateBounds();
 		
+		/** Release shared items.
+		 *
+		 * Remove the shared references of this group from the shared items that
+		 * are still contained in the group.
+		 */
+		virtual void releaseSharedItems();
+		
+		/** Release shared item.
+		 *
+		 * Remove the shared references of this group from the specified item
+		 * that exceed the number of times the item is still contained in the
+		 * group. This should be called whenever an item is removed from the
+		 * group.
+		 *
+		 * \param item Item.
+		 */
+		virtual void releaseSharedItem(Ionflux::GeoUtils::TransformableObject*
+		item);
+		
 	public:
 		/// Class information instance.
 		static const TransformableGroupClassInfo transformableGroupClassInfo;
@@ -118,7 +139,10 @@ class TransformableGroup
 		 *
 		 * Apply transformations that have been accumulated in the 
 		 * transformation matrices. The tolerance is used to compare matrices 
-		 * against the identity matrix and avoid unnecessary transformations.
+		 * against the identity matrix and avoid unnecessary transformations. 
+		 * Items that are shared with other groups are detached before the 
+		 * transformations are applied, so the transformations do not affect 
+		 * other instances (see detachItems()).
 		 *
 		 * \param recursive Apply transformations recursively.
 		 */
@@ -224,6 +248,21 @@ class TransformableGroup
 		Ionflux::GeoUtils::Matrix4& view, const Ionflux::GeoUtils::Matrix4* image
 		= 0);
 		
+		/** Transform items.
+		 *
+		 * Apply a separate transformation to each item of the group. Item \c i
+		 * is transformed by the instance transformation with index \c i (see
+		 * InstanceTransforms). The translation, scaling and centering are
+		 * combined into a single matrix for each item, which is added to the
+		 * deferred transformations of the item. The item data is transformed
+		 * only when the transformations are applied. Items that are shared
+		 * with other objects are copied first (see detachItems()).
+		 *
+		 * \param transforms Instance transforms.
+		 */
+		virtual void transformItems(const Ionflux::GeoUtils::InstanceTransforms&
+		transforms);
+		
 		/** Duplicate.
 		 *
 		 * Create an exact duplicate of the object. The duplicate is a new 
@@ -233,6 +272,46 @@ class TransformableGroup
 		 */
 		virtual Ionflux::GeoUtils::TransformableGroup& duplicate();
 		
+		/** Create instance.
+		 *
+		 * Create an instance of the group. The instance is a new group that
+		 * shares the items of this group (see addSharedItem()) and has its own
+		 * copy of the group transformations. Shared items are copied only when they are about to
+		 * be modified (see applyTransform()), so creating an instance is cheap
+		 * even for groups with a large number of items. The instance is a new
+		 * object which must be managed by the caller.
+		 *
+		 * \return The new instance.
+		 */
+		virtual Ionflux::GeoUtils::TransformableGroup& instance();
+		
+		/** Add shared item.
+		 *
+		 * Add an item that is shared with other groups. The item is not
+		 * modified by this group. Instead, it is replaced by a copy when the
+		 * items of this group are about to be modified (see detachItems()).
+		 * Groups that own the item copy it as well before they modify it, so
+		 * modifications of either group do not affect the other.
+		 *
+		 * \param addElement Item.
+		 */
+		virtual void addSharedItem(Ionflux::GeoUtils::TransformableObject*
+		addElement);
+		
+		/** Detach items.
+		 *
+		 * Replace each item that is shared with other groups by a copy of that
+		 * item, so the item can be modified without affecting other instances.
+		 * An item is shared if it has been added to this group by
+		 * addSharedItem(), or if another group has added it that way. Groups
+		 * are replaced by instances of the groups, which means their own items
+		 * are not copied until they are modified as well. Other items are left
+		 * untouched, even if they are referenced by other objects.
+		 *
+		 * \return Number of items that have been copied.
+		 */
+		virtual unsigned int detachItems();
+		
 		/** Flatten hierarchy.
 		 *
 		 * Flatten the hierarchy starting at this group by finding all leaf 
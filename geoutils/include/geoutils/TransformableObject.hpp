@@ -74,6 +74,8 @@ class TransformableObject
 	protected:
 		/// Bounds cache.
 		Ionflux::GeoUtils::Range3* boundsCache;
+		/// Number of shared references.
+		unsigned int numShares;
 		/// Deferred transformation.
 		Ionflux::GeoUtils::DeferredTransform* deferredTransform;
 		
@@ -374,6 +376,30 @@ class TransformableObject
 		 */
 		virtual Ionflux::GeoUtils::TransformableObject& duplicate();
 		
+		/** Add shared reference.
+		 *
+		 * Record that the object is referenced by a group that shares it with
+		 * other groups (see TransformableGroup::addSharedItem()). Groups that
+		 * share the object do not modify it, but replace it by a copy before it
+		 * is modified (see TransformableGroup::detachItems()).
+		 */
+		virtual void addShare();
+		
+		/** Remove shared reference.
+		 *
+		 * Record that a group no longer shares the object.
+		 */
+		virtual void removeShare();
+		
+		/** Get number of shared references.
+		 *
+		 * Get the number of groups that share the object. The object must not
+		 * be modified in place if this is not zero.
+		 *
+		 * \return Number of shared references.
+		 */
+		virtual unsigned int getNumShares() const;
+		
 		/** Get transformation matrix.
 		 *
 		 * Get the current transformation matrix. If the deferred 
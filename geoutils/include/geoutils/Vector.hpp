@@ -91,6 +91,13 @@ class Vector
 		virtual void initElements();
 		
 	public:
+	    // Friend classes.
+	    friend class Vec2;
+	    friend class Vec3;
+	    friend class Vec4;
+	    friend class Mat3;
+	    friend class Mat4;
+	    
 		/// Number of elements.
 		static const unsigned int NUM_ELEMENTS;
 		/// Class information instance.
@@ -122,6 +122,24 @@ class Vector3Mapping
 		 */
 		virtual std::string getString() const;
 		
+		/** Evaluate the mapping (batch).
+		 *
+		 * Evaluate the mapping with each of the specified parameters and store
+		 * the components of the resulting vectors in the target vectors, which
+		 * are resized to the number of parameters. Mappings that can evaluate a
+		 * whole vector of parameters more efficiently than one parameter at a
+		 * time may override this.
+		 *
+		 * \param values Values.
+		 * \param targetX Where to store the X components.
+		 * \param targetY Where to store the Y components.
+		 * \param targetZ Where to store the Z components.
+		 */
+		virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+		values, Ionflux::ObjectBase::DoubleVector& targetX,
+		Ionflux::ObjectBase::DoubleVector& targetY,
+		Ionflux::ObjectBase::DoubleVector& targetZ) const;
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
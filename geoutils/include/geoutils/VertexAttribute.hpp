@@ -49,6 +49,7 @@ namespace GeoUtils
 class Vertex3Set;
 class VectorSet;
 class Mesh;
+class CompactMesh;
 
 /// Class information for class VertexAttribute.
 class VertexAttributeClassInfo
@@ -73,6 +74,8 @@ class VertexAttribute
 	private:
 		
 	protected:
+		/// Number of exported buffer references.
+		unsigned int numBufferRefs;
 		/// Data buffer.
 		GLvoid* data;
 		/// Data buffer size.
@@ -88,6 +91,15 @@ class VertexAttribute
 		/// Normalized flag.
 		bool normalized;
 		
+		/** Check buffer references.
+		 *
+		 * Check whether the data of the object can be reallocated. An exception
+		 * is thrown if the data is referenced by an exported buffer.
+		 *
+		 * \param source Source function.
+		 */
+		void checkBufferRefs(const std::string& source) const;
+		
 		/** Set data buffer.
 		 *
 		 * Set new value of data buffer.
@@ -145,6 +157,8 @@ class VertexAttribute
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_DATA;
 		/// Vertex attribute type: index.
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_INDEX;
+		/// Vertex attribute type: normal.
+		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_NORMAL;
 		/// Class information instance.
 		static const VertexAttributeClassInfo vertexAttributeClassInfo;
 		/// Class information.
@@ -332,6 +346,30 @@ class VertexAttribute
 		Ionflux::GeoUtils::NFace::TYPE_FACE, Ionflux::GeoUtils::FaceDataTypeID 
 		faceDataType = FaceData::TYPE_VERTEX_NORMAL);
 		
+		/** Set data (compact mesh).
+		 *
+		 * Set the data for the vertex attribute from a compact tri-mesh. \c
+		 * attrType determines what subset of data from the mesh is assigned to
+		 * the vertex attribute. If \c attrType is \c TYPE_DATA, the \c
+		 * faceDataType parameter determines the attribute channel that is
+		 * assigned to the vertex attribute. This function creates one vertex
+		 * attribute element per face vertex, i.e. vertices are duplicated for
+		 * each face. The data is copied directly from the arrays of the compact
+		 * mesh. An exception will be thrown if \c mesh is not a tri-mesh.
+		 *
+		 * \param mesh compact mesh.
+		 * \param attrType vertex attribute type.
+		 * \param nFaceType N-face type.
+		 * \param faceDataType face data type.
+		 *
+		 * \return number of vertex attribute elements that were created.
+		 */
+		virtual unsigned int setData(const Ionflux::GeoUtils::CompactMesh& mesh,
+		Ionflux::GeoUtils::VertexAttributeTypeID attrType = TYPE_POSITION,
+		Ionflux::GeoUtils::NFaceTypeID nFaceType =
+		Ionflux::GeoUtils::NFace::TYPE_FACE, Ionflux::GeoUtils::FaceDataTypeID
+		faceDataType = FaceData::TYPE_VERTEX_NORMAL);
+		
 		/** Get data (float).
 		 *
 		 * Get the data value with the specified element and component index.
@@ -431,6 +469,30 @@ class VertexAttribute
 		virtual void draw(Ionflux::GeoUtils::PrimitiveID primitiveID, unsigned 
 		int drawNumPrimitives = 0, unsigned int startIndex = 0);
 		
+		/** Add buffer reference.
+		 *
+		 * Record that the data of the object is referenced by an exported
+		 * buffer. The data cannot be reallocated until the reference is
+		 * removed.
+		 */
+		virtual void addBufferRef();
+		
+		/** Remove buffer reference.
+		 *
+		 * Record that an exported buffer no longer references the data of the
+		 * object.
+		 */
+		virtual void removeBufferRef();
+		
+		/** Get number of buffer references.
+		 *
+		 * Get the number of exported buffers that reference the data of the
+		 * object.
+		 *
+		 * \return Number of buffer references.
+		 */
+		virtual unsigned int getNumBufferRefs() const;
+		
 		/** Get string representation of value.
 		 *
 		 * Get a string representation of the value of the object.
@@ -0,0 +1,373 @@
+#ifndef IONFLUX_GEOUTILS_VERTEXTREE
+#define IONFLUX_GEOUTILS_VERTEXTREE
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * VertexTree.hpp                  Vertex tree (header).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Vector3;
+class Vertex3Set;
+
+/// Class information for class VertexTree.
+class VertexTreeClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		VertexTreeClassInfo();
+		/// Destructor.
+		virtual ~VertexTreeClassInfo();
+};
+
+/** Vertex tree.
+ * \ingroup geoutils
+ *
+ * A k-d tree over the positions of the vertices of a vertex set, for
+ * nearest neighbor and radius queries. The tree is stored implicitly in
+ * a flat array of vertex indices: each index range is split at its
+ * median along the axis of largest extent, with the median vertex in the
+ * middle of the range. Ranges with at most maxLeafVertices vertices are
+ * leaves. The tree is built in parallel for large vertex sets. The tree
+ * does not track changes to the vertex set, so it has to be updated
+ * whenever the vertices change.
+ */
+class VertexTree
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+		
+	protected:
+		/// Vertex coordinates (x, y, z for each vertex).
+		Ionflux::ObjectBase::DoubleVector coords;
+		/// Vertex indices (in tree order).
+		Ionflux::ObjectBase::UIntVector indices;
+		/// Split axes (in tree order).
+		Ionflux::ObjectBase::UInt8Vector splitAxes;
+		/// Maximum number of vertices per leaf.
+		unsigned int maxLeafVertices;
+		
+		/** Get squared distance.
+		 *
+		 * Get the squared distance of a vertex from a point.
+		 *
+		 * \param vertexIndex Vertex index.
+		 * \param p Point coordinates.
+		 *
+		 * \return Squared distance.
+		 */
+		double getSquaredDistance(unsigned int vertexIndex, const double* p)
+		const;
+		
+		/** Select median.
+		 *
+		 * Partially sort the vertex index range from \c first to \c last so
+		 * that the vertex at index \c mid has the coordinate it would have if
+		 * the range were sorted along the specified axis, all vertices before
+		 * it have smaller or equal coordinates, and all vertices after it have
+		 * greater or equal coordinates.
+		 *
+		 * \param first Index of the first vertex.
+		 * \param mid Index of the median vertex.
+		 * \param last Index after the last vertex.
+		 * \param axis Axis.
+		 */
+		virtual void selectMedian(unsigned int first, unsigned int mid, unsigned
+		int last, Ionflux::GeoUtils::AxisID axis);
+		
+		/** Build range.
+		 *
+		 * Build the subtree for the specified vertex index range. The range is
+		 * split at the median along the axis of largest extent. Subtrees are
+		 * built in parallel up to the specified depth if the range is large
+		 * enough.
+		 *
+		 * \param first Index of the first vertex.
+		 * \param last Index after the last vertex.
+		 * \param parallelDepth Number of levels that may be built in parallel.
+		 */
+		virtual void buildRange(unsigned int first, unsigned int last, unsigned
+		int parallelDepth);
+		
+		/** Build range (task).
+		 *
+		 * Build the subtree for the specified task. This can be used as a
+		 * thread start function. Errors are recorded in the task.
+		 *
+		 * \param taskArg Vertex tree build task.
+		 *
+		 * \return Thread result.
+		 */
+		static void* buildTask(void* taskArg);
+		
+		/** Add candidate.
+		 *
+		 * Add a vertex to the set of the \c k nearest vertices found so far.
+		 * The set is maintained as a heap with the most distant vertex at the
+		 * front.
+		 *
+		 * \param vertexIndex Vertex index.
+		 * \param p Point coordinates.
+		 * \param k Number of vertices.
+		 * \param heap Nearest vertices found so far.
+		 */
+		void addCandidate(unsigned int vertexIndex, const double* p, unsigned
+		int k, Ionflux::GeoUtils::VertexTreeEntryVector& heap) const;
+		
+		/** Search nearest vertices.
+		 *
+		 * Search the subtree for the specified vertex index range for the \c k
+		 * nearest vertices. The near side of each split is searched first. The
+		 * far side is skipped if it cannot contain a vertex that is closer than
+		 * the current \c k nearest vertices by more than the factor \c f (which
+		 * is the squared approximation factor).
+		 *
+		 * \param first Index of the first vertex.
+		 * \param last Index after the last vertex.
+		 * \param p Point coordinates.
+		 * \param k Number of vertices.
+		 * \param f Squared approximation factor.
+		 * \param heap Nearest vertices found so far.
+		 */
+		virtual void searchNearest(unsigned int first, unsigned int last, const
+		double* p, unsigned int k, double f,
+		Ionflux::GeoUtils::VertexTreeEntryVector& heap) const;
+		
+		/** Search vertices within radius.
+		 *
+		 * Search the subtree for the specified vertex index range for vertices
+		 * within the specified squared distance from a point.
+		 *
+		 * \param first Index of the first vertex.
+		 * \param last Index after the last vertex.
+		 * \param p Point coordinates.
+		 * \param r2 Squared radius.
+		 * \param target Where to store the vertex indices.
+		 * \param distances Where to store the distances.
+		 */
+		virtual void searchRadius(unsigned int first, unsigned int last, const
+		double* p, double r2, Ionflux::ObjectBase::UIntVector& target,
+		Ionflux::ObjectBase::DoubleVector* distances) const;
+		
+	public:
+		/// Class information instance.
+		static const VertexTreeClassInfo vertexTreeClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+		
+		/** Constructor.
+		 *
+		 * Construct new VertexTree object.
+		 */
+		VertexTree();
+		
+		/** Constructor.
+		 *
+		 * Construct new VertexTree object.
+		 *
+		 * \param other Other object.
+		 */
+		VertexTree(const Ionflux::GeoUtils::VertexTree& other);
+		
+		/** Destructor.
+		 *
+		 * Destruct VertexTree object.
+		 */
+		virtual ~VertexTree();
+		
+		/** Clear.
+		 *
+		 * Remove all vertices from the tree.
+		 */
+		virtual void clear();
+		
+		/** Update.
+		 *
+		 * Build the tree from the vertices of a vertex set. Existing vertices
+		 * are removed. The vertex positions are copied, so the tree does not
+		 * track changes to the vertex set. Vertices are identified by their
+		 * index within the vertex set. Subtrees are built in parallel using up
+		 * to numThreads threads. If numThreads is 0, the number of available
+		 * processors is used.
+		 *
+		 * \param vertices Vertex set.
+		 * \param newMaxLeafVertices Maximum number of vertices per leaf.
+		 * \param numThreads Number of threads.
+		 *
+		 * \return Number of vertices.
+		 */
+		virtual unsigned int update(Ionflux::GeoUtils::Vertex3Set* vertices,
+		unsigned int newMaxLeafVertices =
+		Ionflux::GeoUtils::DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES, unsigned int
+		numThreads = 0);
+		
+		/** Find nearest vertex.
+		 *
+		 * Find the vertex that is nearest to the specified point. If \c eps is
+		 * greater than zero, an approximate search is performed, which returns
+		 * a vertex whose distance from the point is at most (1 + eps) times the
+		 * distance of the nearest vertex. Approximate searches visit fewer
+		 * nodes.
+		 *
+		 * \param p Point.
+		 * \param eps Approximation tolerance.
+		 *
+		 * \return Index of the nearest vertex, or -1 if the tree is empty.
+		 */
+		virtual int findNearest(const Ionflux::GeoUtils::Vector3& p, double eps
+		= 0.) const;
+		
+		/** Find k nearest vertices.
+		 *
+		 * Find the \c k vertices that are nearest to the specified point. The
+		 * vertex indices are appended to the target vector, ordered by
+		 * increasing distance. If \c distances is specified, the distances of
+		 * the vertices are appended to that vector. If \c eps is greater than
+		 * zero, an approximate search is performed (see findNearest()).
+		 *
+		 * \param p Point.
+		 * \param k Number of vertices.
+		 * \param target Where to store the vertex indices.
+		 * \param distances Where to store the distances.
+		 * \param eps Approximation tolerance.
+		 *
+		 * \return Number of vertices that have been added.
+		 */
+		virtual unsigned int findKNearest(const Ionflux::GeoUtils::Vector3& p,
+		unsigned int k, Ionflux::ObjectBase::UIntVector& target,
+		Ionflux::ObjectBase::DoubleVector* distances = 0, double eps = 0.)
+		const;
+		
+		/** Find vertices within radius.
+		 *
+		 * Find all vertices within the specified distance from a point. The
+		 * vertex indices are appended to the target vector in no particular
+		 * order. If \c distances is specified, the distances of the vertices
+		 * are appended to that vector.
+		 *
+		 * \param p Point.
+		 * \param r Radius.
+		 * \param target Where to store the vertex indices.
+		 * \param distances Where to store the distances.
+		 *
+		 * \return Number of vertices that have been added.
+		 */
+		virtual unsigned int findInRadius(const Ionflux::GeoUtils::Vector3& p,
+		double r, Ionflux::ObjectBase::UIntVector& target,
+		Ionflux::ObjectBase::DoubleVector* distances = 0) const;
+		
+		/** Get number of vertices.
+		 *
+		 * Get the number of vertices in the tree.
+		 *
+		 * \return Number of vertices.
+		 */
+		virtual unsigned int getNumVertices() const;
+		
+		/** Get maximum number of vertices per leaf.
+		 *
+		 * Get the maximum number of vertices per leaf.
+		 *
+		 * \return Maximum number of vertices per leaf.
+		 */
+		virtual unsigned int getMaxLeafVertices() const;
+		
+		/** Get string representation of value.
+		 *
+		 * Get a string representation of the value of the object.
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getValueString() const;
+		
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::GeoUtils::VertexTree& operator=(const
+		Ionflux::GeoUtils::VertexTree& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::GeoUtils::VertexTree* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::GeoUtils::VertexTree*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::GeoUtils::VertexTree*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+/** \file VertexTree.hpp
+ * \brief Vertex tree (header).
+ */
+#endif
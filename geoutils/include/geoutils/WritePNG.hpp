@@ -154,6 +154,16 @@ class WritePNG
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node renders to an image and writes to a file, so it is never
+		 * updated concurrently with other nodes.
+		 *
+		 * \return \c false.
+		 */
+		virtual bool isThreadSafe() const;
+		
 		/** Add styles.
 		 *
 		 * Add styles for rendering.
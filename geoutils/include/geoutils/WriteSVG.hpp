@@ -87,6 +87,10 @@ class WriteSVG
 		unsigned int originY;
 		/// SVG template.
 		std::string svgTemplate;
+		/// Coalesce paths.
+		bool coalescePaths;
+		/// Number of decimal places for coordinates.
+		unsigned int precision;
 		
 		/** Process inputs.
 		 *
@@ -160,6 +164,16 @@ class WriteSVG
 		 */
 		virtual std::string getString() const;
 		
+		/** Thread safety check.
+		 *
+		 * Check whether the node can be updated concurrently with other nodes.
+		 * The node writes to a file, so it is never updated concurrently with
+		 * other nodes.
+		 *
+		 * \return \c false.
+		 */
+		virtual bool isThreadSafe() const;
+		
 		/** Add styles.
 		 *
 		 * Add styles for rendering.
@@ -425,6 +439,35 @@ class WriteSVG
 		 * \param newSvgTemplate New value of sVG template.
 		 */
 		virtual void setSvgTemplate(const std::string& newSvgTemplate);
+		
+		/** Get coalesce paths.
+		 *
+		 * \return Current value of coalesce paths.
+		 */
+		virtual bool getCoalescePaths() const;
+		
+		/** Set coalesce paths.
+		 *
+		 * Set new value of coalesce paths.
+		 *
+		 * \param newCoalescePaths New value of coalesce paths.
+		 */
+		virtual void setCoalescePaths(bool newCoalescePaths);
+		
+		/** Get number of decimal places for coordinates.
+		 *
+		 * \return Current value of number of decimal places for coordinates.
+		 */
+		virtual unsigned int getPrecision() const;
+		
+		/** Set number of decimal places for coordinates.
+		 *
+		 * Set new value of number of decimal places for coordinates.
+		 *
+		 * \param newPrecision New value of number of decimal places for 
+		 * coordinates.
+		 */
+		virtual void setPrecision(unsigned int newPrecision);
 };
 
 }
@@ -167,6 +167,22 @@ const Ionflux::GeoUtils::SVGShapeStyle DEFAULT_SHAPE_STYLE = {
     "#20e045", 0.533, "#0e1723", 1., 1., 4., "none", DEFAULT_SHAPE_TYPE, true
 };
 
+/// Render backend: cairo.
+const Ionflux::GeoUtils::RenderBackendID RENDER_BACKEND_CAIRO = 0;
+/// Render backend: tiled scanline rasterizer.
+const Ionflux::GeoUtils::RenderBackendID RENDER_BACKEND_SCANLINE = 1;
+/// Default raster tile size (pixels).
+const unsigned int DEFAULT_RASTER_TILE_SIZE = 64;
+
+/// Default number of decimal places for SVG coordinates.
+const unsigned int DEFAULT_SVG_PRECISION = 3;
+/// Maximum number of decimal places for SVG coordinates.
+const unsigned int SVG_WRITER_MAX_PRECISION = 17;
+/// SVG writer buffer size (bytes).
+const unsigned int SVG_WRITER_BUFFER_SIZE = 65536;
+/// Minimum number of polygons for using the streaming SVG writer.
+const unsigned int SVG_WRITER_MIN_POLYGONS = 10000;
+
 /// Coordinate index: not set.
 const unsigned int COORDINATE_NOT_SET = UINT_MAX;
 
@@ -182,6 +198,38 @@ const Ionflux::GeoUtils::QuadInterpolationTypeID
 const Ionflux::GeoUtils::QuadInterpolationTypeID 
     QUAD_INTERPOLATION_BILINEAR = 1;
 
+/// Default number of bins for surface area heuristic splits.
+const unsigned int DEFAULT_SAH_NUM_BINS = 16;
+/// Default maximum number of items per leaf for surface area heuristic splits.
+const unsigned int DEFAULT_SAH_MAX_LEAF_ITEMS = 4;
+/// Minimum number of items for building a subtree in a separate thread.
+const unsigned int SAH_PARALLEL_MIN_ITEMS = 4096;
+/// Default maximum surface area ratio for refitting without rotations.
+const double DEFAULT_REFIT_MAX_AREA_RATIO = 1.25;
+/// Default maximum number of vertices per vertex tree leaf.
+const unsigned int DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES = 8;
+/// Minimum number of vertices for building a subtree in a separate thread.
+const unsigned int VERTEX_TREE_PARALLEL_MIN_VERTICES = 8192;
+/// Half-edge index: none.
+const unsigned int HALF_EDGE_NONE = UINT_MAX;
+/// Minimum number of half-edges for matching edges in parallel.
+const unsigned int MESH_ADJACENCY_PARALLEL_MIN_HALF_EDGES = 65536;
+/// Minimum number of vertices for transforming vertices in parallel.
+const unsigned int VERTEX_TRANSFORM_PARALLEL_MIN_VERTICES = 65536;
+/// Minimum file size for parsing OBJ files in parallel.
+const unsigned int OBJ_PARSE_PARALLEL_MIN_BYTES = 4194304;
+/// Mesh I/O buffer size.
+const unsigned int MESH_IO_BUFFER_SIZE = 1048576;
+/// Minimum number of faces for updating mesh geometry in parallel.
+const unsigned int MESH_UPDATE_PARALLEL_MIN_FACES = 8192;
+
+/// Box bounds tree query: all intersected items.
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_ALL = 0;
+/// Box bounds tree query: closest intersected item.
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_FIRST = 1;
+/// Box bounds tree query: any intersected item.
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_ANY = 2;
+
 namespace TransformNodes
 {
 
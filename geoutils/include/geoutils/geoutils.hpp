@@ -43,6 +43,7 @@
 #include "geoutils/Matrix3.hpp"
 #include "geoutils/Vector4.hpp"
 #include "geoutils/Matrix4.hpp"
+#include "geoutils/vecmath.hpp"
 #include "geoutils/VectorSet.hpp"
 #include "geoutils/FaceData.hpp"
 #include "geoutils/VectorSetSet.hpp"
@@ -56,6 +57,7 @@
 #include "geoutils/LinearInterpolator.hpp"
 #include "geoutils/Vertex3Set.hpp"
 #include "geoutils/Vertex3.hpp"
+#include "geoutils/VertexTree.hpp"
 #include "geoutils/Plane3.hpp"
 #include "geoutils/Polygon3.hpp"
 #include "geoutils/Polygon3Set.hpp"
@@ -81,12 +83,16 @@
 #include "geoutils/BoxBoundsItemCompareDistancePlane3.hpp"
 #include "geoutils/ItemSource.hpp"
 #include "geoutils/BoundingBox.hpp"
+#include "geoutils/BoxBoundsTree.hpp"
 #include "geoutils/Camera.hpp"
 #include "geoutils/Vertex.hpp"
 #include "geoutils/Face.hpp"
 #include "geoutils/NFace.hpp"
 #include "geoutils/NFaceSet.hpp"
 #include "geoutils/Mesh.hpp"
+#include "geoutils/CompactMesh.hpp"
+#include "geoutils/MeshAdjacency.hpp"
+#include "geoutils/meshio.hpp"
 #include "geoutils/mappings.hpp"
 #include "geoutils/transformnodes.hpp"
 #include "geoutils/Vector3MappingSet.hpp"
@@ -0,0 +1,273 @@
+#ifndef IONFLUX_GEOUTILS_MESHIO
+#define IONFLUX_GEOUTILS_MESHIO
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2013 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * meshio.hpp                     Mesh I/O functions (header).
+ * =========================================================================
+ *
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 2 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+#include <string>
+#include "ifobject/types.hpp"
+#include "geoutils/types.hpp"
+#include "geoutils/constants.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Mesh;
+class CompactMesh;
+
+/** Parse floating point number.
+ *
+ * Parse a floating point number from a character range that does not
+ * need to be null-terminated. Numbers with up to 15 significant digits
+ * and a decimal exponent of at most 22 are converted directly (and
+ * exactly). Other numbers are converted using strtod().
+ *
+ * \param first First character.
+ * \param last End of the character range.
+ * \param target Where to store the number.
+ *
+ * \return Pointer to the first character after the number, or \c first
+ * if no number could be parsed.
+ */
+const char* parseDouble(const char* first, const char* last,
+    double& target);
+
+/** Append floating point number.
+ *
+ * Append a floating point number in fixed notation with the specified
+ * number of decimal places to a string. The result is the same as for
+ * an output stream with \c std::fixed and \c std::setprecision().
+ *
+ * \param target Where to append the number.
+ * \param value Value.
+ * \param precision Number of decimal places.
+ */
+void appendDouble(std::string& target, double value,
+    unsigned int precision = 6);
+
+/** Append unsigned integer.
+ *
+ * Append an unsigned integer to a string.
+ *
+ * \param target Where to append the number.
+ * \param value Value.
+ */
+void appendUInt(std::string& target, unsigned int value);
+
+/** Little endian check.
+ *
+ * Check whether the host byte order is little endian.
+ *
+ * \return \c true if the host byte order is little endian, \c false
+ * otherwise.
+ */
+bool isLittleEndian();
+
+/** Map file.
+ *
+ * Map a file into memory for reading. If the file cannot be mapped, it
+ * is read into the buffer of the mapped file record instead. The file
+ * must be released using unmapFile().
+ *
+ * \param fileName File name.
+ * \param target Where to store the mapped file record.
+ */
+void mapFile(const std::string& fileName,
+    Ionflux::GeoUtils::MappedFile& target);
+
+/** Unmap file.
+ *
+ * Release a file that has been mapped using mapFile().
+ *
+ * \param target Mapped file record.
+ */
+void unmapFile(Ionflux::GeoUtils::MappedFile& target);
+
+/** Read OBJ file.
+ *
+ * Read the vertex positions and faces of a Wavefront OBJ file into a
+ * compact mesh. Texture coordinates, normals, groups and materials are
+ * ignored. Negative (relative) vertex indices are supported. The file
+ * is mapped into memory and parsed in chunks, in several threads if
+ * the file has at least OBJ_PARSE_PARALLEL_MIN_BYTES bytes.
+ *
+ * \param fileName File name.
+ * \param target Where to store the mesh.
+ * \param numThreads Number of threads (0 = number of processors).
+ */
+void readOBJ(const std::string& fileName,
+    Ionflux::GeoUtils::CompactMesh& target, unsigned int numThreads = 0);
+
+/** Read OBJ file.
+ *
+ * Read a Wavefront OBJ file into a mesh (see readOBJ()).
+ *
+ * \param fileName File name.
+ * \param target Where to store the mesh.
+ * \param numThreads Number of threads (0 = number of processors).
+ */
+void readOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& target,
+    unsigned int numThreads = 0);
+
+/** Read OBJ file (task).
+ *
+ * Thread function for readOBJ().
+ *
+ * \param taskArg OBJ parse task.
+ *
+ * \return Always 0.
+ */
+void* readOBJTask(void* taskArg);
+
+/** Write OBJ file.
+ *
+ * Write the vertex positions and faces of a compact mesh to a Wavefront
+ * OBJ file. The output is the same as for CompactMesh::writeOBJ().
+ *
+ * \param fileName File name.
+ * \param source Mesh.
+ * \param precision Number of decimal places for vertex coordinates.
+ * \param smoothShading Smooth shading flag.
+ */
+void writeOBJ(const std::string& fileName,
+    const Ionflux::GeoUtils::CompactMesh& source,
+    unsigned int precision = 6, bool smoothShading = false);
+
+/** Write OBJ file.
+ *
+ * Write a mesh to a Wavefront OBJ file (see writeOBJ()).
+ *
+ * \param fileName File name.
+ * \param source Mesh.
+ * \param precision Number of decimal places for vertex coordinates.
+ * \param smoothShading Smooth shading flag.
+ */
+void writeOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& source,
+    unsigned int precision = 6, bool smoothShading = false);
+
+/** Read PLY file.
+ *
+ * Read the vertex positions and faces of a binary (little or big endian)
+ * PLY file into a compact mesh. Vertex properties other than \c x, \c y
+ * and \c z, face properties other than the vertex index list and other
+ * elements are skipped.
+ *
+ * \param fileName File name.
+ * \param target Where to store the mesh.
+ */
+void readPLY(const std::string& fileName,
+    Ionflux::GeoUtils::CompactMesh& target);
+
+/** Read PLY file.
+ *
+ * Read a binary PLY file into a mesh (see readPLY()).
+ *
+ * \param fileName File name.
+ * \param target Where to store the mesh.
+ */
+void readPLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& target);
+
+/** Write PLY file.
+ *
+ * Write the vertex positions and faces of a compact mesh to a binary
+ * little endian PLY file.
+ *
+ * \param fileName File name.
+ * \param source Mesh.
+ * \param doublePrecision Write vertex coordinates as \c double instead
+ * of \c float.
+ */
+void writePLY(const std::string& fileName,
+    const Ionflux::GeoUtils::CompactMesh& source,
+    bool doublePrecision = false);
+
+/** Write PLY file.
+ *
+ * Write a mesh to a binary little endian PLY file (see writePLY()).
+ *
+ * \param fileName File name.
+ * \param source Mesh.
+ * \param doublePrecision Write vertex coordinates as \c double instead
+ * of \c float.
+ */
+void writePLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& source,
+    bool doublePrecision = false);
+
+/** Read STL file.
+ *
+ * Read the triangles of a binary or ASCII STL file into a compact mesh.
+ * If \c weldVertices is \c true, triangle corners with identical
+ * coordinates are merged into a single vertex. Otherwise, each triangle
+ * gets three vertices of its own.
+ *
+ * \param fileName File name.
+ * \param target Where to store the mesh.
+ * \param weldVertices Merge identical vertices.
+ */
+void readSTL(const std::string& fileName,
+    Ionflux::GeoUtils::CompactMesh& target, bool weldVertices = true);
+
+/** Read STL file.
+ *
+ * Read an STL file into a mesh (see readSTL()).
+ *
+ * \param fileName File name.
+ * \param target Where to store the mesh.
+ * \param weldVertices Merge identical vertices.
+ */
+void readSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& target,
+    bool weldVertices = true);
+
+/** Write STL file.
+ *
+ * Write the faces of a compact mesh to a binary STL file. Faces with
+ * more than three vertices are triangulated as fans.
+ *
+ * \param fileName File name.
+ * \param source Mesh.
+ */
+void writeSTL(const std::string& fileName,
+    const Ionflux::GeoUtils::CompactMesh& source);
+
+/** Write STL file.
+ *
+ * Write a mesh to a binary STL file (see writeSTL()).
+ *
+ * \param fileName File name.
+ * \param source Mesh.
+ */
+void writeSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& source);
+
+}
+
+}
+
+/** \file meshio.hpp
+ * \brief Mesh I/O functions (header).
+ */
+#endif
@@ -27,9 +27,11 @@
  * 
  * ========================================================================== */
 #include <vector>
+#include <deque>
 #include <string>
 #include <set>
 #include <map>
+#include <pthread.h>
 #include "ifobject/types.hpp"
 
 namespace Ionflux
@@ -133,6 +135,229 @@ typedef std::set<Ionflux::GeoUtils::BoundingBox*> BoundingBoxSet;
 /// Vector of bounding boxes.
 typedef std::vector<Ionflux::GeoUtils::BoundingBox*> BoundingBoxVector;
 
+/// Item record for surface area heuristic splits.
+struct SAHItem
+{
+    /// Item.
+    Ionflux::GeoUtils::BoxBoundsItem* item;
+    /// Center.
+    double center[3];
+    /// Lower bounds.
+    double lower[3];
+    /// Upper bounds.
+    double upper[3];
+};
+
+/// Vector of surface area heuristic item records.
+typedef std::vector<Ionflux::GeoUtils::SAHItem> SAHItemVector;
+
+/// Surface area heuristic hierarchy build task.
+struct SAHBuildTask
+{
+    /// Target bounding box.
+    Ionflux::GeoUtils::BoundingBox* box;
+    /// Item records.
+    Ionflux::GeoUtils::SAHItemVector* items;
+    /// Index of the first item.
+    unsigned int first;
+    /// Index after the last item.
+    unsigned int last;
+    /// Number of bins.
+    unsigned int numBins;
+    /// Maximum number of items per leaf.
+    unsigned int maxLeafItems;
+    /// Maximum split depth.
+    unsigned int maxLevel;
+    /// Current split level.
+    unsigned int splitLevel;
+    /// Number of levels that may be built in parallel.
+    unsigned int parallelDepth;
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+};
+
+/// Box bounds tree query type ID.
+typedef int BoxBoundsTreeQueryID;
+
+/** Box bounds tree node.
+ *
+ * A node of a box bounds tree with four child slots. The bounds of the 
+ * child slots are stored per axis, so they can be tested together.
+ */
+struct BoxBoundsTreeNode
+{
+    /// Lower bounds of the child slots (x, y, z).
+    float lower[3][4];
+    /// Upper bounds of the child slots (x, y, z).
+    float upper[3][4];
+    /** Child slots (> 0: node index, < 0: leaf with items starting at 
+        index -(child + 1), 0: empty). */
+    int child[4];
+    /// Number of items for leaf child slots.
+    unsigned int numItems[4];
+};
+
+/// Vector of box bounds tree nodes.
+typedef std::vector<Ionflux::GeoUtils::BoxBoundsTreeNode> 
+    BoxBoundsTreeNodeVector;
+
+/// Box bounds tree build slot.
+struct BoxBoundsTreeSlot
+{
+    /// Bounding box (0 for a slot that contains leaf items).
+    Ionflux::GeoUtils::BoundingBox* box;
+    /// Leaf items.
+    Ionflux::GeoUtils::BoxBoundsItemVector items;
+    /// Surface area of the bounding box.
+    double area;
+};
+
+/// Vector of box bounds tree build slots.
+typedef std::vector<Ionflux::GeoUtils::BoxBoundsTreeSlot> 
+    BoxBoundsTreeSlotVector;
+
+/// Box bounds tree traversal stack entry.
+struct BoxBoundsTreeStackEntry
+{
+    /// Child slot.
+    int child;
+    /// Number of items (leaf child slots only).
+    unsigned int numItems;
+    /// Entry distance.
+    float tNear;
+};
+
+/// Box bounds tree traversal stack.
+typedef std::vector<Ionflux::GeoUtils::BoxBoundsTreeStackEntry> 
+    BoxBoundsTreeStack;
+
+class VertexTree;
+
+/// Vertex tree search entry (squared distance, vertex index).
+typedef std::pair<double, unsigned int> VertexTreeEntry;
+/// Vector of vertex tree search entries.
+typedef std::vector<Ionflux::GeoUtils::VertexTreeEntry> VertexTreeEntryVector;
+
+/// Vertex tree build task.
+struct VertexTreeBuildTask
+{
+    /// Vertex tree.
+    Ionflux::GeoUtils::VertexTree* tree;
+    /// Index of the first vertex.
+    unsigned int first;
+    /// Index after the last vertex.
+    unsigned int last;
+    /// Number of levels that may be built in parallel.
+    unsigned int parallelDepth;
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+};
+
+class MeshAdjacency;
+
+/// Mesh adjacency edge matching task.
+struct MeshAdjacencyMatchTask
+{
+    /// Mesh adjacency.
+    Ionflux::GeoUtils::MeshAdjacency* adjacency;
+    /// Half-edge key hashes.
+    const Ionflux::ObjectBase::UIntVector* hashes;
+    /// Representative half-edges.
+    Ionflux::ObjectBase::UIntVector* reps;
+    /// Partition.
+    unsigned int part;
+    /// Number of partitions.
+    unsigned int numParts;
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+};
+
+/// Point transform task.
+struct PointTransformTask
+{
+    /// X coordinates.
+    double* x;
+    /// Y coordinates.
+    double* y;
+    /// Z coordinates.
+    double* z;
+    /// Number of points.
+    unsigned int numPoints;
+    /// Transformation matrix (row-major, may be null).
+    const double* matrix;
+    /// View matrix (row-major, may be null).
+    const double* view;
+    /// Image matrix (row-major, may be null).
+    const double* image;
+};
+
+/// Mapped file.
+struct MappedFile
+{
+    /// File data.
+    const char* data;
+    /// File size.
+    size_t size;
+    /// Mapped memory (null if the file has been read into the buffer).
+    void* mapping;
+    /// Buffer (used if the file cannot be mapped).
+    std::string buffer;
+};
+
+/// OBJ parse task.
+struct OBJParseTask
+{
+    /// First character of the chunk.
+    const char* first;
+    /// End of the chunk.
+    const char* last;
+    /// Vertex positions.
+    Ionflux::ObjectBase::DoubleVector positions;
+    /// Face vertex indices.
+    Ionflux::ObjectBase::IntVector indices;
+    /// Indices of face vertex indices relative to the chunk vertices.
+    Ionflux::ObjectBase::UIntVector relIndices;
+    /// Face offsets (end of each face in the face vertex indices).
+    Ionflux::ObjectBase::UIntVector faceOffsets;
+    /// Object name.
+    std::string objectName;
+    /// Number of lines.
+    unsigned int numLines;
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+};
+
+class Mesh;
+
+/// Mesh update task.
+struct MeshUpdateTask
+{
+    /// Mesh.
+    Ionflux::GeoUtils::Mesh* mesh;
+    /// First face.
+    unsigned int firstFace;
+    /// End of the face range.
+    unsigned int lastFace;
+    /// First vertex.
+    unsigned int firstVertex;
+    /// End of the vertex range.
+    unsigned int lastVertex;
+    /// Vertex bounds (minimum and maximum for x, y and z).
+    double bounds[6];
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+};
+
 /// Result of a split test.
 struct SplitTestResult
 {
@@ -231,6 +456,112 @@ typedef std::vector<Ionflux::GeoUtils::SVGShapeStyle*> SVGShapeStyleVector;
 typedef std::map<std::string, Ionflux::GeoUtils::SVGShapeStyle*> 
     SVGShapeStyleStringMap;
 
+/// Render backend ID.
+typedef int RenderBackendID;
+
+/// Raster polygon.
+struct RasterPolygon
+{
+    /// Vertex coordinates (X, pixel space).
+    Ionflux::ObjectBase::DoubleVector x;
+    /// Vertex coordinates (Y, pixel space).
+    Ionflux::ObjectBase::DoubleVector y;
+    /// Minimum X coordinate.
+    double xMin;
+    /// Minimum Y coordinate.
+    double yMin;
+    /// Maximum X coordinate.
+    double xMax;
+    /// Maximum Y coordinate.
+    double yMax;
+    /// Fill color (red, green, blue, alpha).
+    double color[4];
+};
+
+/// Vector of raster polygons.
+typedef std::vector<Ionflux::GeoUtils::RasterPolygon> RasterPolygonVector;
+
+/// Raster tile.
+struct RasterTile
+{
+    /// First column.
+    unsigned int x0;
+    /// First row.
+    unsigned int y0;
+    /// Width.
+    unsigned int width;
+    /// Height.
+    unsigned int height;
+    /// Indices of the polygons overlapping the tile, in drawing order.
+    Ionflux::ObjectBase::UIntVector polygons;
+};
+
+/// Vector of raster tiles.
+typedef std::vector<Ionflux::GeoUtils::RasterTile> RasterTileVector;
+
+/// Parallel rasterization state.
+struct RasterUpdate
+{
+    /// Pixel data.
+    unsigned char* pixels;
+    /// Row stride.
+    unsigned int rowStride;
+    /// Number of channels.
+    unsigned int numChannels;
+    /// Polygons.
+    const Ionflux::GeoUtils::RasterPolygonVector* polygons;
+    /// Tiles.
+    const Ionflux::GeoUtils::RasterTileVector* tiles;
+    /// Index of the next tile to be processed.
+    unsigned int nextTile;
+    /// Mutex.
+    pthread_mutex_t mutex;
+};
+
+/// Pixel span.
+struct PixelSpan
+{
+    /// Row.
+    unsigned int y;
+    /// First column.
+    unsigned int x0;
+    /// Column following the last column.
+    unsigned int x1;
+};
+
+/// Vector of pixel spans.
+typedef std::vector<Ionflux::GeoUtils::PixelSpan> PixelSpanVector;
+
+/** Instance transforms.
+ *
+ * Per-instance transformations stored as separate arrays of components. 
+ * Instance \c i maps a point \c p to 
+ * <tt>s[i] * (p - c[i]) + c[i] + t[i]</tt>, where \c t is the offset, 
+ * \c s is the scale and \c c is the scaling center. The scale and 
+ * center arrays may be empty, in which case no scaling is applied.
+ */
+struct InstanceTransforms
+{
+    /// Offset (X).
+    Ionflux::ObjectBase::DoubleVector offsetX;
+    /// Offset (Y).
+    Ionflux::ObjectBase::DoubleVector offsetY;
+    /// Offset (Z).
+    Ionflux::ObjectBase::DoubleVector offsetZ;
+    /// Scale (X).
+    Ionflux::ObjectBase::DoubleVector scaleX;
+    /// Scale (Y).
+    Ionflux::ObjectBase::DoubleVector scaleY;
+    /// Scale (Z).
+    Ionflux::ObjectBase::DoubleVector scaleZ;
+    /// Scaling center (X).
+    Ionflux::ObjectBase::DoubleVector centerX;
+    /// Scaling center (Y).
+    Ionflux::ObjectBase::DoubleVector centerY;
+    /// Scaling center (Z).
+    Ionflux::ObjectBase::DoubleVector centerZ;
+};
+
 class TransformableObject;
 class TransformableGroup;
 class Vector3;
@@ -238,6 +569,9 @@ class Vector3;
 /// Vector of transformable objects.
 typedef std::vector<Ionflux::GeoUtils::TransformableObject*> 
     TransformableObjectVector;
+/// Map of shared items to the number of shared references.
+typedef std::map<Ionflux::GeoUtils::TransformableObject*, unsigned int> 
+    SharedItemMap;
 /// Vector of 3-element vectors.
 typedef std::vector<Ionflux::GeoUtils::Vector3*> Vector3Vector;
 /// Vector of transformable groups.
@@ -264,6 +598,8 @@ namespace TransformNodes
 class TransformNode;
 class Connection;
 class ParamControl;
+class Source;
+class Profiler;
 
 /// Input node specification.
 struct InputNodeSpec
@@ -288,6 +624,168 @@ typedef std::vector<Ionflux::GeoUtils::TransformNodes::Connection*>
 /// Vector of parameter control.
 typedef std::vector<Ionflux::GeoUtils::TransformNodes::ParamControl*> 
     ParamControlVector;
+/// Map of transform nodes.
+typedef std::map<Ionflux::GeoUtils::TransformNodes::TransformNode*, 
+    Ionflux::GeoUtils::TransformNodes::TransformNode*> TransformNodeMap;
+
+/// Transform graph update queue.
+struct TransformGraphQueue
+{
+    /// Nodes that are ready for update (node indices).
+    std::deque<unsigned int> nodes;
+    /// Mutex.
+    pthread_mutex_t mutex;
+};
+
+/// Parallel transform graph update.
+struct TransformGraphUpdate
+{
+    /// Nodes (in topological order).
+    Ionflux::GeoUtils::TransformNodeVector nodes;
+    /// Serial update flag for each node.
+    std::vector<bool> serial;
+    /// Input nodes of each node (node indices).
+    std::vector<Ionflux::ObjectBase::UIntVector> inputs;
+    /// Consumers of each node (node indices).
+    std::vector<Ionflux::ObjectBase::UIntVector> consumers;
+    /// Number of input nodes of each node that have not been updated.
+    Ionflux::ObjectBase::UIntVector numPendingInputs;
+    /// Number of consumers of each node that have not been updated.
+    Ionflux::ObjectBase::UIntVector numPendingConsumers;
+    /// Nodes that are ready for update by any thread (one queue per thread).
+    std::vector<Ionflux::GeoUtils::TransformGraphQueue> queues;
+    /// Nodes that are ready for update by the calling thread (node indices).
+    Ionflux::ObjectBase::UIntVector readySerial;
+    /// Number of nodes in the thread queues.
+    unsigned int numQueued;
+    /// Number of threads waiting for nodes to become ready.
+    unsigned int numIdle;
+    /// Number of nodes that have not been updated.
+    unsigned int numRemaining;
+    /// Number of nodes that have been processed.
+    unsigned int numUpdated;
+    /// Incremental update flag.
+    bool incremental;
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+    /// Mutex.
+    pthread_mutex_t mutex;
+    /// State changed condition.
+    pthread_cond_t stateChanged;
+};
+
+/// Parallel transform graph update task.
+struct TransformGraphTask
+{
+    /// Transform graph update state.
+    Ionflux::GeoUtils::TransformGraphUpdate* state;
+    /// Thread index.
+    unsigned int threadIndex;
+};
+
+/// Parallel batch update.
+struct BatchUpdate
+{
+    /// Input groups.
+    Ionflux::GeoUtils::TransformableGroupVector inputs;
+    /// Output groups for each input group.
+    std::vector<Ionflux::GeoUtils::TransformableGroupVector> outputs;
+    /// Parameter IDs of the parameter controls.
+    std::vector<Ionflux::ObjectBase::IFParamID> paramIDs;
+    /// Parameter values for each input group.
+    std::vector<Ionflux::ObjectBase::DoubleVector> paramValues;
+    /// Input ID for the processor nodes.
+    unsigned int processorInputID;
+    /// Index of the next input group to be processed.
+    unsigned int nextIndex;
+    /// Error flag.
+    bool error;
+    /// Error message.
+    std::string errorMessage;
+    /// Mutex.
+    pthread_mutex_t mutex;
+};
+
+/// Parallel batch update task.
+struct BatchTask
+{
+    /// Batch update state.
+    Ionflux::GeoUtils::BatchUpdate* state;
+    /// Source node.
+    Ionflux::GeoUtils::TransformNodes::Source* source;
+    /// Processor node.
+    Ionflux::GeoUtils::TransformNodes::TransformNode* processor;
+    /// Nodes controlled by the parameter controls.
+    Ionflux::GeoUtils::TransformNodeVector controlNodes;
+    /// Object holding references to the output groups.
+    Ionflux::ObjectBase::IFObject* outputRefs;
+};
+
+/// Transform node profile.
+struct TransformNodeProfile
+{
+    /// Transform node (0 if the node has been removed from the profiler).
+    Ionflux::GeoUtils::TransformNodes::TransformNode* node;
+    /// Node label.
+    std::string label;
+    /// Number of calls.
+    unsigned int numCalls;
+    /// Inclusive time (seconds).
+    double inclusiveTime;
+    /// Exclusive time (seconds).
+    double exclusiveTime;
+    /// Number of input items.
+    Ionflux::ObjectBase::UInt64 numInputItems;
+    /// Number of output items.
+    Ionflux::ObjectBase::UInt64 numOutputItems;
+    /** Size of the output objects (bytes).
+     *
+     * This is the sum of getMemSize() for the output groups and their
+     * items. Memory allocated by the objects (such as vertex arrays) is
+     * not included.
+     */
+    Ionflux::ObjectBase::UInt64 outputObjectBytes;
+};
+
+/// Vector of transform node profiles.
+typedef std::vector<Ionflux::GeoUtils::TransformNodeProfile> 
+    TransformNodeProfileVector;
+
+/// Transform node profiling event.
+struct TransformProfilerEvent
+{
+    /// Profile index.
+    unsigned int profileIndex;
+    /// Thread index.
+    unsigned int threadIndex;
+    /// Nesting depth.
+    unsigned int depth;
+    /// Start time (seconds, relative to the profiler start time).
+    double startTime;
+    /// Duration (seconds).
+    double duration;
+    /// Time spent in nested events (seconds).
+    double childTime;
+};
+
+/// Vector of transform node profiling events.
+typedef std::vector<Ionflux::GeoUtils::TransformProfilerEvent> 
+    TransformProfilerEventVector;
+
+/// Transform node profiler thread record.
+struct TransformProfilerThread
+{
+    /// Thread.
+    pthread_t thread;
+    /// Stack of open events (event indices).
+    Ionflux::ObjectBase::UIntVector stack;
+};
+
+/// Vector of transform node profiler thread records.
+typedef std::vector<Ionflux::GeoUtils::TransformProfilerThread> 
+    TransformProfilerThreadVector;
 
 namespace Mapping
 {
@@ -342,6 +840,21 @@ typedef Ionflux::ObjectBase::UInt8 MeshTypeID;
 /// Set of edges.
 typedef std::set<Ionflux::GeoUtils::Edge> EdgeObjSet;
 
+/// Compact mesh attribute channel.
+struct CompactMeshChannel
+{
+    /// Face data type.
+    Ionflux::GeoUtils::FaceDataTypeID dataType;
+    /// Number of components per element.
+    unsigned int numComponents;
+    /// Data (one element per face vertex).
+    Ionflux::ObjectBase::DoubleVector data;
+};
+
+/// Vector of compact mesh attribute channels.
+typedef std::vector<Ionflux::GeoUtils::CompactMeshChannel>
+    CompactMeshChannelVector;
+
 }
 
 }
@@ -43,6 +43,8 @@ namespace GeoUtils
 
 class Vertex3;
 class Vertex3Set;
+class Matrix3;
+class Matrix4;
 class BoxBoundsItemCompare;
 
 /** Get range comparison string representation.
@@ -777,6 +779,76 @@ void calculateOuterBezierControlPoint(
     const Ionflux::Mapping::Point* p3, 
     double smoothness = 0.2);
 
+/** Transform points.
+ *
+ * Transform points that are stored as separate coordinate arrays. If 
+ * \c matrix is not null, it is applied first, with an implicit 
+ * homogeneous coordinate of 1, as in Vertex3::transform(). If \c view 
+ * is not null, the view matrix is applied next, followed by the 
+ * perspective divide and the optional image matrix, as in 
+ * Vertex3::transformVI(). The coordinates are processed in SIMD 
+ * registers, and in several threads if there are at least 
+ * VERTEX_TRANSFORM_PARALLEL_MIN_VERTICES points.
+ *
+ * \param x X coordinates.
+ * \param y Y coordinates.
+ * \param z Z coordinates.
+ * \param numPoints Number of points.
+ * \param matrix Transformation matrix.
+ * \param view View matrix.
+ * \param image Image matrix.
+ * \param numThreads Number of threads (0 = number of processors).
+ */
+void transformPoints(double* x, double* y, double* z, 
+    unsigned int numPoints, const Ionflux::GeoUtils::Matrix4* matrix, 
+    const Ionflux::GeoUtils::Matrix4* view = 0, 
+    const Ionflux::GeoUtils::Matrix4* image = 0, 
+    unsigned int numThreads = 0);
+
+/** Transform points.
+ *
+ * Transform points that are stored as separate coordinate arrays by a 
+ * 3x3 matrix.
+ *
+ * \param x X coordinates.
+ * \param y Y coordinates.
+ * \param z Z coordinates.
+ * \param numPoints Number of points.
+ * \param matrix Transformation matrix.
+ * \param numThreads Number of threads (0 = number of processors).
+ */
+void transformPoints(double* x, double* y, double* z, 
+    unsigned int numPoints, const Ionflux::GeoUtils::Matrix3& matrix, 
+    unsigned int numThreads = 0);
+
+/** Transform points (task).
+ *
+ * Thread function for transformPoints(). 
+ *
+ * \param taskArg Point transform task.
+ *
+ * \return Always 0.
+ */
+void* transformPointsTask(void* taskArg);
+
+/** Transform vertices.
+ *
+ * Transform vertices in a batch. The vertex coordinates are gathered 
+ * into contiguous arrays, transformed using transformPoints() and 
+ * written back to the vertices.
+ *
+ * \param vertices Vertices.
+ * \param matrix Transformation matrix.
+ * \param view View matrix.
+ * \param image Image matrix.
+ * \param numThreads Number of threads (0 = number of processors).
+ */
+void transformVertices(Ionflux::GeoUtils::Vertex3Vector& vertices, 
+    const Ionflux::GeoUtils::Matrix4* matrix, 
+    const Ionflux::GeoUtils::Matrix4* view = 0, 
+    const Ionflux::GeoUtils::Matrix4* image = 0, 
+    unsigned int numThreads = 0);
+
 namespace TransformNodes
 {
 
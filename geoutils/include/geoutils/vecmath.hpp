@@ -0,0 +1,775 @@
+#ifndef IONFLUX_GEOUTILS_VECMATH
+#define IONFLUX_GEOUTILS_VECMATH
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * vecmath.hpp                     Vector and matrix value types (header).
+ * =========================================================================
+ *
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ *
+ * GeoUtils - Ionflux' Geometry Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+ *
+ * ========================================================================== */
+#include <cmath>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "geoutils/Vector2.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Vector4.hpp"
+#include "geoutils/Matrix3.hpp"
+#include "geoutils/Matrix4.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+/* The value types in this file are plain structs with stack storage and
+   non-virtual inline operations. They are meant for inner loops, where
+   the heap allocation and virtual calls of the Vector and Matrix classes
+   dominate. Conversion from and to the object types copies the element
+   array directly (Vector declares the value types as friends). The
+   constructors and the operations that fit a single return statement are
+   constexpr, so they can be used for constants and folded by the
+   compiler. */
+
+/// Vector value type (2 elements).
+struct Vec2
+{
+    /// Elements.
+    double v[2];
+
+    constexpr Vec2()
+    : v{0., 0.}
+    { }
+
+    constexpr Vec2(double x0, double x1)
+    : v{x0, x1}
+    { }
+
+    explicit Vec2(const Ionflux::GeoUtils::Vector2& other)
+    {
+        const double* e0 =
+            static_cast<const Ionflux::GeoUtils::Vector&>(other).elements;
+        v[0] = e0[0];
+        v[1] = e0[1];
+    }
+
+    /// Store the elements in a Vector2.
+    void get(Ionflux::GeoUtils::Vector2& target) const
+    {
+        double* e0 = static_cast<Ionflux::GeoUtils::Vector&>(target).elements;
+        e0[0] = v[0];
+        e0[1] = v[1];
+    }
+
+    double& operator[](unsigned int index)
+    {
+        return v[index];
+    }
+
+    constexpr double operator[](unsigned int index) const
+    {
+        return v[index];
+    }
+
+    constexpr Vec2 operator+(const Vec2& other) const
+    {
+        return Vec2(v[0] + other.v[0], v[1] + other.v[1]);
+    }
+
+    constexpr Vec2 operator-(const Vec2& other) const
+    {
+        return Vec2(v[0] - other.v[0], v[1] - other.v[1]);
+    }
+
+    constexpr Vec2 operator-() const
+    {
+        return Vec2(-v[0], -v[1]);
+    }
+
+    constexpr Vec2 operator*(double c) const
+    {
+        return Vec2(c * v[0], c * v[1]);
+    }
+
+    constexpr Vec2 operator/(double c) const
+    {
+        return *this * (1. / c);
+    }
+
+    /// Dot product.
+    constexpr double dot(const Vec2& other) const
+    {
+        return v[0] * other.v[0] + v[1] * other.v[1];
+    }
+
+    /// Euclidean length.
+    double length() const
+    {
+        return ::sqrt(dot(*this));
+    }
+
+    /// Normalized copy of the vector.
+    Vec2 normalize() const
+    {
+        return *this / length();
+    }
+};
+
+/// Vector value type (3 elements).
+struct Vec3
+{
+    /// Elements.
+    double v[3];
+
+    constexpr Vec3()
+    : v{0., 0., 0.}
+    { }
+
+    constexpr Vec3(double x0, double x1, double x2)
+    : v{x0, x1, x2}
+    { }
+
+    explicit Vec3(const Ionflux::GeoUtils::Vector3& other)
+    {
+        const double* e0 =
+            static_cast<const Ionflux::GeoUtils::Vector&>(other).elements;
+        v[0] = e0[0];
+        v[1] = e0[1];
+        v[2] = e0[2];
+    }
+
+    /// Store the elements in a Vector3.
+    void get(Ionflux::GeoUtils::Vector3& target) const
+    {
+        double* e0 = static_cast<Ionflux::GeoUtils::Vector&>(target).elements;
+        e0[0] = v[0];
+        e0[1] = v[1];
+        e0[2] = v[2];
+    }
+
+    double& operator[](unsigned int index)
+    {
+        return v[index];
+    }
+
+    constexpr double operator[](unsigned int index) const
+    {
+        return v[index];
+    }
+
+    constexpr Vec3 operator+(const Vec3& other) const
+    {
+        return Vec3(v[0] + other.v[0], v[1] + other.v[1],
+            v[2] + other.v[2]);
+    }
+
+    constexpr Vec3 operator-(const Vec3& other) const
+    {
+        return Vec3(v[0] - other.v[0], v[1] - other.v[1],
+            v[2] - other.v[2]);
+    }
+
+    constexpr Vec3 operator-() const
+    {
+        return Vec3(-v[0], -v[1], -v[2]);
+    }
+
+    constexpr Vec3 operator*(double c) const
+    {
+        return Vec3(c * v[0], c * v[1], c * v[2]);
+    }
+
+    constexpr Vec3 operator/(double c) const
+    {
+        return *this * (1. / c);
+    }
+
+    /// Dot product.
+    constexpr double dot(const Vec3& other) const
+    {
+        return v[0] * other.v[0] + v[1] * other.v[1] + v[2] * other.v[2];
+    }
+
+    /// Cross product.
+    constexpr Vec3 cross(const Vec3& other) const
+    {
+        return Vec3(v[1] * other.v[2] - v[2] * other.v[1],
+            v[2] * other.v[0] - v[0] * other.v[2],
+            v[0] * other.v[1] - v[1] * other.v[0]);
+    }
+
+    /// Euclidean length.
+    double length() const
+    {
+        return ::sqrt(dot(*this));
+    }
+
+    /// Normalized copy of the vector.
+    Vec3 normalize() const
+    {
+        return *this / length();
+    }
+
+    /// Cosine of the angle between the vectors, clamped to [-1, 1].
+    double angleCos(const Vec3& other) const
+    {
+        double t = dot(other) / (length() * other.length());
+        if (t < -1.)
+            t = -1.;
+        else
+        if (t > 1.)
+            t = 1.;
+        return t;
+    }
+
+    /// Component-wise product.
+    constexpr Vec3 multElements(const Vec3& other) const
+    {
+        return Vec3(v[0] * other.v[0], v[1] * other.v[1],
+            v[2] * other.v[2]);
+    }
+};
+
+/// Vector value type (4 elements).
+struct Vec4
+{
+    /// Elements.
+    double v[4];
+
+    constexpr Vec4()
+    : v{0., 0., 0., 0.}
+    { }
+
+    constexpr Vec4(double x0, double x1, double x2, double x3)
+    : v{x0, x1, x2, x3}
+    { }
+
+    constexpr Vec4(const Vec3& other, double w)
+    : v{other.v[0], other.v[1], other.v[2], w}
+    { }
+
+    explicit Vec4(const Ionflux::GeoUtils::Vector4& other)
+    {
+        const double* e0 =
+            static_cast<const Ionflux::GeoUtils::Vector&>(other).elements;
+        v[0] = e0[0];
+        v[1] = e0[1];
+        v[2] = e0[2];
+        v[3] = e0[3];
+    }
+
+    /// Store the elements in a Vector4.
+    void get(Ionflux::GeoUtils::Vector4& target) const
+    {
+        double* e0 = static_cast<Ionflux::GeoUtils::Vector&>(target).elements;
+        e0[0] = v[0];
+        e0[1] = v[1];
+        e0[2] = v[2];
+        e0[3] = v[3];
+    }
+
+    /// First three elements.
+    constexpr Vec3 getV3() const
+    {
+        return Vec3(v[0], v[1], v[2]);
+    }
+
+    double& operator[](unsigned int index)
+    {
+        return v[index];
+    }
+
+    constexpr double operator[](unsigned int index) const
+    {
+        return v[index];
+    }
+
+    Vec4 operator+(const Vec4& other) const
+    {
+        Vec4 result;
+#if defined(__AVX__)
+        _mm256_storeu_pd(result.v, _mm256_add_pd(_mm256_loadu_pd(v),
+            _mm256_loadu_pd(other.v)));
+#elif defined(__SSE2__)
+        _mm_storeu_pd(result.v, _mm_add_pd(_mm_loadu_pd(v),
+            _mm_loadu_pd(other.v)));
+        _mm_storeu_pd(result.v + 2, _mm_add_pd(_mm_loadu_pd(v + 2),
+            _mm_loadu_pd(other.v + 2)));
+#else
+        for (unsigned int i = 0; i < 4; i++)
+            result.v[i] = v[i] + other.v[i];
+#endif
+        return result;
+    }
+
+    Vec4 operator-(const Vec4& other) const
+    {
+        Vec4 result;
+#if defined(__AVX__)
+        _mm256_storeu_pd(result.v, _mm256_sub_pd(_mm256_loadu_pd(v),
+            _mm256_loadu_pd(other.v)));
+#elif defined(__SSE2__)
+        _mm_storeu_pd(result.v, _mm_sub_pd(_mm_loadu_pd(v),
+            _mm_loadu_pd(other.v)));
+        _mm_storeu_pd(result.v + 2, _mm_sub_pd(_mm_loadu_pd(v + 2),
+            _mm_loadu_pd(other.v + 2)));
+#else
+        for (unsigned int i = 0; i < 4; i++)
+            result.v[i] = v[i] - other.v[i];
+#endif
+        return result;
+    }
+
+    Vec4 operator*(double c) const
+    {
+        Vec4 result;
+#if defined(__AVX__)
+        _mm256_storeu_pd(result.v, _mm256_mul_pd(_mm256_loadu_pd(v),
+            _mm256_set1_pd(c)));
+#elif defined(__SSE2__)
+        __m128d c0 = _mm_set1_pd(c);
+        _mm_storeu_pd(result.v, _mm_mul_pd(_mm_loadu_pd(v), c0));
+        _mm_storeu_pd(result.v + 2, _mm_mul_pd(_mm_loadu_pd(v + 2), c0));
+#else
+        for (unsigned int i = 0; i < 4; i++)
+            result.v[i] = c * v[i];
+#endif
+        return result;
+    }
+
+    Vec4 operator/(double c) const
+    {
+        return *this * (1. / c);
+    }
+
+    /// Dot product.
+    constexpr double dot(const Vec4& other) const
+    {
+        return v[0] * other.v[0] + v[1] * other.v[1]
+            + v[2] * other.v[2] + v[3] * other.v[3];
+    }
+};
+
+/// Matrix value type (3x3, row-major).
+struct Mat3
+{
+    /// Elements.
+    double m[9];
+
+    constexpr Mat3()
+    : m()
+    { }
+
+    explicit Mat3(const Ionflux::GeoUtils::Matrix3& other)
+    {
+        const double* e0 =
+            static_cast<const Ionflux::GeoUtils::Vector&>(other).elements;
+        for (unsigned int i = 0; i < 9; i++)
+            m[i] = e0[i];
+    }
+
+    /// Store the elements in a Matrix3.
+    void get(Ionflux::GeoUtils::Matrix3& target) const
+    {
+        double* e0 = static_cast<Ionflux::GeoUtils::Vector&>(target).elements;
+        for (unsigned int i = 0; i < 9; i++)
+            e0[i] = m[i];
+    }
+
+    /// Identity matrix.
+    static Mat3 identity()
+    {
+        Mat3 result;
+        result.m[0] = 1.;
+        result.m[4] = 1.;
+        result.m[8] = 1.;
+        return result;
+    }
+
+    double& operator()(unsigned int row, unsigned int col)
+    {
+        return m[3 * row + col];
+    }
+
+    constexpr double operator()(unsigned int row, unsigned int col) const
+    {
+        return m[3 * row + col];
+    }
+
+    constexpr Vec3 operator*(const Vec3& x) const
+    {
+        return Vec3(m[0] * x.v[0] + m[1] * x.v[1] + m[2] * x.v[2],
+            m[3] * x.v[0] + m[4] * x.v[1] + m[5] * x.v[2],
+            m[6] * x.v[0] + m[7] * x.v[1] + m[8] * x.v[2]);
+    }
+
+    Mat3 operator*(const Mat3& other) const
+    {
+        Mat3 result;
+        for (unsigned int i = 0; i < 3; i++)
+        {
+            for (unsigned int j = 0; j < 3; j++)
+            {
+                result.m[3 * i + j] = m[3 * i] * other.m[j]
+                    + m[3 * i + 1] * other.m[3 + j]
+                    + m[3 * i + 2] * other.m[6 + j];
+            }
+        }
+        return result;
+    }
+
+    /// Transposed copy of the matrix.
+    Mat3 transpose() const
+    {
+        Mat3 result;
+        for (unsigned int i = 0; i < 3; i++)
+            for (unsigned int j = 0; j < 3; j++)
+                result.m[3 * i + j] = m[3 * j + i];
+        return result;
+    }
+};
+
+/// Matrix value type (4x4, row-major).
+struct Mat4
+{
+    /// Elements.
+    double m[16];
+
+    constexpr Mat4()
+    : m()
+    { }
+
+    explicit Mat4(const Ionflux::GeoUtils::Matrix4& other)
+    {
+        const double* e0 =
+            static_cast<const Ionflux::GeoUtils::Vector&>(other).elements;
+        for (unsigned int i = 0; i < 16; i++)
+            m[i] = e0[i];
+    }
+
+    /// Store the elements in a Matrix4.
+    void get(Ionflux::GeoUtils::Matrix4& target) const
+    {
+        double* e0 = static_cast<Ionflux::GeoUtils::Vector&>(target).elements;
+        for (unsigned int i = 0; i < 16; i++)
+            e0[i] = m[i];
+    }
+
+    /// Identity matrix.
+    static Mat4 identity()
+    {
+        Mat4 result;
+        result.m[0] = 1.;
+        result.m[5] = 1.;
+        result.m[10] = 1.;
+        result.m[15] = 1.;
+        return result;
+    }
+
+    double& operator()(unsigned int row, unsigned int col)
+    {
+        return m[4 * row + col];
+    }
+
+    constexpr double operator()(unsigned int row, unsigned int col) const
+    {
+        return m[4 * row + col];
+    }
+
+    Vec4 operator*(const Vec4& x) const
+    {
+        Vec4 result;
+#if defined(__SSE2__)
+        // two rows at a time, reduced with an unpack/add
+        __m128d x01 = _mm_loadu_pd(x.v);
+        __m128d x23 = _mm_loadu_pd(x.v + 2);
+        for (unsigned int i = 0; i < 4; i += 2)
+        {
+            const double* r0 = m + 4 * i;
+            __m128d s0 = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(r0), x01),
+                _mm_mul_pd(_mm_loadu_pd(r0 + 2), x23));
+            __m128d s1 = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(r0 + 4), x01),
+                _mm_mul_pd(_mm_loadu_pd(r0 + 6), x23));
+            _mm_storeu_pd(result.v + i, _mm_add_pd(
+                _mm_unpacklo_pd(s0, s1), _mm_unpackhi_pd(s0, s1)));
+        }
+#else
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            const double* r0 = m + 4 * i;
+            result.v[i] = r0[0] * x.v[0] + r0[1] * x.v[1]
+                + r0[2] * x.v[2] + r0[3] * x.v[3];
+        }
+#endif
+        return result;
+    }
+
+    Mat4 operator*(const Mat4& other) const
+    {
+        Mat4 result;
+        /* Each result row is a linear combination of the rows of the
+           other matrix, so the inner loop works on contiguous rows. */
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            const double* a0 = m + 4 * i;
+            double* t0 = result.m + 4 * i;
+#if defined(__AVX__)
+            __m256d s0 = _mm256_mul_pd(_mm256_set1_pd(a0[0]),
+                _mm256_loadu_pd(other.m));
+            for (unsigned int k = 1; k < 4; k++)
+                s0 = _mm256_add_pd(s0, _mm256_mul_pd(
+                    _mm256_set1_pd(a0[k]), _mm256_loadu_pd(other.m + 4 * k)));
+            _mm256_storeu_pd(t0, s0);
+#elif defined(__SSE2__)
+            __m128d c0 = _mm_set1_pd(a0[0]);
+            __m128d s0 = _mm_mul_pd(c0, _mm_loadu_pd(other.m));
+            __m128d s1 = _mm_mul_pd(c0, _mm_loadu_pd(other.m + 2));
+            for (unsigned int k = 1; k < 4; k++)
+            {
+                c0 = _mm_set1_pd(a0[k]);
+                s0 = _mm_add_pd(s0,
+                    _mm_mul_pd(c0, _mm_loadu_pd(other.m + 4 * k)));
+                s1 = _mm_add_pd(s1,
+                    _mm_mul_pd(c0, _mm_loadu_pd(other.m + 4 * k + 2)));
+            }
+            _mm_storeu_pd(t0, s0);
+            _mm_storeu_pd(t0 + 2, s1);
+#else
+            for (unsigned int j = 0; j < 4; j++)
+            {
+                t0[j] = a0[0] * other.m[j] + a0[1] * other.m[4 + j]
+                    + a0[2] * other.m[8 + j] + a0[3] * other.m[12 + j];
+            }
+#endif
+        }
+        return result;
+    }
+
+    /// Transposed copy of the matrix.
+    Mat4 transpose() const
+    {
+        Mat4 result;
+        for (unsigned int i = 0; i < 4; i++)
+            for (unsigned int j = 0; j < 4; j++)
+                result.m[4 * i + j] = m[4 * j + i];
+        return result;
+    }
+
+    /** Transform a point.
+     *
+     * Transform a point with an implicit homogeneous coordinate of 1. The
+     * homogeneous coordinate of the result is discarded, which matches
+     * Vertex3::transform().
+     */
+    constexpr Vec3 transformPoint(const Vec3& x) const
+    {
+        return Vec3(
+            m[0] * x.v[0] + m[1] * x.v[1] + m[2] * x.v[2] + m[3],
+            m[4] * x.v[0] + m[5] * x.v[1] + m[6] * x.v[2] + m[7],
+            m[8] * x.v[0] + m[9] * x.v[1] + m[10] * x.v[2] + m[11]);
+    }
+
+    /** Transform a direction.
+     *
+     * Transform a direction, ignoring the translation part of the matrix.
+     */
+    constexpr Vec3 transformDirection(const Vec3& x) const
+    {
+        return Vec3(
+            m[0] * x.v[0] + m[1] * x.v[1] + m[2] * x.v[2],
+            m[4] * x.v[0] + m[5] * x.v[1] + m[6] * x.v[2],
+            m[8] * x.v[0] + m[9] * x.v[1] + m[10] * x.v[2]);
+    }
+};
+
+/* Packed double operations.
+
+   PackedDouble is the widest SIMD register type enabled by the compiler
+   (or plain double if there is none). The operations are overloaded for
+   double as well, so kernels written as templates over the value type
+   can process the remainder of an array one element at a time. */
+
+inline void packedLoad(double& target, const double* source)
+{
+    target = *source;
+}
+
+inline void packedStore(double* target, double source)
+{
+    *target = source;
+}
+
+inline double packedSplat(double value, double)
+{
+    return value;
+}
+
+inline double packedAdd(double a, double b)
+{
+    return a + b;
+}
+
+inline double packedMul(double a, double b)
+{
+    return a * b;
+}
+
+inline double packedDiv(double a, double b)
+{
+    return a / b;
+}
+
+#if defined(__AVX__)
+/// Packed doubles.
+typedef __m256d PackedDouble;
+/// Number of doubles in a packed double.
+const unsigned int PACKED_DOUBLE_WIDTH = 4;
+
+inline void packedLoad(__m256d& target, const double* source)
+{
+    target = _mm256_loadu_pd(source);
+}
+
+inline void packedStore(double* target, __m256d source)
+{
+    _mm256_storeu_pd(target, source);
+}
+
+inline __m256d packedSplat(double value, __m256d)
+{
+    return _mm256_set1_pd(value);
+}
+
+inline __m256d packedAdd(__m256d a, __m256d b)
+{
+    return _mm256_add_pd(a, b);
+}
+
+inline __m256d packedMul(__m256d a, __m256d b)
+{
+    return _mm256_mul_pd(a, b);
+}
+
+inline __m256d packedDiv(__m256d a, __m256d b)
+{
+    return _mm256_div_pd(a, b);
+}
+#elif defined(__SSE2__)
+/// Packed doubles.
+typedef __m128d PackedDouble;
+/// Number of doubles in a packed double.
+const unsigned int PACKED_DOUBLE_WIDTH = 2;
+
+inline void packedLoad(__m128d& target, const double* source)
+{
+    target = _mm_loadu_pd(source);
+}
+
+inline void packedStore(double* target, __m128d source)
+{
+    _mm_storeu_pd(target, source);
+}
+
+inline __m128d packedSplat(double value, __m128d)
+{
+    return _mm_set1_pd(value);
+}
+
+inline __m128d packedAdd(__m128d a, __m128d b)
+{
+    return _mm_add_pd(a, b);
+}
+
+inline __m128d packedMul(__m128d a, __m128d b)
+{
+    return _mm_mul_pd(a, b);
+}
+
+inline __m128d packedDiv(__m128d a, __m128d b)
+{
+    return _mm_div_pd(a, b);
+}
+#else
+/// Packed doubles.
+typedef double PackedDouble;
+/// Number of doubles in a packed double.
+const unsigned int PACKED_DOUBLE_WIDTH = 1;
+#endif
+
+/// Dot product of a matrix row with (x, y, z, 1).
+template<class T>
+inline T packedRowDot(const double* row, const T& x, const T& y, 
+    const T& z)
+{
+    return packedAdd(
+        packedAdd(packedMul(packedSplat(row[0], x), x), 
+            packedMul(packedSplat(row[1], x), y)), 
+        packedAdd(packedMul(packedSplat(row[2], x), z), 
+            packedSplat(row[3], x)));
+}
+
+/** Transform points (packed).
+ *
+ * Transform packed point coordinates by a row-major 4x4 matrix. The 
+ * points have an implicit homogeneous coordinate of 1, and the 
+ * homogeneous coordinate of the result is discarded, as in 
+ * Vertex3::transform().
+ */
+template<class T>
+inline void transformPointPacked(const double* m, T& x, T& y, T& z)
+{
+    T x0 = packedRowDot(m, x, y, z);
+    T y0 = packedRowDot(m + 4, x, y, z);
+    z = packedRowDot(m + 8, x, y, z);
+    x = x0;
+    y = y0;
+}
+
+/** Transform points with perspective divide (packed).
+ *
+ * Transform packed point coordinates by a row-major 4x4 matrix and 
+ * divide by the resulting homogeneous coordinate, as in 
+ * Vertex3::transformVI().
+ */
+template<class T>
+inline void transformPointProjectivePacked(const double* m, T& x, T& y, 
+    T& z)
+{
+    T w0 = packedRowDot(m + 12, x, y, z);
+    T x0 = packedDiv(packedRowDot(m, x, y, z), w0);
+    T y0 = packedDiv(packedRowDot(m + 4, x, y, z), w0);
+    z = packedDiv(packedRowDot(m + 8, x, y, z), w0);
+    x = x0;
+    y = y0;
+}
+
+}
+
+}
+
+/** \file vecmath.hpp
+ * \brief Vector and matrix value types (header).
+ */
+#endif
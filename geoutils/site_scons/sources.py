@@ -10,9 +10,11 @@ geoutilsLibHeaders = [
 	'include/geoutils/types.hpp', 
 	'include/geoutils/utils.hpp', 
 	'include/geoutils/xmlutils.hpp', 
+	'include/geoutils/meshio.hpp', 
 	'include/geoutils/geoutils.hpp', 
 	'include/geoutils/mappings.hpp', 
 	'include/geoutils/transformnodes.hpp', 
+	'include/geoutils/vecmath.hpp', 
     'include/geoutils/Accept3.hpp', 
     'include/geoutils/AcceptLength3.hpp', 
     'include/geoutils/AcceptVolume3.hpp', 
@@ -24,11 +26,13 @@ geoutilsLibHeaders = [
     'include/geoutils/BoxBoundsItemCompareAxis.hpp', 
     'include/geoutils/BoxBoundsItemCompareDistanceVec3.hpp', 
     'include/geoutils/BoxBoundsItemCompareDistancePlane3.hpp', 
+    'include/geoutils/BoxBoundsTree.hpp', 
     'include/geoutils/Cache.hpp', 
     'include/geoutils/Camera.hpp', 
     'include/geoutils/Center.hpp', 
     'include/geoutils/Clock.hpp', 
     'include/geoutils/Clone.hpp', 
+    'include/geoutils/CompactMesh.hpp', 
     'include/geoutils/Compose3.hpp', 
     'include/geoutils/Connection.hpp', 
     'include/geoutils/Duplicate.hpp', 
@@ -54,10 +58,12 @@ geoutilsLibHeaders = [
     'include/geoutils/MatrixTransform.hpp', 
     'include/geoutils/Merge.hpp', 
     'include/geoutils/Mesh.hpp', 
+    'include/geoutils/MeshAdjacency.hpp', 
     'include/geoutils/Normalize.hpp', 
     'include/geoutils/Object3.hpp', 
     'include/geoutils/Shape3.hpp', 
     'include/geoutils/ParamControl.hpp', 
+    'include/geoutils/Profiler.hpp', 
     'include/geoutils/Plane3.hpp', 
     'include/geoutils/Polygon2.hpp', 
     'include/geoutils/Polygon3.hpp', 
@@ -96,6 +102,7 @@ geoutilsLibHeaders = [
     'include/geoutils/Vertex2.hpp', 
     'include/geoutils/Vertex3.hpp', 
     'include/geoutils/Vertex3Set.hpp', 
+    'include/geoutils/VertexTree.hpp', 
     'include/geoutils/Voxel.hpp', 
     'include/geoutils/Wrap.hpp', 
     'include/geoutils/WriteSVG.hpp', 
@@ -104,12 +111,14 @@ geoutilsLibHeaders = [
     'include/geoutils/SVGShapeStyleMap.hpp', 
     'include/geoutils/SVGShapeStyleVectorSource.hpp', 
     'include/geoutils/SVGImageProperties.hpp', 
+    'include/geoutils/SVGWriter.hpp', 
     'include/geoutils/xml_factories.hpp'
 ]
 
 geoutilsLibSources = [
     'build/utils.cpp', 
 	'build/xmlutils.cpp', 
+	'build/meshio.cpp', 
     'build/Accept3.cpp', 
     'build/AcceptLength3.cpp', 
     'build/AcceptVolume3.cpp', 
@@ -121,11 +130,13 @@ geoutilsLibSources = [
     'build/BoxBoundsItemCompareAxis.cpp', 
     'build/BoxBoundsItemCompareDistanceVec3.cpp', 
     'build/BoxBoundsItemCompareDistancePlane3.cpp', 
+    'build/BoxBoundsTree.cpp', 
     'build/Cache.cpp', 
     'build/Camera.cpp', 
     'build/Center.cpp', 
     'build/Clock.cpp', 
     'build/Clone.cpp', 
+    'build/CompactMesh.cpp', 
     'build/Compose3.cpp', 
     'build/Connection.cpp', 
     'build/Duplicate.cpp', 
@@ -151,10 +162,12 @@ geoutilsLibSources = [
     'build/MatrixTransform.cpp', 
     'build/Merge.cpp', 
     'build/Mesh.cpp', 
+    'build/MeshAdjacency.cpp', 
     'build/Normalize.cpp', 
     'build/Object3.cpp', 
     'build/Shape3.cpp', 
     'build/ParamControl.cpp', 
+    'build/Profiler.cpp', 
     'build/Plane3.cpp', 
     'build/Polygon2.cpp', 
     'build/Polygon3.cpp', 
@@ -193,6 +206,7 @@ geoutilsLibSources = [
     'build/Vertex2.cpp', 
     'build/Vertex3.cpp', 
     'build/Vertex3Set.cpp', 
+    'build/VertexTree.cpp', 
     'build/Voxel.cpp', 
     'build/Wrap.cpp', 
     'build/WriteSVG.cpp', 
@@ -201,6 +215,7 @@ geoutilsLibSources = [
     'build/SVGShapeStyleMap.cpp', 
     'build/SVGShapeStyleVectorSource.cpp', 
     'build/SVGImageProperties.cpp', 
+    'build/SVGWriter.cpp', 
     'build/gslutils.cpp'
 ]
 
@@ -216,11 +231,13 @@ geoutilsLibClasses = [
     'BoxBoundsItemCompareAxis', 
     'BoxBoundsItemCompareDistanceVec3', 
     'BoxBoundsItemCompareDistancePlane3', 
+    'BoxBoundsTree', 
     'Cache', 
     'Camera', 
     'Center', 
     'Clock', 
     'Clone', 
+    'CompactMesh', 
     'Compose3', 
     'Connection', 
     'Duplicate', 
@@ -246,10 +263,12 @@ geoutilsLibClasses = [
     'MatrixTransform', 
     'Merge', 
     'Mesh', 
+    'MeshAdjacency', 
     'Normalize', 
     'Object3', 
     'Shape3', 
     'ParamControl', 
+    'Profiler', 
     'Plane3', 
     'Polygon2', 
     'Polygon3', 
@@ -288,6 +307,7 @@ geoutilsLibClasses = [
     'Vertex2', 
     'Vertex3', 
     'Vertex3Set', 
+    'VertexTree', 
     'Voxel', 
     'Wrap', 
     'WriteSVG', 
@@ -295,7 +315,8 @@ geoutilsLibClasses = [
     'SVGShapeStyleSource', 
     'SVGShapeStyleMap', 
     'SVGShapeStyleVectorSource', 
-    'SVGImageProperties'
+    'SVGImageProperties', 
+    'SVGWriter'
 ]
 
 geoutilsLibXMLClasses = [
@@ -111,22 +111,9 @@ void Array::process()
 	/* Since we are going to manipulate the individual elements, 
 	   any existing group transformations must be applied first. */
 	g0->applyTransform();
-	double width = numColumns * cellWidth;
-	double height = numRows * cellHeight;
-	// Translation to center the array around the origin.
-	Vector3 v0(-0.5 * width, -0.5 * height, 0.);
-	unsigned int numSourceItems = g0->getNumItems();
-	for (unsigned int i = 0; i < numSourceItems; i++)
-	{
-	    TransformableObject* o0 = g0->getItem(i);
-	    unsigned int row = (i / numColumns) % numRows;
-	    unsigned int col = i % numColumns;
-	    // Translation for the cell.
-	    Vector3 v1((col + 0.5) * cellWidth, 
-	        (numRows - row - 0.5) * cellHeight, 0);
-	    // Translate the object.
-	    o0->translate(v0 + v1 + offset);
-	}
+	InstanceTransforms t0;
+	getInstanceTransforms(g0->getNumItems(), t0);
+	g0->transformItems(t0);
 	addOutput(g0);
 }
 
@@ -139,9 +126,40 @@ std::string Array::getString() const
 	return status.str();
 }
 
+void Array::getInstanceTransforms(unsigned int numItems,
+Ionflux::GeoUtils::InstanceTransforms& target)
+{
+	double width = numColumns * cellWidth;
+	double height = numRows * cellHeight;
+	// Translation to center the array around the origin.
+	double x0 = -0.5 * width;
+	double y0 = -0.5 * height;
+	DoubleVector& ox = target.offsetX;
+	DoubleVector& oy = target.offsetY;
+	DoubleVector& oz = target.offsetZ;
+	ox.resize(numItems);
+	oy.resize(numItems);
+	oz.assign(numItems, offset[2]);
+	for (unsigned int i = 0; i < numItems; i++)
+	{
+	    unsigned int row = (i / numColumns) % numRows;
+	    unsigned int col = i % numColumns;
+	    // Translation for the cell.
+	    ox[i] = x0 + (col + 0.5) * cellWidth + offset[0];
+	    oy[i] = y0 + (numRows - row - 0.5) * cellHeight + offset[1];
+	}
+	target.scaleX.clear();
+	target.scaleY.clear();
+	target.scaleZ.clear();
+	target.centerX.clear();
+	target.centerY.clear();
+	target.centerZ.clear();
+}
+
 void Array::setOffset(const Ionflux::GeoUtils::Vector3& newOffset)
 {
 	offset = newOffset;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Array::getOffset() const
@@ -152,6 +170,7 @@ Ionflux::GeoUtils::Vector3 Array::getOffset() const
 void Array::setNumRows(unsigned int newNumRows)
 {
 	numRows = newNumRows;
+	touch();
 }
 
 unsigned int Array::getNumRows() const
@@ -162,6 +181,7 @@ unsigned int Array::getNumRows() const
 void Array::setNumColumns(unsigned int newNumColumns)
 {
 	numColumns = newNumColumns;
+	touch();
 }
 
 unsigned int Array::getNumColumns() const
@@ -172,6 +192,7 @@ unsigned int Array::getNumColumns() const
 void Array::setCellWidth(double newCellWidth)
 {
 	cellWidth = newCellWidth;
+	touch();
 }
 
 double Array::getCellWidth() const
@@ -182,6 +203,7 @@ double Array::getCellWidth() const
 void Array::setCellHeight(double newCellHeight)
 {
 	cellHeight = newCellHeight;
+	touch();
 }
 
 double Array::getCellHeight() const
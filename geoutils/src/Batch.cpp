@@ -32,7 +32,10 @@
 #include <sstream>
 #include <iomanip>
 #include <fstream>
+#include <pthread.h>
+#include <unistd.h>
 #include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Profiler.hpp"
 #include "ifmapping/utils.hpp"
 
 using namespace std;
@@ -68,7 +71,8 @@ const BatchClassInfo Batch::batchClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* Batch::CLASS_INFO = &Batch::batchClassInfo;
 
 Batch::Batch()
-: source(0), processor(0), processorInputID(DEFAULT_PROCESSOR_INPUT_ID)
+: source(0), processorParamVersion(0), processor(0), 
+processorInputID(DEFAULT_PROCESSOR_INPUT_ID), numThreads(1)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -77,7 +81,8 @@ Batch::Batch()
 }
 
 Batch::Batch(const Ionflux::GeoUtils::TransformNodes::Batch& other)
-: source(0), processor(0), processorInputID(DEFAULT_PROCESSOR_INPUT_ID)
+: source(0), processorParamVersion(0), processor(0), 
+processorInputID(DEFAULT_PROCESSOR_INPUT_ID), numThreads(1)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -87,8 +92,8 @@ Batch::Batch(const Ionflux::GeoUtils::TransformNodes::Batch& other)
 Batch::Batch(Ionflux::GeoUtils::TransformNodes::TransformNode* 
 initProcessor, unsigned int initProcessorInputID, const 
 Ionflux::ObjectBase::IFObjectID& nodeID)
-: TransformNode(nodeID), source(0), processor(0), 
-processorInputID(initProcessorInputID)
+: TransformNode(nodeID), source(0), processorParamVersion(0), 
+processor(0), processorInputID(initProcessorInputID), numThreads(1)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -119,55 +124,15 @@ void Batch::updateControls(Ionflux::Mapping::MappingValue value)
 
 void Batch::updateControls(unsigned int index)
 {
-	double seqR = static_cast<double>(index) 
-	    / (inputs.size() - 1);
-	if (dimensions.size() == 0)
-	{
-	    // linear mode
-	    updateControls(seqR);
-	    return;
-	}
-	// array mode
-	std::ostringstream status;
-	Ionflux::ObjectBase::UIntVector coords;
-	Ionflux::ObjectBase::DoubleVector coordsRel;
-	seqToCoords(index, dimensions, coords);
-	getCoordsRel(coords, dimensions, coordsRel);
-	if (coordsRel.size() != coords.size())
-	{
-	    status << "[Batch::updateControls] " 
-	        "Unexpected number of relative coordinates "
-	        "(numCoordsRel = " << coordsRel.size() 
-	        << ", numCoords = " << coords.size() << ")!";
-	    throw GeoUtilsError(status.str());
-	}
-	for (ParamControlVector::const_iterator i = 
-	    controls.begin(); i != controls.end(); i++)
+	Ionflux::ObjectBase::DoubleVector v0;
+	getControlInputs(index, v0);
+	for (unsigned int i = 0; i < controls.size(); i++)
 	{
-	    ParamControl* c0 = *i;
+	    ParamControl* c0 = controls[i];
 	    if (c0 == 0)
 	        throw GeoUtilsError("[Batch::updateControls] "
 	            "Parameter control is null!");
-	    unsigned int ci0 = c0->getCoord();
-	    if (ci0 == COORDINATE_NOT_SET)
-	        // Use normalized sequence index to update parameter control.
-	        (*c0)(seqR);
-	    else
-	    {
-	        // Use normalized coordinate to update parameter control.
-	        if (ci0 >= coordsRel.size())
-	        {
-	            status.str("");
-	            status << "[Batch::updateControls] " 
-	                "Parameter control has invalid coordinate index "
-	                "(index = " << ci0 << ", numCoordsRel = " 
-	                << coordsRel.size() << ", numDimensions = " 
-	                << dimensions.size() << ", numCoords = " 
-	                << coords.size() << ", " << (*c0) << ")!";
-	            throw GeoUtilsError(status.str());
-	        }
-	        (*c0)(coordsRel[ci0]);
-	    }
+	    (*c0)(v0[i]);
 	}
 }
 
@@ -176,6 +141,28 @@ void Batch::process()
 	if (processor == 0)
 	    throw GeoUtilsError("[Batch::process] Processor node not set.");
 	clearInputGroups();
+	if (profiler != 0)
+	    processor->setProfiler(profiler);
+	unsigned int nt = numThreads;
+	if (nt == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        nt = np;
+	    else
+	        nt = 1;
+	}
+	if (nt > inputCache.size())
+	    nt = inputCache.size();
+	/* Processors that are not thread-safe (such as Render or WritePNG, which 
+	   write to a target image shared by all clones) are updated serially. */
+	if ((nt > 1) 
+	    && processor->isThreadSafe() 
+	    && processParallel(nt))
+	{
+	    processorParamVersion = processor->getTotalParamVersion();
+	    return;
+	}
 	// Process input groups.
 	/* <---- DEBUG ----- //
 	ostringstream message;
@@ -220,6 +207,7 @@ void Batch::process()
 	}
 	// Clear the link to the processor node.
 	processor->setInput(createInputNodeSpec(0, 0), processorInputID);
+	processorParamVersion = processor->getTotalParamVersion();
 	/* <---- DEBUG ----- //
 	message.str("");
 	message << "Number of outputs: " << outputs.size();
@@ -227,6 +215,230 @@ void Batch::process()
 	// ----- DEBUG ----> */
 }
 
+void Batch::getControlInputs(unsigned int index,
+Ionflux::ObjectBase::DoubleVector& target)
+{
+	double seqR = static_cast<double>(index) 
+	    / (inputs.size() - 1);
+	if (dimensions.size() == 0)
+	{
+	    // linear mode
+	    for (unsigned int i = 0; i < controls.size(); i++)
+	        target.push_back(seqR);
+	    return;
+	}
+	// array mode
+	std::ostringstream status;
+	Ionflux::ObjectBase::UIntVector coords;
+	Ionflux::ObjectBase::DoubleVector coordsRel;
+	seqToCoords(index, dimensions, coords);
+	getCoordsRel(coords, dimensions, coordsRel);
+	if (coordsRel.size() != coords.size())
+	{
+	    status << "[Batch::getControlInputs] " 
+	        "Unexpected number of relative coordinates "
+	        "(numCoordsRel = " << coordsRel.size() 
+	        << ", numCoords = " << coords.size() << ")!";
+	    throw GeoUtilsError(status.str());
+	}
+	for (ParamControlVector::const_iterator i = 
+	    controls.begin(); i != controls.end(); i++)
+	{
+	    ParamControl* c0 = *i;
+	    if (c0 == 0)
+	        throw GeoUtilsError("[Batch::getControlInputs] "
+	            "Parameter control is null!");
+	    unsigned int ci0 = c0->getCoord();
+	    if (ci0 == COORDINATE_NOT_SET)
+	        // Use normalized sequence index for the parameter control.
+	        target.push_back(seqR);
+	    else
+	    {
+	        // Use normalized coordinate for the parameter control.
+	        if (ci0 >= coordsRel.size())
+	        {
+	            status.str("");
+	            status << "[Batch::getControlInputs] " 
+	                "Parameter control has invalid coordinate index "
+	                "(index = " << ci0 << ", numCoordsRel = " 
+	                << coordsRel.size() << ", numDimensions = " 
+	                << dimensions.size() << ", numCoords = " 
+	                << coords.size() << ", " << (*c0) << ")!";
+	            throw GeoUtilsError(status.str());
+	        }
+	        target.push_back(coordsRel[ci0]);
+	    }
+	}
+}
+
+bool Batch::processParallel(unsigned int numThreads)
+{
+	unsigned int n = inputCache.size();
+	std::vector<BatchTask> t0(numThreads);
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    t0[i].state = 0;
+	    t0[i].source = 0;
+	    t0[i].processor = 0;
+	    t0[i].outputRefs = 0;
+	}
+	BatchUpdate u0;
+	u0.processorInputID = processorInputID;
+	u0.nextIndex = 0;
+	u0.error = false;
+	// Create a processor clone for each worker.
+	bool result = true;
+	for (unsigned int i = 0; result && (i < numThreads); i++)
+	{
+	    BatchTask& t1 = t0[i];
+	    t1.state = &u0;
+	    TransformNodeMap m0;
+	    t1.processor = processor->createClone(m0);
+	    addLocalRef(t1.processor);
+	    t1.processor->setProfiler(profiler);
+	    t1.source = Source::create();
+	    addLocalRef(t1.source);
+	    t1.processor->setInput(createInputNodeSpec(t1.source, 0), 
+	        processorInputID);
+	    t1.outputRefs = new IFObject();
+	    if (t1.outputRefs == 0)
+	        throw GeoUtilsError("[Batch::processParallel] "
+	            "Could not allocate object.");
+	    addLocalRef(t1.outputRefs);
+	    for (ParamControlVector::const_iterator j = controls.begin(); 
+	        result && (j != controls.end()); j++)
+	    {
+	        ParamControl* c0 = *j;
+	        if (c0 == 0)
+	            throw GeoUtilsError("[Batch::processParallel] "
+	                "Parameter control is null!");
+	        TransformNodeMap::iterator k = m0.find(c0->getNode());
+	        if (k != m0.end())
+	            t1.controlNodes.push_back((*k).second);
+	        else
+	            // Parameter controls must only affect the processor.
+	            result = false;
+	    }
+	}
+	if (result)
+	{
+	    /* Parameter values are determined by the calling thread, in input 
+	       order, since mappings may have shared state. */
+	    for (ParamControlVector::const_iterator i = controls.begin(); 
+	        i != controls.end(); i++)
+	        u0.paramIDs.push_back((*i)->getParamID());
+	    u0.paramValues.resize(n);
+	    for (unsigned int k = 0; (k < n) && (controls.size() > 0); k++)
+	    {
+	        Ionflux::ObjectBase::DoubleVector v0;
+	        getControlInputs(k, v0);
+	        for (unsigned int i = 0; i < controls.size(); i++)
+	            u0.paramValues[k].push_back(controls[i]->getValue(v0[i]));
+	    }
+	    /* Each worker gets a copy of its input group that does not share 
+	       any geometry with other input groups, since reference counts 
+	       are not synchronized. */
+	    for (TransformableGroupVector::iterator i = inputCache.begin(); 
+	        i != inputCache.end(); i++)
+	    {
+	        TransformableGroup* g0 = &((*i)->duplicate());
+	        addLocalRef(g0);
+	        u0.inputs.push_back(g0);
+	        copyItemVertices(*g0);
+	    }
+	    u0.outputs.resize(n);
+	    pthread_mutex_init(&(u0.mutex), 0);
+	    std::vector<pthread_t> threads(numThreads);
+	    std::vector<bool> threaded(numThreads, false);
+	    for (unsigned int i = 1; i < numThreads; i++)
+	        threaded[i] = (pthread_create(&(threads[i]), 0, processTask, 
+	            &(t0[i])) == 0);
+	    /* The calling thread takes part in the update. Input groups are 
+	       taken from a common queue, so all input groups are processed 
+	       even if no thread could be created. */
+	    processTask(&(t0[0]));
+	    for (unsigned int i = 1; i < numThreads; i++)
+	    {
+	        if (threaded[i])
+	            pthread_join(threads[i], 0);
+	    }
+	    pthread_mutex_destroy(&(u0.mutex));
+	    if (!u0.error)
+	    {
+	        // Gather the output groups in input order.
+	        for (unsigned int k = 0; k < n; k++)
+	        {
+	            TransformableGroupVector& v1 = u0.outputs[k];
+	            for (TransformableGroupVector::iterator i = v1.begin(); 
+	                i != v1.end(); i++)
+	                addOutput(*i);
+	        }
+	    }
+	}
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    BatchTask& t1 = t0[i];
+	    if (t1.outputRefs != 0)
+	        removeLocalRef(t1.outputRefs);
+	    if (t1.processor != 0)
+	        removeLocalRef(t1.processor);
+	    if (t1.source != 0)
+	        removeLocalRef(t1.source);
+	}
+	for (TransformableGroupVector::iterator i = u0.inputs.begin(); 
+	    i != u0.inputs.end(); i++)
+	    removeLocalRef(*i);
+	if (u0.error)
+	    throw GeoUtilsError("[Batch::processParallel] " + u0.errorMessage);
+	return result;
+}
+
+void* Batch::processTask(void* taskArg)
+{
+	BatchTask* t0 = static_cast<BatchTask*>(taskArg);
+	BatchUpdate& u0 = *(t0->state);
+	while (true)
+	{
+	    pthread_mutex_lock(&(u0.mutex));
+	    unsigned int k = u0.nextIndex;
+	    bool done = u0.error 
+	        || (k >= u0.inputs.size());
+	    if (!done)
+	        u0.nextIndex++;
+	    pthread_mutex_unlock(&(u0.mutex));
+	    if (done)
+	        break;
+	    try
+	    {
+	        Ionflux::ObjectBase::DoubleVector& v0 = u0.paramValues[k];
+	        for (unsigned int i = 0; i < v0.size(); i++)
+	        {
+	            TransformNode* n0 = t0->controlNodes[i];
+	            n0->setParam(u0.paramIDs[i], v0[i]);
+	        }
+	        t0->source->setSource(u0.inputs[k]);
+	        t0->processor->update();
+	        for (unsigned int j = 0; j < t0->processor->getNumOutputs(); j++)
+	        {
+	            TransformableGroup* g0 = t0->processor->getOutput(j);
+	            t0->outputRefs->addLocalRef(g0);
+	            u0.outputs[k].push_back(g0);
+	        }
+	        t0->processor->clearOutputs();
+	    } catch (std::exception& e)
+	    {
+	        pthread_mutex_lock(&(u0.mutex));
+	        if (!u0.error)
+	        {
+	            u0.error = true;
+	            u0.errorMessage = e.what();
+	        }
+	        pthread_mutex_unlock(&(u0.mutex));
+	    }
+	}
+	return 0;
+}
+
 std::string Batch::getString() const
 {
 	ostringstream status;
@@ -239,6 +451,29 @@ std::string Batch::getString() const
 	return status.str();
 }
 
+bool Batch::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
+bool Batch::isDirty() const
+{
+	bool result = TransformNode::isDirty() 
+	    || ((processor != 0) 
+	        && (processor->getTotalParamVersion() 
+	            != processorParamVersion));
+	return result;
+}
+
+unsigned int Batch::getTotalParamVersion() const
+{
+	unsigned int result = paramVersion;
+	if (processor != 0)
+	    result += processor->getTotalParamVersion();
+	return result;
+}
+
 void Batch::addControls(Ionflux::GeoUtils::ParamControlVector& newControls)
 {
 	for (ParamControlVector::iterator i = newControls.begin(); 
@@ -250,6 +485,7 @@ void Batch::setProcessor(Ionflux::GeoUtils::TransformNodes::TransformNode*
 newProcessor)
 {
 	processor = newProcessor;
+	touch();
 }
 
 Ionflux::GeoUtils::TransformNodes::TransformNode* Batch::getProcessor() 
@@ -306,6 +542,7 @@ addElement)
 {
 	addLocalRef(addElement);
 	controls.push_back(addElement);
+	touch();
 }
 
 void Batch::removeControl(Ionflux::GeoUtils::TransformNodes::ParamControl* 
@@ -328,6 +565,7 @@ removeElement)
 		controls.erase(controls.begin() + i);
 		if (currentControl != 0)
 			removeLocalRef(currentControl);
+		touch();
 	}
 }
 
@@ -339,6 +577,7 @@ void Batch::removeControlIndex(unsigned int removeIndex)
     controls.erase(controls.begin() + removeIndex);
     if (e0 != 0)
         removeLocalRef(e0);
+	touch();
 }
 
 void Batch::clearControls()
@@ -348,11 +587,13 @@ void Batch::clearControls()
 		if (*i != 0)
 			removeLocalRef(*i);
 	controls.clear();
+	touch();
 }
 
 void Batch::setProcessorInputID(unsigned int newProcessorInputID)
 {
 	processorInputID = newProcessorInputID;
+	touch();
 }
 
 unsigned int Batch::getProcessorInputID() const
@@ -403,6 +644,7 @@ std::vector<unsigned int>& Batch::getDimensions()
 void Batch::addDimension(unsigned int addElement)
 {
 	dimensions.push_back(addElement);
+	touch();
 }
 
 void Batch::removeDimension(unsigned int removeElement)
@@ -422,6 +664,7 @@ void Batch::removeDimension(unsigned int removeElement)
 	if (found)
 	{
 		dimensions.erase(dimensions.begin() + i);
+		touch();
 	}
 }
 
@@ -430,11 +673,23 @@ void Batch::removeDimensionIndex(unsigned int removeIndex)
     if (removeIndex > dimensions.size())
         return;
     dimensions.erase(dimensions.begin() + removeIndex);
+	touch();
 }
 
 void Batch::clearDimensions()
 {
     dimensions.clear();
+	touch();
+}
+
+void Batch::setNumThreads(unsigned int newNumThreads)
+{
+	numThreads = newNumThreads;
+}
+
+unsigned int Batch::getNumThreads() const
+{
+    return numThreads;
 }
 
 Ionflux::GeoUtils::TransformNodes::Batch& Batch::operator=(const 
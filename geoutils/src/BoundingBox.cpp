@@ -32,6 +32,8 @@
 #include <sstream>
 #include <iomanip>
 #include <fstream>
+#include <pthread.h>
+#include <unistd.h>
 #include "geoutils/GeoUtilsError.hpp"
 
 using namespace std;
@@ -92,6 +94,428 @@ BoundingBox::~BoundingBox()
 	// TODO: Nothing ATM. ;-)
 }
 
+double BoundingBox::getSAHArea(const double* lower, const double* upper)
+{
+	double dx = upper[0] - lower[0];
+	double dy = upper[1] - lower[1];
+	double dz = upper[2] - lower[2];
+	return 2. * (dx * dy + dy * dz + dz * dx);
+}
+
+unsigned int BoundingBox::getSAHSplit(Ionflux::GeoUtils::SAHItemVector&
+sahItems, unsigned int first, unsigned int last, unsigned int numBins)
+{
+	unsigned int n = last - first;
+	if (n < 2)
+	    return first;
+	// Bounds of the item centers.
+	double cl[3];
+	double cu[3];
+	for (unsigned int k = 0; k < 3; k++)
+	{
+	    cl[k] = sahItems[first].center[k];
+	    cu[k] = cl[k];
+	}
+	for (unsigned int i = first + 1; i < last; i++)
+	{
+	    const SAHItem& it = sahItems[i];
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        if (it.center[k] < cl[k])
+	            cl[k] = it.center[k];
+	        if (it.center[k] > cu[k])
+	            cu[k] = it.center[k];
+	    }
+	}
+	std::vector<unsigned int> binCounts(numBins);
+	std::vector<double> binLower(3 * numBins);
+	std::vector<double> binUpper(3 * numBins);
+	std::vector<unsigned int> upperCounts(numBins);
+	std::vector<double> upperCosts(numBins);
+	int bestAxis = -1;
+	unsigned int bestBin = 0;
+	double bestCost = 0.;
+	double bestScale = 0.;
+	for (unsigned int a = 0; a < 3; a++)
+	{
+	    double e0 = cu[a] - cl[a];
+	    if (e0 <= 0.)
+	        continue;
+	    double s0 = numBins / e0;
+	    // Sort the items into bins.
+	    for (unsigned int j = 0; j < numBins; j++)
+	        binCounts[j] = 0;
+	    for (unsigned int i = first; i < last; i++)
+	    {
+	        const SAHItem& it = sahItems[i];
+	        unsigned int b = static_cast<unsigned int>(
+	            (it.center[a] - cl[a]) * s0);
+	        if (b >= numBins)
+	            b = numBins - 1;
+	        double* bl = &(binLower[3 * b]);
+	        double* bu = &(binUpper[3 * b]);
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            if ((binCounts[b] == 0)
+	                || (it.lower[k] < bl[k]))
+	                bl[k] = it.lower[k];
+	            if ((binCounts[b] == 0)
+	                || (it.upper[k] > bu[k]))
+	                bu[k] = it.upper[k];
+	        }
+	        binCounts[b]++;
+	    }
+	    // Sweep from the upper end to get the costs of the upper partitions.
+	    double pl[3];
+	    double pu[3];
+	    unsigned int np = 0;
+	    for (unsigned int j = numBins - 1; j > 0; j--)
+	    {
+	        if (binCounts[j] > 0)
+	        {
+	            const double* bl = &(binLower[3 * j]);
+	            const double* bu = &(binUpper[3 * j]);
+	            for (unsigned int k = 0; k < 3; k++)
+	            {
+	                if ((np == 0) || (bl[k] < pl[k]))
+	                    pl[k] = bl[k];
+	                if ((np == 0) || (bu[k] > pu[k]))
+	                    pu[k] = bu[k];
+	            }
+	            np += binCounts[j];
+	        }
+	        upperCounts[j] = np;
+	        if (np > 0)
+	            upperCosts[j] = np * getSAHArea(pl, pu);
+	        else
+	            upperCosts[j] = 0.;
+	    }
+	    /* Sweep from the lower end and evaluate the split after each bin. 
+	       The cost of a split is the sum of the surface areas of the two 
+	       partitions, weighted by the number of items they contain. */
+	    np = 0;
+	    for (unsigned int j = 0; j < (numBins - 1); j++)
+	    {
+	        if (binCounts[j] > 0)
+	        {
+	            const double* bl = &(binLower[3 * j]);
+	            const double* bu = &(binUpper[3 * j]);
+	            for (unsigned int k = 0; k < 3; k++)
+	            {
+	                if ((np == 0) || (bl[k] < pl[k]))
+	                    pl[k] = bl[k];
+	                if ((np == 0) || (bu[k] > pu[k]))
+	                    pu[k] = bu[k];
+	            }
+	            np += binCounts[j];
+	        }
+	        if ((np == 0) 
+	            || (upperCounts[j + 1] == 0))
+	            continue;
+	        double c0 = np * getSAHArea(pl, pu) + upperCosts[j + 1];
+	        if ((bestAxis < 0) 
+	            || (c0 < bestCost))
+	        {
+	            bestAxis = a;
+	            bestBin = j;
+	            bestCost = c0;
+	            bestScale = s0;
+	        }
+	    }
+	}
+	if (bestAxis < 0)
+	{
+	    // All item centers coincide.
+	    return first + n / 2;
+	}
+	// Partition the item records.
+	unsigned int i0 = first;
+	unsigned int i1 = last;
+	while (i0 < i1)
+	{
+	    unsigned int b = static_cast<unsigned int>(
+	        (sahItems[i0].center[bestAxis] - cl[bestAxis]) * bestScale);
+	    if (b <= bestBin)
+	        i0++;
+	    else
+	    {
+	        i1--;
+	        SAHItem t0 = sahItems[i0];
+	        sahItems[i0] = sahItems[i1];
+	        sahItems[i1] = t0;
+	    }
+	}
+	return i0;
+}
+
+void BoundingBox::buildSAH(Ionflux::GeoUtils::SAHItemVector& sahItems,
+unsigned int first, unsigned int last, unsigned int numBins, unsigned
+int maxLeafItems, unsigned int maxLevel, unsigned int splitLevel,
+unsigned int parallelDepth)
+{
+	unsigned int mid = first;
+	if (((last - first) > maxLeafItems) 
+	    && ((maxLevel == 0) || (splitLevel < maxLevel)))
+	    mid = getSAHSplit(sahItems, first, last, numBins);
+	if (mid == first)
+	{
+	    for (unsigned int i = first; i < last; i++)
+	        addItem(sahItems[i].item);
+	    return;
+	}
+	BoundingBoxPair boxes = buildSAHChildren(sahItems, first, mid, last, 
+	    numBins, maxLeafItems, maxLevel, splitLevel, parallelDepth);
+	addItem(boxes.b0);
+	addItem(boxes.b1);
+}
+
+Ionflux::GeoUtils::BoundingBoxPair
+BoundingBox::buildSAHChildren(Ionflux::GeoUtils::SAHItemVector&
+sahItems, unsigned int first, unsigned int mid, unsigned int last,
+unsigned int numBins, unsigned int maxLeafItems, unsigned int maxLevel,
+unsigned int splitLevel, unsigned int parallelDepth)
+{
+	BoundingBoxPair result;
+	result.b0 = new BoundingBox();
+	if (result.b0 == 0)
+	    throw GeoUtilsError("Could not allocate object.");
+	result.b0->setLevel(splitLevel + 1);
+	result.b1 = new BoundingBox();
+	if (result.b1 == 0)
+	    throw GeoUtilsError("Could not allocate object.");
+	result.b1->setLevel(splitLevel + 1);
+	unsigned int pd = 0;
+	if (parallelDepth > 0)
+	    pd = parallelDepth - 1;
+	SAHBuildTask tasks[2];
+	for (unsigned int i = 0; i < 2; i++)
+	{
+	    SAHBuildTask& t0 = tasks[i];
+	    t0.items = &sahItems;
+	    t0.numBins = numBins;
+	    t0.maxLeafItems = maxLeafItems;
+	    t0.maxLevel = maxLevel;
+	    t0.splitLevel = splitLevel + 1;
+	    t0.parallelDepth = pd;
+	    t0.error = false;
+	}
+	tasks[0].box = result.b0;
+	tasks[0].first = first;
+	tasks[0].last = mid;
+	tasks[1].box = result.b1;
+	tasks[1].first = mid;
+	tasks[1].last = last;
+	bool threaded = false;
+	pthread_t thread0;
+	if ((parallelDepth > 0) 
+	    && ((last - first) >= SAH_PARALLEL_MIN_ITEMS))
+	    threaded = (pthread_create(&thread0, 0, buildSAHTask, 
+	        &(tasks[0])) == 0);
+	if (!threaded)
+	    buildSAHTask(&(tasks[0]));
+	buildSAHTask(&(tasks[1]));
+	if (threaded)
+	    pthread_join(thread0, 0);
+	for (unsigned int i = 0; i < 2; i++)
+	{
+	    if (tasks[i].error)
+	    {
+	        delete result.b0;
+	        delete result.b1;
+	        throw GeoUtilsError(tasks[i].errorMessage);
+	    }
+	}
+	return result;
+}
+
+void* BoundingBox::buildSAHTask(void* taskArg)
+{
+	SAHBuildTask* t0 = static_cast<SAHBuildTask*>(taskArg);
+	try
+	{
+	    t0->box->buildSAH(*(t0->items), t0->first, t0->last, t0->numBins, 
+	        t0->maxLeafItems, t0->maxLevel, t0->splitLevel, t0->parallelDepth);
+	} catch (std::exception& e)
+	{
+	    t0->error = true;
+	    t0->errorMessage = e.what();
+	}
+	return 0;
+}
+
+double BoundingBox::getItemsArea(Ionflux::GeoUtils::BoxBoundsItem*
+exclude, Ionflux::GeoUtils::BoxBoundsItem* include) const
+{
+	double lower[3];
+	double upper[3];
+	bool e0 = true;
+	BoxBoundsItemSet::const_iterator i = items.begin();
+	bool finished = false;
+	while (!finished)
+	{
+	    BoxBoundsItem* it = 0;
+	    if (i != items.end())
+	    {
+	        it = *i;
+	        i++;
+	        if (it == exclude)
+	            continue;
+	    } else
+	    {
+	        it = include;
+	        finished = true;
+	    }
+	    if (it == 0)
+	        continue;
+	    Vector3 c0 = it->getCenter();
+	    Vector3 r0 = it->getRVec();
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        double l0 = c0[k] - ::fabs(r0[k]);
+	        double u0 = c0[k] + ::fabs(r0[k]);
+	        if (e0 || (l0 < lower[k]))
+	            lower[k] = l0;
+	        if (e0 || (u0 > upper[k]))
+	            upper[k] = u0;
+	    }
+	    e0 = false;
+	}
+	if (e0)
+	    return 0.;
+	return getSAHArea(lower, upper);
+}
+
+void BoundingBox::refitBounds()
+{
+	if (items.size() == 0) 
+	    return;
+	bool e0 = true;
+	for (BoxBoundsItemSet::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoxBoundsItem* it = *i;
+	    if (e0)
+	    {
+	        bounds.setBounds(it->getCenter());
+	        e0 = false;
+	    }
+	    bounds.extend(it->getCenter() + it->getRVec());
+	    bounds.extend(it->getCenter() - it->getRVec());
+	}
+	updateRadiusAndCenter();
+}
+
+double BoundingBox::refitImpl(bool updateItems)
+{
+	double result = 0.;
+	for (BoxBoundsItemSet::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoxBoundsItem* it = *i;
+	    BoundingBox* b0 = BoundingBox::upcast(it);
+	    if (b0 != 0)
+	        result += b0->refitImpl(updateItems);
+	    else
+	    if (updateItems)
+	        it->updateBounds();
+	}
+	refitBounds();
+	result += getItemsArea();
+	return result;
+}
+
+void BoundingBox::updateLevels(int newLevel)
+{
+	level = newLevel;
+	for (BoxBoundsItemSet::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoundingBox* b0 = BoundingBox::upcast(*i);
+	    if (b0 != 0)
+	        b0->updateLevels(level + 1);
+	}
+}
+
+bool BoundingBox::rotateNode()
+{
+	if (items.size() < 2)
+	    return false;
+	BoundingBox* bestBox = 0;
+	BoxBoundsItem* bestUp = 0;
+	BoxBoundsItem* bestDown = 0;
+	double bestGain = 0.;
+	for (BoxBoundsItemSet::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoundingBox* c0 = BoundingBox::upcast(*i);
+	    if ((c0 == 0) 
+	        || (c0->items.size() == 0))
+	        continue;
+	    double a0 = c0->getItemsArea();
+	    for (BoxBoundsItemSet::iterator j = items.begin(); 
+	        j != items.end(); j++)
+	    {
+	        BoxBoundsItem* down = *j;
+	        if (down == c0)
+	            continue;
+	        for (BoxBoundsItemSet::iterator k = c0->items.begin(); 
+	            k != c0->items.end(); k++)
+	        {
+	            BoxBoundsItem* up = *k;
+	            double gain = a0 - c0->getItemsArea(up, down);
+	            if ((gain > bestGain) 
+	                && (gain > (DEFAULT_TOLERANCE * a0)))
+	            {
+	                bestBox = c0;
+	                bestUp = up;
+	                bestDown = down;
+	                bestGain = gain;
+	            }
+	        }
+	    }
+	}
+	if (bestBox == 0)
+	    return false;
+	// Keep references while the items are exchanged.
+	bestBox->addLocalRef(bestDown);
+	addLocalRef(bestUp);
+	bestBox->items.erase(bestUp);
+	items.erase(bestDown);
+	bestBox->items.insert(bestDown);
+	items.insert(bestUp);
+	bestBox->removeLocalRef(bestUp);
+	removeLocalRef(bestDown);
+	BoundingBox* b0 = BoundingBox::upcast(bestDown);
+	if (b0 != 0)
+	{
+	    b0->setParent(bestBox);
+	    b0->updateLevels(bestBox->getLevel() + 1);
+	}
+	b0 = BoundingBox::upcast(bestUp);
+	if (b0 != 0)
+	{
+	    b0->setParent(this);
+	    b0->updateLevels(level + 1);
+	}
+	bestBox->refitBounds();
+	return true;
+}
+
+unsigned int BoundingBox::rotateImpl()
+{
+	unsigned int result = 0;
+	for (BoxBoundsItemSet::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoundingBox* b0 = BoundingBox::upcast(*i);
+	    if (b0 != 0)
+	        result += b0->rotateImpl();
+	}
+	if (rotateNode())
+	    result++;
+	return result;
+}
+
 void BoundingBox::update()
 {
 	if (items.size() == 0) 
@@ -540,6 +964,108 @@ double t, bool preferLongestAxis, double longestAxisTolerance)
 	return result;
 }
 
+Ionflux::GeoUtils::SplitResult BoundingBox::splitSAH(unsigned int
+maxLeafItems, unsigned int numBins, unsigned int maxLevel, unsigned int
+numThreads)
+{
+	SplitResult result;
+	result.success = false;
+	result.boxes.b0 = 0;
+	result.boxes.b1 = 0;
+	if (numBins < 2)
+	    throw GeoUtilsError("[BoundingBox::splitSAH] "
+	        "Number of bins must be at least 2.");
+	if (maxLeafItems < 1)
+	    throw GeoUtilsError("[BoundingBox::splitSAH] "
+	        "Maximum number of leaf items must be at least 1.");
+	if ((items.size() <= maxLeafItems) 
+	    || ((maxLevel > 0) 
+	        && (level >= static_cast<int>(maxLevel))))
+	    return result;
+	SAHItemVector sahItems;
+	sahItems.reserve(items.size());
+	for (BoxBoundsItemSet::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoxBoundsItem* it = *i;
+	    Vector3 c0 = it->getCenter();
+	    Vector3 r0 = it->getRVec();
+	    SAHItem si;
+	    si.item = it;
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        si.center[k] = c0[k];
+	        si.lower[k] = c0[k] - ::fabs(r0[k]);
+	        si.upper[k] = c0[k] + ::fabs(r0[k]);
+	    }
+	    sahItems.push_back(si);
+	}
+	unsigned int n = sahItems.size();
+	unsigned int mid = getSAHSplit(sahItems, 0, n, numBins);
+	if (mid == 0)
+	    return result;
+	if (numThreads == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        numThreads = np;
+	    else
+	        numThreads = 1;
+	}
+	unsigned int parallelDepth = 0;
+	while ((1U << parallelDepth) < numThreads)
+	    parallelDepth++;
+	result.boxes = buildSAHChildren(sahItems, 0, mid, n, numBins, 
+	    maxLeafItems, maxLevel, level, parallelDepth);
+	/* The new boxes hold references to the items now, so the items can be 
+	   removed from this box. */
+	clear();
+	addItem(result.boxes.b0);
+	addItem(result.boxes.b1);
+	result.success = true;
+	return result;
+}
+
+double BoundingBox::refit(bool updateItems, double refArea, double
+maxAreaRatio, unsigned int maxPasses)
+{
+	double result = refitImpl(updateItems);
+	if ((refArea > 0.) 
+	    && (result > (refArea * maxAreaRatio)) 
+	    && (rotate(maxPasses) > 0))
+	    result = getTotalArea();
+	return result;
+}
+
+unsigned int BoundingBox::rotate(unsigned int maxPasses)
+{
+	unsigned int result = 0;
+	unsigned int numPasses = 0;
+	unsigned int n0 = 1;
+	while ((n0 > 0) 
+	    && ((maxPasses == 0) 
+	        || (numPasses < maxPasses)))
+	{
+	    n0 = rotateImpl();
+	    result += n0;
+	    numPasses++;
+	}
+	return result;
+}
+
+double BoundingBox::getTotalArea() const
+{
+	double result = getItemsArea();
+	for (BoxBoundsItemSet::const_iterator i = items.begin(); 
+	    i != items.end(); i++)
+	{
+	    BoundingBox* b0 = BoundingBox::upcast(*i);
+	    if (b0 != 0)
+	        result += b0->getTotalArea();
+	}
+	return result;
+}
+
 Ionflux::GeoUtils::BoxBoundsItemSet 
 BoundingBox::getItemsAbovePlane(Ionflux::GeoUtils::Plane3& plane, double t)
 {
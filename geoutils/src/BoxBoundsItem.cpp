@@ -30,7 +30,9 @@
 #include <cstdlib>
 #include <sstream>
 #include <iomanip>
+#include <cfloat>
 #include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/vecmath.hpp"
 
 using namespace std;
 using namespace Ionflux::ObjectBase;
@@ -88,6 +90,45 @@ BoxBoundsItem::~BoxBoundsItem()
 	// TODO: Nothing ATM. ;-)
 }
 
+bool BoxBoundsItem::getLineInterval(const Ionflux::GeoUtils::Line3&
+line, double& tNear, double& tFar, double t) const
+{
+	Vec3 p0(line.getP());
+	Vec3 u0(line.getU());
+	Vec3 c0(center);
+	Vec3 r0(rVec);
+	tNear = -DBL_MAX;
+	tFar = DBL_MAX;
+	for (unsigned int i = 0; i < 3; i++)
+	{
+	    double bMin = c0[i] - r0[i] - t;
+	    double bMax = c0[i] + r0[i] + t;
+	    if (u0[i] == 0.)
+	    {
+	        // line is parallel to the slab
+	        if ((p0[i] < bMin) || (p0[i] > bMax))
+	            return false;
+	        continue;
+	    }
+	    double s0 = 1. / u0[i];
+	    double t0 = (bMin - p0[i]) * s0;
+	    double t1 = (bMax - p0[i]) * s0;
+	    if (t0 > t1)
+	    {
+	        double t2 = t0;
+	        t0 = t1;
+	        t1 = t2;
+	    }
+	    if (t0 > tNear)
+	        tNear = t0;
+	    if (t1 < tFar)
+	        tFar = t1;
+	    if (tNear > tFar)
+	        return false;
+	}
+	return true;
+}
+
 void BoxBoundsItem::updateBounds()
 {
 	bounds = Range3(center);
@@ -235,22 +276,9 @@ sphere, double t)
 bool BoxBoundsItem::checkLine(const Ionflux::GeoUtils::Line3& line, double 
 t)
 {
-	Polygon3Vector faces = getBoxFaces();
-	for (Polygon3Vector::iterator i = faces.begin(); i != faces.end(); i++)
-	{
-	    Polygon3* p0 = *i;
-	    if (line.intersectionInPoly(*p0, t))
-	    {
-	        /* <---- DEBUG ----- //
-	        std::cerr << "[BoxBoundsItem::checkLine] "
-	        << "intersection: " << p0->getString() << std::endl;
-	        // ----- DEBUG ----> */
-	        return true;
-	    }
-	}
-	clearBoxVertices();
-	clearBoxFaces();
-	return false;
+	double tNear = 0.;
+	double tFar = 0.;
+	return getLineInterval(line, tNear, tFar, t);
 }
 
 bool BoxBoundsItem::checkLineInner(const Ionflux::GeoUtils::Line3& line, 
@@ -294,14 +322,11 @@ other, double t)
 
 bool BoxBoundsItem::checkRay(const Ionflux::GeoUtils::Line3& ray, double t)
 {
-	/* Do a plane check first to see if the item is in the 
-	   same half space as the ray. */
-	// TODO: Use a ray class to avoid creating a new plane for each check.
-	Plane3 p = Plane3::createFromNormal(ray.getU(), Vector3::E_X, 
-	    ray.getP());
-	if (checkPlane(p, t) == -1)
+	double tNear = 0.;
+	double tFar = 0.;
+	if (!getLineInterval(ray, tNear, tFar, t))
 	    return false;
-	return checkLine(ray, t);
+	return (tFar >= 0.);
 }
 
 bool BoxBoundsItem::checkRayInner(const Ionflux::GeoUtils::Line3& ray, 
@@ -0,0 +1,775 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * BoxBoundsTree.cpp               Box bounds tree (implementation).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/BoxBoundsTree.hpp"
+#include <cmath>
+#include <cfloat>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include "ifobject/objectutils.hpp"
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Range3.hpp"
+#include "geoutils/Line3.hpp"
+#include "geoutils/Sphere3.hpp"
+#include "geoutils/BoxBoundsItem.hpp"
+#include "geoutils/BoundingBox.hpp"
+
+using namespace std;
+using namespace Ionflux::ObjectBase;
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+BoxBoundsTreeClassInfo::BoxBoundsTreeClassInfo()
+{
+	name = "BoxBoundsTree";
+	desc = "Box bounds tree";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+BoxBoundsTreeClassInfo::~BoxBoundsTreeClassInfo()
+{
+}
+
+// run-time type information instance constants
+const BoxBoundsTreeClassInfo BoxBoundsTree::boxBoundsTreeClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* BoxBoundsTree::CLASS_INFO = &BoxBoundsTree::boxBoundsTreeClassInfo;
+
+BoxBoundsTree::BoxBoundsTree()
+: depth(0), tolerance(Ionflux::GeoUtils::DEFAULT_TOLERANCE)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	// TODO: Nothing ATM. ;-)
+}
+
+BoxBoundsTree::BoxBoundsTree(const Ionflux::GeoUtils::BoxBoundsTree& other)
+: depth(0), tolerance(Ionflux::GeoUtils::DEFAULT_TOLERANCE)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	*this = other;
+}
+
+BoxBoundsTree::~BoxBoundsTree()
+{
+	clear();
+}
+
+float BoxBoundsTree::toFloatLower(double v)
+{
+	float result = static_cast<float>(v);
+	if (result > v)
+	    result -= ::fabs(result) * FLT_EPSILON + FLT_MIN;
+	return result;
+}
+
+float BoxBoundsTree::toFloatUpper(double v)
+{
+	float result = static_cast<float>(v);
+	if (result < v)
+	    result += ::fabs(result) * FLT_EPSILON + FLT_MIN;
+	return result;
+}
+
+void BoxBoundsTree::updateItemBounds(unsigned int itemIndex)
+{
+	BoxBoundsItem* it = items[itemIndex];
+	Vector3 c0 = it->getCenter();
+	Vector3 r0 = it->getRVec();
+	float* b0 = &(itemBounds[6 * itemIndex]);
+	for (unsigned int k = 0; k < 3; k++)
+	{
+	    b0[k] = toFloatLower(c0[k] - ::fabs(r0[k]) - tolerance);
+	    b0[k + 3] = toFloatUpper(c0[k] + ::fabs(r0[k]) + tolerance);
+	}
+}
+
+void BoxBoundsTree::addItemRecord(Ionflux::GeoUtils::BoxBoundsItem*
+item)
+{
+	addLocalRef(item);
+	items.push_back(item);
+	itemBounds.resize(6 * items.size());
+	updateItemBounds(items.size() - 1);
+}
+
+void BoxBoundsTree::getSlots(Ionflux::GeoUtils::BoundingBox* box,
+Ionflux::GeoUtils::BoxBoundsTreeSlotVector& target)
+{
+	BoxBoundsItemSet bi;
+	box->getItems(bi);
+	BoxBoundsTreeSlot leaf;
+	leaf.box = 0;
+	leaf.area = 0.;
+	for (BoxBoundsItemSet::iterator i = bi.begin(); i != bi.end(); i++)
+	{
+	    BoxBoundsItem* it = *i;
+	    BoundingBox* b0 = BoundingBox::upcast(it);
+	    if (b0 != 0)
+	    {
+	        if (b0->getNumItems() == 0)
+	            continue;
+	        BoxBoundsTreeSlot s0;
+	        s0.box = b0;
+	        Vector3 e0 = b0->getBounds().getExtent();
+	        s0.area = 2. * (e0[0] * e0[1] + e0[1] * e0[2] 
+	            + e0[2] * e0[0]);
+	        target.push_back(s0);
+	    } else
+	        leaf.items.push_back(it);
+	}
+	if (leaf.items.size() > 0)
+	    target.push_back(leaf);
+}
+
+void
+BoxBoundsTree::expandSlots(Ionflux::GeoUtils::BoxBoundsTreeSlotVector&
+slots)
+{
+	bool expanded = true;
+	while (expanded 
+	    && (slots.size() < 4))
+	{
+	    expanded = false;
+	    int best = -1;
+	    BoxBoundsTreeSlotVector bestSlots;
+	    for (unsigned int i = 0; i < slots.size(); i++)
+	    {
+	        BoxBoundsTreeSlot& s0 = slots[i];
+	        if ((s0.box == 0) 
+	            || ((best >= 0) && (s0.area <= slots[best].area)))
+	            continue;
+	        BoxBoundsTreeSlotVector cs;
+	        getSlots(s0.box, cs);
+	        if ((slots.size() - 1 + cs.size()) <= 4)
+	        {
+	            best = i;
+	            bestSlots = cs;
+	        }
+	    }
+	    if (best >= 0)
+	    {
+	        slots.erase(slots.begin() + best);
+	        slots.insert(slots.end(), bestSlots.begin(), bestSlots.end());
+	        expanded = true;
+	    }
+	}
+}
+
+void BoxBoundsTree::getNodeBounds(int nodeIndex, float* lower, float*
+upper) const
+{
+	const BoxBoundsTreeNode& n0 = nodes[nodeIndex];
+	for (unsigned int k = 0; k < 3; k++)
+	{
+	    lower[k] = FLT_MAX;
+	    upper[k] = -FLT_MAX;
+	    for (unsigned int j = 0; j < 4; j++)
+	    {
+	        if (n0.child[j] == 0)
+	            continue;
+	        if (n0.lower[k][j] < lower[k])
+	            lower[k] = n0.lower[k][j];
+	        if (n0.upper[k][j] > upper[k])
+	            upper[k] = n0.upper[k][j];
+	    }
+	}
+}
+
+void BoxBoundsTree::getItemRangeBounds(unsigned int first, unsigned int
+num, float* lower, float* upper) const
+{
+	for (unsigned int k = 0; k < 3; k++)
+	{
+	    lower[k] = FLT_MAX;
+	    upper[k] = -FLT_MAX;
+	}
+	for (unsigned int i = first; i < (first + num); i++)
+	{
+	    const float* b0 = &(itemBounds[6 * i]);
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        if (b0[k] < lower[k])
+	            lower[k] = b0[k];
+	        if (b0[k + 3] > upper[k])
+	            upper[k] = b0[k + 3];
+	    }
+	}
+}
+
+int BoxBoundsTree::buildNode(Ionflux::GeoUtils::BoxBoundsTreeSlotVector&
+slots, unsigned int nodeDepth)
+{
+	int n0 = nodes.size();
+	BoxBoundsTreeNode nd;
+	for (unsigned int j = 0; j < 4; j++)
+	{
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        nd.lower[k][j] = FLT_MAX;
+	        nd.upper[k][j] = -FLT_MAX;
+	    }
+	    nd.child[j] = 0;
+	    nd.numItems[j] = 0;
+	}
+	nodes.push_back(nd);
+	if (nodeDepth > depth)
+	    depth = nodeDepth;
+	expandSlots(slots);
+	unsigned int numSlots = slots.size();
+	unsigned int numChunks = numSlots;
+	if (numChunks > 4)
+	    numChunks = 4;
+	for (unsigned int c = 0; c < numChunks; c++)
+	{
+	    unsigned int first = c * numSlots / numChunks;
+	    unsigned int last = (c + 1) * numSlots / numChunks;
+	    int child = 0;
+	    unsigned int numItems = 0;
+	    float l0[3];
+	    float u0[3];
+	    if ((last - first) > 1)
+	    {
+	        // Too many slots, add an intermediate node.
+	        BoxBoundsTreeSlotVector cs(slots.begin() + first, 
+	            slots.begin() + last);
+	        child = buildNode(cs, nodeDepth + 1);
+	        getNodeBounds(child, l0, u0);
+	    } else
+	    if (slots[first].box != 0)
+	    {
+	        BoxBoundsTreeSlotVector cs;
+	        getSlots(slots[first].box, cs);
+	        child = buildNode(cs, nodeDepth + 1);
+	        getNodeBounds(child, l0, u0);
+	    } else
+	    {
+	        BoxBoundsItemVector& li = slots[first].items;
+	        unsigned int i0 = items.size();
+	        child = -static_cast<int>(i0) - 1;
+	        numItems = li.size();
+	        for (unsigned int i = 0; i < numItems; i++)
+	            addItemRecord(li[i]);
+	        getItemRangeBounds(i0, numItems, l0, u0);
+	    }
+	    // The node vector may have been reallocated by the recursion.
+	    BoxBoundsTreeNode& nd0 = nodes[n0];
+	    nd0.child[c] = child;
+	    nd0.numItems[c] = numItems;
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        nd0.lower[k][c] = l0[k];
+	        nd0.upper[k][c] = u0[k];
+	    }
+	}
+	return n0;
+}
+
+Ionflux::GeoUtils::BoxBoundsItem* BoxBoundsTree::castRay(const
+Ionflux::GeoUtils::Line3& ray, bool line,
+Ionflux::GeoUtils::BoxBoundsTreeQueryID query,
+Ionflux::GeoUtils::BoxBoundsItemVector* target, double t)
+{
+	if (nodes.size() == 0)
+	    return 0;
+	Vector3 p0 = ray.getP();
+	Vector3 u0 = ray.getU();
+	float o[3];
+	float inv[3];
+	for (unsigned int k = 0; k < 3; k++)
+	{
+	    o[k] = static_cast<float>(p0[k]);
+	    double u1 = u0[k];
+	    // Avoid infinities for axis parallel rays.
+	    if (::fabs(u1) < 1e-30)
+	        u1 = 1e-30;
+	    inv[k] = static_cast<float>(1. / u1);
+	}
+	float tMin = 0.;
+	if (line)
+	    tMin = -FLT_MAX;
+	float tMax = FLT_MAX;
+	BoxBoundsItem* result = 0;
+	float best = FLT_MAX;
+	BoxBoundsTreeStack stack(4 * (depth + 2));
+	unsigned int sp = 0;
+	BoxBoundsTreeStackEntry e0;
+	e0.child = 0;
+	e0.numItems = 0;
+	e0.tNear = 0.;
+	stack[sp++] = e0;
+	std::vector<std::pair<float, unsigned int> > candidates;
+	while (sp > 0)
+	{
+	    e0 = stack[--sp];
+	    if ((query == BOX_BOUNDS_TREE_QUERY_FIRST) 
+	        && (e0.tNear > best))
+	        continue;
+	    if (e0.child >= 0)
+	    {
+	        // Test the ray against all child slots of the node.
+	        const BoxBoundsTreeNode& n0 = nodes[e0.child];
+	        float tn[4];
+	        bool hit[4];
+	        for (unsigned int j = 0; j < 4; j++)
+	        {
+	            float tx0 = (n0.lower[0][j] - o[0]) * inv[0];
+	            float tx1 = (n0.upper[0][j] - o[0]) * inv[0];
+	            float ty0 = (n0.lower[1][j] - o[1]) * inv[1];
+	            float ty1 = (n0.upper[1][j] - o[1]) * inv[1];
+	            float tz0 = (n0.lower[2][j] - o[2]) * inv[2];
+	            float tz1 = (n0.upper[2][j] - o[2]) * inv[2];
+	            float t0 = (tx0 < tx1) ? tx0 : tx1;
+	            float t1 = (tx0 < tx1) ? tx1 : tx0;
+	            float ta = (ty0 < ty1) ? ty0 : ty1;
+	            float tb = (ty0 < ty1) ? ty1 : ty0;
+	            t0 = (ta > t0) ? ta : t0;
+	            t1 = (tb < t1) ? tb : t1;
+	            ta = (tz0 < tz1) ? tz0 : tz1;
+	            tb = (tz0 < tz1) ? tz1 : tz0;
+	            t0 = (ta > t0) ? ta : t0;
+	            t1 = (tb < t1) ? tb : t1;
+	            t0 = (tMin > t0) ? tMin : t0;
+	            t1 = (tMax < t1) ? tMax : t1;
+	            tn[j] = t0;
+	            hit[j] = (t0 <= t1) && (n0.child[j] != 0);
+	        }
+	        // Push the slots far to near, so the nearest slot is visited first.
+	        unsigned int order[4] = { 0, 1, 2, 3 };
+	        if (query == BOX_BOUNDS_TREE_QUERY_FIRST)
+	        {
+	            for (unsigned int j = 1; j < 4; j++)
+	            {
+	                unsigned int k = j;
+	                while ((k > 0) 
+	                    && (tn[order[k - 1]] < tn[order[k]]))
+	                {
+	                    unsigned int tmp = order[k - 1];
+	                    order[k - 1] = order[k];
+	                    order[k] = tmp;
+	                    k--;
+	                }
+	            }
+	        }
+	        for (unsigned int j = 0; j < 4; j++)
+	        {
+	            unsigned int c0 = order[j];
+	            if (!hit[c0])
+	                continue;
+	            BoxBoundsTreeStackEntry e1;
+	            e1.child = n0.child[c0];
+	            e1.numItems = n0.numItems[c0];
+	            e1.tNear = tn[c0];
+	            stack[sp++] = e1;
+	        }
+	        continue;
+	    }
+	    // Test the ray against the leaf items.
+	    unsigned int first = -(e0.child + 1);
+	    candidates.clear();
+	    for (unsigned int i = first; i < (first + e0.numItems); i++)
+	    {
+	        const float* b0 = &(itemBounds[6 * i]);
+	        float t0 = tMin;
+	        float t1 = tMax;
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            float ta = (b0[k] - o[k]) * inv[k];
+	            float tb = (b0[k + 3] - o[k]) * inv[k];
+	            if (ta > tb)
+	            {
+	                float tmp = ta;
+	                ta = tb;
+	                tb = tmp;
+	            }
+	            t0 = (ta > t0) ? ta : t0;
+	            t1 = (tb < t1) ? tb : t1;
+	        }
+	        if (t0 > t1)
+	            continue;
+	        if (query == BOX_BOUNDS_TREE_QUERY_FIRST)
+	        {
+	            if (t0 <= best)
+	                candidates.push_back(std::make_pair(t0, i));
+	            continue;
+	        }
+	        BoxBoundsItem* it = items[i];
+	        bool r0 = false;
+	        if (line)
+	            r0 = it->checkLineInner(ray, t);
+	        else
+	            r0 = it->checkRayInner(ray, t);
+	        if (!r0)
+	            continue;
+	        if (query == BOX_BOUNDS_TREE_QUERY_ANY)
+	            return it;
+	        target->push_back(it);
+	    }
+	    if (candidates.size() == 0)
+	        continue;
+	    // Test the candidates front to back.
+	    std::sort(candidates.begin(), candidates.end());
+	    for (unsigned int i = 0; i < candidates.size(); i++)
+	    {
+	        if (candidates[i].first > best)
+	            break;
+	        BoxBoundsItem* it = items[candidates[i].second];
+	        bool r0 = false;
+	        if (line)
+	            r0 = it->checkLineInner(ray, t);
+	        else
+	            r0 = it->checkRayInner(ray, t);
+	        if (r0)
+	        {
+	            best = candidates[i].first;
+	            result = it;
+	            break;
+	        }
+	    }
+	}
+	return result;
+}
+
+void BoxBoundsTree::clear()
+{
+	for (BoxBoundsItemVector::iterator i = items.begin(); 
+	    i != items.end(); i++)
+	    removeLocalRef(*i);
+	items.clear();
+	nodes.clear();
+	itemBounds.clear();
+	depth = 0;
+}
+
+unsigned int BoxBoundsTree::update(Ionflux::GeoUtils::BoundingBox* root,
+double t)
+{
+	Ionflux::ObjectBase::nullPointerCheck(root, this, 
+	    "update", "Bounding box hierarchy root");
+	clear();
+	tolerance = t;
+	BoxBoundsTreeSlotVector slots;
+	getSlots(root, slots);
+	if (slots.size() > 0)
+	    buildNode(slots, 0);
+	return nodes.size();
+}
+
+void BoxBoundsTree::refit(bool updateItems)
+{
+	for (unsigned int i = 0; i < items.size(); i++)
+	{
+	    if (updateItems)
+	        items[i]->updateBounds();
+	    updateItemBounds(i);
+	}
+	// Child nodes always have a higher index than their parent node.
+	for (int i = nodes.size() - 1; i >= 0; i--)
+	{
+	    for (unsigned int j = 0; j < 4; j++)
+	    {
+	        int child = nodes[i].child[j];
+	        if (child == 0)
+	            continue;
+	        float l0[3];
+	        float u0[3];
+	        if (child > 0)
+	            getNodeBounds(child, l0, u0);
+	        else
+	            getItemRangeBounds(-(child + 1), nodes[i].numItems[j], 
+	                l0, u0);
+	        BoxBoundsTreeNode& nd = nodes[i];
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            nd.lower[k][j] = l0[k];
+	            nd.upper[k][j] = u0[k];
+	        }
+	    }
+	}
+}
+
+unsigned int BoxBoundsTree::getItemsOnRay(const
+Ionflux::GeoUtils::Line3& ray, Ionflux::GeoUtils::BoxBoundsItemVector&
+target, double t)
+{
+	unsigned int n0 = target.size();
+	castRay(ray, false, BOX_BOUNDS_TREE_QUERY_ALL, &target, t);
+	return target.size() - n0;
+}
+
+unsigned int BoxBoundsTree::getItemsOnLine(const
+Ionflux::GeoUtils::Line3& line, Ionflux::GeoUtils::BoxBoundsItemVector&
+target, double t)
+{
+	unsigned int n0 = target.size();
+	castRay(line, true, BOX_BOUNDS_TREE_QUERY_ALL, &target, t);
+	return target.size() - n0;
+}
+
+Ionflux::GeoUtils::BoxBoundsItem* BoxBoundsTree::getFirstItemOnRay(const
+Ionflux::GeoUtils::Line3& ray, double t)
+{
+	// TODO: Implementation.
+	return castRay(ray, false, BOX_BOUNDS_TREE_QUERY_FIRST, 0, t);
+}
+
+Ionflux::GeoUtils::BoxBoundsItem* BoxBoundsTree::getAnyItemOnRay(const
+Ionflux::GeoUtils::Line3& ray, double t)
+{
+	// TODO: Implementation.
+	return castRay(ray, false, BOX_BOUNDS_TREE_QUERY_ANY, 0, t);
+}
+
+unsigned int BoxBoundsTree::getItemsInSphere(const
+Ionflux::GeoUtils::Sphere3& sphere,
+Ionflux::GeoUtils::BoxBoundsItemVector& target, double t)
+{
+	if (nodes.size() == 0)
+	    return 0;
+	unsigned int n0 = target.size();
+	Vector3 p0 = sphere.getP();
+	float c[3];
+	for (unsigned int k = 0; k < 3; k++)
+	    c[k] = static_cast<float>(p0[k]);
+	float r0 = toFloatUpper(sphere.getR() + t);
+	float r2 = r0 * r0;
+	std::vector<int> stack(4 * (depth + 2));
+	std::vector<unsigned int> stackItems(stack.size());
+	unsigned int sp = 0;
+	stack[sp] = 0;
+	stackItems[sp] = 0;
+	sp++;
+	while (sp > 0)
+	{
+	    sp--;
+	    int child = stack[sp];
+	    unsigned int numItems = stackItems[sp];
+	    if (child >= 0)
+	    {
+	        const BoxBoundsTreeNode& nd = nodes[child];
+	        for (unsigned int j = 0; j < 4; j++)
+	        {
+	            float d2 = 0.;
+	            for (unsigned int k = 0; k < 3; k++)
+	            {
+	                float d0 = nd.lower[k][j] - c[k];
+	                float d1 = c[k] - nd.upper[k][j];
+	                float d = (d0 > d1) ? d0 : d1;
+	                d = (d > 0.) ? d : 0.;
+	                d2 += d * d;
+	            }
+	            if ((d2 <= r2) 
+	                && (nd.child[j] != 0))
+	            {
+	                stack[sp] = nd.child[j];
+	                stackItems[sp] = nd.numItems[j];
+	                sp++;
+	            }
+	        }
+	        continue;
+	    }
+	    unsigned int first = -(child + 1);
+	    for (unsigned int i = first; i < (first + numItems); i++)
+	    {
+	        const float* b0 = &(itemBounds[6 * i]);
+	        float d2 = 0.;
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            float d0 = b0[k] - c[k];
+	            float d1 = c[k] - b0[k + 3];
+	            float d = (d0 > d1) ? d0 : d1;
+	            d = (d > 0.) ? d : 0.;
+	            d2 += d * d;
+	        }
+	        if (d2 > r2)
+	            continue;
+	        BoxBoundsItem* it = items[i];
+	        if (it->checkSphereInner(sphere, t) != -1)
+	            target.push_back(it);
+	    }
+	}
+	return target.size() - n0;
+}
+
+unsigned int
+BoxBoundsTree::getItemsInBox(Ionflux::GeoUtils::BoxBoundsItem& box,
+Ionflux::GeoUtils::BoxBoundsItemVector& target, double t)
+{
+	if (nodes.size() == 0)
+	    return 0;
+	unsigned int n0 = target.size();
+	Vector3 c0 = box.getCenter();
+	Vector3 r0 = box.getRVec();
+	float bl[3];
+	float bu[3];
+	for (unsigned int k = 0; k < 3; k++)
+	{
+	    bl[k] = toFloatLower(c0[k] - ::fabs(r0[k]) - t);
+	    bu[k] = toFloatUpper(c0[k] + ::fabs(r0[k]) + t);
+	}
+	std::vector<int> stack(4 * (depth + 2));
+	std::vector<unsigned int> stackItems(stack.size());
+	unsigned int sp = 0;
+	stack[sp] = 0;
+	stackItems[sp] = 0;
+	sp++;
+	while (sp > 0)
+	{
+	    sp--;
+	    int child = stack[sp];
+	    unsigned int numItems = stackItems[sp];
+	    if (child >= 0)
+	    {
+	        const BoxBoundsTreeNode& nd = nodes[child];
+	        for (unsigned int j = 0; j < 4; j++)
+	        {
+	            bool hit = (nd.child[j] != 0);
+	            for (unsigned int k = 0; k < 3; k++)
+	                hit = hit && (nd.lower[k][j] <= bu[k]) 
+	                    && (nd.upper[k][j] >= bl[k]);
+	            if (hit)
+	            {
+	                stack[sp] = nd.child[j];
+	                stackItems[sp] = nd.numItems[j];
+	                sp++;
+	            }
+	        }
+	        continue;
+	    }
+	    unsigned int first = -(child + 1);
+	    for (unsigned int i = first; i < (first + numItems); i++)
+	    {
+	        const float* b0 = &(itemBounds[6 * i]);
+	        bool hit = true;
+	        for (unsigned int k = 0; k < 3; k++)
+	            hit = hit && (b0[k] <= bu[k]) && (b0[k + 3] >= bl[k]);
+	        if (!hit)
+	            continue;
+	        BoxBoundsItem* it = items[i];
+	        if (it->checkBoxInner(box, t) != -1)
+	            target.push_back(it);
+	    }
+	}
+	return target.size() - n0;
+}
+
+unsigned int BoxBoundsTree::getNumNodes() const
+{
+	// TODO: Implementation.
+	return nodes.size();
+}
+
+unsigned int BoxBoundsTree::getNumItems() const
+{
+	// TODO: Implementation.
+	return items.size();
+}
+
+Ionflux::GeoUtils::BoxBoundsItem* BoxBoundsTree::getItem(unsigned int
+elementIndex) const
+{
+	if (elementIndex >= items.size())
+	    return 0;
+	return items[elementIndex];
+}
+
+unsigned int BoxBoundsTree::getDepth() const
+{
+	// TODO: Implementation.
+	return depth;
+}
+
+std::string BoxBoundsTree::getValueString() const
+{
+	ostringstream status;
+	status << "numNodes = " << nodes.size() << ", numItems = " 
+	    << items.size() << ", depth = " << depth;
+	return status.str();
+}
+
+Ionflux::GeoUtils::BoxBoundsTree& BoxBoundsTree::operator=(const 
+Ionflux::GeoUtils::BoxBoundsTree& other)
+{
+    if (this == &other)
+        return *this;
+    clear();
+    for (BoxBoundsItemVector::const_iterator i = other.items.begin(); 
+        i != other.items.end(); i++)
+        addLocalRef(*i);
+    nodes = other.nodes;
+    items = other.items;
+    itemBounds = other.itemBounds;
+    depth = other.depth;
+    tolerance = other.tolerance;
+	return *this;
+}
+
+Ionflux::GeoUtils::BoxBoundsTree* BoxBoundsTree::copy() const
+{
+    BoxBoundsTree* newBoxBoundsTree = create();
+    *newBoxBoundsTree = *this;
+    return newBoxBoundsTree;
+}
+
+Ionflux::GeoUtils::BoxBoundsTree* 
+BoxBoundsTree::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<BoxBoundsTree*>(other);
+}
+
+Ionflux::GeoUtils::BoxBoundsTree* 
+BoxBoundsTree::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    BoxBoundsTree* newObject = new BoxBoundsTree();
+    if (newObject == 0)
+    {
+        throw GeoUtilsError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int BoxBoundsTree::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+/** \file BoxBoundsTree.cpp
+ * \brief Box bounds tree implementation.
+ */
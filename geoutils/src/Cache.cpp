@@ -34,6 +34,7 @@
 #include <fstream>
 #include "ifmapping/utils.hpp"
 #include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Profiler.hpp"
 
 using namespace std;
 using namespace Ionflux::ObjectBase;
@@ -99,7 +100,7 @@ void Cache::process()
 	    throw GeoUtilsError("Input cache is empty.");
 	clearInputGroups();
 	TransformableGroup* g0 = inputCache[0];
-	addOutput(&(g0->duplicate()));
+	addOutput(&(g0->instance()));
 }
 
 std::string Cache::getString() const
@@ -109,6 +110,12 @@ std::string Cache::getString() const
 	return status.str();
 }
 
+bool Cache::sharesItems() const
+{
+	// TODO: Implementation.
+	return true;
+}
+
 void Cache::cleanup()
 {
 	// TODO: Implementation.
@@ -119,6 +126,8 @@ void Cache::update()
 	if (loopCounter >= loopMax)
 	    throw GeoUtilsError("Maximum number of loop iterations exceeded.");
 	loopCounter++;
+	if (profiler != 0)
+	    profiler->begin(this);
 	if (inputCache.size() == 0)
 	{
 	    /* Do not update the source node unless the input cache has been 
@@ -126,18 +135,11 @@ void Cache::update()
 	    updateInputs();
 	    clearInputGroups();
 	}
-	/* <---- DEBUG ----- //
-	Ionflux::GeoUtils::Clock c0;
-	c0.start();
-	// ----- DEBUG ----> */
 	process();
-	/* <---- DEBUG ----- //
-	c0.stop();
-	std::ostringstream message;
-	message << "processing time: " << c0.getElapsedTime() << " secs";
-	log(IFLogMessage(message.str(), VL_DEBUG, this, "update"));
-	// ----- DEBUG ----> */
+	if (profiler != 0)
+	    profiler->end(this, getNumInputItems());
 	cleanup();
+	updateVersions();
 	updateCounter++;
 	loopCounter = 0;
 	if (debugMode)
@@ -144,6 +144,7 @@ std::string Center::getString() const
 void Center::setOrigin(const Ionflux::GeoUtils::Vector3& newOrigin)
 {
 	origin = newOrigin;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Center::getOrigin() const
@@ -154,6 +155,7 @@ Ionflux::GeoUtils::Vector3 Center::getOrigin() const
 void Center::setMethod(Ionflux::GeoUtils::CenteringMethod newMethod)
 {
 	method = newMethod;
+	touch();
 }
 
 Ionflux::GeoUtils::CenteringMethod Center::getMethod() const
@@ -101,7 +101,7 @@ void Clone::process()
 	TransformableGroup* g0 = inputCache[0];
 	// Clone the input group.
 	for (unsigned int j = 0; j < numClones; j++)
-	    addOutput(&(g0->duplicate()));
+	    addOutput(&(g0->instance()));
 	/* <---- DEBUG ----- //
 	ostringstream message;
 	message << "updateCounter = " << updateCounter << ", added " 
@@ -118,9 +118,16 @@ std::string Clone::getString() const
 	return status.str();
 }
 
+bool Clone::sharesItems() const
+{
+	// TODO: Implementation.
+	return true;
+}
+
 void Clone::setNumClones(unsigned int newNumClones)
 {
 	numClones = newNumClones;
+	touch();
 }
 
 unsigned int Clone::getNumClones() const
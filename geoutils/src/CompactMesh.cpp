@@ -0,0 +1,700 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * CompactMesh.cpp                 Compact mesh (implementation).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/CompactMesh.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include "ifobject/objectutils.hpp"
+#include "ifobject/IFIOContext.hpp"
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Vector2.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Vector4.hpp"
+#include "geoutils/VectorN.hpp"
+#include "geoutils/Vertex3.hpp"
+#include "geoutils/Vertex3Set.hpp"
+#include "geoutils/VectorSetSet.hpp"
+#include "geoutils/FaceData.hpp"
+#include "geoutils/Face.hpp"
+#include "geoutils/Mesh.hpp"
+#include "geoutils/meshio.hpp"
+
+using namespace std;
+using namespace Ionflux::ObjectBase;
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+CompactMeshClassInfo::CompactMeshClassInfo()
+{
+	name = "CompactMesh";
+	desc = "Compact mesh";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+CompactMeshClassInfo::~CompactMeshClassInfo()
+{
+}
+
+// run-time type information instance constants
+const CompactMeshClassInfo CompactMesh::compactMeshClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* CompactMesh::CLASS_INFO = &CompactMesh::compactMeshClassInfo;
+
+CompactMesh::CompactMesh()
+: numBufferRefs(0)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	// TODO: Nothing ATM. ;-)
+}
+
+CompactMesh::CompactMesh(const Ionflux::GeoUtils::CompactMesh& other)
+: numBufferRefs(0)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	*this = other;
+}
+
+CompactMesh::~CompactMesh()
+{
+	// TODO: Nothing ATM. ;-)
+}
+
+Ionflux::GeoUtils::Vector* CompactMesh::createVector(unsigned int
+numComponents, const double* data)
+{
+	Vector* result = 0;
+	if (numComponents == 2)
+	    result = Vector2::create();
+	else
+	if (numComponents == 3)
+	    result = Vector3::create();
+	else
+	if (numComponents == 4)
+	    result = Vector4::create();
+	else
+	    result = VectorN::create(numComponents);
+	for (unsigned int i = 0; i < numComponents; i++)
+	    result->setElement(i, data[i]);
+	return result;
+}
+
+void CompactMesh::checkFaceIndex(unsigned int faceIndex, const
+std::string& source) const
+{
+	if (faceIndex >= getNumFaces())
+	{
+	    std::ostringstream status;
+	    status << "Face index out of bounds: " << faceIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void CompactMesh::checkChannelIndex(unsigned int channelIndex, const
+std::string& source) const
+{
+	if (channelIndex >= channels.size())
+	{
+	    std::ostringstream status;
+	    status << "Channel index out of bounds: " << channelIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void CompactMesh::checkBufferRefs(const std::string& source) const
+{
+	if (numBufferRefs > 0)
+	{
+	    std::ostringstream status;
+	    status << "Data is referenced by " << numBufferRefs 
+	        << " exported buffer(s).";
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void CompactMesh::clear()
+{
+	checkBufferRefs("clear");
+	positions.clear();
+	indices.clear();
+	faceOffsets.clear();
+	edgeIndices.clear();
+	channels.clear();
+}
+
+void CompactMesh::initFromMesh(Ionflux::GeoUtils::Mesh& mesh)
+{
+	clear();
+	Mesh* source = 0;
+	bool ownSource = false;
+	if (mesh.checkTransform())
+	{
+	    // create a copy with transformations applied
+	    source = mesh.copy();
+	    addLocalRef(source);
+	    source->applyTransform(true);
+	    ownSource = true;
+	} else
+	    source = &mesh;
+	// vertices
+	unsigned int numVerts = source->getNumVertices();
+	positions.reserve(3 * numVerts);
+	for (unsigned int i = 0; i < numVerts; i++)
+	{
+	    Vertex3* cv = Ionflux::ObjectBase::nullPointerCheck(
+	        source->getVertex(i), this, "initFromMesh", "Vertex");
+	    positions.push_back(cv->getX());
+	    positions.push_back(cv->getY());
+	    positions.push_back(cv->getZ());
+	}
+	// faces
+	unsigned int numFaces = source->getNumFaces();
+	faceOffsets.reserve(numFaces + 1);
+	faceOffsets.push_back(0);
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    Face* cf = Ionflux::ObjectBase::nullPointerCheck(
+	        source->getFace(i), this, "initFromMesh", "Face");
+	    unsigned int nfv = cf->getNumVertices();
+	    for (unsigned int k = 0; k < nfv; k++)
+	        indices.push_back(cf->getVertex(k));
+	    faceOffsets.push_back(indices.size());
+	    // face data
+	    VectorSetSet* fd = cf->getFaceData();
+	    unsigned int numFD = 0;
+	    if (fd != 0)
+	        numFD = fd->getNumVectorSets();
+	    if (i == 0)
+	    {
+	        // The first face determines the channel layout.
+	        for (unsigned int k = 0; k < numFD; k++)
+	        {
+	            FaceData* cfd = Ionflux::ObjectBase::nullPointerCheck(
+	                FaceData::upcast(fd->getVectorSet(k)), this,
+	                "initFromMesh", "Face data");
+	            CompactMeshChannel c0;
+	            c0.dataType = cfd->getDataType();
+	            c0.numComponents = 0;
+	            if (cfd->getNumVectors() > 0)
+	            {
+	                Vector* v0 = Ionflux::ObjectBase::nullPointerCheck(
+	                    cfd->getVector(0), this, "initFromMesh",
+	                    "Face data vector");
+	                c0.numComponents = v0->getNumElements();
+	            }
+	            channels.push_back(c0);
+	        }
+	    }
+	    if (numFD != channels.size())
+	    {
+	        std::ostringstream status;
+	        status << "Inconsistent face data layout (face = " << i
+	            << ", numFaceData = " << numFD << ", numChannels = "
+	            << channels.size() << ")";
+	        throw GeoUtilsError(getErrorString(status.str(),
+	            "initFromMesh"));
+	    }
+	    for (unsigned int k = 0; k < numFD; k++)
+	    {
+	        CompactMeshChannel& c0 = channels[k];
+	        FaceData* cfd = Ionflux::ObjectBase::nullPointerCheck(
+	            FaceData::upcast(fd->getVectorSet(k)), this,
+	            "initFromMesh", "Face data");
+	        if ((cfd->getDataType() != c0.dataType)
+	            || (cfd->getNumVectors() != nfv))
+	        {
+	            std::ostringstream status;
+	            status << "Inconsistent face data layout (face = " << i
+	                << ", channel = " << k << ", type = "
+	                << FaceData::getTypeIDString(cfd->getDataType())
+	                << ", numVectors = " << cfd->getNumVectors() << ")";
+	            throw GeoUtilsError(getErrorString(status.str(),
+	                "initFromMesh"));
+	        }
+	        for (unsigned int j = 0; j < nfv; j++)
+	        {
+	            Vector* v0 = Ionflux::ObjectBase::nullPointerCheck(
+	                cfd->getVector(j), this, "initFromMesh",
+	                "Face data vector");
+	            if (v0->getNumElements() != c0.numComponents)
+	            {
+	                std::ostringstream status;
+	                status << "Inconsistent face data vector dimension "
+	                    "(face = " << i << ", channel = " << k
+	                    << ", numElements = " << v0->getNumElements()
+	                    << ", numComponents = " << c0.numComponents << ")";
+	                throw GeoUtilsError(getErrorString(status.str(),
+	                    "initFromMesh"));
+	            }
+	            for (unsigned int m = 0; m < c0.numComponents; m++)
+	                c0.data.push_back(v0->getElement(m));
+	        }
+	    }
+	}
+	// edges
+	unsigned int numEdges = source->getNumEdges();
+	edgeIndices.reserve(2 * numEdges);
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    NFace* ce = Ionflux::ObjectBase::nullPointerCheck(
+	        source->getEdge(i), this, "initFromMesh", "Edge");
+	    if (ce->getNumVertices() != 2)
+	    {
+	        std::ostringstream status;
+	        status << "Edge does not have two vertices (edge = " << i
+	            << ", numVertices = " << ce->getNumVertices() << ")";
+	        throw GeoUtilsError(getErrorString(status.str(),
+	            "initFromMesh"));
+	    }
+	    edgeIndices.push_back(ce->getVertex(0));
+	    edgeIndices.push_back(ce->getVertex(1));
+	}
+	if (ownSource)
+	    removeLocalRef(source);
+}
+
+void CompactMesh::getMesh(Ionflux::GeoUtils::Mesh& target, bool
+copyChannels) const
+{
+	target.clear();
+	Vertex3Set* vs0 = Vertex3Set::create();
+	target.setVertexSource(vs0);
+	// vertices
+	unsigned int numVerts = getNumVertices();
+	vs0->getVertices().reserve(numVerts);
+	for (unsigned int i = 0; i < numVerts; i++)
+	{
+	    const double* c0 = &(positions[3 * i]);
+	    vs0->addVertex(Vertex3::create(c0[0], c0[1], c0[2]));
+	}
+	// faces
+	unsigned int numFaces = getNumFaces();
+	target.getFaces().reserve(numFaces);
+	Ionflux::ObjectBase::UIntVector fv0;
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    unsigned int i0 = faceOffsets[i];
+	    unsigned int i1 = faceOffsets[i + 1];
+	    fv0.assign(indices.begin() + i0, indices.begin() + i1);
+	    Face* nf = Face::create(&fv0, vs0);
+	    if (copyChannels)
+	    {
+	        for (CompactMeshChannelVector::const_iterator j =
+	            channels.begin(); j != channels.end(); j++)
+	        {
+	            const CompactMeshChannel& c0 = *j;
+	            FaceData* fd = FaceData::create(c0.dataType);
+	            for (unsigned int k = i0; k < i1; k++)
+	            {
+	                fd->addVector(createVector(c0.numComponents,
+	                    &(c0.data[k * c0.numComponents])));
+	            }
+	            nf->addFaceData(fd);
+	        }
+	    }
+	    target.addFace(nf);
+	}
+	// edges
+	unsigned int numEdges = getNumEdges();
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    target.addEdge(NFace::create(edgeIndices[2 * i],
+	        edgeIndices[2 * i + 1], NFace::VERTEX_INDEX_NONE,
+	        NFace::VERTEX_INDEX_NONE, vs0));
+	}
+	target.update(false, false);
+}
+
+void CompactMesh::initFromArrays(Ionflux::ObjectBase::DoubleVector&
+newPositions, Ionflux::ObjectBase::UIntVector& newIndices,
+Ionflux::ObjectBase::UIntVector& newFaceOffsets)
+{
+	if ((newPositions.size() % 3) != 0)
+	{
+	    std::ostringstream status;
+	    status << "Invalid number of vertex coordinates: " 
+	        << newPositions.size();
+	    throw GeoUtilsError(getErrorString(status.str(), "initFromArrays"));
+	}
+	unsigned int numVerts = newPositions.size() / 3;
+	unsigned int numOffsets = newFaceOffsets.size();
+	if (((numOffsets == 0) && (newIndices.size() > 0))
+	    || ((numOffsets > 0) 
+	        && ((newFaceOffsets[0] != 0) 
+	            || (newFaceOffsets[numOffsets - 1] != newIndices.size()))))
+	{
+	    std::ostringstream status;
+	    status << "Face offsets do not match face vertex indices (numOffsets = " 
+	        << numOffsets << ", numIndices = " << newIndices.size() << ")";
+	    throw GeoUtilsError(getErrorString(status.str(), "initFromArrays"));
+	}
+	for (unsigned int i = 1; i < numOffsets; i++)
+	{
+	    if (newFaceOffsets[i] < newFaceOffsets[i - 1])
+	    {
+	        std::ostringstream status;
+	        status << "Face offsets are not ascending (face = " << (i - 1) 
+	            << ")";
+	        throw GeoUtilsError(getErrorString(status.str(), 
+	            "initFromArrays"));
+	    }
+	}
+	for (unsigned int i = 0; i < newIndices.size(); i++)
+	{
+	    if (newIndices[i] >= numVerts)
+	    {
+	        std::ostringstream status;
+	        status << "Vertex index out of range: " << newIndices[i] 
+	            << " (numVertices = " << numVerts << ")";
+	        throw GeoUtilsError(getErrorString(status.str(), 
+	            "initFromArrays"));
+	    }
+	}
+	clear();
+	positions.swap(newPositions);
+	indices.swap(newIndices);
+	faceOffsets.swap(newFaceOffsets);
+}
+
+unsigned int CompactMesh::addVertex(double x, double y, double z)
+{
+	checkBufferRefs("addVertex");
+	positions.push_back(x);
+	positions.push_back(y);
+	positions.push_back(z);
+	return positions.size() / 3 - 1;
+}
+
+unsigned int CompactMesh::addFace(const Ionflux::ObjectBase::UIntVector&
+faceVertices)
+{
+	checkBufferRefs("addFace");
+	if (faceOffsets.size() == 0)
+	    faceOffsets.push_back(0);
+	indices.insert(indices.end(), faceVertices.begin(), faceVertices.end());
+	faceOffsets.push_back(indices.size());
+	for (CompactMeshChannelVector::iterator i = channels.begin();
+	    i != channels.end(); i++)
+	    (*i).data.resize(indices.size() * (*i).numComponents, 0.);
+	return faceOffsets.size() - 2;
+}
+
+unsigned int CompactMesh::addEdge(unsigned int v0, unsigned int v1)
+{
+	checkBufferRefs("addEdge");
+	edgeIndices.push_back(v0);
+	edgeIndices.push_back(v1);
+	return edgeIndices.size() / 2 - 1;
+}
+
+unsigned int CompactMesh::addChannel(Ionflux::GeoUtils::FaceDataTypeID
+dataType, unsigned int numComponents)
+{
+	checkBufferRefs("addChannel");
+	CompactMeshChannel c0;
+	c0.dataType = dataType;
+	c0.numComponents = numComponents;
+	c0.data.resize(indices.size() * numComponents, 0.);
+	channels.push_back(c0);
+	return channels.size() - 1;
+}
+
+int CompactMesh::findChannel(Ionflux::GeoUtils::FaceDataTypeID dataType,
+unsigned int index) const
+{
+	unsigned int k = 0;
+	for (unsigned int i = 0; i < channels.size(); i++)
+	{
+	    if (channels[i].dataType == dataType)
+	    {
+	        if (k == index)
+	            return i;
+	        k++;
+	    }
+	}
+	return -1;
+}
+
+unsigned int CompactMesh::getNumVertices() const
+{
+	// TODO: Implementation.
+	return positions.size() / 3;
+}
+
+unsigned int CompactMesh::getNumFaces() const
+{
+	if (faceOffsets.size() == 0)
+	    return 0;
+	return faceOffsets.size() - 1;
+}
+
+unsigned int CompactMesh::getNumFaceVertices(unsigned int faceIndex)
+const
+{
+	checkFaceIndex(faceIndex, "getNumFaceVertices");
+	return faceOffsets[faceIndex + 1] - faceOffsets[faceIndex];
+}
+
+unsigned int CompactMesh::getNumIndices() const
+{
+	// TODO: Implementation.
+	return indices.size();
+}
+
+unsigned int CompactMesh::getNumEdges() const
+{
+	// TODO: Implementation.
+	return edgeIndices.size() / 2;
+}
+
+unsigned int CompactMesh::getNumChannels() const
+{
+	// TODO: Implementation.
+	return channels.size();
+}
+
+Ionflux::GeoUtils::Vector3 CompactMesh::getVertex(unsigned int
+vertexIndex) const
+{
+	if (vertexIndex >= getNumVertices())
+	{
+	    std::ostringstream status;
+	    status << "Vertex index out of bounds: " << vertexIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), "getVertex"));
+	}
+	const double* c0 = &(positions[3 * vertexIndex]);
+	return Vector3(c0[0], c0[1], c0[2]);
+}
+
+unsigned int CompactMesh::getFace(unsigned int faceIndex,
+Ionflux::ObjectBase::UIntVector& target) const
+{
+	checkFaceIndex(faceIndex, "getFace");
+	unsigned int i0 = faceOffsets[faceIndex];
+	unsigned int i1 = faceOffsets[faceIndex + 1];
+	target.insert(target.end(), indices.begin() + i0, indices.begin() + i1);
+	return i1 - i0;
+}
+
+Ionflux::GeoUtils::FaceDataTypeID
+CompactMesh::getChannelDataType(unsigned int channelIndex) const
+{
+	checkChannelIndex(channelIndex, "getChannelDataType");
+	return channels[channelIndex].dataType;
+}
+
+unsigned int CompactMesh::getChannelNumComponents(unsigned int
+channelIndex) const
+{
+	checkChannelIndex(channelIndex, "getChannelNumComponents");
+	return channels[channelIndex].numComponents;
+}
+
+bool CompactMesh::isTriMesh() const
+{
+	unsigned int numFaces = getNumFaces();
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    if ((faceOffsets[i + 1] - faceOffsets[i]) != 3)
+	        return false;
+	}
+	return true;
+}
+
+const double* CompactMesh::getPositionData() const
+{
+	if (positions.size() == 0)
+	    return 0;
+	return &(positions[0]);
+}
+
+const unsigned int* CompactMesh::getIndexData() const
+{
+	if (indices.size() == 0)
+	    return 0;
+	return &(indices[0]);
+}
+
+const unsigned int* CompactMesh::getFaceOffsetData() const
+{
+	if (faceOffsets.size() == 0)
+	    return 0;
+	return &(faceOffsets[0]);
+}
+
+const unsigned int* CompactMesh::getEdgeIndexData() const
+{
+	if (edgeIndices.size() == 0)
+	    return 0;
+	return &(edgeIndices[0]);
+}
+
+const double* CompactMesh::getChannelData(unsigned int channelIndex)
+const
+{
+	checkChannelIndex(channelIndex, "getChannelData");
+	const Ionflux::ObjectBase::DoubleVector& d0 = channels[channelIndex].data;
+	if (d0.size() == 0)
+	    return 0;
+	return &(d0[0]);
+}
+
+void CompactMesh::addBufferRef()
+{
+	numBufferRefs++;
+}
+
+void CompactMesh::removeBufferRef()
+{
+	if (numBufferRefs > 0)
+	    numBufferRefs--;
+}
+
+unsigned int CompactMesh::getNumBufferRefs() const
+{
+	// TODO: Implementation.
+	return numBufferRefs;
+}
+
+void CompactMesh::writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx,
+unsigned int precision, bool smoothShading)
+{
+	std::string id0 = getID();
+	std::string b0;
+	b0.reserve(MESH_IO_BUFFER_SIZE + 256);
+	if (id0.size() > 0)
+	    b0.append("o " + id0 + "\n");
+	// vertices
+	unsigned int numVerts = getNumVertices();
+	for (unsigned int i = 0; i < numVerts; i++)
+	{
+	    const double* c0 = &(positions[3 * i]);
+	    b0.append("v ");
+	    appendDouble(b0, c0[0], precision);
+	    b0.push_back(' ');
+	    appendDouble(b0, c0[1], precision);
+	    b0.push_back(' ');
+	    appendDouble(b0, c0[2], precision);
+	    b0.push_back('\n');
+	    if (b0.size() >= MESH_IO_BUFFER_SIZE)
+	    {
+	        ioCtx.writeToOutputStream(b0);
+	        b0.clear();
+	    }
+	}
+	// faces
+	if (smoothShading)
+	    b0.append("s on\n");
+	else
+	    b0.append("s off\n");
+	unsigned int numFaces = getNumFaces();
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    b0.push_back('f');
+	    for (unsigned int k = faceOffsets[i]; k < faceOffsets[i + 1]; k++)
+	    {
+	        b0.push_back(' ');
+	        appendUInt(b0, indices[k] + 1);
+	    }
+	    b0.push_back('\n');
+	    if (b0.size() >= MESH_IO_BUFFER_SIZE)
+	    {
+	        ioCtx.writeToOutputStream(b0);
+	        b0.clear();
+	    }
+	}
+	if (b0.size() > 0)
+	    ioCtx.writeToOutputStream(b0);
+}
+
+std::string CompactMesh::getValueString() const
+{
+	ostringstream status;
+	status << "numVertices = " << getNumVertices() << ", numFaces = "
+	    << getNumFaces() << ", numEdges = " << getNumEdges()
+	    << ", numChannels = " << getNumChannels();
+	return status.str();
+}
+
+Ionflux::GeoUtils::CompactMesh& CompactMesh::operator=(const 
+Ionflux::GeoUtils::CompactMesh& other)
+{
+    if (this == &other)
+        return *this;
+    checkBufferRefs("operator=");
+    positions = other.positions;
+    indices = other.indices;
+    faceOffsets = other.faceOffsets;
+    edgeIndices = other.edgeIndices;
+    channels = other.channels;
+	return *this;
+}
+
+Ionflux::GeoUtils::CompactMesh* CompactMesh::copy() const
+{
+    CompactMesh* newCompactMesh = create();
+    *newCompactMesh = *this;
+    return newCompactMesh;
+}
+
+Ionflux::GeoUtils::CompactMesh* 
+CompactMesh::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<CompactMesh*>(other);
+}
+
+Ionflux::GeoUtils::CompactMesh* 
+CompactMesh::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    CompactMesh* newObject = new CompactMesh();
+    if (newObject == 0)
+    {
+        throw GeoUtilsError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int CompactMesh::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+/** \file CompactMesh.cpp
+ * \brief Compact mesh implementation.
+ */
@@ -123,6 +123,26 @@ value) const
 	return Vector3(x0, x1, x2);
 }
 
+void Compose3::callBatch(const Ionflux::Mapping::MappingValueVector&
+values, Ionflux::ObjectBase::DoubleVector& targetX,
+Ionflux::ObjectBase::DoubleVector& targetY,
+Ionflux::ObjectBase::DoubleVector& targetZ) const
+{
+	unsigned int n = values.size();
+	if (funcX0 != 0)
+	    funcX0->callBatch(values, targetX);
+	else
+	    targetX.assign(n, 0.);
+	if (funcX1 != 0)
+	    funcX1->callBatch(values, targetY);
+	else
+	    targetY = targetX;
+	if (funcX2 != 0)
+	    funcX2->callBatch(values, targetZ);
+	else
+	    targetZ = targetY;
+}
+
 std::string Compose3::getString() const
 {
 	ostringstream status;
@@ -130,9 +130,11 @@ void Duplicate::process()
 	        k = static_cast<unsigned int>(Ionflux::Mapping::clamp(
 	            (*func)(t), CLAMP_RANGE) * numSourceItems);
 	    }
-	    // Create the duplicate.
+	    /* Add the source element. The element is shared between the 
+	       duplicates until it is modified (see 
+	       TransformableGroup::detachItems()). */
 	    TransformableObject* o0 = g0->getItem(k);
-	    g1->addItem(&(o0->duplicate()));
+	    g1->addSharedItem(o0);
 	}
 	addOutput(g1);
 }
@@ -150,9 +152,22 @@ std::string Duplicate::getString() const
 	return status.str();
 }
 
+bool Duplicate::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return func == 0;
+}
+
+bool Duplicate::sharesItems() const
+{
+	// TODO: Implementation.
+	return true;
+}
+
 void Duplicate::setNumDuplicates(unsigned int newNumDuplicates)
 {
 	numDuplicates = newNumDuplicates;
+	touch();
 }
 
 unsigned int Duplicate::getNumDuplicates() const
@@ -175,12 +190,13 @@ Ionflux::Mapping::MappingValue Duplicate::getNumDuplicatesParam() const
 void Duplicate::setFunc(Ionflux::Mapping::Mapping* newFunc)
 {
 	if (func == newFunc)
-		return;
-    if (newFunc != 0)
-        addLocalRef(newFunc);
+	    return;
+	if (newFunc != 0)
+	    addLocalRef(newFunc);
 	if (func != 0)
-		removeLocalRef(func);
+	    removeLocalRef(func);
 	func = newFunc;
+	touch();
 }
 
 Ionflux::Mapping::Mapping* Duplicate::getFunc() const
@@ -150,6 +150,7 @@ std::string Explode::getString() const
 void Explode::setElementsPerGroup(unsigned int newElementsPerGroup)
 {
 	elementsPerGroup = newElementsPerGroup;
+	touch();
 }
 
 unsigned int Explode::getElementsPerGroup() const
@@ -132,6 +132,12 @@ void Face::update()
 	clearTangentSpace();
 }
 
+void Face::updateFromBounds(const Ionflux::GeoUtils::Range3& newBounds)
+{
+	NFace::updateFromBounds(newBounds);
+	clearTangentSpace();
+}
+
 void Face::clearTangentSpace()
 {
 	if (tangent != 0)
@@ -154,6 +160,13 @@ void Face::clear()
 void Face::setFaceVertexNormals(bool flip0)
 {
 	Vector3 n0 = getNormal();
+	if (flip0)
+	    n0.flipIP();
+	setVertexNormals(n0);
+}
+
+void Face::setVertexNormals(const Ionflux::GeoUtils::Vector3& normal)
+{
 	FaceData* vn0 = getVertexNormals0();
 	if (vn0 == 0)
 	{
@@ -163,12 +176,7 @@ void Face::setFaceVertexNormals(bool flip0)
 	vn0->clearVectors();
 	unsigned int numVerts = getNumVertices();
 	for (unsigned int i = 0; i < numVerts; i++)
-	{
-	    Vector* v0 = n0.copy();
-	    if (flip0)
-	        v0->flipIP();
-	    vn0->addVector(v0);
-	}
+	    vn0->addVector(normal.copy());
 }
 
 void Face::setVertexColors(const Ionflux::GeoUtils::Vector4& color)
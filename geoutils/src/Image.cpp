@@ -31,6 +31,10 @@
 #include <cstdlib>
 #include <sstream>
 #include <iomanip>
+#include <cfloat>
+#include <algorithm>
+#include <pthread.h>
+#include <unistd.h>
 #include <cairo.h>
 #include <librsvg/rsvg.h>
 #include <librsvg/rsvg-cairo.h>
@@ -180,6 +184,263 @@ void Image::recalculateBounds()
 	removeLocalRef(p0);
 }
 
+void* Image::rasterizeTask(void* taskArg)
+{
+	RasterUpdate& u0 = *(static_cast<RasterUpdate*>(taskArg));
+	Ionflux::ObjectBase::DoubleVector coverage;
+	while (true)
+	{
+	    pthread_mutex_lock(&(u0.mutex));
+	    unsigned int k = u0.nextTile;
+	    bool done = (k >= u0.tiles->size());
+	    if (!done)
+	        u0.nextTile++;
+	    pthread_mutex_unlock(&(u0.mutex));
+	    if (done)
+	        break;
+	    rasterizeTile(u0, (*u0.tiles)[k], coverage);
+	}
+	return 0;
+}
+
+void Image::rasterizeTile(const Ionflux::GeoUtils::RasterUpdate& state,
+const Ionflux::GeoUtils::RasterTile& tile,
+Ionflux::ObjectBase::DoubleVector& coverage)
+{
+	/* The coverage buffer has two extra columns, since edges to the 
+	   right of the tile are clamped to the right border. */
+	unsigned int stride = tile.width + 2;
+	if (coverage.size() < stride * tile.height)
+	    coverage.resize(stride * tile.height);
+	const RasterPolygonVector& pv = *(state.polygons);
+	double tx = tile.x0;
+	double ty = tile.y0;
+	for (Ionflux::ObjectBase::UIntVector::const_iterator i = 
+	    tile.polygons.begin(); i != tile.polygons.end(); i++)
+	{
+	    const RasterPolygon& p0 = pv[*i];
+	    // Clear the coverage buffer within the polygon bounds.
+	    unsigned int cx0 = static_cast<unsigned int>(
+	        std::max(0., std::floor(p0.xMin - tx)));
+	    unsigned int cx1 = static_cast<unsigned int>(
+	        std::max(0., std::ceil(p0.xMax - tx) + 2.));
+	    if (cx1 > stride)
+	        cx1 = stride;
+	    unsigned int cy0 = static_cast<unsigned int>(
+	        std::max(0., std::floor(p0.yMin - ty)));
+	    unsigned int cy1 = static_cast<unsigned int>(
+	        std::max(0., std::ceil(p0.yMax - ty)));
+	    if (cy1 > tile.height)
+	        cy1 = tile.height;
+	    if ((cx0 >= tile.width) 
+	        || (cy0 >= cy1))
+	        continue;
+	    for (unsigned int y = cy0; y < cy1; y++)
+	        for (unsigned int x = cx0; x < cx1; x++)
+	            coverage[y * stride + x] = 0.;
+	    // Accumulate the signed area of the edges.
+	    unsigned int n = p0.x.size();
+	    for (unsigned int k = 0; k < n; k++)
+	    {
+	        unsigned int k1 = (k + 1) % n;
+	        addRasterEdge(coverage, stride, tile.width, tile.height, 
+	            p0.x[k] - tx, p0.y[k] - ty, p0.x[k1] - tx, p0.y[k1] - ty);
+	    }
+	    // Composite the polygon onto the pixels.
+	    if (cx1 > tile.width)
+	        cx1 = tile.width;
+	    for (unsigned int y = cy0; y < cy1; y++)
+	    {
+	        double a0 = 0.;
+	        PixelData pt = state.pixels + (tile.y0 + y) * state.rowStride 
+	            + (tile.x0 + cx0) * state.numChannels;
+	        for (unsigned int x = cx0; x < cx1; x++)
+	        {
+	            a0 += coverage[y * stride + x];
+	            double a1 = std::fabs(a0);
+	            if (a1 > 1.)
+	                a1 = 1.;
+	            a1 *= p0.color[3];
+	            if (a1 > 0.)
+	            {
+	                if (state.numChannels < 4)
+	                {
+	                    for (unsigned int c = 0; c < 3; c++)
+	                        pt[c] = floatToByte(p0.color[c] * a1 
+	                            + byteToFloat(pt[c]) * (1. - a1));
+	                } else
+	                {
+	                    // Source over, non-premultiplied.
+	                    double ta = byteToFloat(pt[3]) * (1. - a1);
+	                    double ra = a1 + ta;
+	                    for (unsigned int c = 0; c < 3; c++)
+	                        pt[c] = floatToByte((p0.color[c] * a1 
+	                            + byteToFloat(pt[c]) * ta) / ra);
+	                    pt[3] = floatToByte(ra);
+	                }
+	            }
+	            pt += state.numChannels;
+	        }
+	    }
+	}
+}
+
+void Image::addRasterEdge(Ionflux::ObjectBase::DoubleVector& coverage,
+unsigned int stride, unsigned int width, unsigned int height, double x0,
+double y0, double x1, double y1)
+{
+	if (y0 == y1)
+	    return;
+	double dir = 1.;
+	if (y0 > y1)
+	{
+	    std::swap(x0, x1);
+	    std::swap(y0, y1);
+	    dir = -1.;
+	}
+	double w = width;
+	double h = height;
+	if ((y1 <= 0.) || (y0 >= h))
+	    return;
+	// Clip the edge to the rows of the tile.
+	double dxdy = (x1 - x0) / (y1 - y0);
+	if (y0 < 0.)
+	{
+	    x0 -= y0 * dxdy;
+	    y0 = 0.;
+	}
+	if (y1 > h)
+	{
+	    x1 -= (y1 - h) * dxdy;
+	    y1 = h;
+	}
+	/* Split the edge where it crosses the left or right border, so each 
+	   segment can be clamped to the columns of the tile. */
+	double px[4];
+	double py[4];
+	unsigned int np = 0;
+	px[np] = x0;
+	py[np] = y0;
+	np++;
+	if (dxdy != 0.)
+	{
+	    double cx[2] = { 0., w };
+	    if (x1 < x0)
+	        std::swap(cx[0], cx[1]);
+	    for (unsigned int i = 0; i < 2; i++)
+	    {
+	        double cy = y0 + (cx[i] - x0) / dxdy;
+	        if ((cy > py[np - 1]) && (cy < y1))
+	        {
+	            px[np] = cx[i];
+	            py[np] = cy;
+	            np++;
+	        }
+	    }
+	}
+	px[np] = x1;
+	py[np] = y1;
+	np++;
+	for (unsigned int k = 0; (k + 1) < np; k++)
+	{
+	    double ax = std::min(std::max(px[k], 0.), w);
+	    double bx = std::min(std::max(px[k + 1], 0.), w);
+	    double ay = py[k];
+	    double by = py[k + 1];
+	    if (ay == by)
+	        continue;
+	    double sx = (bx - ax) / (by - ay);
+	    double x = ax;
+	    unsigned int yi0 = static_cast<unsigned int>(ay);
+	    unsigned int yi1 = std::min(height, 
+	        static_cast<unsigned int>(std::ceil(by)));
+	    for (unsigned int y = yi0; y < yi1; y++)
+	    {
+	        double dy = std::min(y + 1., by)
+	            - std::max(static_cast<double>(y), ay);
+	        double xn = std::min(std::max(x + sx * dy, 0.), w);
+	        double d = dy * dir;
+	        double xa = std::min(x, xn);
+	        double xb = std::max(x, xn);
+	        double xaf = std::floor(xa);
+	        double xbc = std::ceil(xb);
+	        unsigned int xai = static_cast<unsigned int>(xaf);
+	        unsigned int xbi = static_cast<unsigned int>(xbc);
+	        double* row = &(coverage[y * stride]);
+	        if (xbi <= (xai + 1))
+	        {
+	            // The segment is within a single column.
+	            double xm = 0.5 * (x + xn) - xaf;
+	            row[xai] += d * (1. - xm);
+	            row[xai + 1] += d * xm;
+	        } else
+	        {
+	            // Distribute the area over the columns crossed by the segment.
+	            double s = 1. / (xb - xa);
+	            double fa = xa - xaf;
+	            double a0 = 0.5 * s * (1. - fa) * (1. - fa);
+	            double fb = xb - xbc + 1.;
+	            double am = 0.5 * s * fb * fb;
+	            row[xai] += d * a0;
+	            if (xbi == (xai + 2))
+	                row[xai + 1] += d * (1. - a0 - am);
+	            else
+	            {
+	                double a1 = s * (1.5 - fa);
+	                row[xai + 1] += d * (a1 - a0);
+	                for (unsigned int xi = xai + 2; (xi + 1) < xbi; xi++)
+	                    row[xi] += d * s;
+	                double a2 = a1 + (xbi - xai - 3) * s;
+	                row[xbi - 1] += d * (1. - a2 - am);
+	            }
+	            row[xbi] += d * am;
+	        }
+	        x = xn;
+	    }
+	}
+}
+
+bool Image::clipRaySlab(double p, double u, double bMin, double bMax,
+double& s0, double& s1)
+{
+	if (u == 0.)
+	    // Ray is parallel to the slab.
+	    return (p >= bMin) && (p <= bMax);
+	double r = 1. / u;
+	double t0 = (bMin - p) * r;
+	double t1 = (bMax - p) * r;
+	if (t0 > t1)
+	{
+	    double t2 = t0;
+	    t0 = t1;
+	    t1 = t2;
+	}
+	if (t0 > s0)
+	    s0 = t0;
+	if (t1 < s1)
+	    s1 = t1;
+	return (s0 <= s1);
+}
+
+unsigned int Image::addPixelSpan(Ionflux::GeoUtils::PixelSpanVector&
+target, unsigned int y, double xMin, double xMax)
+{
+	double x0 = ::ceil(xMin);
+	if (x0 < 0.)
+	    x0 = 0.;
+	double x1 = ::floor(xMax);
+	if (x1 > (width - 1.))
+	    x1 = width - 1.;
+	if (x0 > x1)
+	    return 0;
+	PixelSpan s0;
+	s0.y = y;
+	s0.x0 = static_cast<unsigned int>(x0);
+	s0.x1 = static_cast<unsigned int>(x1) + 1;
+	target.push_back(s0);
+	return s0.x1 - s0.x0;
+}
+
 void Image::drawPolygons(Ionflux::GeoUtils::Polygon3Set& polygons, const 
 Ionflux::GeoUtils::SVGShapeStyleVector* styles, Ionflux::GeoUtils::AxisID 
 axis, bool closePath, int originX, int originY)
@@ -275,6 +536,185 @@ axis, bool closePath, int originX, int originY)
 	cairo_restore(context);
 }
 
+void Image::rasterizePolygons(Ionflux::GeoUtils::Polygon3Set& polygons,
+const Ionflux::GeoUtils::SVGShapeStyleVector* styles,
+Ionflux::GeoUtils::AxisID axis, int originX, int originY, unsigned int
+numThreads, unsigned int tileSize)
+{
+	if (pixels == 0)
+	    throw GeoUtilsError("[Image::rasterizePolygons] " 
+	        "Image not initialized!");
+	if (tileSize == 0)
+	    throw GeoUtilsError("[Image::rasterizePolygons] " 
+	        "Invalid tile size!");
+	AxisID oa[2];
+	if (axis == AXIS_Y)
+	{
+	    oa[0] = AXIS_X;
+	    oa[1] = AXIS_Z;
+	} else
+	if (axis == AXIS_X)
+	{
+	    oa[0] = AXIS_Y;
+	    oa[1] = AXIS_Z;
+	} else
+	if (axis == AXIS_Z)
+	{
+	    oa[0] = AXIS_X;
+	    oa[1] = AXIS_Y;
+	} else
+	{
+	    ostringstream message;
+	    message << "[Image::rasterizePolygons] Invalid axis: " << axis;
+	    throw GeoUtilsError(message.str());
+	}
+	polygons.applyTransform(true);
+	// Fill colors.
+	std::vector<const SVGShapeStyle*> sv;
+	if (styles != 0)
+	    sv.insert(sv.end(), styles->begin(), styles->end());
+	if (sv.size() == 0)
+	    sv.push_back(&DEFAULT_SHAPE_STYLE);
+	std::vector<bool> filled(sv.size(), false);
+	Ionflux::ObjectBase::DoubleVector colors(4 * sv.size(), 0.);
+	for (unsigned int i = 0; i < sv.size(); i++)
+	{
+	    const SVGShapeStyle* style = sv[i];
+	    if ((style->color.size() == 0) 
+	        || (style->color == "none") 
+	        || (style->fillOpacity <= 0.))
+	        continue;
+	    Ionflux::Altjira::Color fillColor(style->color);
+	    colors[4 * i] = fillColor.getRed();
+	    colors[4 * i + 1] = fillColor.getGreen();
+	    colors[4 * i + 2] = fillColor.getBlue();
+	    colors[4 * i + 3] = style->fillOpacity;
+	    filled[i] = true;
+	}
+	// Project the polygons to pixel coordinates.
+	double ox = 0.5 * width + originX;
+	double oy = 0.5 * height + originY;
+	RasterPolygonVector rp;
+	rp.reserve(polygons.getNumPolygons());
+	for (unsigned int i = 0; i < polygons.getNumPolygons(); i++)
+	{
+	    unsigned int si = i % sv.size();
+	    Polygon3* p0 = polygons.getPolygon(i);
+	    unsigned int nv = p0->getNumVertices();
+	    if (!filled[si] 
+	        || (nv < 3))
+	        continue;
+	    rp.push_back(RasterPolygon());
+	    RasterPolygon& r0 = rp.back();
+	    r0.x.resize(nv);
+	    r0.y.resize(nv);
+	    for (unsigned int k = 0; k < nv; k++)
+	    {
+	        Vertex3* v0 = p0->getVertex(k);
+	        double x0 = ox + v0->getCoord(oa[0]);
+	        double y0 = oy - v0->getCoord(oa[1]);
+	        r0.x[k] = x0;
+	        r0.y[k] = y0;
+	        if ((k == 0) || (x0 < r0.xMin))
+	            r0.xMin = x0;
+	        if ((k == 0) || (x0 > r0.xMax))
+	            r0.xMax = x0;
+	        if ((k == 0) || (y0 < r0.yMin))
+	            r0.yMin = y0;
+	        if ((k == 0) || (y0 > r0.yMax))
+	            r0.yMax = y0;
+	    }
+	    if ((r0.xMax <= 0.) || (r0.xMin >= width) 
+	        || (r0.yMax <= 0.) || (r0.yMin >= height) 
+	        || (r0.xMin == r0.xMax) || (r0.yMin == r0.yMax))
+	    {
+	        // Polygon is not visible.
+	        rp.pop_back();
+	        continue;
+	    }
+	    for (unsigned int k = 0; k < 4; k++)
+	        r0.color[k] = colors[4 * si + k];
+	}
+	// Sort the polygons into tiles.
+	unsigned int nx = (width + tileSize - 1) / tileSize;
+	unsigned int ny = (height + tileSize - 1) / tileSize;
+	RasterTileVector tiles(nx * ny);
+	for (unsigned int i = 0; i < nx; i++)
+	    for (unsigned int j = 0; j < ny; j++)
+	    {
+	        RasterTile& t0 = tiles[j * nx + i];
+	        t0.x0 = i * tileSize;
+	        t0.y0 = j * tileSize;
+	        t0.width = std::min(tileSize, width - t0.x0);
+	        t0.height = std::min(tileSize, height - t0.y0);
+	    }
+	for (unsigned int k = 0; k < rp.size(); k++)
+	{
+	    const RasterPolygon& r0 = rp[k];
+	    unsigned int tx0 = static_cast<unsigned int>(
+	        std::max(0., r0.xMin)) / tileSize;
+	    unsigned int tx1 = std::min(static_cast<unsigned int>(r0.xMax) 
+	        / tileSize, nx - 1);
+	    unsigned int ty0 = static_cast<unsigned int>(
+	        std::max(0., r0.yMin)) / tileSize;
+	    unsigned int ty1 = std::min(static_cast<unsigned int>(r0.yMax) 
+	        / tileSize, ny - 1);
+	    for (unsigned int j = ty0; j <= ty1; j++)
+	        for (unsigned int i = tx0; i <= tx1; i++)
+	            tiles[j * nx + i].polygons.push_back(k);
+	}
+	RasterTileVector t1;
+	for (RasterTileVector::iterator i = tiles.begin(); i != tiles.end(); i++)
+	{
+	    if (i->polygons.size() > 0)
+	    {
+	        t1.push_back(RasterTile());
+	        RasterTile& t0 = t1.back();
+	        t0.x0 = i->x0;
+	        t0.y0 = i->y0;
+	        t0.width = i->width;
+	        t0.height = i->height;
+	        t0.polygons.swap(i->polygons);
+	    }
+	}
+	if (t1.size() == 0)
+	    return;
+	// Fill the tiles.
+	if (numThreads == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        numThreads = np;
+	    else
+	        numThreads = 1;
+	}
+	if (numThreads > t1.size())
+	    numThreads = t1.size();
+	RasterUpdate u0;
+	u0.pixels = pixels;
+	u0.rowStride = rowStride;
+	u0.numChannels = numChannels;
+	u0.polygons = &rp;
+	u0.tiles = &t1;
+	u0.nextTile = 0;
+	pthread_mutex_init(&(u0.mutex), 0);
+	std::vector<pthread_t> threads(numThreads);
+	std::vector<bool> threaded(numThreads, false);
+	for (unsigned int i = 1; i < numThreads; i++)
+	    threaded[i] = (pthread_create(&(threads[i]), 0, rasterizeTask, 
+	        &u0) == 0);
+	/* The calling thread takes part in the update. Tiles are taken from 
+	   a common queue, so all tiles are filled even if no thread could 
+	   be created. */
+	rasterizeTask(&u0);
+	for (unsigned int i = 1; i < numThreads; i++)
+	{
+	    if (threaded[i])
+	        pthread_join(threads[i], 0);
+	}
+	pthread_mutex_destroy(&(u0.mutex));
+}
+
 void Image::drawSVG(Ionflux::GeoUtils::SVG& svg, int originX, int originY)
 {
 	if (!drawingInProgress())
@@ -609,6 +1049,217 @@ blender)
 	    delete blender;
 }
 
+unsigned int Image::getPixelSpansOnRay(const Ionflux::GeoUtils::Line3&
+ray, Ionflux::GeoUtils::PixelSpanVector& target, double t)
+{
+	if ((width == 0) || (height == 0))
+	    return 0;
+	Vector3 p0(ray.getP());
+	Vector3 u0(ray.getU());
+	// Restrict the ray to the slab containing the pixel voxels.
+	double s0 = 0.;
+	double s1 = DBL_MAX;
+	if (!clipRaySlab(p0[2], u0[2], -0.5 - t, 0.5 + t, s0, s1)
+	    || !clipRaySlab(p0[0], u0[0], -t, width + t, s0, s1)
+	    || !clipRaySlab(p0[1], u0[1], -t, height + t, s0, s1))
+	    return 0;
+	double yMin = p0[1];
+	double yMax = p0[1];
+	if (u0[1] != 0.)
+	{
+	    yMin = p0[1] + s0 * u0[1];
+	    yMax = p0[1] + s1 * u0[1];
+	    if (yMin > yMax)
+	        swap(yMin, yMax);
+	}
+	double r0 = ::ceil(yMin - 1. - t);
+	if (r0 < 0.)
+	    r0 = 0.;
+	double r1 = ::floor(yMax + t);
+	if (r1 > (height - 1.))
+	    r1 = height - 1.;
+	unsigned int numPixels = 0;
+	for (int y = static_cast<int>(r0); y <= static_cast<int>(r1); y++)
+	{
+	    double s2 = s0;
+	    double s3 = s1;
+	    if (!clipRaySlab(p0[1], u0[1], y - t, y + 1. + t, s2, s3))
+	        continue;
+	    double xMin = p0[0];
+	    double xMax = p0[0];
+	    if (u0[0] != 0.)
+	    {
+	        xMin = p0[0] + s2 * u0[0];
+	        xMax = p0[0] + s3 * u0[0];
+	        if (xMin > xMax)
+	            swap(xMin, xMax);
+	    }
+	    numPixels += addPixelSpan(target, y, xMin - 1. - t, xMax + t);
+	}
+	return numPixels;
+}
+
+unsigned int Image::getPixelSpansInSphere(const
+Ionflux::GeoUtils::Sphere3& sphere, Ionflux::GeoUtils::PixelSpanVector&
+target, double t)
+{
+	Vector3 c0(sphere.getP());
+	/* Like BoxBoundsItem::checkSphere(), this uses the bounding sphere of
+	   the pixel voxel. */
+	double r0 = sphere.getR() + ::sqrt(0.75) + t;
+	double r2 = r0 * r0 - c0[2] * c0[2];
+	if ((r2 < 0.) || (width == 0) || (height == 0))
+	    return 0;
+	double r1 = ::sqrt(r2);
+	double y0 = ::ceil(c0[1] - r1 - 0.5);
+	if (y0 < 0.)
+	    y0 = 0.;
+	double y1 = ::floor(c0[1] + r1 - 0.5);
+	if (y1 > (height - 1.))
+	    y1 = height - 1.;
+	unsigned int numPixels = 0;
+	for (int y = static_cast<int>(y0); y <= static_cast<int>(y1); y++)
+	{
+	    double dy = y + 0.5 - c0[1];
+	    double w2 = r2 - dy * dy;
+	    if (w2 < 0.)
+	        continue;
+	    double w = ::sqrt(w2);
+	    numPixels += addPixelSpan(target, y, c0[0] - w - 0.5,
+	        c0[0] + w - 0.5);
+	}
+	return numPixels;
+}
+
+unsigned int Image::getPixelSpansInBox(const
+Ionflux::GeoUtils::BoxBoundsItem& box,
+Ionflux::GeoUtils::PixelSpanVector& target, double t)
+{
+	Range3 b0(box.getBounds());
+	Vector3 bMin(b0.getRMin());
+	Vector3 bMax(b0.getRMax());
+	if ((width == 0) || (height == 0)
+	    || (0.5 < (bMin[2] - t)) || (-0.5 > (bMax[2] + t)))
+	    return 0;
+	double y0 = ::ceil(bMin[1] - 1. - t);
+	if (y0 < 0.)
+	    y0 = 0.;
+	double y1 = ::floor(bMax[1] + t);
+	if (y1 > (height - 1.))
+	    y1 = height - 1.;
+	unsigned int numPixels = 0;
+	for (int y = static_cast<int>(y0); y <= static_cast<int>(y1); y++)
+	    numPixels += addPixelSpan(target, y, bMin[0] - 1. - t, bMax[0] + t);
+	return numPixels;
+}
+
+unsigned int Image::getPixelSpansInPolygon(Ionflux::GeoUtils::Polygon3&
+polygon, Ionflux::GeoUtils::PixelSpanVector& target)
+{
+	polygon.applyTransform();
+	unsigned int numVerts = polygon.getNumVertices();
+	if ((numVerts < 3) || (width == 0) || (height == 0))
+	    return 0;
+	DoubleVector px;
+	DoubleVector py;
+	double yMin = DBL_MAX;
+	double yMax = -DBL_MAX;
+	for (unsigned int i = 0; i < numVerts; i++)
+	{
+	    Vertex3* v0 = polygon.getVertex(i);
+	    px.push_back((*v0)[0]);
+	    py.push_back((*v0)[1]);
+	    if ((*v0)[1] < yMin)
+	        yMin = (*v0)[1];
+	    if ((*v0)[1] > yMax)
+	        yMax = (*v0)[1];
+	}
+	double y0 = ::ceil(yMin - 0.5);
+	if (y0 < 0.)
+	    y0 = 0.;
+	double y1 = ::floor(yMax - 0.5);
+	if (y1 > (height - 1.))
+	    y1 = height - 1.;
+	unsigned int numPixels = 0;
+	DoubleVector xs;
+	for (int y = static_cast<int>(y0); y <= static_cast<int>(y1); y++)
+	{
+	    // Find the edge crossings at the pixel centers of the row.
+	    double yc = y + 0.5;
+	    xs.clear();
+	    for (unsigned int i = 0; i < numVerts; i++)
+	    {
+	        unsigned int j = (i + 1) % numVerts;
+	        if ((py[i] <= yc) != (py[j] <= yc))
+	            xs.push_back(px[i] + (yc - py[i])
+	                * (px[j] - px[i]) / (py[j] - py[i]));
+	    }
+	    sort(xs.begin(), xs.end());
+	    for (unsigned int k = 0; (k + 1) < xs.size(); k += 2)
+	        numPixels += addPixelSpan(target, y, xs[k] - 0.5,
+	            ::ceil(xs[k + 1] - 0.5) - 1.);
+	}
+	return numPixels;
+}
+
+void Image::markPixelSpans(const Ionflux::GeoUtils::PixelSpanVector&
+spans, const Ionflux::Altjira::Color& color, const
+Ionflux::Altjira::ColorBlender* blender)
+{
+	for (PixelSpanVector::const_iterator i = spans.begin();
+	    i != spans.end(); i++)
+	{
+	    const PixelSpan& s0 = *i;
+	    if ((s0.y >= height)
+	        || (s0.x0 > s0.x1)
+	        || (s0.x1 > width))
+	    {
+	        std::ostringstream status;
+	        status << "[Image::markPixelSpans] "
+	            "Invalid pixel span: (" << s0.y << ", " << s0.x0 << ", "
+	            << s0.x1 << ")";
+	        throw GeoUtilsError(status.str());
+	    }
+	}
+	bool ownBlender = false;
+	bool useComp = false;
+	if (color.getAlpha() != 1)
+	{
+	    // use compositing.
+	    useComp = true;
+	    if (blender == 0)
+	    {
+	        blender = Ionflux::Altjira::BlendSrcOver::create();
+	        ownBlender = true;
+	    }
+	}
+	ByteColor sc0;
+	sc0.space = Ionflux::Altjira::Color::SPACE_RGB;
+	color.getByteColor(sc0);
+	ByteColor rc0;
+	rc0.space = Ionflux::Altjira::Color::SPACE_RGB;
+	ByteColor tc0;
+	tc0.space = Ionflux::Altjira::Color::SPACE_RGB;
+	if (!useComp)
+	    rc0 = sc0;
+	for (PixelSpanVector::const_iterator i = spans.begin();
+	    i != spans.end(); i++)
+	{
+	    const PixelSpan& s0 = *i;
+	    for (unsigned int x = s0.x0; x < s0.x1; x++)
+	    {
+	        if (useComp)
+	        {
+	            getPixel(x, s0.y, tc0);
+	            blender->blend(rc0, sc0, tc0, 255, 255);
+	        }
+	        setPixel(x, s0.y, rc0);
+	    }
+	}
+	if (ownBlender)
+	    delete blender;
+}
+
 Ionflux::GeoUtils::Image& Image::operator=(const Ionflux::GeoUtils::Image& 
 other)
 {
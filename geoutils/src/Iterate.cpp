@@ -158,6 +158,25 @@ std::string Iterate::getString() const
 	return status.str();
 }
 
+bool Iterate::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
+bool Iterate::isDirty() const
+{
+	bool result = TransformNode::isDirty();
+	if (!result 
+	    && (inputs.size() > 0))
+	{
+	    TransformNode* n0 = inputs[INPUT_SOURCE].node;
+	    result = (n0 != 0) 
+	        && n0->isDirty();
+	}
+	return result;
+}
+
 void Iterate::updateInputs()
 {
 	/* Nothing to be done here. Input nodes will be updated in the 
@@ -167,6 +186,7 @@ void Iterate::updateInputs()
 void Iterate::setNumIterations(unsigned int newNumIterations)
 {
 	numIterations = newNumIterations;
+	touch();
 }
 
 unsigned int Iterate::getNumIterations() const
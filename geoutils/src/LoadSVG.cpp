@@ -133,9 +133,16 @@ std::string LoadSVG::getString() const
 	return status.str();
 }
 
+bool LoadSVG::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
 void LoadSVG::setFileName(const std::string& newFileName)
 {
 	fileName = newFileName;
+	touch();
 }
 
 std::string LoadSVG::getFileName() const
@@ -187,6 +194,7 @@ std::vector<std::string>& LoadSVG::getElementIDs()
 void LoadSVG::addElementID(std::string addElement)
 {
 	elementIDs.push_back(addElement);
+	touch();
 }
 
 void LoadSVG::removeElementID(std::string removeElement)
@@ -206,6 +214,7 @@ void LoadSVG::removeElementID(std::string removeElement)
 	if (found)
 	{
 		elementIDs.erase(elementIDs.begin() + i);
+		touch();
 	}
 }
 
@@ -214,11 +223,13 @@ void LoadSVG::removeElementIDIndex(unsigned int removeIndex)
     if (removeIndex > elementIDs.size())
         return;
     elementIDs.erase(elementIDs.begin() + removeIndex);
+	touch();
 }
 
 void LoadSVG::clearElementIDs()
 {
     elementIDs.clear();
+	touch();
 }
 
 Ionflux::GeoUtils::TransformNodes::LoadSVG& LoadSVG::operator=(const 
@@ -141,6 +141,33 @@ value) const
 	return *result;
 }
 
+void Lookup3::callBatch(const Ionflux::Mapping::MappingValueVector&
+values, Ionflux::ObjectBase::DoubleVector& targetX,
+Ionflux::ObjectBase::DoubleVector& targetY,
+Ionflux::ObjectBase::DoubleVector& targetZ) const
+{
+	unsigned int n0 = entries.size();
+	if (n0 == 0)
+	    throw GeoUtilsError("Lookup table is empty.");
+	unsigned int n = values.size();
+	targetX.resize(n);
+	targetY.resize(n);
+	targetZ.resize(n);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    unsigned int k = static_cast<unsigned int>(
+	        Ionflux::Mapping::clamp(values[i], CLAMP_RANGE) * n0);
+	    if (k >= n0)
+	        k = n0 - 1;
+	    Vector3* v0 = entries[k];
+	    if (v0 == 0)
+	        throw GeoUtilsError("Result vector is null.");
+	    targetX[i] = v0->getX0();
+	    targetY[i] = v0->getX1();
+	    targetZ[i] = v0->getX2();
+	}
+}
+
 std::string Lookup3::getString() const
 {
 	ostringstream status;
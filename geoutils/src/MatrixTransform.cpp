@@ -118,6 +118,7 @@ void MatrixTransform::setMatrix(const Ionflux::GeoUtils::Matrix4&
 newMatrix)
 {
 	matrix = newMatrix;
+	touch();
 }
 
 Ionflux::GeoUtils::Matrix4 MatrixTransform::getMatrix() const
@@ -33,17 +33,23 @@
 #include <iomanip>
 #include <fstream>
 #include <algorithm>
+#include <pthread.h>
+#include <unistd.h>
 #include "ifmapping/utils.hpp"
 #include "ifobject/utils.hpp"
 #include "ifobject/objectutils.hpp"
 #include "ifobject/IFIOContext.hpp"
 #include "geoutils/GeoUtilsError.hpp"
 #include "geoutils/Vertex.hpp"
+#include "geoutils/FaceData.hpp"
 #include "geoutils/Edge.hpp"
 #include "geoutils/NFaceSet.hpp"
 #include "geoutils/VectorSetSet.hpp"
 #include "geoutils/FaceCompareAxis.hpp"
 #include "geoutils/xmlutils.hpp"
+#include "geoutils/VertexTree.hpp"
+#include "geoutils/MeshAdjacency.hpp"
+#include "geoutils/meshio.hpp"
 #include "ifobject/utils.hpp"
 #include "ifobject/xmlutils.hpp"
 #include "ifobject/xmlutils_private.hpp"
@@ -172,6 +178,184 @@ void Mesh::recalculateBounds()
 	removeLocalRef(m0);
 }
 
+void Mesh::checkFaceGeometry(unsigned int faceIndex, const std::string&
+source) const
+{
+	if (!hasFaceGeometry() 
+	    || (faceIndex >= faces.size()))
+	{
+	    std::ostringstream status;
+	    status << "Face geometry not available (faceIndex = " 
+	        << faceIndex << ").";
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void Mesh::calculateGeometry(Ionflux::GeoUtils::MeshUpdateTask& task)
+{
+	// vertex bounds
+	double* vb = task.bounds;
+	for (unsigned int i = task.firstVertex; i < task.lastVertex; i++)
+	{
+	    Vertex3* v0 = Ionflux::ObjectBase::nullPointerCheck(
+	        vertexSource->getVertex(i), this, "calculateGeometry", "Vertex");
+	    double x = v0->getX();
+	    double y = v0->getY();
+	    double z = v0->getZ();
+	    if (i == task.firstVertex)
+	    {
+	        vb[0] = vb[1] = x;
+	        vb[2] = vb[3] = y;
+	        vb[4] = vb[5] = z;
+	        continue;
+	    }
+	    if (x < vb[0])
+	        vb[0] = x;
+	    if (x > vb[1])
+	        vb[1] = x;
+	    if (y < vb[2])
+	        vb[2] = y;
+	    if (y > vb[3])
+	        vb[3] = y;
+	    if (z < vb[4])
+	        vb[4] = z;
+	    if (z > vb[5])
+	        vb[5] = z;
+	}
+	// face geometry
+	for (unsigned int i = task.firstFace; i < task.lastFace; i++)
+	{
+	    double* n0 = &(faceNormals[3 * i]);
+	    double* t0 = &(faceTangents[3 * i]);
+	    double* b0 = &(faceBinormals[3 * i]);
+	    double* fb = &(faceBounds[6 * i]);
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        n0[k] = 0.;
+	        t0[k] = 0.;
+	        b0[k] = 0.;
+	    }
+	    for (unsigned int k = 0; k < 6; k++)
+	        fb[k] = 0.;
+	    Face* f = faces[i];
+	    if (f == 0)
+	        continue;
+	    Vertex3Set* vs0 = f->getVertexSource();
+	    unsigned int numVerts = f->getNumVertices();
+	    if ((vs0 == 0) 
+	        || (numVerts == 0))
+	        continue;
+	    double p[9];
+	    for (unsigned int k = 0; k < numVerts; k++)
+	    {
+	        Vertex3* v0 = vs0->getVertex(f->getVertex(k));
+	        if (v0 == 0)
+	        {
+	            std::ostringstream status;
+	            status << "Vertex index out of range (face = " << i 
+	                << ", index = " << f->getVertex(k) << ").";
+	            throw GeoUtilsError(getErrorString(status.str(), 
+	                "calculateGeometry"));
+	        }
+	        double x = v0->getX();
+	        double y = v0->getY();
+	        double z = v0->getZ();
+	        if (k < 3)
+	        {
+	            p[3 * k] = x;
+	            p[3 * k + 1] = y;
+	            p[3 * k + 2] = z;
+	        }
+	        if (k == 0)
+	        {
+	            fb[0] = fb[1] = x;
+	            fb[2] = fb[3] = y;
+	            fb[4] = fb[5] = z;
+	            continue;
+	        }
+	        if (x < fb[0])
+	            fb[0] = x;
+	        if (x > fb[1])
+	            fb[1] = x;
+	        if (y < fb[2])
+	            fb[2] = y;
+	        if (y > fb[3])
+	            fb[3] = y;
+	        if (z < fb[4])
+	            fb[4] = z;
+	        if (z > fb[5])
+	            fb[5] = z;
+	    }
+	    if (numVerts < 3)
+	        continue;
+	    double e1[3];
+	    double e2[3];
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        e1[k] = p[3 + k] - p[k];
+	        e2[k] = p[6 + k] - p[k];
+	    }
+	    FaceData* uv = f->getTexCoords0();
+	    if ((uv == 0) 
+	        || (uv->getNumVectors() < 3))
+	    {
+	        // Calculate tangent space according to the face edges.
+	        double l0 = ::sqrt(e2[0] * e2[0] + e2[1] * e2[1] + e2[2] * e2[2]);
+	        for (unsigned int k = 0; k < 3; k++)
+	            b0[k] = e2[k] / l0;
+	        double d0 = b0[0] * e1[0] + b0[1] * e1[1] + b0[2] * e1[2];
+	        double d1 = b0[0] * b0[0] + b0[1] * b0[1] + b0[2] * b0[2];
+	        for (unsigned int k = 0; k < 3; k++)
+	            t0[k] = e1[k] - (d0 * b0[k]) / d1;
+	        double l1 = ::sqrt(t0[0] * t0[0] + t0[1] * t0[1] + t0[2] * t0[2]);
+	        for (unsigned int k = 0; k < 3; k++)
+	            t0[k] /= l1;
+	    } else
+	    {
+	        // Calculate tangent space according to texture coordinates.
+	        Vector* uv0 = Ionflux::ObjectBase::nullPointerCheck(
+	            uv->getVector(0), this, "calculateGeometry", 
+	            "Texture coordinate vector");
+	        Vector* uv1 = Ionflux::ObjectBase::nullPointerCheck(
+	            uv->getVector(1), this, "calculateGeometry", 
+	            "Texture coordinate vector");
+	        Vector* uv2 = Ionflux::ObjectBase::nullPointerCheck(
+	            uv->getVector(2), this, "calculateGeometry", 
+	            "Texture coordinate vector");
+	        double du1 = uv1->getElement(0) - uv0->getElement(0);
+	        double dv1 = uv1->getElement(1) - uv0->getElement(1);
+	        double du2 = uv2->getElement(0) - uv0->getElement(0);
+	        double dv2 = uv2->getElement(1) - uv0->getElement(1);
+	        double s0 = 1. / (dv2 * du1 - dv1 * du2);
+	        for (unsigned int k = 0; k < 3; k++)
+	            b0[k] = s0 * (du1 * e2[k] - du2 * e1[k]);
+	        double s1 = 1. / du1;
+	        for (unsigned int k = 0; k < 3; k++)
+	            t0[k] = s1 * (e1[k] - dv1 * b0[k]);
+	    }
+	    n0[0] = t0[1] * b0[2] - t0[2] * b0[1];
+	    n0[1] = t0[2] * b0[0] - t0[0] * b0[2];
+	    n0[2] = t0[0] * b0[1] - t0[1] * b0[0];
+	    double l2 = ::sqrt(n0[0] * n0[0] + n0[1] * n0[1] + n0[2] * n0[2]);
+	    for (unsigned int k = 0; k < 3; k++)
+	        n0[k] /= l2;
+	}
+}
+
+void* Mesh::updateTask(void* taskArg)
+{
+	MeshUpdateTask* t0 = static_cast<MeshUpdateTask*>(taskArg);
+	try
+	{
+	    t0->mesh->calculateGeometry(*t0);
+	} catch (std::exception& e)
+	{
+	    t0->error = true;
+	    t0->errorMessage = e.what();
+	}
+	return 0;
+}
+
 Ionflux::GeoUtils::Range3 Mesh::getBounds()
 {
 	bounds = TransformableObject::getBounds();
@@ -189,37 +373,33 @@ void Mesh::update(bool updateFaces, bool updateEdges)
 {
 	Ionflux::ObjectBase::nullPointerCheck(vertexSource, this, 
 	    "update", "Vertex source");
-	// Determine the bounds.
-	recalculateBounds();
-	// update faces.
 	/* <---- DEBUG ----- //
 	std::cerr << "[Mesh::update] DEBUG: updating faces (numFaces = " 
 	    << getNumFaces() << ", updateFaces = " << updateFaces 
 	    << ", updateEdges = " << updateEdges << ")." << std::endl;
-	unsigned int k = 0;
 	// ----- DEBUG ----> */
-	for (FaceVector::iterator i = faces.begin(); 
-	    i != faces.end(); i++)
+	if (updateFaces)
 	{
-	    /* <---- DEBUG ----- //
-	    if ((k % 10000) == 0)
-	    {
-	        std::cerr << "[Mesh::update] DEBUG: updating face #" << k 
-	            << "." << std::endl;
-	    }
-	    // ----- DEBUG ----> */
-	    Face* f = *i;
-	    if (f->getVertexSource() == 0)
+	    // Determine the bounds and update faces.
+	    updateGeometry();
+	} else
+	{
+	    // Determine the bounds.
+	    recalculateBounds();
+	    /* Face geometry is not updated, so it may be out of date with 
+	       respect to the vertices. */
+	    clearFaceGeometry();
+	    for (FaceVector::iterator i = faces.begin(); 
+	        i != faces.end(); i++)
 	    {
-	        /* If the vertex source is not defined for the face, set it 
-	           to the vertex source of this mesh. */
-	        f->setVertexSource(vertexSource);
+	        Face* f = *i;
+	        if (f->getVertexSource() == 0)
+	        {
+	            /* If the vertex source is not defined for the face, set it 
+	               to the vertex source of this mesh. */
+	            f->setVertexSource(vertexSource);
+	        }
 	    }
-	    if (updateFaces)
-	        f->update();
-	    /* <---- DEBUG ----- //
-	    k++;
-	    // ----- DEBUG ----> */
 	}
 	// update edges.
 	/* <---- DEBUG ----- //
@@ -242,11 +422,240 @@ void Mesh::update(bool updateFaces, bool updateEdges)
 	updateRadiusAndCenter();
 }
 
+void Mesh::updateGeometry(unsigned int numThreads)
+{
+	Ionflux::ObjectBase::nullPointerCheck(vertexSource, this, 
+	    "updateGeometry", "Vertex source");
+	unsigned int numFaces = faces.size();
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    Face* f = faces[i];
+	    if ((f != 0) 
+	        && (f->getVertexSource() == 0))
+	    {
+	        /* If the vertex source is not defined for the face, set it 
+	           to the vertex source of this mesh. */
+	        f->setVertexSource(vertexSource);
+	    }
+	}
+	/* The bounds of the mesh can be taken directly from the vertices if 
+	   neither the mesh nor the vertex source are transformed. */
+	bool vertexBounds = !useTransform() && !useVI() 
+	    && !vertexSource->useTransform() && !vertexSource->useVI();
+	unsigned int numVerts = 0;
+	if (vertexBounds)
+	    numVerts = vertexSource->getNumVertices();
+	faceNormals.resize(3 * numFaces);
+	faceTangents.resize(3 * numFaces);
+	faceBinormals.resize(3 * numFaces);
+	faceBounds.resize(6 * numFaces);
+	if (numThreads == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        numThreads = np;
+	    else
+	        numThreads = 1;
+	}
+	if (numFaces < MESH_UPDATE_PARALLEL_MIN_FACES)
+	    numThreads = 1;
+	std::vector<MeshUpdateTask> tasks(numThreads);
+	std::vector<pthread_t> threads(numThreads);
+	std::vector<bool> threaded(numThreads, false);
+	unsigned int fc = numFaces / numThreads;
+	unsigned int vc = numVerts / numThreads;
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    MeshUpdateTask& t0 = tasks[i];
+	    t0.mesh = this;
+	    t0.firstFace = i * fc;
+	    t0.firstVertex = i * vc;
+	    if ((i + 1) < numThreads)
+	    {
+	        t0.lastFace = t0.firstFace + fc;
+	        t0.lastVertex = t0.firstVertex + vc;
+	    } else
+	    {
+	        t0.lastFace = numFaces;
+	        t0.lastVertex = numVerts;
+	    }
+	    for (unsigned int k = 0; k < 6; k++)
+	        t0.bounds[k] = 0.;
+	    t0.error = false;
+	}
+	for (unsigned int i = 1; i < numThreads; i++)
+	    threaded[i] = (pthread_create(&(threads[i]), 0, updateTask,
+	        &(tasks[i])) == 0);
+	updateTask(&(tasks[0]));
+	for (unsigned int i = 1; i < numThreads; i++)
+	{
+	    if (threaded[i])
+	        pthread_join(threads[i], 0);
+	    else
+	        updateTask(&(tasks[i]));
+	}
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    if (tasks[i].error)
+	    {
+	        clearFaceGeometry();
+	        throw GeoUtilsError(tasks[i].errorMessage);
+	    }
+	}
+	// mesh bounds
+	if (vertexBounds)
+	{
+	    TransformableObject::recalculateBounds();
+	    bool e0 = true;
+	    double vb[6];
+	    for (unsigned int i = 0; i < numThreads; i++)
+	    {
+	        const MeshUpdateTask& t0 = tasks[i];
+	        if (t0.firstVertex == t0.lastVertex)
+	            continue;
+	        if (e0)
+	        {
+	            for (unsigned int k = 0; k < 6; k++)
+	                vb[k] = t0.bounds[k];
+	            e0 = false;
+	            continue;
+	        }
+	        for (unsigned int k = 0; k < 6; k += 2)
+	        {
+	            if (t0.bounds[k] < vb[k])
+	                vb[k] = t0.bounds[k];
+	            if (t0.bounds[k + 1] > vb[k + 1])
+	                vb[k + 1] = t0.bounds[k + 1];
+	        }
+	    }
+	    if (!e0)
+	        *boundsCache = Range3(vb[0], vb[1], vb[2], vb[3], vb[4], vb[5]);
+	    bounds = *boundsCache;
+	} else
+	    recalculateBounds();
+	// face bounds
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    Face* f = faces[i];
+	    if (f == 0)
+	        continue;
+	    Vertex3Set* vs0 = f->getVertexSource();
+	    double* fb = &(faceBounds[6 * i]);
+	    if ((f->getNumVertices() > 0) 
+	        && !f->useTransform() && !f->useVI() 
+	        && !vs0->useTransform() && !vs0->useVI())
+	    {
+	        f->updateFromBounds(
+	            Range3(fb[0], fb[1], fb[2], fb[3], fb[4], fb[5]));
+	    } else
+	    {
+	        f->update();
+	        if (f->getNumVertices() > 0)
+	        {
+	            Range3 r0 = f->getBounds();
+	            Range rx = r0.getX();
+	            Range ry = r0.getY();
+	            Range rz = r0.getZ();
+	            fb[0] = rx.getRMin();
+	            fb[1] = rx.getRMax();
+	            fb[2] = ry.getRMin();
+	            fb[3] = ry.getRMax();
+	            fb[4] = rz.getRMin();
+	            fb[5] = rz.getRMax();
+	        }
+	    }
+	}
+}
+
+void Mesh::clearFaceGeometry()
+{
+	faceNormals.clear();
+	faceTangents.clear();
+	faceBinormals.clear();
+	faceBounds.clear();
+}
+
+bool Mesh::hasFaceGeometry() const
+{
+	unsigned int numFaces = faces.size();
+	bool result = (faceNormals.size() == 3 * numFaces) 
+	    && (faceBounds.size() == 6 * numFaces);
+	return result;
+}
+
+Ionflux::GeoUtils::Vector3 Mesh::getFaceNormal(unsigned int faceIndex)
+const
+{
+	checkFaceGeometry(faceIndex, "getFaceNormal");
+	const double* c0 = &(faceNormals[3 * faceIndex]);
+	return Vector3(c0[0], c0[1], c0[2]);
+}
+
+Ionflux::GeoUtils::Vector3 Mesh::getFaceTangent(unsigned int faceIndex)
+const
+{
+	checkFaceGeometry(faceIndex, "getFaceTangent");
+	const double* c0 = &(faceTangents[3 * faceIndex]);
+	return Vector3(c0[0], c0[1], c0[2]);
+}
+
+Ionflux::GeoUtils::Vector3 Mesh::getFaceBinormal(unsigned int faceIndex)
+const
+{
+	checkFaceGeometry(faceIndex, "getFaceBinormal");
+	const double* c0 = &(faceBinormals[3 * faceIndex]);
+	return Vector3(c0[0], c0[1], c0[2]);
+}
+
+Ionflux::GeoUtils::Range3 Mesh::getFaceBounds(unsigned int faceIndex)
+const
+{
+	checkFaceGeometry(faceIndex, "getFaceBounds");
+	const double* c0 = &(faceBounds[6 * faceIndex]);
+	return Range3(c0[0], c0[1], c0[2], c0[3], c0[4], c0[5]);
+}
+
+const double* Mesh::getFaceNormalData() const
+{
+	if (!hasFaceGeometry() 
+	    || (faceNormals.size() == 0))
+	    return 0;
+	return &(faceNormals[0]);
+}
+
+const double* Mesh::getFaceTangentData() const
+{
+	if (!hasFaceGeometry() 
+	    || (faceTangents.size() == 0))
+	    return 0;
+	return &(faceTangents[0]);
+}
+
+const double* Mesh::getFaceBinormalData() const
+{
+	if (!hasFaceGeometry() 
+	    || (faceBinormals.size() == 0))
+	    return 0;
+	return &(faceBinormals[0]);
+}
+
+void Mesh::updateBounds()
+{
+	if (vertexSource == 0)
+	{
+	    BoxBoundsItem::updateBounds();
+	    return;
+	}
+	recalculateBounds();
+	updateRadiusAndCenter();
+}
+
 void Mesh::clear()
 {
 	setVertexSource(0);
 	clearFaces();
 	clearEdges();
+	clearFaceGeometry();
 	BoxBoundsItem::clear();
 	TransformableObject::clear();
 }
@@ -257,6 +666,7 @@ void Mesh::clearData()
 	    vertexSource->clearVertices();
 	clearFaces();
 	clearEdges();
+	clearFaceGeometry();
 	BoxBoundsItem::clear();
 	TransformableObject::clear();
 }
@@ -534,6 +944,8 @@ void Mesh::applyTransform(bool recursive)
 {
 	Ionflux::ObjectBase::nullPointerCheck(vertexSource, this, 
 	    "applyTransform", "Vertex source");
+	// Face geometry is dependent on transformation.
+	clearFaceGeometry();
 	if (!useTransform() && !useVI())
 	{
 	    if (recursive)
@@ -802,12 +1214,19 @@ unsigned int Mesh::makeTris()
 
 void Mesh::setFaceVertexNormals(bool flip0)
 {
+	if (!hasFaceGeometry())
+	    updateGeometry();
 	unsigned int numFaces = getNumFaces();
 	for (unsigned int i = 0; i < numFaces; i++)
 	{
 	    Face* cf = getFace(i);
 	    if (cf != 0)
-	        cf->setFaceVertexNormals(flip0);
+	    {
+	        Vector3 n0 = getFaceNormal(i);
+	        if (flip0)
+	            n0.flipIP();
+	        cf->setVertexNormals(n0);
+	    }
 	}
 }
 
@@ -868,57 +1287,40 @@ bool Mesh::isTriMesh() const
 
 unsigned int Mesh::createEdges()
 {
-	unsigned int numFaces = getNumFaces();
-	unsigned int neCount = 0;
-	NFaceSet nes;
-	NFaceSet ces;
-	EdgeObjSet es0;
-	for (unsigned int i = 0; i < numFaces; i++)
-	{
-	    Face* cf = getFace(i);
-	    if (cf != 0)
+	MeshAdjacency* ma = MeshAdjacency::create();
+	addLocalRef(ma);
+	unsigned int neCount = ma->update(*this);
+	NFaceVector nes;
+	UIntVector vv0;
+	for (unsigned int i = 0; i < neCount; i++)
+	{
+	    // first half-edge of each edge, in order of first occurrence
+	    unsigned int h0 = ma->getEdgeHalfEdge(i);
+	    unsigned int h1 = ma->getNextHalfEdge(h0);
+	    unsigned int fi = ma->getHalfEdgeFace(h0);
+	    Face* cf = Ionflux::ObjectBase::nullPointerCheck(getFace(fi), 
+	        this, "createEdges", "Face");
+	    NFace* e0 = NFace::create();
+	    e0->setVertexSource(cf->getVertexSource());
+	    e0->addVertices(ma->getHalfEdgeSource(h0), 
+	        ma->getHalfEdgeSource(h1));
+	    if (cf->getFaceData() != 0)
 	    {
-	        ces.clearNFaces();
-	        cf->getEdges(ces, true);
-	        for (unsigned int k = 0; k < ces.getNumNFaces(); k++)
-	        {
-	            NFace* ce0 = Ionflux::ObjectBase::nullPointerCheck(
-	                ces.getNFace(k), this, "createEdges", "Edge");
-	            Edge ce1;
-	            ce0->getEdge(ce1);
-	            ce1.sort();
-	            /* <---- DEBUG ----- //
-	            std::cerr << "[Mesh::createEdges] DEBUG: "
-	                "N-face: [" << ce0->getValueString() 
-	                << "], edge: [" << ce1.getValueString() << "]" 
-	                << std::endl;
-	            // ----- DEBUG ----> */
-	            if (es0.count(ce1) == 0)
-	            {
-	                /* <---- DEBUG ----- //
-	                std::cerr << "[Mesh::createEdges] DEBUG: "
-	                    "adding edge: [" << ce0->getValueString() 
-	                    << "]" << std::endl;
-	                // ----- DEBUG ----> */
-	                // new edge
-	                es0.insert(ce1);
-	                nes.addNFace(ce0);
-	                neCount++;
-	            } else 
-	            {
-	                /* <---- DEBUG ----- //
-	                std::cerr << "[Mesh::createEdges] DEBUG: "
-	                    "not adding edge to new edge set" 
-	                    << std::endl;
-	                // ----- DEBUG ----> */
-	            }
-	        }
+	        // copy face data
+	        unsigned int fh0 = ma->getFaceHalfEdge(fi);
+	        vv0.clear();
+	        Ionflux::ObjectBase::addValues(vv0, 2, h0 - fh0, h1 - fh0);
+	        VectorSetSet* fd0 = VectorSetSet::create();
+	        cf->getFaceDataByVertex(vv0, *fd0);
+	        e0->setFaceData(fd0);
 	    }
+	    nes.push_back(e0);
 	}
+	removeLocalRef(ma);
 	if (neCount > 0)
 	{
 	    clearEdges();
-	    addEdges(nes.getNFaces());
+	    addEdges(nes);
 	}
 	return neCount;
 }
@@ -969,53 +1371,112 @@ void Mesh::merge(Ionflux::GeoUtils::Mesh& other)
 	    removeLocalRef(source);
 }
 
+unsigned int Mesh::weld(double t, unsigned int numThreads)
+{
+	Ionflux::ObjectBase::nullPointerCheck(vertexSource, this, 
+	    "weld", "Vertex source");
+	unsigned int n0 = vertexSource->getNumVertices();
+	if (n0 < 2)
+	    return 0;
+	VertexTree* vt = VertexTree::create();
+	addLocalRef(vt);
+	vt->update(vertexSource, DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES, 
+	    numThreads);
+	// n0 marks vertices that have not been assigned yet.
+	UIntVector indexMap(n0, n0);
+	UIntVector found;
+	Vertex3Vector keep;
+	for (unsigned int i = 0; i < n0; i++)
+	{
+	    if (indexMap[i] != n0)
+	        continue;
+	    Vertex3* v0 = Ionflux::ObjectBase::nullPointerCheck(
+	        vertexSource->getVertex(i), this, "weld", "Vertex");
+	    unsigned int k = keep.size();
+	    indexMap[i] = k;
+	    keep.push_back(v0);
+	    addLocalRef(v0);
+	    found.clear();
+	    vt->findInRadius(v0->getVector(), t, found);
+	    for (UIntVector::iterator j = found.begin(); j != found.end(); j++)
+	    {
+	        if (indexMap[*j] == n0)
+	            indexMap[*j] = k;
+	    }
+	}
+	removeLocalRef(vt);
+	unsigned int result = n0 - keep.size();
+	if (result == 0)
+	{
+	    for (Vertex3Vector::iterator i = keep.begin(); i != keep.end(); i++)
+	        removeLocalRef(*i);
+	    return 0;
+	}
+	vertexSource->clearVertices();
+	vertexSource->addVertices(keep);
+	for (Vertex3Vector::iterator i = keep.begin(); i != keep.end(); i++)
+	    removeLocalRef(*i);
+	for (FaceVector::iterator i = faces.begin(); i != faces.end(); i++)
+	    (*i)->applyVertexIndexMap(indexMap);
+	for (NFaceVector::iterator i = edges.begin(); i != edges.end(); i++)
+	    (*i)->applyVertexIndexMap(indexMap);
+	update();
+	return result;
+}
+
 void Mesh::writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx, unsigned int 
 precision, bool smoothShading)
 {
 	std::string id0 = getID();
-	std::ostringstream d0;
+	std::string b0;
+	b0.reserve(MESH_IO_BUFFER_SIZE + 256);
 	if (id0.size() > 0)
-	{
-	    d0 << "o " << id0 << "\n";
-	    ioCtx.writeToOutputStream(d0.str());
-	}
+	    b0.append("o " + id0 + "\n");
 	// vertices
 	unsigned int numVerts = getNumVertices();
-	d0.str("");
-	d0 << std::fixed << std::setprecision(precision);
 	for (unsigned int i = 0; i < numVerts; i++)
 	{
 	    Vertex3* cv = Ionflux::ObjectBase::nullPointerCheck(getVertex(i), 
 	        this, "writeOBJ", "Vertex");
-	    d0.str("");
-	    d0 << "v " << cv->getX() << " " << cv->getY() << " " 
-	        << cv->getZ() << "\n";
-	    ioCtx.writeToOutputStream(d0.str());
+	    b0.append("v ");
+	    appendDouble(b0, cv->getX(), precision);
+	    b0.push_back(' ');
+	    appendDouble(b0, cv->getY(), precision);
+	    b0.push_back(' ');
+	    appendDouble(b0, cv->getZ(), precision);
+	    b0.push_back('\n');
+	    if (b0.size() >= MESH_IO_BUFFER_SIZE)
+	    {
+	        ioCtx.writeToOutputStream(b0);
+	        b0.clear();
+	    }
 	}
 	// faces
-	d0.str("");
-	d0 << "s ";
 	if (smoothShading)
-	    d0 << "on";
+	    b0.append("s on\n");
 	else
-	    d0 << "off";
-	d0 << "\n";
-	ioCtx.writeToOutputStream(d0.str());
+	    b0.append("s off\n");
 	unsigned int numFaces = getNumFaces();
 	for (unsigned int i = 0; i < numFaces; i++)
 	{
 	    Face* cf = Ionflux::ObjectBase::nullPointerCheck(getFace(i), 
 	        this, "writeOBJ", "Face");
-	    d0.str("");
-	    d0 << "f";
+	    b0.push_back('f');
 	    unsigned int nfv = cf->getNumVertices();
 	    for (unsigned int k = 0; k < nfv; k++)
 	    {
-	        d0 << " " << (cf->getVertex(k) + 1);
+	        b0.push_back(' ');
+	        appendUInt(b0, cf->getVertex(k) + 1);
+	    }
+	    b0.push_back('\n');
+	    if (b0.size() >= MESH_IO_BUFFER_SIZE)
+	    {
+	        ioCtx.writeToOutputStream(b0);
+	        b0.clear();
 	    }
-	    d0 << "\n";
-	    ioCtx.writeToOutputStream(d0.str());
 	}
+	if (b0.size() > 0)
+	    ioCtx.writeToOutputStream(b0);
 }
 
 std::string Mesh::getValueString() const
@@ -1790,6 +2251,7 @@ other)
     }
     clearEdges();
     addEdges(ev0);
+    clearFaceGeometry();
     BoxBoundsItem::clear();
     TransformableObject::clear();
     update(false, false);
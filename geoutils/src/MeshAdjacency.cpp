@@ -0,0 +1,746 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * MeshAdjacency.cpp               Mesh adjacency (implementation).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/MeshAdjacency.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include <pthread.h>
+#include <unistd.h>
+#include "ifobject/objectutils.hpp"
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Face.hpp"
+#include "geoutils/Mesh.hpp"
+#include "geoutils/CompactMesh.hpp"
+
+using namespace std;
+using namespace Ionflux::ObjectBase;
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+MeshAdjacencyClassInfo::MeshAdjacencyClassInfo()
+{
+	name = "MeshAdjacency";
+	desc = "Mesh adjacency";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+MeshAdjacencyClassInfo::~MeshAdjacencyClassInfo()
+{
+}
+
+// run-time type information instance constants
+const MeshAdjacencyClassInfo MeshAdjacency::meshAdjacencyClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* MeshAdjacency::CLASS_INFO = &MeshAdjacency::meshAdjacencyClassInfo;
+
+MeshAdjacency::MeshAdjacency()
+: numVertices(0)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	// TODO: Nothing ATM. ;-)
+}
+
+MeshAdjacency::MeshAdjacency(const Ionflux::GeoUtils::MeshAdjacency& other)
+: numVertices(0)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	*this = other;
+}
+
+MeshAdjacency::~MeshAdjacency()
+{
+	// TODO: Nothing ATM. ;-)
+}
+
+unsigned int MeshAdjacency::nextHalfEdge(unsigned int halfEdgeIndex)
+const
+{
+	unsigned int f0 = halfEdgeFaces[halfEdgeIndex];
+	if ((halfEdgeIndex + 1) < faceOffsets[f0 + 1])
+	    return halfEdgeIndex + 1;
+	return faceOffsets[f0];
+}
+
+unsigned int MeshAdjacency::getEdgeHash(unsigned int halfEdgeIndex)
+const
+{
+	unsigned int v0 = indices[halfEdgeIndex];
+	unsigned int v1 = indices[nextHalfEdge(halfEdgeIndex)];
+	if (v1 < v0)
+	{
+	    unsigned int tmp = v0;
+	    v0 = v1;
+	    v1 = tmp;
+	}
+	return (v0 * 73856093U) ^ (v1 * 19349663U);
+}
+
+bool MeshAdjacency::isSameEdge(unsigned int h0, unsigned int h1) const
+{
+	unsigned int s0 = indices[h0];
+	unsigned int t0 = indices[nextHalfEdge(h0)];
+	unsigned int s1 = indices[h1];
+	unsigned int t1 = indices[nextHalfEdge(h1)];
+	return ((s0 == s1) && (t0 == t1)) || ((s0 == t1) && (t0 == s1));
+}
+
+void MeshAdjacency::matchEdges(unsigned int part, unsigned int numParts,
+const Ionflux::ObjectBase::UIntVector& hashes,
+Ionflux::ObjectBase::UIntVector& reps) const
+{
+	unsigned int numHalfEdges = indices.size();
+	unsigned int n0 = 0;
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    if ((hashes[i] % numParts) == part)
+	        n0++;
+	}
+	unsigned int tableSize = 16;
+	while (tableSize < 2 * n0)
+	    tableSize <<= 1;
+	unsigned int mask = tableSize - 1;
+	Ionflux::ObjectBase::UIntVector table(tableSize, HALF_EDGE_NONE);
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    unsigned int hv = hashes[i];
+	    if ((hv % numParts) != part)
+	        continue;
+	    unsigned int k = (hv / numParts) & mask;
+	    while (true)
+	    {
+	        unsigned int h0 = table[k];
+	        if (h0 == HALF_EDGE_NONE)
+	        {
+	            table[k] = i;
+	            reps[i] = i;
+	            break;
+	        }
+	        if (isSameEdge(h0, i))
+	        {
+	            reps[i] = h0;
+	            break;
+	        }
+	        k = (k + 1) & mask;
+	    }
+	}
+}
+
+void* MeshAdjacency::matchTask(void* taskArg)
+{
+	MeshAdjacencyMatchTask* t0 =
+	    static_cast<MeshAdjacencyMatchTask*>(taskArg);
+	try
+	{
+	    t0->adjacency->matchEdges(t0->part, t0->numParts, *(t0->hashes),
+	        *(t0->reps));
+	} catch (std::exception& e)
+	{
+	    t0->error = true;
+	    t0->errorMessage = e.what();
+	}
+	return 0;
+}
+
+void MeshAdjacency::build(unsigned int numThreads)
+{
+	unsigned int numHalfEdges = indices.size();
+	unsigned int numFaces = getNumFaces();
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    if (indices[i] >= numVertices)
+	    {
+	        std::ostringstream status;
+	        status << "Vertex index out of bounds: " << indices[i];
+	        throw GeoUtilsError(getErrorString(status.str(), "build"));
+	    }
+	}
+	// faces of half-edges
+	halfEdgeFaces.resize(numHalfEdges);
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    for (unsigned int k = faceOffsets[i]; k < faceOffsets[i + 1]; k++)
+	        halfEdgeFaces[k] = i;
+	}
+	// match half-edges to edges
+	Ionflux::ObjectBase::UIntVector hashes(numHalfEdges);
+	Ionflux::ObjectBase::UIntVector reps(numHalfEdges);
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	    hashes[i] = getEdgeHash(i);
+	if (numThreads == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        numThreads = np;
+	    else
+	        numThreads = 1;
+	}
+	if (numHalfEdges < MESH_ADJACENCY_PARALLEL_MIN_HALF_EDGES)
+	    numThreads = 1;
+	std::vector<MeshAdjacencyMatchTask> tasks(numThreads);
+	std::vector<pthread_t> threads(numThreads);
+	std::vector<bool> threaded(numThreads, false);
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    MeshAdjacencyMatchTask& t0 = tasks[i];
+	    t0.adjacency = this;
+	    t0.hashes = &hashes;
+	    t0.reps = &reps;
+	    t0.part = i;
+	    t0.numParts = numThreads;
+	    t0.error = false;
+	}
+	for (unsigned int i = 1; i < numThreads; i++)
+	    threaded[i] = (pthread_create(&(threads[i]), 0, matchTask,
+	        &(tasks[i])) == 0);
+	matchTask(&(tasks[0]));
+	for (unsigned int i = 1; i < numThreads; i++)
+	{
+	    if (threaded[i])
+	        pthread_join(threads[i], 0);
+	    else
+	        matchTask(&(tasks[i]));
+	}
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    if (tasks[i].error)
+	        throw GeoUtilsError(tasks[i].errorMessage);
+	}
+	/* Number the edges in the order of their first half-edge. The
+	   representative half-edge of an edge always precedes the other
+	   half-edges of the edge. */
+	halfEdgeEdges.resize(numHalfEdges);
+	unsigned int numEdges = 0;
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    if (reps[i] == i)
+	    {
+	        halfEdgeEdges[i] = numEdges;
+	        numEdges++;
+	    } else
+	        halfEdgeEdges[i] = halfEdgeEdges[reps[i]];
+	}
+	// half-edges of edges
+	edgeOffsets.assign(numEdges + 1, 0);
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	    edgeOffsets[halfEdgeEdges[i] + 1]++;
+	for (unsigned int i = 0; i < numEdges; i++)
+	    edgeOffsets[i + 1] += edgeOffsets[i];
+	edgeHalfEdges.resize(numHalfEdges);
+	Ionflux::ObjectBase::UIntVector next0(edgeOffsets.begin(),
+	    edgeOffsets.end() - 1);
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    unsigned int e0 = halfEdgeEdges[i];
+	    edgeHalfEdges[next0[e0]] = i;
+	    next0[e0]++;
+	}
+	// twins
+	twins.assign(numHalfEdges, HALF_EDGE_NONE);
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    if ((edgeOffsets[i + 1] - edgeOffsets[i]) == 2)
+	    {
+	        unsigned int h0 = edgeHalfEdges[edgeOffsets[i]];
+	        unsigned int h1 = edgeHalfEdges[edgeOffsets[i] + 1];
+	        twins[h0] = h1;
+	        twins[h1] = h0;
+	    }
+	}
+	// outgoing half-edges of vertices
+	vertexOffsets.assign(numVertices + 1, 0);
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	    vertexOffsets[indices[i] + 1]++;
+	for (unsigned int i = 0; i < numVertices; i++)
+	    vertexOffsets[i + 1] += vertexOffsets[i];
+	vertexHalfEdges.resize(numHalfEdges);
+	next0.assign(vertexOffsets.begin(), vertexOffsets.end() - 1);
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    unsigned int v0 = indices[i];
+	    vertexHalfEdges[next0[v0]] = i;
+	    next0[v0]++;
+	}
+}
+
+void MeshAdjacency::checkHalfEdgeIndex(unsigned int halfEdgeIndex, const
+std::string& source) const
+{
+	if (halfEdgeIndex >= indices.size())
+	{
+	    std::ostringstream status;
+	    status << "Half-edge index out of bounds: " << halfEdgeIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void MeshAdjacency::checkEdgeIndex(unsigned int edgeIndex, const
+std::string& source) const
+{
+	if (edgeIndex >= getNumEdges())
+	{
+	    std::ostringstream status;
+	    status << "Edge index out of bounds: " << edgeIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void MeshAdjacency::checkFaceIndex(unsigned int faceIndex, const
+std::string& source) const
+{
+	if (faceIndex >= getNumFaces())
+	{
+	    std::ostringstream status;
+	    status << "Face index out of bounds: " << faceIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+void MeshAdjacency::checkVertexIndex(unsigned int vertexIndex, const
+std::string& source) const
+{
+	if (vertexIndex >= numVertices)
+	{
+	    std::ostringstream status;
+	    status << "Vertex index out of bounds: " << vertexIndex;
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
+bool MeshAdjacency::addUnique(Ionflux::ObjectBase::UIntVector& target,
+unsigned int offset, unsigned int value)
+{
+	for (unsigned int i = offset; i < target.size(); i++)
+	{
+	    if (target[i] == value)
+	        return false;
+	}
+	target.push_back(value);
+	return true;
+}
+
+void MeshAdjacency::clear()
+{
+	numVertices = 0;
+	indices.clear();
+	faceOffsets.clear();
+	halfEdgeFaces.clear();
+	halfEdgeEdges.clear();
+	twins.clear();
+	edgeOffsets.clear();
+	edgeHalfEdges.clear();
+	vertexOffsets.clear();
+	vertexHalfEdges.clear();
+}
+
+unsigned int MeshAdjacency::update(const Ionflux::GeoUtils::Mesh& mesh,
+unsigned int numThreads)
+{
+	clear();
+	numVertices = mesh.getNumVertices();
+	unsigned int numFaces = mesh.getNumFaces();
+	faceOffsets.reserve(numFaces + 1);
+	faceOffsets.push_back(0);
+	for (unsigned int i = 0; i < numFaces; i++)
+	{
+	    Face* cf = mesh.getFace(i);
+	    if (cf != 0)
+	    {
+	        unsigned int nfv = cf->getNumVertices();
+	        for (unsigned int k = 0; k < nfv; k++)
+	            indices.push_back(cf->getVertex(k));
+	    }
+	    faceOffsets.push_back(indices.size());
+	}
+	build(numThreads);
+	return getNumEdges();
+}
+
+unsigned int MeshAdjacency::update(const Ionflux::GeoUtils::CompactMesh&
+mesh, unsigned int numThreads)
+{
+	clear();
+	numVertices = mesh.getNumVertices();
+	unsigned int numFaces = mesh.getNumFaces();
+	if (numFaces > 0)
+	{
+	    const unsigned int* fo0 = mesh.getFaceOffsetData();
+	    faceOffsets.assign(fo0, fo0 + numFaces + 1);
+	} else
+	    faceOffsets.push_back(0);
+	unsigned int numIndices = mesh.getNumIndices();
+	if (numIndices > 0)
+	{
+	    const unsigned int* iv0 = mesh.getIndexData();
+	    indices.assign(iv0, iv0 + numIndices);
+	}
+	build(numThreads);
+	return getNumEdges();
+}
+
+unsigned int MeshAdjacency::getNumVertices() const
+{
+	// TODO: Implementation.
+	return numVertices;
+}
+
+unsigned int MeshAdjacency::getNumFaces() const
+{
+	if (faceOffsets.size() == 0)
+	    return 0;
+	return faceOffsets.size() - 1;
+}
+
+unsigned int MeshAdjacency::getNumHalfEdges() const
+{
+	// TODO: Implementation.
+	return indices.size();
+}
+
+unsigned int MeshAdjacency::getNumEdges() const
+{
+	if (edgeOffsets.size() == 0)
+	    return 0;
+	return edgeOffsets.size() - 1;
+}
+
+unsigned int MeshAdjacency::getHalfEdgeSource(unsigned int
+halfEdgeIndex) const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getHalfEdgeSource");
+	return indices[halfEdgeIndex];
+}
+
+unsigned int MeshAdjacency::getHalfEdgeTarget(unsigned int
+halfEdgeIndex) const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getHalfEdgeTarget");
+	return indices[nextHalfEdge(halfEdgeIndex)];
+}
+
+unsigned int MeshAdjacency::getNextHalfEdge(unsigned int halfEdgeIndex)
+const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getNextHalfEdge");
+	return nextHalfEdge(halfEdgeIndex);
+}
+
+unsigned int MeshAdjacency::getPrevHalfEdge(unsigned int halfEdgeIndex)
+const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getPrevHalfEdge");
+	unsigned int f0 = halfEdgeFaces[halfEdgeIndex];
+	if (halfEdgeIndex > faceOffsets[f0])
+	    return halfEdgeIndex - 1;
+	return faceOffsets[f0 + 1] - 1;
+}
+
+unsigned int MeshAdjacency::getTwin(unsigned int halfEdgeIndex) const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getTwin");
+	return twins[halfEdgeIndex];
+}
+
+unsigned int MeshAdjacency::getHalfEdgeFace(unsigned int halfEdgeIndex)
+const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getHalfEdgeFace");
+	return halfEdgeFaces[halfEdgeIndex];
+}
+
+unsigned int MeshAdjacency::getHalfEdgeEdge(unsigned int halfEdgeIndex)
+const
+{
+	checkHalfEdgeIndex(halfEdgeIndex, "getHalfEdgeEdge");
+	return halfEdgeEdges[halfEdgeIndex];
+}
+
+unsigned int MeshAdjacency::getFaceHalfEdge(unsigned int faceIndex)
+const
+{
+	checkFaceIndex(faceIndex, "getFaceHalfEdge");
+	return faceOffsets[faceIndex];
+}
+
+unsigned int MeshAdjacency::getEdgeHalfEdge(unsigned int edgeIndex,
+unsigned int index) const
+{
+	checkEdgeIndex(edgeIndex, "getEdgeHalfEdge");
+	unsigned int h0 = edgeOffsets[edgeIndex] + index;
+	if (h0 >= edgeOffsets[edgeIndex + 1])
+	{
+	    std::ostringstream status;
+	    status << "Edge half-edge index out of bounds: " << index;
+	    throw GeoUtilsError(getErrorString(status.str(), "getEdgeHalfEdge"));
+	}
+	return edgeHalfEdges[h0];
+}
+
+unsigned int MeshAdjacency::getEdgeNumFaces(unsigned int edgeIndex)
+const
+{
+	checkEdgeIndex(edgeIndex, "getEdgeNumFaces");
+	return edgeOffsets[edgeIndex + 1] - edgeOffsets[edgeIndex];
+}
+
+bool MeshAdjacency::isBoundaryEdge(unsigned int edgeIndex) const
+{
+	// TODO: Implementation.
+	return getEdgeNumFaces(edgeIndex) == 1;
+}
+
+bool MeshAdjacency::isNonManifoldEdge(unsigned int edgeIndex) const
+{
+	// TODO: Implementation.
+	return getEdgeNumFaces(edgeIndex) > 2;
+}
+
+unsigned int MeshAdjacency::getEdgeFaces(unsigned int edgeIndex,
+Ionflux::ObjectBase::UIntVector& target) const
+{
+	checkEdgeIndex(edgeIndex, "getEdgeFaces");
+	for (unsigned int i = edgeOffsets[edgeIndex];
+	    i < edgeOffsets[edgeIndex + 1]; i++)
+	    target.push_back(halfEdgeFaces[edgeHalfEdges[i]]);
+	return edgeOffsets[edgeIndex + 1] - edgeOffsets[edgeIndex];
+}
+
+unsigned int MeshAdjacency::getFaceNeighbors(unsigned int faceIndex,
+Ionflux::ObjectBase::UIntVector& target) const
+{
+	checkFaceIndex(faceIndex, "getFaceNeighbors");
+	unsigned int n0 = target.size();
+	for (unsigned int i = faceOffsets[faceIndex];
+	    i < faceOffsets[faceIndex + 1]; i++)
+	{
+	    unsigned int e0 = halfEdgeEdges[i];
+	    for (unsigned int k = edgeOffsets[e0]; k < edgeOffsets[e0 + 1]; k++)
+	    {
+	        unsigned int f0 = halfEdgeFaces[edgeHalfEdges[k]];
+	        if (f0 != faceIndex)
+	            addUnique(target, n0, f0);
+	    }
+	}
+	return target.size() - n0;
+}
+
+unsigned int MeshAdjacency::getVertexHalfEdges(unsigned int vertexIndex,
+Ionflux::ObjectBase::UIntVector& target) const
+{
+	checkVertexIndex(vertexIndex, "getVertexHalfEdges");
+	target.insert(target.end(),
+	    vertexHalfEdges.begin() + vertexOffsets[vertexIndex],
+	    vertexHalfEdges.begin() + vertexOffsets[vertexIndex + 1]);
+	return vertexOffsets[vertexIndex + 1] - vertexOffsets[vertexIndex];
+}
+
+unsigned int MeshAdjacency::getVertexFaces(unsigned int vertexIndex,
+Ionflux::ObjectBase::UIntVector& target) const
+{
+	checkVertexIndex(vertexIndex, "getVertexFaces");
+	unsigned int n0 = target.size();
+	for (unsigned int i = vertexOffsets[vertexIndex];
+	    i < vertexOffsets[vertexIndex + 1]; i++)
+	    addUnique(target, n0, halfEdgeFaces[vertexHalfEdges[i]]);
+	return target.size() - n0;
+}
+
+unsigned int MeshAdjacency::getVertexNeighbors(unsigned int vertexIndex,
+Ionflux::ObjectBase::UIntVector& target) const
+{
+	checkVertexIndex(vertexIndex, "getVertexNeighbors");
+	unsigned int n0 = target.size();
+	for (unsigned int i = vertexOffsets[vertexIndex];
+	    i < vertexOffsets[vertexIndex + 1]; i++)
+	{
+	    unsigned int h0 = vertexHalfEdges[i];
+	    unsigned int v0 = indices[nextHalfEdge(h0)];
+	    if (v0 != vertexIndex)
+	        addUnique(target, n0, v0);
+	    v0 = indices[getPrevHalfEdge(h0)];
+	    if (v0 != vertexIndex)
+	        addUnique(target, n0, v0);
+	}
+	return target.size() - n0;
+}
+
+unsigned int
+MeshAdjacency::getBoundaryEdges(Ionflux::ObjectBase::UIntVector& target)
+const
+{
+	unsigned int n0 = target.size();
+	unsigned int numEdges = getNumEdges();
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    if ((edgeOffsets[i + 1] - edgeOffsets[i]) == 1)
+	        target.push_back(i);
+	}
+	return target.size() - n0;
+}
+
+unsigned int
+MeshAdjacency::getNonManifoldEdges(Ionflux::ObjectBase::UIntVector&
+target) const
+{
+	unsigned int n0 = target.size();
+	unsigned int numEdges = getNumEdges();
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    if ((edgeOffsets[i + 1] - edgeOffsets[i]) > 2)
+	        target.push_back(i);
+	}
+	return target.size() - n0;
+}
+
+unsigned int
+MeshAdjacency::getBoundaryLoops(Ionflux::ObjectBase::UIntVector& target,
+Ionflux::ObjectBase::UIntVector& offsets) const
+{
+	unsigned int numHalfEdges = indices.size();
+	std::vector<bool> visited(numHalfEdges, false);
+	unsigned int numLoops = 0;
+	for (unsigned int i = 0; i < numHalfEdges; i++)
+	{
+	    if (visited[i]
+	        || !isBoundaryEdge(halfEdgeEdges[i]))
+	        continue;
+	    offsets.push_back(target.size());
+	    unsigned int h0 = i;
+	    while (h0 != HALF_EDGE_NONE)
+	    {
+	        visited[h0] = true;
+	        target.push_back(indices[h0]);
+	        // find the next boundary half-edge
+	        unsigned int v0 = indices[nextHalfEdge(h0)];
+	        h0 = HALF_EDGE_NONE;
+	        for (unsigned int k = vertexOffsets[v0];
+	            (k < vertexOffsets[v0 + 1]) && (h0 == HALF_EDGE_NONE); k++)
+	        {
+	            unsigned int h1 = vertexHalfEdges[k];
+	            if (!visited[h1]
+	                && isBoundaryEdge(halfEdgeEdges[h1]))
+	                h0 = h1;
+	        }
+	    }
+	    numLoops++;
+	}
+	return numLoops;
+}
+
+bool MeshAdjacency::isClosed() const
+{
+	unsigned int numEdges = getNumEdges();
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    if ((edgeOffsets[i + 1] - edgeOffsets[i]) == 1)
+	        return false;
+	}
+	return true;
+}
+
+bool MeshAdjacency::isManifold() const
+{
+	unsigned int numEdges = getNumEdges();
+	for (unsigned int i = 0; i < numEdges; i++)
+	{
+	    if ((edgeOffsets[i + 1] - edgeOffsets[i]) > 2)
+	        return false;
+	}
+	return true;
+}
+
+std::string MeshAdjacency::getValueString() const
+{
+	ostringstream status;
+	status << "numVertices = " << numVertices << ", numFaces = "
+	    << getNumFaces() << ", numHalfEdges = " << getNumHalfEdges()
+	    << ", numEdges = " << getNumEdges();
+	return status.str();
+}
+
+Ionflux::GeoUtils::MeshAdjacency& MeshAdjacency::operator=(const 
+Ionflux::GeoUtils::MeshAdjacency& other)
+{
+    if (this == &other)
+        return *this;
+    numVertices = other.numVertices;
+    indices = other.indices;
+    faceOffsets = other.faceOffsets;
+    halfEdgeFaces = other.halfEdgeFaces;
+    halfEdgeEdges = other.halfEdgeEdges;
+    twins = other.twins;
+    edgeOffsets = other.edgeOffsets;
+    edgeHalfEdges = other.edgeHalfEdges;
+    vertexOffsets = other.vertexOffsets;
+    vertexHalfEdges = other.vertexHalfEdges;
+	return *this;
+}
+
+Ionflux::GeoUtils::MeshAdjacency* MeshAdjacency::copy() const
+{
+    MeshAdjacency* newMeshAdjacency = create();
+    *newMeshAdjacency = *this;
+    return newMeshAdjacency;
+}
+
+Ionflux::GeoUtils::MeshAdjacency* 
+MeshAdjacency::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<MeshAdjacency*>(other);
+}
+
+Ionflux::GeoUtils::MeshAdjacency* 
+MeshAdjacency::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    MeshAdjacency* newObject = new MeshAdjacency();
+    if (newObject == 0)
+    {
+        throw GeoUtilsError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int MeshAdjacency::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+/** \file MeshAdjacency.cpp
+ * \brief Mesh adjacency implementation.
+ */
@@ -173,6 +173,28 @@ void NFace::update()
 	updateRadiusAndCenter();
 }
 
+void NFace::updateBounds()
+{
+	if ((vertexSource == 0) 
+	    || (vertices.size() == 0))
+	{
+	    BoxBoundsItem::updateBounds();
+	    return;
+	}
+	clearPolygon();
+	recalculateBounds();
+	updateRadiusAndCenter();
+}
+
+void NFace::updateFromBounds(const Ionflux::GeoUtils::Range3& newBounds)
+{
+	clearPolygon();
+	TransformableObject::recalculateBounds();
+	*boundsCache = newBounds;
+	bounds = newBounds;
+	updateRadiusAndCenter();
+}
+
 void NFace::clearPolygon()
 {
 	if (polygon != 0)
@@ -646,6 +668,17 @@ void NFace::applyVertexIndexOffset(int offset)
 	}
 }
 
+void NFace::applyVertexIndexMap(const Ionflux::ObjectBase::UIntVector&
+indexMap)
+{
+	for (unsigned int i = 0; i < vertices.size(); i++)
+	{
+	    unsigned int cv = vertices[i];
+	    if (cv < indexMap.size())
+	        vertices[i] = indexMap[cv];
+	}
+}
+
 void NFace::getTris(Ionflux::GeoUtils::NFaceVector& target)
 {
 	Ionflux::ObjectBase::nullPointerCheck(vertexSource, this, 
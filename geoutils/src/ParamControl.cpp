@@ -91,14 +91,20 @@ ParamControl::~ParamControl()
 
 void ParamControl::call(Ionflux::Mapping::MappingValue value) const
 {
-	if (func == 0)
-	    throw GeoUtilsError("Mapping not set.");
+	Ionflux::Mapping::MappingValue v0 = getValue(value);
 	if (node == 0)
 	    throw GeoUtilsError("Node not set.");
-	Ionflux::Mapping::MappingValue v0 = (*func)(value);
 	node->setParam(paramID, v0);
 }
 
+Ionflux::Mapping::MappingValue
+ParamControl::getValue(Ionflux::Mapping::MappingValue value) const
+{
+	if (func == 0)
+	    throw GeoUtilsError("Mapping not set.");
+	return (*func)(value);
+}
+
 void ParamControl::operator()(Ionflux::Mapping::MappingValue value) const
 {
 	call(value);
@@ -177,6 +183,7 @@ Ionflux::GeoUtils::TransformNodes::ParamControl& other)
     node = other.node;
     setFunc(other.func);
     paramID = other.paramID;
+    coord = other.coord;
 	return *this;
 }
 
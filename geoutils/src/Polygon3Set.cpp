@@ -36,6 +36,7 @@
 #include "geoutils/GeoUtilsError.hpp"
 #include "geoutils/Polygon3.hpp"
 #include "geoutils/transformutils.hpp"
+#include "geoutils/utils.hpp"
 #include "ifobject/utils.hpp"
 #include "ifobject/xmlutils.hpp"
 #include "ifobject/xmlutils_private.hpp"
@@ -146,8 +147,52 @@ Ionflux::GeoUtils::Vector3 Polygon3Set::getBarycenter()
 
 void Polygon3Set::applyTransform(bool recursive)
 {
-	Ionflux::GeoUtils::applyTransform(*this, polys, 
-	    recursive, "Polygon");
+	if (!recursive 
+	    || (!useTransform() && !useVI()))
+	{
+	    Ionflux::GeoUtils::applyTransform(*this, polys, recursive, 
+	        "Polygon");
+	    return;
+	}
+	/* Polygons that have no transformations of their own, and whose 
+	   vertex sources have none either, are transformed in a single batch. 
+	   The result is the same as applying the transformations to each 
+	   polygon in turn. */
+	Matrix4* tm0 = 0;
+	Matrix4* vm0 = 0;
+	Matrix4* im0 = 0;
+	if (useTransform())
+	    tm0 = getTransformMatrix();
+	if (useVI())
+	{
+	    vm0 = getViewMatrix();
+	    im0 = getImageMatrix();
+	}
+	Vertex3Vector bv0;
+	for (Polygon3Vector::iterator i = polys.begin(); i != polys.end(); i++)
+	{
+	    Polygon3* p0 = Ionflux::ObjectBase::nullPointerCheck(*i, this, 
+	        "applyTransform", "Polygon");
+	    Vertex3Set* vs0 = p0->getVertexSource();
+	    if ((vs0 != 0) 
+	        && !p0->useTransform() && !p0->useVI() 
+	        && !vs0->useTransform() && !vs0->useVI())
+	    {
+	        p0->copyVertices();
+	        Vertex3Vector& pv0 = p0->getVertices();
+	        bv0.insert(bv0.end(), pv0.begin(), pv0.end());
+	    } else
+	    {
+	        if (tm0 != 0)
+	            p0->transform(*tm0);
+	        if (vm0 != 0)
+	            p0->transformVI(*vm0, im0);
+	    }
+	}
+	Ionflux::GeoUtils::transformVertices(bv0, tm0, vm0, im0);
+	for (Polygon3Vector::iterator i = polys.begin(); i != polys.end(); i++)
+	    (*i)->applyTransform(recursive);
+	clearTransformations();
 }
 
 std::string Polygon3Set::getSVG(const std::string& attrs, const 
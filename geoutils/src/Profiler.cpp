@@ -0,0 +1,536 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * Profiler.cpp                    Transform node profiler (implementation).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/Profiler.hpp"
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/TransformableGroup.hpp"
+#include "geoutils/TransformNode.hpp"
+
+using namespace std;
+using namespace Ionflux::ObjectBase;
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+namespace TransformNodes
+{
+
+ProfilerClassInfo::ProfilerClassInfo()
+{
+	name = "Profiler";
+	desc = "Transform node profiler";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+ProfilerClassInfo::~ProfilerClassInfo()
+{
+}
+
+// run-time type information instance constants
+const ProfilerClassInfo Profiler::profilerClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* Profiler::CLASS_INFO = &Profiler::profilerClassInfo;
+
+Profiler::Profiler()
+: startTime(0.)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	pthread_mutex_init(&mutex, 0);
+	startTime = timer.getCurrentTime();
+}
+
+Profiler::Profiler(const Ionflux::GeoUtils::TransformNodes::Profiler& other)
+: startTime(0.)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	pthread_mutex_init(&mutex, 0);
+	*this = other;
+}
+
+Profiler::~Profiler()
+{
+	pthread_mutex_destroy(&mutex);
+}
+
+double Profiler::getTime()
+{
+	// TODO: Implementation.
+	return timer.getCurrentTime() - startTime;
+}
+
+unsigned int Profiler::getThreadIndex()
+{
+	pthread_t t0 = pthread_self();
+	for (unsigned int i = 0; i < threads.size(); i++)
+	{
+	    if (pthread_equal(threads[i].thread, t0))
+	        return i;
+	}
+	TransformProfilerThread r0;
+	r0.thread = t0;
+	threads.push_back(r0);
+	return threads.size() - 1;
+}
+
+int Profiler::findOpenEvent(const
+Ionflux::GeoUtils::TransformProfilerThread& thread,
+Ionflux::GeoUtils::TransformNodes::TransformNode* node)
+{
+	std::map<TransformNode*, unsigned int>::const_iterator i =
+	    profileMap.find(node);
+	if (i == profileMap.end())
+	    return -1;
+	for (int k = thread.stack.size() - 1; k >= 0; k--)
+	{
+	    if (events[thread.stack[k]].profileIndex == (*i).second)
+	        return k;
+	}
+	return -1;
+}
+
+Ionflux::ObjectBase::UInt64
+Profiler::getGroupMemSize(Ionflux::GeoUtils::TransformableGroup* group)
+{
+	if (group == 0)
+	    return 0;
+	Ionflux::ObjectBase::UInt64 result = group->getMemSize();
+	for (unsigned int i = 0; i < group->getNumItems(); i++)
+	{
+	    TransformableObject* o0 = group->getItem(i);
+	    if (o0 == 0)
+	        continue;
+	    TransformableGroup* g0 = TransformableGroup::upcast(o0);
+	    if (g0 != 0)
+	        result += getGroupMemSize(g0);
+	    else
+	        result += o0->getMemSize();
+	}
+	return result;
+}
+
+std::string Profiler::getJSONString(const std::string& source)
+{
+	ostringstream status;
+	status << "\"";
+	for (unsigned int i = 0; i < source.size(); i++)
+	{
+	    char c = source[i];
+	    if ((c == '"') || (c == '\\'))
+	        status << '\\' << c;
+	    else
+	    if (static_cast<unsigned char>(c) < 0x20)
+	        status << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+	            << static_cast<int>(c) << std::dec << std::setfill(' ');
+	    else
+	        status << c;
+	}
+	status << "\"";
+	return status.str();
+}
+
+void Profiler::clear()
+{
+	pthread_mutex_lock(&mutex);
+	profiles.clear();
+	profileMap.clear();
+	events.clear();
+	threads.clear();
+	startTime = timer.getCurrentTime();
+	pthread_mutex_unlock(&mutex);
+}
+
+void Profiler::begin(Ionflux::GeoUtils::TransformNodes::TransformNode*
+node)
+{
+	if (node == 0)
+	    throw GeoUtilsError("[Profiler::begin] Node not set.");
+	double t0 = getTime();
+	pthread_mutex_lock(&mutex);
+	unsigned int k = 0;
+	std::map<TransformNode*, unsigned int>::iterator i =
+	    profileMap.find(node);
+	if (i == profileMap.end())
+	{
+	    TransformNodeProfile p0;
+	    p0.node = node;
+	    p0.label = node->getString();
+	    p0.numCalls = 0;
+	    p0.inclusiveTime = 0.;
+	    p0.exclusiveTime = 0.;
+	    p0.numInputItems = 0;
+	    p0.numOutputItems = 0;
+	    p0.outputObjectBytes = 0;
+	    k = profiles.size();
+	    profiles.push_back(p0);
+	    profileMap[node] = k;
+	} else
+	    k = (*i).second;
+	unsigned int ti = getThreadIndex();
+	TransformProfilerThread& r0 = threads[ti];
+	TransformProfilerEvent e0;
+	e0.profileIndex = k;
+	e0.threadIndex = ti;
+	e0.depth = r0.stack.size();
+	e0.startTime = t0;
+	e0.duration = -1.;
+	e0.childTime = 0.;
+	r0.stack.push_back(events.size());
+	events.push_back(e0);
+	pthread_mutex_unlock(&mutex);
+}
+
+void Profiler::end(Ionflux::GeoUtils::TransformNodes::TransformNode*
+node, Ionflux::ObjectBase::UInt64 numInputItems)
+{
+	if (node == 0)
+	    throw GeoUtilsError("[Profiler::end] Node not set.");
+	// Take the time first so the output size walk is not included.
+	double t0 = getTime();
+	Ionflux::ObjectBase::UInt64 no0 = 0;
+	Ionflux::ObjectBase::UInt64 nb0 = 0;
+	for (unsigned int i = 0; i < node->getNumOutputs(); i++)
+	{
+	    TransformableGroup* g0 = node->getOutput(i);
+	    if (g0 == 0)
+	        continue;
+	    no0 += g0->getNumItems();
+	    nb0 += getGroupMemSize(g0);
+	}
+	pthread_mutex_lock(&mutex);
+	TransformProfilerThread& r0 = threads[getThreadIndex()];
+	int k = findOpenEvent(r0, node);
+	if (k < 0)
+	{
+	    pthread_mutex_unlock(&mutex);
+	    std::ostringstream status;
+	    status << "[Profiler::end] No open event for node: "
+	        << node->getString();
+	    throw GeoUtilsError(status.str());
+	}
+	unsigned int ei = r0.stack[k];
+	while (static_cast<int>(r0.stack.size()) > k)
+	{
+	    TransformProfilerEvent& e1 = events[r0.stack.back()];
+	    e1.duration = t0 - e1.startTime;
+	    r0.stack.pop_back();
+	}
+	TransformProfilerEvent& e0 = events[ei];
+	TransformNodeProfile& p0 = profiles[e0.profileIndex];
+	p0.numCalls++;
+	p0.inclusiveTime += e0.duration;
+	p0.exclusiveTime += (e0.duration - e0.childTime);
+	p0.numInputItems += numInputItems;
+	p0.numOutputItems += no0;
+	p0.outputObjectBytes += nb0;
+	if (r0.stack.size() > 0)
+	    events[r0.stack.back()].childTime += e0.duration;
+	pthread_mutex_unlock(&mutex);
+}
+
+void Profiler::cancel(Ionflux::GeoUtils::TransformNodes::TransformNode*
+node)
+{
+	double t0 = getTime();
+	pthread_mutex_lock(&mutex);
+	TransformProfilerThread& r0 = threads[getThreadIndex()];
+	int k = findOpenEvent(r0, node);
+	if (k >= 0)
+	{
+	    while (static_cast<int>(r0.stack.size()) > k)
+	    {
+	        TransformProfilerEvent& e0 = events[r0.stack.back()];
+	        e0.duration = t0 - e0.startTime;
+	        r0.stack.pop_back();
+	    }
+	}
+	pthread_mutex_unlock(&mutex);
+}
+
+void
+Profiler::removeNode(Ionflux::GeoUtils::TransformNodes::TransformNode*
+node)
+{
+	pthread_mutex_lock(&mutex);
+	std::map<TransformNode*, unsigned int>::iterator i =
+	    profileMap.find(node);
+	if (i != profileMap.end())
+	{
+	    profiles[(*i).second].node = 0;
+	    profileMap.erase(i);
+	}
+	pthread_mutex_unlock(&mutex);
+}
+
+unsigned int Profiler::getNumProfiles() const
+{
+	// TODO: Implementation.
+	return profiles.size();
+}
+
+Ionflux::GeoUtils::TransformNodeProfile Profiler::getProfile(unsigned
+int index) const
+{
+	if (index >= profiles.size())
+	{
+	    std::ostringstream status;
+	    status << "[Profiler::getProfile] Index out of range: " << index;
+	    throw GeoUtilsError(status.str());
+	}
+	return profiles[index];
+}
+
+int
+Profiler::findProfile(Ionflux::GeoUtils::TransformNodes::TransformNode*
+node) const
+{
+	std::map<TransformNode*, unsigned int>::const_iterator i =
+	    profileMap.find(node);
+	if (i == profileMap.end())
+	    return -1;
+	return (*i).second;
+}
+
+unsigned int Profiler::getNumEvents() const
+{
+	// TODO: Implementation.
+	return events.size();
+}
+
+Ionflux::GeoUtils::TransformProfilerEvent Profiler::getEvent(unsigned
+int index) const
+{
+	if (index >= events.size())
+	{
+	    std::ostringstream status;
+	    status << "[Profiler::getEvent] Index out of range: " << index;
+	    throw GeoUtilsError(status.str());
+	}
+	return events[index];
+}
+
+unsigned int Profiler::getNumThreads() const
+{
+	// TODO: Implementation.
+	return threads.size();
+}
+
+std::string Profiler::getSummary(unsigned int maxProfiles) const
+{
+	std::vector<std::pair<double, unsigned int> > v0;
+	for (unsigned int i = 0; i < profiles.size(); i++)
+	    v0.push_back(std::make_pair(-profiles[i].exclusiveTime, i));
+	std::sort(v0.begin(), v0.end());
+	unsigned int n = v0.size();
+	if ((maxProfiles > 0) 
+	    && (maxProfiles < n))
+	    n = maxProfiles;
+	ostringstream status;
+	status << std::setw(6) << "index" << std::setw(12) << "exclusive" 
+	    << std::setw(12) << "inclusive" << std::setw(8) << "calls" 
+	    << std::setw(10) << "inputs" << std::setw(10) << "outputs" 
+	    << std::setw(12) << "objbytes" << "  node" << std::endl;
+	status << std::fixed << std::setprecision(6);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    const TransformNodeProfile& p0 = profiles[v0[i].second];
+	    status << std::setw(6) << v0[i].second 
+	        << std::setw(12) << p0.exclusiveTime 
+	        << std::setw(12) << p0.inclusiveTime 
+	        << std::setw(8) << p0.numCalls 
+	        << std::setw(10) << p0.numInputItems 
+	        << std::setw(10) << p0.numOutputItems 
+	        << std::setw(12) << p0.outputObjectBytes 
+	        << "  " << p0.label << std::endl;
+	}
+	return status.str();
+}
+
+std::string Profiler::getJSON() const
+{
+	ostringstream status;
+	status << std::setprecision(9);
+	status << "{" << std::endl
+	    << "    \"numThreads\": " << threads.size() << "," << std::endl
+	    << "    \"numEvents\": " << events.size() << "," << std::endl
+	    << "    \"nodes\": [";
+	for (unsigned int i = 0; i < profiles.size(); i++)
+	{
+	    const TransformNodeProfile& p0 = profiles[i];
+	    if (i > 0)
+	        status << ",";
+	    status << std::endl << "        {" << std::endl
+	        << "            \"index\": " << i << "," << std::endl
+	        << "            \"label\": " << getJSONString(p0.label) << "," 
+	            << std::endl
+	        << "            \"numCalls\": " << p0.numCalls << "," << std::endl
+	        << "            \"inclusiveTime\": " << p0.inclusiveTime << "," 
+	            << std::endl
+	        << "            \"exclusiveTime\": " << p0.exclusiveTime << "," 
+	            << std::endl
+	        << "            \"numInputItems\": " << p0.numInputItems << "," 
+	            << std::endl
+	        << "            \"numOutputItems\": " << p0.numOutputItems << "," 
+	            << std::endl
+	        << "            \"outputObjectBytes\": " 
+	        << p0.outputObjectBytes << std::endl
+	        << "        }";
+	}
+	status << std::endl << "    ]" << std::endl << "}" << std::endl;
+	return status.str();
+}
+
+void Profiler::writeJSON(const std::string& fileName) const
+{
+	std::ofstream f0;
+	f0.open(fileName.c_str(), std::ios_base::out);
+	if (!f0)
+	{
+	    std::ostringstream status;
+	    status << "[Profiler::writeJSON] Could not open file: " << fileName;
+	    throw GeoUtilsError(status.str());
+	}
+	f0 << getJSON();
+}
+
+std::string Profiler::getTrace() const
+{
+	ostringstream status;
+	status << std::fixed << std::setprecision(3);
+	status << "{" << std::endl << "    \"traceEvents\": [";
+	bool first = true;
+	for (unsigned int i = 0; i < threads.size(); i++)
+	{
+	    if (!first)
+	        status << ",";
+	    first = false;
+	    status << std::endl << "        {\"name\": \"thread_name\", "
+	        "\"ph\": \"M\", \"pid\": 0, \"tid\": " << i 
+	        << ", \"args\": {\"name\": \"thread " << i << "\"}}";
+	}
+	for (unsigned int i = 0; i < events.size(); i++)
+	{
+	    const TransformProfilerEvent& e0 = events[i];
+	    if (e0.duration < 0.)
+	        continue;
+	    if (!first)
+	        status << ",";
+	    first = false;
+	    status << std::endl << "        {\"name\": " 
+	        << getJSONString(profiles[e0.profileIndex].label) 
+	        << ", \"cat\": \"TransformNode\", \"ph\": \"X\", \"ts\": " 
+	        << (1e6 * e0.startTime) << ", \"dur\": " << (1e6 * e0.duration) 
+	        << ", \"pid\": 0, \"tid\": " << e0.threadIndex 
+	        << ", \"args\": {\"profile\": " << e0.profileIndex 
+	        << ", \"depth\": " << e0.depth << "}}";
+	}
+	status << std::endl << "    ]," << std::endl 
+	    << "    \"displayTimeUnit\": \"ms\"" << std::endl << "}" << std::endl;
+	return status.str();
+}
+
+void Profiler::writeTrace(const std::string& fileName) const
+{
+	std::ofstream f0;
+	f0.open(fileName.c_str(), std::ios_base::out);
+	if (!f0)
+	{
+	    std::ostringstream status;
+	    status << "[Profiler::writeTrace] Could not open file: " << fileName;
+	    throw GeoUtilsError(status.str());
+	}
+	f0 << getTrace();
+}
+
+std::string Profiler::getValueString() const
+{
+	ostringstream status;
+	status << "numProfiles = " << profiles.size() << ", numEvents = " 
+	    << events.size() << ", numThreads = " << threads.size();
+	return status.str();
+}
+
+Ionflux::GeoUtils::TransformNodes::Profiler& Profiler::operator=(const 
+Ionflux::GeoUtils::TransformNodes::Profiler& other)
+{
+    if (this == &other)
+        return *this;
+    startTime = other.startTime;
+    profiles = other.profiles;
+    profileMap = other.profileMap;
+    events = other.events;
+    threads = other.threads;
+	return *this;
+}
+
+Ionflux::GeoUtils::TransformNodes::Profiler* Profiler::copy() const
+{
+    Profiler* newProfiler = create();
+    *newProfiler = *this;
+    return newProfiler;
+}
+
+Ionflux::GeoUtils::TransformNodes::Profiler* 
+Profiler::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<Profiler*>(other);
+}
+
+Ionflux::GeoUtils::TransformNodes::Profiler* 
+Profiler::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    Profiler* newObject = new Profiler();
+    if (newObject == 0)
+    {
+        throw GeoUtilsError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int Profiler::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+}
+
+/** \file Profiler.cpp
+ * \brief Transform node profiler implementation.
+ */
@@ -71,7 +71,7 @@ const RenderClassInfo Render::renderClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* Render::CLASS_INFO = &Render::renderClassInfo;
 
 Render::Render()
-: image(0), axis(Ionflux::GeoUtils::AXIS_Z), closePath(true), originX(0), originY(0), backgroundColor(Ionflux::Altjira::Color::TRANSPARENT)
+: image(0), axis(Ionflux::GeoUtils::AXIS_Z), closePath(true), originX(0), originY(0), backgroundColor(Ionflux::Altjira::Color::TRANSPARENT), backend(Ionflux::GeoUtils::RENDER_BACKEND_CAIRO), numThreads(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -79,7 +79,7 @@ Render::Render()
 }
 
 Render::Render(const Ionflux::GeoUtils::TransformNodes::Render& other)
-: image(0), axis(Ionflux::GeoUtils::AXIS_Z), closePath(true), originX(0), originY(0), backgroundColor(Ionflux::Altjira::Color::TRANSPARENT)
+: image(0), axis(Ionflux::GeoUtils::AXIS_Z), closePath(true), originX(0), originY(0), backgroundColor(Ionflux::Altjira::Color::TRANSPARENT), backend(Ionflux::GeoUtils::RENDER_BACKEND_CAIRO), numThreads(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -94,7 +94,8 @@ initOriginY, const Ionflux::Altjira::Color& initBackgroundColor, const
 Ionflux::ObjectBase::IFObjectID& nodeID)
 : TransformNode(nodeID), image(0), axis(initAxis), 
 closePath(initClosePath), originX(initOriginX), originY(initOriginY), 
-backgroundColor(initBackgroundColor)
+backgroundColor(initBackgroundColor), 
+backend(Ionflux::GeoUtils::RENDER_BACKEND_CAIRO), numThreads(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -129,8 +130,13 @@ void Render::process()
 	    image->fill(backgroundColor);
 	// Process polygons.
 	Ionflux::GeoUtils::Polygon3Set ps0;
+	/* The scanline backend writes to the image pixels directly, so it 
+	   cannot be used if a drawing operation is already in progress. */
+	bool scanline = (backend == RENDER_BACKEND_SCANLINE) 
+	    && !image->drawingInProgress();
 	bool ownDrawing = false;
-	if (!image->drawingInProgress())
+	if (!scanline 
+	    && !image->drawingInProgress())
 	{
 	    ownDrawing = true;
 	    image->begin();
@@ -147,16 +153,33 @@ void Render::process()
 	        // Check for SVG.
 	        SVG* svg0 = SVG::upcast(it0);
 	        if (svg0 != 0)
+	        {
+	            if (!image->drawingInProgress())
+	            {
+	                ownDrawing = true;
+	                image->begin();
+	            }
 	            /* Render the SVG.
 	               NOTE: Polygons are always rendered over SVG elements. 
 	                     Find a solution that keeps the correct order. */
 	            image->drawSVG(*svg0);
+	        }
 	    }
 	}
-	// Render polygons to image.
-	image->drawPolygons(ps0, &styles, axis, closePath, originX, originY);
-	if (ownDrawing)
-	    image->finish();
+	if (scanline)
+	{
+	    // SVG elements have to be composited before the polygons.
+	    if (ownDrawing)
+	        image->finish();
+	    image->rasterizePolygons(ps0, &styles, axis, originX, originY, 
+	        numThreads);
+	} else
+	{
+	    // Render polygons to image.
+	    image->drawPolygons(ps0, &styles, axis, closePath, originX, originY);
+	    if (ownDrawing)
+	        image->finish();
+	}
 	addOutput(g0);
 }
 
@@ -172,6 +195,12 @@ std::string Render::getString() const
 	return status.str();
 }
 
+bool Render::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
 void Render::addStyles(const Ionflux::GeoUtils::SVGShapeStyleVector& 
 newStyles)
 {
@@ -183,12 +212,13 @@ newStyles)
 void Render::setImage(Ionflux::GeoUtils::Image* newImage)
 {
 	if (image == newImage)
-		return;
-    if (newImage != 0)
-        addLocalRef(newImage);
+	    return;
+	if (newImage != 0)
+	    addLocalRef(newImage);
 	if (image != 0)
-		removeLocalRef(image);
+	    removeLocalRef(image);
 	image = newImage;
+	touch();
 }
 
 Ionflux::GeoUtils::Image* Render::getImage() const
@@ -241,6 +271,7 @@ std::vector<Ionflux::GeoUtils::SVGShapeStyle*>& Render::getStyles()
 void Render::addStyle(Ionflux::GeoUtils::SVGShapeStyle* addElement)
 {
 	styles.push_back(addElement);
+	touch();
 }
 
 void Render::removeStyle(Ionflux::GeoUtils::SVGShapeStyle* removeElement)
@@ -260,6 +291,7 @@ void Render::removeStyle(Ionflux::GeoUtils::SVGShapeStyle* removeElement)
 	if (found)
 	{
 		styles.erase(styles.begin() + i);
+		touch();
 	}
 }
 
@@ -268,16 +300,19 @@ void Render::removeStyleIndex(unsigned int removeIndex)
     if (removeIndex > styles.size())
         return;
     styles.erase(styles.begin() + removeIndex);
+	touch();
 }
 
 void Render::clearStyles()
 {
     styles.clear();
+	touch();
 }
 
 void Render::setAxis(Ionflux::GeoUtils::AxisID newAxis)
 {
 	axis = newAxis;
+	touch();
 }
 
 Ionflux::GeoUtils::AxisID Render::getAxis() const
@@ -288,6 +323,7 @@ Ionflux::GeoUtils::AxisID Render::getAxis() const
 void Render::setClosePath(bool newClosePath)
 {
 	closePath = newClosePath;
+	touch();
 }
 
 bool Render::getClosePath() const
@@ -298,6 +334,7 @@ bool Render::getClosePath() const
 void Render::setOriginX(unsigned int newOriginX)
 {
 	originX = newOriginX;
+	touch();
 }
 
 unsigned int Render::getOriginX() const
@@ -308,6 +345,7 @@ unsigned int Render::getOriginX() const
 void Render::setOriginY(unsigned int newOriginY)
 {
 	originY = newOriginY;
+	touch();
 }
 
 unsigned int Render::getOriginY() const
@@ -319,6 +357,7 @@ void Render::setBackgroundColor(const Ionflux::Altjira::Color&
 newBackgroundColor)
 {
 	backgroundColor = newBackgroundColor;
+	touch();
 }
 
 Ionflux::Altjira::Color Render::getBackgroundColor() const
@@ -326,6 +365,27 @@ Ionflux::Altjira::Color Render::getBackgroundColor() const
     return backgroundColor;
 }
 
+void Render::setBackend(Ionflux::GeoUtils::RenderBackendID newBackend)
+{
+	backend = newBackend;
+	touch();
+}
+
+Ionflux::GeoUtils::RenderBackendID Render::getBackend() const
+{
+    return backend;
+}
+
+void Render::setNumThreads(unsigned int newNumThreads)
+{
+	numThreads = newNumThreads;
+}
+
+unsigned int Render::getNumThreads() const
+{
+    return numThreads;
+}
+
 Ionflux::GeoUtils::TransformNodes::Render& Render::operator=(const 
 Ionflux::GeoUtils::TransformNodes::Render& other)
 {
@@ -336,6 +396,8 @@ Ionflux::GeoUtils::TransformNodes::Render& other)
     closePath = other.closePath;
     originX = other.originX;
     originY = other.originY;
+    backend = other.backend;
+    numThreads = other.numThreads;
 	return *this;
 }
 
@@ -187,9 +187,16 @@ std::string Rotate::getString() const
 	return status.str();
 }
 
+bool Rotate::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return (indexFunc == 0) && (distanceFunc == 0);
+}
+
 void Rotate::setAxis(Ionflux::GeoUtils::AxisID newAxis)
 {
 	axis = newAxis;
+	touch();
 }
 
 Ionflux::GeoUtils::AxisID Rotate::getAxis() const
@@ -200,6 +207,7 @@ Ionflux::GeoUtils::AxisID Rotate::getAxis() const
 void Rotate::setAngle(Ionflux::Mapping::MappingValue newAngle)
 {
 	angle = newAngle;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Rotate::getAngle() const
@@ -210,6 +218,7 @@ Ionflux::Mapping::MappingValue Rotate::getAngle() const
 void Rotate::setDeltaAngle(Ionflux::Mapping::MappingValue newDeltaAngle)
 {
 	deltaAngle = newDeltaAngle;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Rotate::getDeltaAngle() const
@@ -220,12 +229,13 @@ Ionflux::Mapping::MappingValue Rotate::getDeltaAngle() const
 void Rotate::setIndexFunc(Ionflux::Mapping::Mapping* newIndexFunc)
 {
 	if (indexFunc == newIndexFunc)
-		return;
-    if (newIndexFunc != 0)
-        addLocalRef(newIndexFunc);
+	    return;
+	if (newIndexFunc != 0)
+	    addLocalRef(newIndexFunc);
 	if (indexFunc != 0)
-		removeLocalRef(indexFunc);
+	    removeLocalRef(indexFunc);
 	indexFunc = newIndexFunc;
+	touch();
 }
 
 Ionflux::Mapping::Mapping* Rotate::getIndexFunc() const
@@ -236,12 +246,13 @@ Ionflux::Mapping::Mapping* Rotate::getIndexFunc() const
 void Rotate::setDistanceFunc(Ionflux::Mapping::Mapping* newDistanceFunc)
 {
 	if (distanceFunc == newDistanceFunc)
-		return;
-    if (newDistanceFunc != 0)
-        addLocalRef(newDistanceFunc);
+	    return;
+	if (newDistanceFunc != 0)
+	    addLocalRef(newDistanceFunc);
 	if (distanceFunc != 0)
-		removeLocalRef(distanceFunc);
+	    removeLocalRef(distanceFunc);
 	distanceFunc = newDistanceFunc;
+	touch();
 }
 
 Ionflux::Mapping::Mapping* Rotate::getDistanceFunc() const
@@ -252,6 +263,7 @@ Ionflux::Mapping::Mapping* Rotate::getDistanceFunc() const
 void Rotate::setIndexRange(const Ionflux::GeoUtils::Range& newIndexRange)
 {
 	indexRange = newIndexRange;
+	touch();
 }
 
 Ionflux::GeoUtils::Range Rotate::getIndexRange() const
@@ -263,6 +275,7 @@ void Rotate::setDistanceRange(const Ionflux::GeoUtils::Range&
 newDistanceRange)
 {
 	distanceRange = newDistanceRange;
+	touch();
 }
 
 Ionflux::GeoUtils::Range Rotate::getDistanceRange() const
@@ -274,6 +287,7 @@ void Rotate::setCenteringMethod(Ionflux::GeoUtils::CenteringMethod
 newCenteringMethod)
 {
 	centeringMethod = newCenteringMethod;
+	touch();
 }
 
 Ionflux::GeoUtils::CenteringMethod Rotate::getCenteringMethod() const
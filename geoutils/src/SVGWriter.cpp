@@ -0,0 +1,428 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * SVGWriter.cpp                   SVG writer (implementation).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/SVGWriter.hpp"
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <fstream>
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/utils.hpp"
+#include "geoutils/meshio.hpp"
+#include "geoutils/Vertex3.hpp"
+#include "geoutils/Polygon3.hpp"
+#include "geoutils/Polygon3Set.hpp"
+
+using namespace std;
+using namespace Ionflux::ObjectBase;
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+SVGWriterClassInfo::SVGWriterClassInfo()
+{
+	name = "SVGWriter";
+	desc = "SVG writer";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+SVGWriterClassInfo::~SVGWriterClassInfo()
+{
+}
+
+// run-time type information instance constants
+const SVGWriterClassInfo SVGWriter::sVGWriterClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* SVGWriter::CLASS_INFO = &SVGWriter::sVGWriterClassInfo;
+
+SVGWriter::SVGWriter()
+: numPolygons(0), precision(Ionflux::GeoUtils::DEFAULT_SVG_PRECISION), coalescePaths(false), elementIDPrefix("polygon"), axis(Ionflux::GeoUtils::AXIS_Y), shapeType(Ionflux::GeoUtils::DEFAULT_SHAPE_TYPE), closePath(true)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	buffer.reserve(2 * SVG_WRITER_BUFFER_SIZE);
+}
+
+SVGWriter::SVGWriter(const Ionflux::GeoUtils::SVGWriter& other)
+: numPolygons(0), precision(Ionflux::GeoUtils::DEFAULT_SVG_PRECISION), coalescePaths(false), elementIDPrefix("polygon"), axis(Ionflux::GeoUtils::AXIS_Y), shapeType(Ionflux::GeoUtils::DEFAULT_SHAPE_TYPE), closePath(true)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	*this = other;
+}
+
+SVGWriter::~SVGWriter()
+{
+	// TODO: Nothing ATM. ;-)
+}
+
+void SVGWriter::appendNumber(std::string& target, double value, unsigned
+int precision)
+{
+	if (precision > SVG_WRITER_MAX_PRECISION)
+	    precision = SVG_WRITER_MAX_PRECISION;
+	std::string::size_type p0 = target.size();
+	appendDouble(target, value, precision);
+	if ((precision > 0)
+	    && (target.find('.', p0) != std::string::npos))
+	{
+	    // Skip trailing zeros of the fractional part.
+	    std::string::size_type p1 = target.find_last_not_of('0');
+	    if (target[p1] == '.')
+	        p1--;
+	    target.erase(p1 + 1);
+	}
+	// Skip the sign of values that are rounded to zero.
+	if (target.compare(p0, std::string::npos, "-0") == 0)
+	    target.erase(p0, 1);
+}
+
+void SVGWriter::appendElementStart(const std::string& attrs, unsigned
+int elementIndex, Ionflux::GeoUtils::SVGShapeType elementShapeType)
+{
+	if (elementShapeType == SHAPE_TYPE_POLYGON)
+	    buffer.append("<polygon id=\"");
+	else
+	    buffer.append("<path id=\"");
+	buffer.append(elementIDPrefix);
+	char b0[16];
+	snprintf(b0, sizeof(b0), "%08u", elementIndex);
+	buffer.append(b0);
+	buffer.push_back('"');
+	if (attrs.size() > 0)
+	{
+	    buffer.push_back(' ');
+	    buffer.append(attrs);
+	}
+	if (elementShapeType == SHAPE_TYPE_POLYGON)
+	    buffer.append(" points=\"");
+	else
+	    buffer.append(" d=\"");
+}
+
+void SVGWriter::appendPolygon(Ionflux::GeoUtils::Polygon3& polygon,
+Ionflux::GeoUtils::AxisID axisX, Ionflux::GeoUtils::AxisID axisY,
+Ionflux::GeoUtils::SVGShapeType elementShapeType)
+{
+	polygon.applyTransform();
+	unsigned int numVerts = polygon.getNumVertices();
+	for (unsigned int i = 0; i < numVerts; i++)
+	{
+	    Vertex3* v0 = polygon.getVertex(i);
+	    if (i > 0)
+	    {
+	        buffer.push_back(' ');
+	        if (elementShapeType == SHAPE_TYPE_PATH)
+	            buffer.append("L ");
+	    } else
+	    if (elementShapeType == SHAPE_TYPE_PATH)
+	        buffer.append("M ");
+	    appendNumber(buffer, (*v0)[axisX], precision);
+	    buffer.push_back(',');
+	    appendNumber(buffer, (*v0)[axisY], precision);
+	}
+	if (closePath
+	    && (elementShapeType == SHAPE_TYPE_PATH))
+	    buffer.append(" z");
+}
+
+void SVGWriter::flushBuffer(std::ostream& target, bool force)
+{
+	if (!force
+	    && (buffer.size() < SVG_WRITER_BUFFER_SIZE))
+	    return;
+	if (buffer.size() > 0)
+	    target.write(buffer.data(), buffer.size());
+	buffer.clear();
+}
+
+void SVGWriter::writeHeader(std::ostream& target, unsigned int width,
+unsigned int height, int originX, int originY, const std::string&
+svgTemplate)
+{
+	std::string::size_type p0 = svgTemplate.find("{$data}");
+	if (p0 == std::string::npos)
+	    throw GeoUtilsError("[SVGWriter::writeHeader] "
+	        "SVG template does not contain a data tag.");
+	std::ostringstream v0;
+	Dictionary d0;
+	v0 << width;
+	d0["width"] = v0.str();
+	v0.str("");
+	v0 << height;
+	d0["height"] = v0.str();
+	v0.str("");
+	v0 << originX;
+	d0["originX"] = v0.str();
+	v0.str("");
+	v0 << originY;
+	d0["originY"] = v0.str();
+	buffer.clear();
+	numPolygons = 0;
+	footer = fillTags(svgTemplate.substr(p0 + 7), d0);
+	std::string h0 = fillTags(svgTemplate.substr(0, p0), d0);
+	target.write(h0.data(), h0.size());
+}
+
+void SVGWriter::writePolygons(std::ostream& target,
+Ionflux::GeoUtils::Polygon3Set& polygons, const
+Ionflux::GeoUtils::SVGShapeStyleVector* styles)
+{
+	AxisID oa[2];
+	if (axis == AXIS_Y)
+	{
+	    oa[0] = AXIS_X;
+	    oa[1] = AXIS_Z;
+	} else
+	if (axis == AXIS_X)
+	{
+	    oa[0] = AXIS_Y;
+	    oa[1] = AXIS_Z;
+	} else
+	if (axis == AXIS_Z)
+	{
+	    oa[0] = AXIS_X;
+	    oa[1] = AXIS_Y;
+	} else
+	{
+	    std::ostringstream status;
+	    status << "[SVGWriter::writePolygons] Invalid axis: " << axis;
+	    throw GeoUtilsError(status.str());
+	}
+	if ((shapeType != SHAPE_TYPE_POLYGON)
+	    && (shapeType != SHAPE_TYPE_PATH))
+	{
+	    std::ostringstream status;
+	    status << "[SVGWriter::writePolygons] Unknown shape type: "
+	        << shapeType;
+	    throw GeoUtilsError(status.str());
+	}
+	// Format the style attributes only once per style.
+	Ionflux::ObjectBase::StringVector attrs;
+	if (styles != 0)
+	{
+	    for (SVGShapeStyleVector::const_iterator j = styles->begin();
+	        j != styles->end(); j++)
+	        attrs.push_back(getSVGPolygonStyle(*(*j)));
+	}
+	if (attrs.size() == 0)
+	    attrs.push_back(SVG_DEFAULT_POLY_STYLE);
+	unsigned int numAttrs = attrs.size();
+	/* Map each style to the first style with identical attributes, so
+	   polygons can be coalesced even if the style objects differ. */
+	Ionflux::ObjectBase::UIntVector attrIndex;
+	for (unsigned int i = 0; i < numAttrs; i++)
+	{
+	    unsigned int k = 0;
+	    while (attrs[k] != attrs[i])
+	        k++;
+	    attrIndex.push_back(k);
+	}
+	// Only paths can contain more than one polygon.
+	SVGShapeType st0 = shapeType;
+	if (coalescePaths)
+	    st0 = SHAPE_TYPE_PATH;
+	polygons.applyTransform();
+	unsigned int numPolys = polygons.getNumPolygons();
+	bool open = false;
+	unsigned int a0 = 0;
+	for (unsigned int i = 0; i < numPolys; i++)
+	{
+	    Polygon3* p0 = polygons.getPolygon(i);
+	    unsigned int a1 = attrIndex[i % numAttrs];
+	    if (coalescePaths && open && (a1 == a0))
+	        buffer.push_back(' ');
+	    else
+	    {
+	        if (open)
+	        {
+	            buffer.append("\" />");
+	            flushBuffer(target);
+	        }
+	        if ((numPolygons + i) > 0)
+	            buffer.push_back('\n');
+	        appendElementStart(attrs[a1], numPolygons + i, st0);
+	        open = true;
+	        a0 = a1;
+	    }
+	    appendPolygon(*p0, oa[0], oa[1], st0);
+	}
+	if (open)
+	    buffer.append("\" />");
+	numPolygons += numPolys;
+	flushBuffer(target, true);
+}
+
+void SVGWriter::writeFooter(std::ostream& target)
+{
+	flushBuffer(target, true);
+	target.write(footer.data(), footer.size());
+}
+
+void SVGWriter::writeFile(const std::string& fileName,
+Ionflux::GeoUtils::Polygon3Set& polygons, const
+Ionflux::GeoUtils::SVGShapeStyleVector* styles, unsigned int width,
+unsigned int height, int originX, int originY, const std::string&
+svgTemplate)
+{
+	std::ofstream f0;
+	f0.open(fileName.c_str(), ios_base::out);
+	if (!f0)
+	{
+	    std::ostringstream status;
+	    status << "[SVGWriter::writeFile] Could not open file: " << fileName;
+	    throw GeoUtilsError(status.str());
+	}
+	writeHeader(f0, width, height, originX, originY, svgTemplate);
+	writePolygons(f0, polygons, styles);
+	writeFooter(f0);
+}
+
+std::string SVGWriter::getString() const
+{
+	ostringstream status;
+	status << getClassName() << "[" << precision << ", "
+	    << coalescePaths << ", " << numPolygons << "]";
+	return status.str();
+}
+
+void SVGWriter::setPrecision(unsigned int newPrecision)
+{
+	precision = newPrecision;
+}
+
+unsigned int SVGWriter::getPrecision() const
+{
+    return precision;
+}
+
+void SVGWriter::setCoalescePaths(bool newCoalescePaths)
+{
+	coalescePaths = newCoalescePaths;
+}
+
+bool SVGWriter::getCoalescePaths() const
+{
+    return coalescePaths;
+}
+
+void SVGWriter::setElementIDPrefix(const std::string&
+newElementIDPrefix)
+{
+	elementIDPrefix = newElementIDPrefix;
+}
+
+std::string SVGWriter::getElementIDPrefix() const
+{
+    return elementIDPrefix;
+}
+
+void SVGWriter::setAxis(Ionflux::GeoUtils::AxisID newAxis)
+{
+	axis = newAxis;
+}
+
+Ionflux::GeoUtils::AxisID SVGWriter::getAxis() const
+{
+    return axis;
+}
+
+void SVGWriter::setShapeType(Ionflux::GeoUtils::SVGShapeType
+newShapeType)
+{
+	shapeType = newShapeType;
+}
+
+Ionflux::GeoUtils::SVGShapeType SVGWriter::getShapeType() const
+{
+    return shapeType;
+}
+
+void SVGWriter::setClosePath(bool newClosePath)
+{
+	closePath = newClosePath;
+}
+
+bool SVGWriter::getClosePath() const
+{
+    return closePath;
+}
+
+Ionflux::GeoUtils::SVGWriter& SVGWriter::operator=(const 
+Ionflux::GeoUtils::SVGWriter& other)
+{
+    if (this == &other)
+        return *this;
+    precision = other.precision;
+    coalescePaths = other.coalescePaths;
+    elementIDPrefix = other.elementIDPrefix;
+    axis = other.axis;
+    shapeType = other.shapeType;
+    closePath = other.closePath;
+	return *this;
+}
+
+Ionflux::GeoUtils::SVGWriter* SVGWriter::copy() const
+{
+    SVGWriter* newSVGWriter = create();
+    *newSVGWriter = *this;
+    return newSVGWriter;
+}
+
+Ionflux::GeoUtils::SVGWriter* 
+SVGWriter::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<SVGWriter*>(other);
+}
+
+Ionflux::GeoUtils::SVGWriter* 
+SVGWriter::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    SVGWriter* newObject = new SVGWriter();
+    if (newObject == 0)
+    {
+        throw GeoUtilsError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int SVGWriter::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+/** \file SVGWriter.cpp
+ * \brief SVG writer implementation.
+ */
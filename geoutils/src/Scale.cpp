@@ -210,9 +210,16 @@ std::string Scale::getString() const
 	return status.str();
 }
 
+bool Scale::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return (indexFunc == 0) && (distanceFunc == 0);
+}
+
 void Scale::setScale(const Ionflux::GeoUtils::Vector3& newScale)
 {
 	scale = newScale;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Scale::getScale() const
@@ -224,12 +231,13 @@ void Scale::setIndexFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newIndexFunc)
 {
 	if (indexFunc == newIndexFunc)
-		return;
-    if (newIndexFunc != 0)
-        addLocalRef(newIndexFunc);
+	    return;
+	if (newIndexFunc != 0)
+	    addLocalRef(newIndexFunc);
 	if (indexFunc != 0)
-		removeLocalRef(indexFunc);
+	    removeLocalRef(indexFunc);
 	indexFunc = newIndexFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* Scale::getIndexFunc() const
@@ -241,12 +249,13 @@ void Scale::setDistanceFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newDistanceFunc)
 {
 	if (distanceFunc == newDistanceFunc)
-		return;
-    if (newDistanceFunc != 0)
-        addLocalRef(newDistanceFunc);
+	    return;
+	if (newDistanceFunc != 0)
+	    addLocalRef(newDistanceFunc);
 	if (distanceFunc != 0)
-		removeLocalRef(distanceFunc);
+	    removeLocalRef(distanceFunc);
 	distanceFunc = newDistanceFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* Scale::getDistanceFunc() const
@@ -258,6 +267,7 @@ void Scale::setCenteringMethod(Ionflux::GeoUtils::CenteringMethod
 newCenteringMethod)
 {
 	centeringMethod = newCenteringMethod;
+	touch();
 }
 
 Ionflux::GeoUtils::CenteringMethod Scale::getCenteringMethod() const
@@ -268,6 +278,7 @@ Ionflux::GeoUtils::CenteringMethod Scale::getCenteringMethod() const
 void Scale::setScaleFactor(Ionflux::Mapping::MappingValue newScaleFactor)
 {
 	scaleFactor = newScaleFactor;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scale::getScaleFactor() const
@@ -279,6 +290,7 @@ void Scale::setDeltaScaleFactor(Ionflux::Mapping::MappingValue
 newDeltaScaleFactor)
 {
 	deltaScaleFactor = newDeltaScaleFactor;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scale::getDeltaScaleFactor() const
@@ -290,8 +302,12 @@ Ionflux::GeoUtils::TransformNodes::Scale& Scale::operator=(const
 Ionflux::GeoUtils::TransformNodes::Scale& other)
 {
     TransformNode::operator=(other);
+    scale = other.scale;
     setIndexFunc(other.indexFunc);
     setDistanceFunc(other.distanceFunc);
+    scaleFactor = other.scaleFactor;
+    deltaScaleFactor = other.deltaScaleFactor;
+    centeringMethod = other.centeringMethod;
 	return *this;
 }
 
@@ -34,6 +34,7 @@
 #include <fstream>
 #include "ifmapping/utils.hpp"
 #include "ifmapping/RandomNorm.hpp"
+#include "ifobject/objectutils.hpp"
 #include "geoutils/GeoUtilsError.hpp"
 #include "geoutils/Compose3.hpp"
 #include "geoutils/Lookup3.hpp"
@@ -138,50 +139,100 @@ void Scatter::process()
 	/* Since we are going to manipulate the individual elements, 
 	   any existing group transformations must be applied first. */
 	g0->applyTransform();
-	// Process elements from the input group.
-	unsigned int numSourceItems = g0->getNumItems();
-	/* <---- DEBUG ----- //
-	std::ostringstream message;
-	message << "START: Group: barycenter = " << g0->getBarycenter()
-	    << ", bounds.center = " << g0->getBounds().getCenter();
-	log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	// ----- DEBUG ----> */
-	for (unsigned int i = 0; i < numSourceItems; i++)
-	{
-	    TransformableObject* o0 = g0->getItem(i);
-	    /* <---- DEBUG ----- //
-	    message.str("");
-	    message << "Processing object: " << o0->getClassName() 
-	        << " (barycenter = " << o0->getBarycenter() << ")";
-	    log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	    // ----- DEBUG ----> */
-	    // Calculate the element offset.
-	    MappingValue i0 = Ionflux::Mapping::wrap(
-	        static_cast<MappingValue>(i) / (numSourceItems - 1.) 
+	/* Calculate the transformations for all elements first, then add them 
+	   to the elements in a single pass. The elements are not transformed 
+	   until their transformations are applied. */
+	InstanceTransforms t0;
+	getInstanceTransforms(*g0, t0);
+	g0->transformItems(t0);
+	addOutput(g0);
+}
+
+std::string Scatter::getString() const
+{
+	ostringstream status;
+	status << getClassName() << "[" << defaultStr(id, "<unnamed>") << "]";
+	return status.str();
+}
+
+bool Scatter::isThreadSafe() const
+{
+	bool result = (offsetFunc == 0) && (offsetIndexFunc == 0) 
+	    && (elementScaleIndexFunc == 0) && (elementScaleDistanceFunc == 0);
+	return result;
+}
+
+void
+Scatter::getInstanceTransforms(Ionflux::GeoUtils::TransformableGroup&
+source, Ionflux::GeoUtils::InstanceTransforms& target)
+{
+	if (offsetFunc == 0)
+	    throw GeoUtilsError("Offset mapping not set.");
+	unsigned int n = source.getNumItems();
+	// Evaluate the offset mappings for all elements.
+	MappingValueVector iv(n);
+	for (unsigned int i = 0; i < n; i++)
+	    iv[i] = Ionflux::Mapping::wrap(
+	        static_cast<MappingValue>(i) / (n - 1.) 
 	        * offsetIndexScale + offsetIndexOffset, OFFSET_INDEX_RANGE);
-	    if (offsetIndexFunc != 0)
-	        i0 = (*offsetIndexFunc)(i0);
-	    Vector3 v0((*offsetFunc)(i0));
-	    // Scale the offset vector.
-	    Vector3 s1((offsetScaleFactor + i * offsetDeltaScaleFactor) 
-	        * offsetScale);
-	    v0 = offset + v0.multElements(s1);
-	    // Translate the object.
-	    o0->translate(v0);
-	    /* <---- DEBUG ----- //
-	    message.str("");
-	    message << "After translation: barycenter = " << o0->getBarycenter();
-	    log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	    // ----- DEBUG ----> */
-	    // Calculate the element scale.
-	    Vector3 s0((elementScaleFactor + i * elementDeltaScaleFactor) 
-	        * elementScale);
-	    if (elementScaleIndexFunc != 0)
-	        // Multiply element scaling according to index mapping.
-	        s0 = s0.multElements(
-	            (*elementScaleIndexFunc)(static_cast<double>(i) 
-	                / (numSourceItems - 1)));
-	    // Determine the center vector.
+	if (offsetIndexFunc != 0)
+	    offsetIndexFunc->callBatch(iv, iv);
+	DoubleVector& ox = target.offsetX;
+	DoubleVector& oy = target.offsetY;
+	DoubleVector& oz = target.offsetZ;
+	offsetFunc->callBatch(iv, ox, oy, oz);
+	// Scale the offset vectors.
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    double f = offsetScaleFactor + i * offsetDeltaScaleFactor;
+	    ox[i] = offset[0] + ox[i] * (f * offsetScale[0]);
+	    oy[i] = offset[1] + oy[i] * (f * offsetScale[1]);
+	    oz[i] = offset[2] + oz[i] * (f * offsetScale[2]);
+	}
+	// Calculate the element scale factors.
+	DoubleVector& sx = target.scaleX;
+	DoubleVector& sy = target.scaleY;
+	DoubleVector& sz = target.scaleZ;
+	sx.resize(n);
+	sy.resize(n);
+	sz.resize(n);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    double f = elementScaleFactor + i * elementDeltaScaleFactor;
+	    sx[i] = f * elementScale[0];
+	    sy[i] = f * elementScale[1];
+	    sz[i] = f * elementScale[2];
+	}
+	DoubleVector mx;
+	DoubleVector my;
+	DoubleVector mz;
+	if (elementScaleIndexFunc != 0)
+	{
+	    // Multiply element scaling according to index mapping.
+	    for (unsigned int i = 0; i < n; i++)
+	        iv[i] = static_cast<MappingValue>(i) / (n - 1.);
+	    elementScaleIndexFunc->callBatch(iv, mx, my, mz);
+	    for (unsigned int i = 0; i < n; i++)
+	    {
+	        sx[i] *= mx[i];
+	        sy[i] *= my[i];
+	        sz[i] *= mz[i];
+	    }
+	}
+	/* Determine the scaling centers. The elements are scaled after they 
+	   have been translated, so a center that does not depend on the element 
+	   (CENTER_ORIGIN) is shifted by the inverse offset. */
+	DoubleVector& cx = target.centerX;
+	DoubleVector& cy = target.centerY;
+	DoubleVector& cz = target.centerZ;
+	cx.resize(n);
+	cy.resize(n);
+	cz.resize(n);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    TransformableObject* o0 = 
+	        Ionflux::ObjectBase::nullPointerCheck(source.getItem(i), this, 
+	            "getInstanceTransforms", "Transformable object");
 	    Vector3 c0;
 	    if (centeringMethod == CENTER_BOUNDS)
 	        c0 = o0->getBounds().getCenter();
@@ -189,57 +240,29 @@ void Scatter::process()
 	    if (centeringMethod == CENTER_BARYCENTER)
 	        c0 = o0->getBarycenter();
 	    else
-	        c0 = Vector3::ZERO;
-	    if (elementScaleDistanceFunc != 0)
+	        c0 = Vector3(-ox[i], -oy[i], -oz[i]);
+	    cx[i] = c0[0];
+	    cy[i] = c0[1];
+	    cz[i] = c0[2];
+	}
+	if (elementScaleDistanceFunc != 0)
+	{
+	    // Multiply element scaling according to distance mapping.
+	    for (unsigned int i = 0; i < n; i++)
 	    {
-	        // Multiply element scaling according to distance mapping.
-	        double r0 = c0.norm();
-	        s0 = s0.multElements((*elementScaleDistanceFunc)(r0));
+	        double x0 = cx[i] + ox[i];
+	        double x1 = cy[i] + oy[i];
+	        double x2 = cz[i] + oz[i];
+	        iv[i] = ::sqrt(x0 * x0 + x1 * x1 + x2 * x2);
+	    }
+	    elementScaleDistanceFunc->callBatch(iv, mx, my, mz);
+	    for (unsigned int i = 0; i < n; i++)
+	    {
+	        sx[i] *= mx[i];
+	        sy[i] *= my[i];
+	        sz[i] *= mz[i];
 	    }
-	    /* <---- DEBUG ----- //
-	    message.str("");
-	    message << "Scaling center: " << c0 << " (v0 = " 
-	        << v0 << ", s0 = " << s0 << ", centeringMethod = " 
-	        << centeringMethod << ").";
-	    log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	    // ----- DEBUG ----> */
-	    // Scale the object.
-	    o0->translate(c0.flip());
-	    /* <---- DEBUG ----- //
-	    message.str("");
-	    message << "Before scaling: barycenter = " << o0->getBarycenter();
-	    log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	    // ----- DEBUG ----> */
-	    o0->scale(s0);
-	    /* <---- DEBUG ----- //
-	    message.str("");
-	    message << "After scaling: barycenter = " << o0->getBarycenter();
-	    log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	    // ----- DEBUG ----> */
-	    o0->translate(c0);
-	    /* <---- DEBUG ----- //
-	    message.str("");
-	    message << "Result: barycenter = " << o0->getBarycenter() 
-	        << ", bounds.center = " << o0->getBounds().getCenter() 
-	        << ", v0 = " << v0;
-	    log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	    // ----- DEBUG ----> */
 	}
-	/* <---- DEBUG ----- //
-	message.str("");
-	message << "END: Group: barycenter = " << g0->getBarycenter() 
-	    << ", bounds = " << g0->getBounds() << ", bounds.center = " 
-	    << g0->getBounds().getCenter();
-	log(IFLogMessage(message.str(), VL_DEBUG, this, "process"));
-	// ----- DEBUG ----> */
-	addOutput(g0);
-}
-
-std::string Scatter::getString() const
-{
-	ostringstream status;
-	status << getClassName() << "[" << defaultStr(id, "<unnamed>") << "]";
-	return status.str();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* Scatter::createLUT(unsigned int
@@ -294,6 +317,7 @@ sourceFuncY, Ionflux::Mapping::Mapping* sourceFuncZ)
 void Scatter::setOffset(const Ionflux::GeoUtils::Vector3& newOffset)
 {
 	offset = newOffset;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Scatter::getOffset() const
@@ -305,12 +329,13 @@ void Scatter::setOffsetFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newOffsetFunc)
 {
 	if (offsetFunc == newOffsetFunc)
-		return;
-    if (newOffsetFunc != 0)
-        addLocalRef(newOffsetFunc);
+	    return;
+	if (newOffsetFunc != 0)
+	    addLocalRef(newOffsetFunc);
 	if (offsetFunc != 0)
-		removeLocalRef(offsetFunc);
+	    removeLocalRef(offsetFunc);
 	offsetFunc = newOffsetFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* Scatter::getOffsetFunc() const
@@ -322,12 +347,13 @@ void Scatter::setOffsetIndexFunc(Ionflux::Mapping::Mapping*
 newOffsetIndexFunc)
 {
 	if (offsetIndexFunc == newOffsetIndexFunc)
-		return;
-    if (newOffsetIndexFunc != 0)
-        addLocalRef(newOffsetIndexFunc);
+	    return;
+	if (newOffsetIndexFunc != 0)
+	    addLocalRef(newOffsetIndexFunc);
 	if (offsetIndexFunc != 0)
-		removeLocalRef(offsetIndexFunc);
+	    removeLocalRef(offsetIndexFunc);
 	offsetIndexFunc = newOffsetIndexFunc;
+	touch();
 }
 
 Ionflux::Mapping::Mapping* Scatter::getOffsetIndexFunc() const
@@ -339,6 +365,7 @@ void Scatter::setOffsetScale(const Ionflux::GeoUtils::Vector3&
 newOffsetScale)
 {
 	offsetScale = newOffsetScale;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Scatter::getOffsetScale() const
@@ -350,6 +377,7 @@ void Scatter::setOffsetScaleFactor(Ionflux::Mapping::MappingValue
 newOffsetScaleFactor)
 {
 	offsetScaleFactor = newOffsetScaleFactor;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scatter::getOffsetScaleFactor() const
@@ -361,6 +389,7 @@ void Scatter::setOffsetDeltaScaleFactor(Ionflux::Mapping::MappingValue
 newOffsetDeltaScaleFactor)
 {
 	offsetDeltaScaleFactor = newOffsetDeltaScaleFactor;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scatter::getOffsetDeltaScaleFactor() const
@@ -372,6 +401,7 @@ void Scatter::setOffsetIndexOffset(Ionflux::Mapping::MappingValue
 newOffsetIndexOffset)
 {
 	offsetIndexOffset = newOffsetIndexOffset;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scatter::getOffsetIndexOffset() const
@@ -383,6 +413,7 @@ void Scatter::setOffsetIndexScale(Ionflux::Mapping::MappingValue
 newOffsetIndexScale)
 {
 	offsetIndexScale = newOffsetIndexScale;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scatter::getOffsetIndexScale() const
@@ -394,6 +425,7 @@ void Scatter::setElementScale(const Ionflux::GeoUtils::Vector3&
 newElementScale)
 {
 	elementScale = newElementScale;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Scatter::getElementScale() const
@@ -405,6 +437,7 @@ void Scatter::setElementScaleFactor(Ionflux::Mapping::MappingValue
 newElementScaleFactor)
 {
 	elementScaleFactor = newElementScaleFactor;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scatter::getElementScaleFactor() const
@@ -416,6 +449,7 @@ void Scatter::setElementDeltaScaleFactor(Ionflux::Mapping::MappingValue
 newElementDeltaScaleFactor)
 {
 	elementDeltaScaleFactor = newElementDeltaScaleFactor;
+	touch();
 }
 
 Ionflux::Mapping::MappingValue Scatter::getElementDeltaScaleFactor() const
@@ -428,12 +462,13 @@ Scatter::setElementScaleIndexFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newElementScaleIndexFunc)
 {
 	if (elementScaleIndexFunc == newElementScaleIndexFunc)
-		return;
-    if (newElementScaleIndexFunc != 0)
-        addLocalRef(newElementScaleIndexFunc);
+	    return;
+	if (newElementScaleIndexFunc != 0)
+	    addLocalRef(newElementScaleIndexFunc);
 	if (elementScaleIndexFunc != 0)
-		removeLocalRef(elementScaleIndexFunc);
+	    removeLocalRef(elementScaleIndexFunc);
 	elementScaleIndexFunc = newElementScaleIndexFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* 
@@ -447,12 +482,13 @@ Scatter::setElementScaleDistanceFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newElementScaleDistanceFunc)
 {
 	if (elementScaleDistanceFunc == newElementScaleDistanceFunc)
-		return;
-    if (newElementScaleDistanceFunc != 0)
-        addLocalRef(newElementScaleDistanceFunc);
+	    return;
+	if (newElementScaleDistanceFunc != 0)
+	    addLocalRef(newElementScaleDistanceFunc);
 	if (elementScaleDistanceFunc != 0)
-		removeLocalRef(elementScaleDistanceFunc);
+	    removeLocalRef(elementScaleDistanceFunc);
 	elementScaleDistanceFunc = newElementScaleDistanceFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* 
@@ -465,6 +501,7 @@ void Scatter::setCenteringMethod(Ionflux::GeoUtils::CenteringMethod
 newCenteringMethod)
 {
 	centeringMethod = newCenteringMethod;
+	touch();
 }
 
 Ionflux::GeoUtils::CenteringMethod Scatter::getCenteringMethod() const
@@ -98,7 +98,9 @@ void Source::process()
 {
 	if (source == 0)
 	    return;
-	addOutput(&(source->duplicate()));
+	/* The source group may also be used by other nodes that are updated 
+	   at the same time (see duplicateInput()). */
+	addOutput(duplicateInput(*source));
 }
 
 std::string Source::getString() const
@@ -116,12 +118,13 @@ std::string Source::getString() const
 void Source::setSource(Ionflux::GeoUtils::TransformableGroup* newSource)
 {
 	if (source == newSource)
-		return;
-    if (newSource != 0)
-        addLocalRef(newSource);
+	    return;
+	if (newSource != 0)
+	    addLocalRef(newSource);
 	if (source != 0)
-		removeLocalRef(source);
+	    removeLocalRef(source);
 	source = newSource;
+	touch();
 }
 
 Ionflux::GeoUtils::TransformableGroup* Source::getSource() const
@@ -34,7 +34,11 @@
 #include <iomanip>
 #include <algorithm>
 #include <set>
+#include <map>
+#include <pthread.h>
+#include <unistd.h>
 #include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Profiler.hpp"
 
 using namespace std;
 using namespace Ionflux::ObjectBase;
@@ -66,7 +70,7 @@ const TransformGraphClassInfo TransformGraph::transformGraphClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* TransformGraph::CLASS_INFO = &TransformGraph::transformGraphClassInfo;
 
 TransformGraph::TransformGraph()
-: source(0), drain(0)
+: numNodeUpdates(0), numEliminatedUpdates(0), source(0), drain(0), numThreads(1), incremental(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -74,7 +78,7 @@ TransformGraph::TransformGraph()
 }
 
 TransformGraph::TransformGraph(const Ionflux::GeoUtils::TransformNodes::TransformGraph& other)
-: source(0), drain(0)
+: numNodeUpdates(0), numEliminatedUpdates(0), source(0), drain(0), numThreads(1), incremental(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -96,6 +100,290 @@ void TransformGraph::process()
 	       by the drain node. */
 }
 
+unsigned int TransformGraph::updateParallel(const
+Ionflux::GeoUtils::TransformNodeVector& schedule, unsigned int
+numThreads)
+{
+	if (numThreads == 0)
+	    numThreads = 1;
+	TransformGraphUpdate u0;
+	u0.nodes = schedule;
+	unsigned int n = schedule.size();
+	std::map<TransformNode*, unsigned int> ni0;
+	for (unsigned int i = 0; i < n; i++)
+	    ni0[schedule[i]] = i;
+	u0.serial.resize(n, false);
+	u0.inputs.resize(n);
+	u0.consumers.resize(n);
+	u0.numPendingInputs.resize(n, 0);
+	u0.numPendingConsumers.resize(n, 0);
+	/* Nodes that depend on a node that shares items between groups may 
+	   modify the reference counts of shared items, so they are updated 
+	   by the calling thread. */
+	std::vector<bool> sh0(n, false);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    TransformNode* n0 = schedule[i];
+	    bool s0 = n0->sharesItems();
+	    std::set<unsigned int> is0;
+	    for (unsigned int k = 0; k < n0->getNumInputs(); k++)
+	    {
+	        TransformNode* n1 = n0->getInput(k).node;
+	        std::map<TransformNode*, unsigned int>::iterator j = 
+	            ni0.find(n1);
+	        if (j == ni0.end())
+	        {
+	            if ((n1 != 0) 
+	                && n1->sharesItems())
+	                s0 = true;
+	            continue;
+	        }
+	        if (sh0[(*j).second])
+	            s0 = true;
+	        if (!is0.insert((*j).second).second)
+	            continue;
+	        u0.inputs[i].push_back((*j).second);
+	        u0.consumers[(*j).second].push_back(i);
+	    }
+	    u0.numPendingInputs[i] = u0.inputs[i].size();
+	    sh0[i] = s0;
+	    u0.serial[i] = !n0->isThreadSafe() || s0;
+	}
+	u0.queues.resize(numThreads);
+	for (unsigned int i = 0; i < numThreads; i++)
+	    pthread_mutex_init(&(u0.queues[i].mutex), 0);
+	u0.numQueued = 0;
+	u0.numIdle = 0;
+	/* Distribute the nodes that are ready initially among the threads. 
+	   Nodes in the queue of a thread that could not be created are 
+	   stolen by the other threads. */
+	unsigned int t0 = 0;
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    u0.numPendingConsumers[i] = u0.consumers[i].size();
+	    if (u0.numPendingInputs[i] > 0)
+	        continue;
+	    if (u0.serial[i])
+	        u0.readySerial.push_back(i);
+	    else
+	    {
+	        u0.queues[t0].nodes.push_back(i);
+	        u0.numQueued++;
+	        t0 = (t0 + 1) % numThreads;
+	    }
+	}
+	u0.numRemaining = n;
+	u0.numUpdated = 0;
+	u0.incremental = incremental;
+	u0.error = false;
+	pthread_mutex_init(&(u0.mutex), 0);
+	pthread_cond_init(&(u0.stateChanged), 0);
+	std::vector<TransformGraphTask> tasks(numThreads);
+	std::vector<pthread_t> threads(numThreads);
+	std::vector<bool> threaded(numThreads, false);
+	for (unsigned int i = 0; i < numThreads; i++)
+	{
+	    tasks[i].state = &u0;
+	    tasks[i].threadIndex = i;
+	}
+	for (unsigned int i = 1; i < numThreads; i++)
+	    threaded[i] = (pthread_create(&(threads[i]), 0, updateTask, 
+	        &(tasks[i])) == 0);
+	/* The calling thread takes part in the update. If no thread could be 
+	   created, it updates all nodes. */
+	updateNodes(u0, 0);
+	for (unsigned int i = 1; i < numThreads; i++)
+	{
+	    if (threaded[i])
+	        pthread_join(threads[i], 0);
+	}
+	pthread_cond_destroy(&(u0.stateChanged));
+	pthread_mutex_destroy(&(u0.mutex));
+	for (unsigned int i = 0; i < numThreads; i++)
+	    pthread_mutex_destroy(&(u0.queues[i].mutex));
+	if (u0.error)
+	    throw GeoUtilsError(u0.errorMessage);
+	return u0.numUpdated;
+}
+
+void TransformGraph::pushNode(Ionflux::GeoUtils::TransformGraphUpdate&
+state, unsigned int threadIndex, unsigned int nodeIndex)
+{
+	if (state.serial[nodeIndex])
+	{
+	    pthread_mutex_lock(&(state.mutex));
+	    state.readySerial.push_back(nodeIndex);
+	    pthread_cond_broadcast(&(state.stateChanged));
+	    pthread_mutex_unlock(&(state.mutex));
+	    return;
+	}
+	/* The node is counted before it is queued, so the count never drops 
+	   below zero if another thread steals the node right away. */
+	__atomic_add_fetch(&(state.numQueued), 1, __ATOMIC_SEQ_CST);
+	TransformGraphQueue& q0 = state.queues[threadIndex];
+	pthread_mutex_lock(&(q0.mutex));
+	q0.nodes.push_back(nodeIndex);
+	pthread_mutex_unlock(&(q0.mutex));
+	/* Idle threads count themselves before they check the number of 
+	   queued nodes, so either they see the new node or they are 
+	   notified here. */
+	if (__atomic_load_n(&(state.numIdle), __ATOMIC_SEQ_CST) > 0)
+	{
+	    pthread_mutex_lock(&(state.mutex));
+	    pthread_cond_broadcast(&(state.stateChanged));
+	    pthread_mutex_unlock(&(state.mutex));
+	}
+}
+
+bool TransformGraph::popNode(Ionflux::GeoUtils::TransformGraphUpdate&
+state, unsigned int threadIndex, unsigned int& nodeIndex)
+{
+	bool found = false;
+	unsigned int n = state.queues.size();
+	for (unsigned int i = 0; !found && (i < n); i++)
+	{
+	    TransformGraphQueue& q0 = state.queues[(threadIndex + i) % n];
+	    pthread_mutex_lock(&(q0.mutex));
+	    if (q0.nodes.size() > 0)
+	    {
+	        if (i == 0)
+	        {
+	            nodeIndex = q0.nodes.back();
+	            q0.nodes.pop_back();
+	        } else
+	        {
+	            nodeIndex = q0.nodes.front();
+	            q0.nodes.pop_front();
+	        }
+	        found = true;
+	    }
+	    pthread_mutex_unlock(&(q0.mutex));
+	}
+	if (found)
+	    __atomic_sub_fetch(&(state.numQueued), 1, __ATOMIC_SEQ_CST);
+	return found;
+}
+
+void
+TransformGraph::updateNodes(Ionflux::GeoUtils::TransformGraphUpdate&
+state, unsigned int threadIndex)
+{
+	bool callingThread = (threadIndex == 0);
+	while (!__atomic_load_n(&(state.error), __ATOMIC_ACQUIRE) 
+	    && (__atomic_load_n(&(state.numRemaining), __ATOMIC_ACQUIRE) > 0))
+	{
+	    unsigned int k = 0;
+	    bool found = false;
+	    if (callingThread)
+	    {
+	        pthread_mutex_lock(&(state.mutex));
+	        if (state.readySerial.size() > 0)
+	        {
+	            k = state.readySerial.back();
+	            state.readySerial.pop_back();
+	            found = true;
+	        }
+	        pthread_mutex_unlock(&(state.mutex));
+	    }
+	    if (!found 
+	        && (__atomic_load_n(&(state.numQueued), __ATOMIC_SEQ_CST) > 0))
+	        found = popNode(state, threadIndex, k);
+	    if (!found)
+	    {
+	        // Wait until a node becomes ready or the update is finished.
+	        pthread_mutex_lock(&(state.mutex));
+	        __atomic_add_fetch(&(state.numIdle), 1, __ATOMIC_SEQ_CST);
+	        if (!state.error 
+	            && (__atomic_load_n(&(state.numRemaining), 
+	                __ATOMIC_SEQ_CST) > 0) 
+	            && (__atomic_load_n(&(state.numQueued), 
+	                __ATOMIC_SEQ_CST) == 0) 
+	            && (!callingThread 
+	                || (state.readySerial.size() == 0)))
+	            pthread_cond_wait(&(state.stateChanged), &(state.mutex));
+	        __atomic_sub_fetch(&(state.numIdle), 1, __ATOMIC_SEQ_CST);
+	        pthread_mutex_unlock(&(state.mutex));
+	        continue;
+	    }
+	    TransformNode* n0 = state.nodes[k];
+	    bool e0 = false;
+	    bool u1 = false;
+	    std::string m0;
+	    try
+	    {
+	        if (!state.incremental 
+	            || n0->isDirty())
+	        {
+	            n0->setScheduled(true);
+	            n0->update();
+	            u1 = true;
+	        }
+	    } catch (std::exception& e)
+	    {
+	        e0 = true;
+	        m0 = e.what();
+	    }
+	    n0->setScheduled(false);
+	    if (e0)
+	    {
+	        pthread_mutex_lock(&(state.mutex));
+	        if (!state.error)
+	        {
+	            state.errorMessage = m0;
+	            __atomic_store_n(&(state.error), true, __ATOMIC_RELEASE);
+	        }
+	        pthread_cond_broadcast(&(state.stateChanged));
+	        pthread_mutex_unlock(&(state.mutex));
+	        continue;
+	    }
+	    if (u1)
+	        __atomic_add_fetch(&(state.numUpdated), 1, __ATOMIC_RELAXED);
+	    Ionflux::ObjectBase::UIntVector& v0 = state.consumers[k];
+	    for (Ionflux::ObjectBase::UIntVector::iterator i = v0.begin(); 
+	        i != v0.end(); i++)
+	    {
+	        unsigned int j = *i;
+	        if (__atomic_sub_fetch(&(state.numPendingInputs[j]), 1, 
+	            __ATOMIC_ACQ_REL) == 0)
+	            pushNode(state, threadIndex, j);
+	    }
+	    Ionflux::ObjectBase::UIntVector& v1 = state.inputs[k];
+	    for (Ionflux::ObjectBase::UIntVector::iterator i = v1.begin(); 
+	        i != v1.end(); i++)
+	    {
+	        unsigned int j = *i;
+	        /* Consumers of shared output groups get copies, so the 
+	           outputs are no longer needed (unless they are kept for 
+	           the next incremental update). */
+	        if ((__atomic_sub_fetch(&(state.numPendingConsumers[j]), 1, 
+	                __ATOMIC_ACQ_REL) == 0) 
+	            && !state.incremental 
+	            && (state.consumers[j].size() > 1))
+	        {
+	            // Copies share data with the outputs.
+	            pthread_mutex_t* m1 = getCopyMutex();
+	            pthread_mutex_lock(m1);
+	            state.nodes[j]->clearOutputs();
+	            pthread_mutex_unlock(m1);
+	        }
+	    }
+	    if (__atomic_sub_fetch(&(state.numRemaining), 1, 
+	        __ATOMIC_ACQ_REL) == 0)
+	    {
+	        pthread_mutex_lock(&(state.mutex));
+	        pthread_cond_broadcast(&(state.stateChanged));
+	        pthread_mutex_unlock(&(state.mutex));
+	    }
+	}
+}
+
+void* TransformGraph::updateTask(void* taskArg)
+{
+	TransformGraphTask* t0 = static_cast<TransformGraphTask*>(taskArg);
+	updateNodes(*(t0->state), t0->threadIndex);
+	return 0;
+}
+
 void 
 TransformGraph::addLinked(Ionflux::GeoUtils::TransformNodes::TransformNode*
 newNode)
@@ -354,12 +642,316 @@ void TransformGraph::update()
 	if (drain == 0)
 	    throw GeoUtilsError("[TransformGraph.update] "
 	        "Drain node not set.");
-	drain->update();
+	if (profiler != 0)
+	{
+	    /* Make sure that nodes which have been added since the profiler 
+	       was set report to the profiler as well. */
+	    if (!scheduled)
+	        setProfiler(profiler);
+	    profiler->begin(this);
+	}
+	TransformNodeVector s0;
+	getSchedule(s0);
+	std::set<TransformNode*> ns0(s0.begin(), s0.end());
+	/* Determine the distinct input nodes of each scheduled node. Input 
+	   nodes that are not part of the schedule are external inputs. */
+	std::map<TransformNode*, TransformNodeVector> in0;
+	TransformNodeVector ext0;
+	std::map<TransformNode*, unsigned int> ep0;
+	for (TransformNodeVector::iterator i = s0.begin(); i != s0.end(); i++)
+	{
+	    TransformNode* n0 = *i;
+	    TransformNodeVector& v0 = in0[n0];
+	    std::set<TransformNode*> is0;
+	    for (unsigned int k = 0; k < n0->getNumInputs(); k++)
+	    {
+	        TransformNode* n1 = n0->getInput(k).node;
+	        if ((n1 == 0) || !is0.insert(n1).second)
+	            continue;
+	        v0.push_back(n1);
+	        if ((ns0.find(n1) == ns0.end()) 
+	            && (ep0.find(n1) == ep0.end()))
+	        {
+	            ext0.push_back(n1);
+	            ep0[n1] = n1->getPendingConsumers();
+	        }
+	    }
+	}
+	/* Count the node updates that a recursive update starting at the 
+	   drain node would do (each node updates each of its distinct input 
+	   nodes once per update). */
+	std::map<TransformNode*, Ionflux::ObjectBase::UInt64> pc0;
+	pc0[drain] = 1;
+	Ionflux::ObjectBase::UInt64 t0 = 0;
+	for (TransformNodeVector::reverse_iterator i = s0.rbegin(); 
+	    i != s0.rend(); i++)
+	{
+	    Ionflux::ObjectBase::UInt64 c0 = pc0[*i];
+	    t0 += c0;
+	    TransformNodeVector& v0 = in0[*i];
+	    for (TransformNodeVector::iterator k = v0.begin(); k != v0.end(); k++)
+	    {
+	        if (ns0.find(*k) == ns0.end())
+	            continue;
+	        Ionflux::ObjectBase::UInt64& c1 = pc0[*k];
+	        c1 += c0;
+	        if (c1 > UINT_MAX)
+	            c1 = UINT_MAX;
+	    }
+	}
+	if (!scheduled)
+	{
+	    // Update the external input nodes.
+	    for (TransformNodeVector::iterator i = ext0.begin(); 
+	        i != ext0.end(); i++)
+	        (*i)->update();
+	}
+	/* Count the consumers of each input node. For an incremental update, 
+	   the graph itself counts as a consumer, so the outputs are kept for 
+	   the next update. */
+	for (TransformNodeVector::iterator i = s0.begin(); i != s0.end(); i++)
+	{
+	    if (incremental)
+	        (*i)->setPendingConsumers(1);
+	    else
+	        (*i)->setPendingConsumers(0);
+	}
+	for (TransformNodeVector::iterator i = s0.begin(); i != s0.end(); i++)
+	{
+	    TransformNodeVector& v0 = in0[*i];
+	    for (TransformNodeVector::iterator k = v0.begin(); k != v0.end(); k++)
+	        (*k)->setPendingConsumers((*k)->getPendingConsumers() + 1);
+	}
+	unsigned int nt = numThreads;
+	if (nt == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        nt = np;
+	    else
+	        nt = 1;
+	}
+	if (nt > s0.size())
+	    nt = s0.size();
+	unsigned int nu = 0;
+	try
+	{
+	    if (nt > 1)
+	        nu = updateParallel(s0, nt);
+	    else
+	    {
+	        // Update the nodes in topological order.
+	        for (TransformNodeVector::iterator i = s0.begin(); 
+	            i != s0.end(); i++)
+	        {
+	            TransformNode* n0 = *i;
+	            if (!incremental 
+	                || n0->isDirty())
+	            {
+	                n0->setScheduled(true);
+	                n0->update();
+	                n0->setScheduled(false);
+	                nu++;
+	            }
+	            TransformNodeVector& v0 = in0[n0];
+	            for (TransformNodeVector::iterator k = v0.begin(); 
+	                k != v0.end(); k++)
+	                (*k)->setPendingConsumers(
+	                    (*k)->getPendingConsumers() - 1);
+	        }
+	    }
+	} catch (...)
+	{
+	    for (TransformNodeVector::iterator i = s0.begin(); 
+	        i != s0.end(); i++)
+	    {
+	        (*i)->setScheduled(false);
+	        (*i)->setPendingConsumers(0);
+	    }
+	    for (std::map<TransformNode*, unsigned int>::iterator i = 
+	        ep0.begin(); i != ep0.end(); i++)
+	        (*i).first->setPendingConsumers((*i).second);
+	    if (profiler != 0)
+	        profiler->cancel(this);
+	    throw;
+	}
+	for (TransformNodeVector::iterator i = s0.begin(); i != s0.end(); i++)
+	    (*i)->setPendingConsumers(0);
+	for (std::map<TransformNode*, unsigned int>::iterator i = ep0.begin(); 
+	    i != ep0.end(); i++)
+	    (*i).first->setPendingConsumers((*i).second);
+	numNodeUpdates = nu;
+	if ((t0 - nu) > UINT_MAX)
+	    numEliminatedUpdates = UINT_MAX;
+	else
+	    numEliminatedUpdates = t0 - nu;
+	updateVersions();
 	updateCounter++;
 	loopCounter = 0;
 	if (debugMode)
 	    log(IFLogMessage(drain->getDebugInfo(debugExpand), VL_DEBUG, 
 	        this, "update"));
+	if (profiler != 0)
+	    profiler->end(this);
+}
+
+void TransformGraph::getSchedule(Ionflux::GeoUtils::TransformNodeVector&
+target)
+{
+	if (drain == 0)
+	    throw GeoUtilsError("[TransformGraph.getSchedule] "
+	        "Drain node not set.");
+	std::set<TransformNode*> ns0(nodes.begin(), nodes.end());
+	/* Iterative depth-first search starting at the drain node. The state 
+	   of a node is 1 while it is on the stack and 2 once it has been 
+	   added to the schedule. */
+	std::map<TransformNode*, int> state;
+	std::vector<std::pair<TransformNode*, unsigned int> > stack;
+	stack.push_back(std::make_pair(drain, 0u));
+	state[drain] = 1;
+	while (stack.size() > 0)
+	{
+	    TransformNode* n0 = stack.back().first;
+	    unsigned int k = stack.back().second;
+	    if (k >= n0->getNumInputs())
+	    {
+	        target.push_back(n0);
+	        state[n0] = 2;
+	        stack.pop_back();
+	        continue;
+	    }
+	    stack.back().second++;
+	    TransformNode* n1 = n0->getInput(k).node;
+	    if ((n1 == 0) 
+	        || (ns0.find(n1) == ns0.end()))
+	        continue;
+	    int s1 = state[n1];
+	    if (s1 == 1)
+	    {
+	        std::ostringstream message;
+	        message << "[TransformGraph.getSchedule] "
+	            "Graph contains a loop (node: " << n1->getString() << ").";
+	        throw GeoUtilsError(message.str());
+	    }
+	    if (s1 == 0)
+	    {
+	        state[n1] = 1;
+	        stack.push_back(std::make_pair(n1, 0u));
+	    }
+	}
+}
+
+unsigned int TransformGraph::getNumNodeUpdates() const
+{
+	// TODO: Implementation.
+	return numNodeUpdates;
+}
+
+unsigned int TransformGraph::getNumEliminatedUpdates() const
+{
+	// TODO: Implementation.
+	return numEliminatedUpdates;
+}
+
+bool TransformGraph::isThreadSafe() const
+{
+	bool result = true;
+	for (TransformNodeVector::const_iterator i = nodes.begin(); 
+	    result && (i != nodes.end()); i++)
+	    result = (*i)->isThreadSafe();
+	return result;
+}
+
+bool TransformGraph::sharesItems() const
+{
+	bool result = false;
+	for (TransformNodeVector::const_iterator i = nodes.begin(); 
+	    !result && (i != nodes.end()); i++)
+	    result = (*i)->sharesItems();
+	return result;
+}
+
+Ionflux::GeoUtils::TransformNodes::TransformNode*
+TransformGraph::createClone(Ionflux::GeoUtils::TransformNodeMap&
+nodeMap) const
+{
+	TransformGraph* result = create();
+	result->setLoopMax(loopMax);
+	result->numThreads = numThreads;
+	result->incremental = incremental;
+	nodeMap[const_cast<TransformGraph*>(this)] = result;
+	TransformNodeVector v0;
+	for (TransformNodeVector::const_iterator i = nodes.begin(); 
+	    i != nodes.end(); i++)
+	{
+	    TransformNode* n0 = (*i)->createClone(nodeMap);
+	    result->addNode(n0);
+	    v0.push_back(n0);
+	}
+	/* Inputs may refer to nodes that have been cloned after the node 
+	   itself. */
+	for (TransformNodeVector::iterator i = v0.begin(); i != v0.end(); i++)
+	    (*i)->remapInputs(nodeMap);
+	for (ConnectionVector::const_iterator i = connections.begin(); 
+	    i != connections.end(); i++)
+	{
+	    Connection* c0 = *i;
+	    if ((c0 == 0) 
+	        || !c0->isConnected())
+	        continue;
+	    TransformNodeMap::iterator j0 = nodeMap.find(c0->getSource());
+	    TransformNodeMap::iterator j1 = nodeMap.find(c0->getTarget());
+	    if ((j0 == nodeMap.end()) 
+	        || (j1 == nodeMap.end()))
+	        continue;
+	    result->connect((*j0).second, (*j1).second, c0->getOutputID(), 
+	        c0->getInputID());
+	}
+	TransformNodeMap::iterator j = nodeMap.find(source);
+	if (j != nodeMap.end())
+	    result->setSource((*j).second);
+	j = nodeMap.find(drain);
+	if (j != nodeMap.end())
+	    result->setDrain((*j).second);
+	return result;
+}
+
+void TransformGraph::remapInputs(const
+Ionflux::GeoUtils::TransformNodeMap& nodeMap)
+{
+	if (source != 0)
+	    source->remapInputs(nodeMap);
+}
+
+bool TransformGraph::isDirty() const
+{
+	bool result = (updateCounter == 0) 
+	    || (drain == 0) 
+	    || (drain->getNumOutputs() == 0) 
+	    || (paramVersion != lastParamVersion);
+	for (TransformNodeVector::const_iterator i = nodes.begin(); 
+	    !result && (i != nodes.end()); i++)
+	    result = (*i)->isDirty();
+	return result;
+}
+
+unsigned int TransformGraph::getTotalParamVersion() const
+{
+	unsigned int result = paramVersion;
+	for (TransformNodeVector::const_iterator i = nodes.begin(); 
+	    i != nodes.end(); i++)
+	    result += (*i)->getTotalParamVersion();
+	return result;
+}
+
+void
+TransformGraph::setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler*
+newProfiler)
+{
+	TransformNode::setProfiler(newProfiler);
+	for (TransformNodeVector::iterator i = nodes.begin(); 
+	    i != nodes.end(); i++)
+	    (*i)->setProfiler(newProfiler);
 }
 
 unsigned int TransformGraph::getNumInputs() const
@@ -717,6 +1309,26 @@ TransformGraph::getDrain() const
     return drain;
 }
 
+void TransformGraph::setNumThreads(unsigned int newNumThreads)
+{
+	numThreads = newNumThreads;
+}
+
+unsigned int TransformGraph::getNumThreads() const
+{
+    return numThreads;
+}
+
+void TransformGraph::setIncremental(bool newIncremental)
+{
+	incremental = newIncremental;
+}
+
+bool TransformGraph::getIncremental() const
+{
+    return incremental;
+}
+
 Ionflux::GeoUtils::TransformNodes::TransformGraph& 
 TransformGraph::operator=(const 
 Ionflux::GeoUtils::TransformNodes::TransformGraph& other)
@@ -725,6 +1337,8 @@ Ionflux::GeoUtils::TransformNodes::TransformGraph& other)
     TransformNodeVector v0;
     source = other.source;
     drain = other.drain;
+    numThreads = other.numThreads;
+    incremental = other.incremental;
     for (TransformNodeVector::const_iterator i = other.nodes.begin(); 
         i != other.nodes.end(); i++)
     {
@@ -31,7 +31,12 @@
 #include <cstdlib>
 #include <sstream>
 #include <iomanip>
+#include <set>
+#include <map>
 #include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Profiler.hpp"
+#include "geoutils/Polygon3.hpp"
+#include "geoutils/Mesh.hpp"
 
 using namespace std;
 using namespace Ionflux::ObjectBase;
@@ -65,7 +70,7 @@ const TransformNodeClassInfo TransformNode::transformNodeClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* TransformNode::CLASS_INFO = &TransformNode::transformNodeClassInfo;
 
 TransformNode::TransformNode()
-: loopCounter(0), visited(false), debugMode(false), debugExpand(false), loopMax(DEFAULT_LOOP_MAX), maxNumInputs(DEFAULT_MAX_NUM_INPUTS), updateCounter(0)
+: loopCounter(0), visited(false), debugMode(false), debugExpand(false), lastParamVersion(0), loopMax(DEFAULT_LOOP_MAX), maxNumInputs(DEFAULT_MAX_NUM_INPUTS), updateCounter(0), scheduled(false), pendingConsumers(0), paramVersion(0), profiler(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -73,7 +78,7 @@ TransformNode::TransformNode()
 }
 
 TransformNode::TransformNode(const Ionflux::GeoUtils::TransformNodes::TransformNode& other)
-: loopCounter(0), visited(false), debugMode(false), debugExpand(false), loopMax(DEFAULT_LOOP_MAX), maxNumInputs(DEFAULT_MAX_NUM_INPUTS), updateCounter(0)
+: loopCounter(0), visited(false), debugMode(false), debugExpand(false), lastParamVersion(0), loopMax(DEFAULT_LOOP_MAX), maxNumInputs(DEFAULT_MAX_NUM_INPUTS), updateCounter(0), scheduled(false), pendingConsumers(0), paramVersion(0), profiler(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -82,8 +87,9 @@ TransformNode::TransformNode(const Ionflux::GeoUtils::TransformNodes::TransformN
 
 TransformNode::TransformNode(const Ionflux::ObjectBase::IFObjectID& nodeID)
 : loopCounter(0), visited(false), debugMode(false), debugExpand(false), 
-loopMax(DEFAULT_LOOP_MAX), maxNumInputs(DEFAULT_MAX_NUM_INPUTS), 
-updateCounter(0)
+lastParamVersion(0), loopMax(DEFAULT_LOOP_MAX), 
+maxNumInputs(DEFAULT_MAX_NUM_INPUTS), updateCounter(0), scheduled(false), 
+pendingConsumers(0), paramVersion(0), profiler(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -94,7 +100,9 @@ TransformNode::~TransformNode()
 {
 	clearInputs();
 	clearOutputs();
-	// TODO: Nothing ATM. ;-)
+	// Profiles are keyed by node, so the address must not be reused.
+	if (profiler != 0)
+	    profiler->removeNode(this);
 }
 
 void TransformNode::process()
@@ -102,6 +110,80 @@ void TransformNode::process()
 	// TODO: Implementation.
 }
 
+void TransformNode::updateVersions()
+{
+	lastParamVersion = paramVersion;
+	lastInputs = inputs;
+	lastInputVersions.clear();
+	for (InputNodeSpecVector::const_iterator i = inputs.begin(); 
+	    i != inputs.end(); i++)
+	{
+	    if ((*i).node != 0)
+	        lastInputVersions.push_back((*i).node->getUpdateCounter());
+	    else
+	        lastInputVersions.push_back(0);
+	}
+}
+
+unsigned int TransformNode::getNumInputItems() const
+{
+	unsigned int result = 0;
+	for (TransformableGroupVector::const_iterator i = inputCache.begin(); 
+	    i != inputCache.end(); i++)
+	{
+	    if (*i != 0)
+	        result += (*i)->getNumItems();
+	}
+	return result;
+}
+
+pthread_mutex_t* TransformNode::getCopyMutex()
+{
+	static pthread_mutex_t copyMutex = PTHREAD_MUTEX_INITIALIZER;
+	return &copyMutex;
+}
+
+Ionflux::GeoUtils::TransformableGroup*
+TransformNode::duplicateInput(Ionflux::GeoUtils::TransformableGroup&
+group)
+{
+	if (!scheduled)
+	    return &(group.duplicate());
+	pthread_mutex_t* m0 = getCopyMutex();
+	pthread_mutex_lock(m0);
+	TransformableGroup* result = 0;
+	try
+	{
+	    result = &(group.duplicate());
+	    copyItemVertices(*result);
+	} catch (...)
+	{
+	    pthread_mutex_unlock(m0);
+	    throw;
+	}
+	pthread_mutex_unlock(m0);
+	return result;
+}
+
+void
+TransformNode::copyItemVertices(Ionflux::GeoUtils::TransformableGroup&
+group)
+{
+	TransformableGroup g0;
+	group.getLeafItems(g0);
+	for (unsigned int i = 0; i < g0.getNumItems(); i++)
+	{
+	    TransformableObject* it0 = g0.getItem(i);
+	    Polygon3* p0 = Polygon3::upcast(it0);
+	    Mesh* m0 = Mesh::upcast(it0);
+	    if (p0 != 0)
+	        p0->copyVertices();
+	    else
+	    if (m0 != 0)
+	        m0->copyVertices();
+	}
+}
+
 void TransformNode::addInputs(const Ionflux::GeoUtils::InputNodeSpecVector&
 newInputs)
 {
@@ -146,6 +228,12 @@ inputID)
 
 void TransformNode::clearInputCache()
 {
+	pthread_mutex_t* m0 = 0;
+	if (scheduled)
+	{
+	    m0 = getCopyMutex();
+	    pthread_mutex_lock(m0);
+	}
 	for (TransformableGroupVector::iterator i = 
 	    inputCache.begin(); i != inputCache.end(); i++)
 	{
@@ -154,6 +242,8 @@ void TransformNode::clearInputCache()
 	        removeLocalRef(g0);
 	}
 	inputCache.clear();
+	if (m0 != 0)
+	    pthread_mutex_unlock(m0);
 }
 
 void TransformNode::updateInputs()
@@ -178,10 +268,12 @@ void TransformNode::updateInputs()
 	    message << "updating node: " << (*(*j));
 	    log(IFLogMessage(message.str(), VL_DEBUG, this, "updateInputs"));
 	    // ----- DEBUG ----> */
-	    (*j)->update();
+	    if (!scheduled)
+	        (*j)->update();
 	}
 	// Populate the input cache.
 	clearInputCache();
+	std::map<TransformableGroup*, TransformableGroup*> dm0;
 	for (InputNodeSpecVector::iterator k = inputs.begin(); 
 	    k != inputs.end(); k++)
 	{
@@ -208,6 +300,20 @@ void TransformNode::updateInputs()
 	            << n0->getNumOutputs() << ").";
 	        throw GeoUtilsError(message.str());
 	    }
+	    if (n0->getPendingConsumers() > 1)
+	    {
+	        /* Other consumers still need the output group, so this node 
+	           gets a copy of its own. */
+	        std::map<TransformableGroup*, TransformableGroup*>::iterator 
+	            m = dm0.find(g0);
+	        if (m == dm0.end())
+	        {
+	            TransformableGroup* g1 = duplicateInput(*g0);
+	            dm0[g0] = g1;
+	            g0 = g1;
+	        } else
+	            g0 = (*m).second;
+	    }
 	    addLocalRef(g0);
 	    inputCache.push_back(g0);
 	}
@@ -225,7 +331,10 @@ void TransformNode::clearInputGroups()
 	}
 	for (std::set<TransformNode*>::iterator j = is0.begin(); 
 	    j != is0.end(); j++)
-	    (*j)->clearOutputs();
+	{
+	    if ((*j)->getPendingConsumers() <= 1)
+	        (*j)->clearOutputs();
+	}
 }
 
 void TransformNode::cleanup()
@@ -238,48 +347,36 @@ void TransformNode::update()
 	if (loopCounter >= loopMax)
 	    throw GeoUtilsError("Maximum number of loop iterations exceeded.");
 	loopCounter++;
-	/* <---- DEBUG ----- //
-	Ionflux::GeoUtils::Clock c0;
-	double inputUpdateTime = 0.;
-	double outputClearTime = 0.;
-	double processingTime = 0.;
-	c0.start();
-	// ----- DEBUG ----> */
-	updateInputs();
-	// NOTE: This can be enabled when all nodes use the input cache.
-	//clearInputGroups();
-	/* <---- DEBUG ----- //
-	c0.stop();
-	inputUpdateTime = c0.getElapsedTime();
-	c0.start();
-	// ----- DEBUG ----> */
-	clearOutputs();
-	/* <---- DEBUG ----- //
-	c0.stop();
-	outputClearTime = c0.getElapsedTime();
-	c0.start();
-	// ----- DEBUG ----> */
-	/* <---- DEBUG ----- //
-	log(IFLogMessage("Processing...", VL_DEBUG, this, "update"));
-	// ----- DEBUG ----> */
-	process();
-	/* <---- DEBUG ----- //
-	log(IFLogMessage("Finished.", VL_DEBUG, this, "update"));
-	// ----- DEBUG ----> */
-	/* <---- DEBUG ----- //
-	c0.stop();
-	processingTime = c0.getElapsedTime();
-	std::ostringstream message;
-	message << "inputUpdateTime = " << inputUpdateTime 
-	    << ", outputClearTime = " << outputClearTime 
-	    << ", processingTime = " << processingTime << " secs";
-	log(IFLogMessage(message.str(), VL_DEBUG, this, "update"));
-	// ----- DEBUG ----> */
+	if (profiler != 0)
+	    profiler->begin(this);
+	try
+	{
+	    updateInputs();
+	    // NOTE: This can be enabled when all nodes use the input cache.
+	    //clearInputGroups();
+	    clearOutputs();
+	    /* <---- DEBUG ----- //
+	    log(IFLogMessage("Processing...", VL_DEBUG, this, "update"));
+	    // ----- DEBUG ----> */
+	    process();
+	    /* <---- DEBUG ----- //
+	    log(IFLogMessage("Finished.", VL_DEBUG, this, "update"));
+	    // ----- DEBUG ----> */
+	} catch (...)
+	{
+	    // Close the profiler event so the event stack stays consistent.
+	    if (profiler != 0)
+	        profiler->end(this, getNumInputItems());
+	    throw;
+	}
+	updateVersions();
 	updateCounter++;
 	loopCounter = 0;
 	if (debugMode)
 	    log(IFLogMessage(getDebugInfo(debugExpand), VL_DEBUG, 
 	        this, "update"));
+	if (profiler != 0)
+	    profiler->end(this, getNumInputItems());
 	cleanup();
 }
 
@@ -290,6 +387,70 @@ std::string TransformNode::getString() const
 	return status.str();
 }
 
+bool TransformNode::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return true;
+}
+
+bool TransformNode::sharesItems() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
+Ionflux::GeoUtils::TransformNodes::TransformNode*
+TransformNode::createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap)
+const
+{
+	TransformNode* result = copy();
+	nodeMap[const_cast<TransformNode*>(this)] = result;
+	result->remapInputs(nodeMap);
+	return result;
+}
+
+void TransformNode::remapInputs(const
+Ionflux::GeoUtils::TransformNodeMap& nodeMap)
+{
+	for (InputNodeSpecVector::iterator i = inputs.begin(); 
+	    i != inputs.end(); i++)
+	{
+	    TransformNodeMap::const_iterator j = nodeMap.find((*i).node);
+	    if (j != nodeMap.end())
+	        (*i).node = (*j).second;
+	}
+}
+
+void TransformNode::touch()
+{
+	paramVersion++;
+}
+
+bool TransformNode::isDirty() const
+{
+	bool result = (updateCounter == 0) 
+	    || (outputs.size() == 0) 
+	    || (paramVersion != lastParamVersion) 
+	    || (inputs.size() != lastInputs.size()) 
+	    || (inputs.size() != lastInputVersions.size());
+	for (unsigned int i = 0; !result && (i < inputs.size()); i++)
+	{
+	    const InputNodeSpec& i0 = inputs[i];
+	    const InputNodeSpec& i1 = lastInputs[i];
+	    result = (i0.node == 0) 
+	        || (i0.node != i1.node) 
+	        || (i0.outputID != i1.outputID) 
+	        || (i0.node->getUpdateCounter() != lastInputVersions[i]);
+	}
+	return result;
+}
+
+unsigned int TransformNode::getTotalParamVersion() const
+{
+	// TODO: Implementation.
+	return paramVersion;
+}
+
 std::string TransformNode::getDebugInfo(bool expand)
 {
 	ostringstream result;
@@ -552,6 +713,58 @@ unsigned int TransformNode::getUpdateCounter() const
     return updateCounter;
 }
 
+void TransformNode::setScheduled(bool newScheduled)
+{
+	scheduled = newScheduled;
+}
+
+bool TransformNode::getScheduled() const
+{
+    return scheduled;
+}
+
+void TransformNode::setPendingConsumers(unsigned int newPendingConsumers)
+{
+	pendingConsumers = newPendingConsumers;
+}
+
+unsigned int TransformNode::getPendingConsumers() const
+{
+    return pendingConsumers;
+}
+
+void TransformNode::setParamVersion(unsigned int newParamVersion)
+{
+	paramVersion = newParamVersion;
+}
+
+unsigned int TransformNode::getParamVersion() const
+{
+    return paramVersion;
+}
+
+void 
+TransformNode::setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler* 
+newProfiler)
+{
+	if (profiler == newProfiler)
+	    return;
+	if (newProfiler != 0)
+	    addLocalRef(newProfiler);
+	if (profiler != 0)
+	{
+	    profiler->removeNode(this);
+	    removeLocalRef(profiler);
+	}
+	profiler = newProfiler;
+}
+
+Ionflux::GeoUtils::TransformNodes::Profiler* TransformNode::getProfiler() 
+const
+{
+    return profiler;
+}
+
 Ionflux::GeoUtils::TransformNodes::TransformNode& 
 TransformNode::operator=(const 
 Ionflux::GeoUtils::TransformNodes::TransformNode& other)
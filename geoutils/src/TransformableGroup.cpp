@@ -82,8 +82,8 @@ TransformableGroup::TransformableGroup(const Ionflux::GeoUtils::TransformableGro
 
 TransformableGroup::~TransformableGroup()
 {
+	releaseSharedItems();
 	clearItems();
-	// TODO: Nothing ATM. ;-)
 }
 
 void TransformableGroup::recalculateBounds()
@@ -93,8 +93,9 @@ void TransformableGroup::recalculateBounds()
 	TransformableGroup* g1 = 0;
 	if (useTransform() || useVI())
 	{
-	    // Adjust for transformation.
-	    g1 = copy();
+	    /* Adjust for transformation. Using an instance here avoids 
+	       copying items that are not affected by the transformation. */
+	    g1 = &(instance());
 	    addLocalRef(g1);
 	    g1->applyTransform();
 	    g0 = g1;
@@ -118,14 +119,54 @@ void TransformableGroup::recalculateBounds()
 	    removeLocalRef(g1);
 }
 
+void TransformableGroup::releaseSharedItems()
+{
+	for (unsigned int i = 0; i < items.size(); i++)
+	{
+	    SharedItemMap::iterator j = sharedItems.find(items[i]);
+	    if ((j == sharedItems.end()) 
+	        || ((*j).second == 0))
+	        continue;
+	    (*j).second--;
+	    items[i]->removeShare();
+	}
+	sharedItems.clear();
+}
+
+void
+TransformableGroup::releaseSharedItem(Ionflux::GeoUtils::TransformableObject*
+item)
+{
+	SharedItemMap::iterator j = sharedItems.find(item);
+	if (j == sharedItems.end())
+	    return;
+	unsigned int n = 0;
+	for (unsigned int i = 0; i < items.size(); i++)
+	{
+	    if (items[i] == item)
+	        n++;
+	}
+	while ((*j).second > n)
+	{
+	    (*j).second--;
+	    item->removeShare();
+	}
+	if ((*j).second == 0)
+	    sharedItems.erase(j);
+}
+
 void TransformableGroup::clear()
 {
+	releaseSharedItems();
 	clearItems();
 	TransformableObject::clear();
 }
 
 void TransformableGroup::applyTransform(bool recursive)
 {
+	/* The items are going to be modified, so any items shared with 
+	   other instances must be copied first. */
+	detachItems();
 	Ionflux::GeoUtils::applyTransform(*this, items, 
 	    recursive, "Transformable object");
 }
@@ -203,12 +244,119 @@ const Ionflux::GeoUtils::Matrix4* image)
 	return *this;
 }
 
+void TransformableGroup::transformItems(const
+Ionflux::GeoUtils::InstanceTransforms& transforms)
+{
+	unsigned int n = items.size();
+	if ((transforms.offsetX.size() < n) 
+	    || (transforms.offsetY.size() < n) 
+	    || (transforms.offsetZ.size() < n))
+	    throw GeoUtilsError("Not enough instance offsets.");
+	bool useScale = (transforms.scaleX.size() > 0);
+	if (useScale 
+	    && ((transforms.scaleX.size() < n) 
+	        || (transforms.scaleY.size() < n) 
+	        || (transforms.scaleZ.size() < n) 
+	        || (transforms.centerX.size() < n) 
+	        || (transforms.centerY.size() < n) 
+	        || (transforms.centerZ.size() < n)))
+	    throw GeoUtilsError("Not enough instance scale factors or centers.");
+	// Shared items must not be affected by the transformations.
+	detachItems();
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    TransformableObject* it0 = 
+	        Ionflux::ObjectBase::nullPointerCheck(items[i], this, 
+	            "transformItems", "Transformable object");
+	    double tx = transforms.offsetX[i];
+	    double ty = transforms.offsetY[i];
+	    double tz = transforms.offsetZ[i];
+	    if (!useScale)
+	    {
+	        it0->transform(Matrix4::translate(tx, ty, tz));
+	        continue;
+	    }
+	    double sx = transforms.scaleX[i];
+	    double sy = transforms.scaleY[i];
+	    double sz = transforms.scaleZ[i];
+	    double cx = transforms.centerX[i];
+	    double cy = transforms.centerY[i];
+	    double cz = transforms.centerZ[i];
+	    it0->transform(Matrix4(sx, 0., 0., cx - sx * cx + tx, 
+	        0., sy, 0., cy - sy * cy + ty, 
+	        0., 0., sz, cz - sz * cz + tz, 
+	        0., 0., 0., 1.));
+	}
+}
+
 Ionflux::GeoUtils::TransformableGroup& TransformableGroup::duplicate()
 {
 	// TODO: Implementation.
 	return *copy();
 }
 
+Ionflux::GeoUtils::TransformableGroup& TransformableGroup::instance()
+{
+	TransformableGroup* g0 = create();
+	// Keep group transformations.
+	g0->copyTransform(*this);
+	for (unsigned int i = 0; i < items.size(); i++)
+	    g0->addSharedItem(items[i]);
+	return *g0;
+}
+
+void
+TransformableGroup::addSharedItem(Ionflux::GeoUtils::TransformableObject*
+addElement)
+{
+	Ionflux::ObjectBase::nullPointerCheck(addElement, this, 
+	    "addSharedItem", "Transformable object");
+	addItem(addElement);
+	addElement->addShare();
+	sharedItems[addElement]++;
+}
+
+unsigned int TransformableGroup::detachItems()
+{
+	unsigned int result = 0;
+	for (unsigned int i = 0; i < items.size(); i++)
+	{
+	    TransformableObject* it0 = 
+	        Ionflux::ObjectBase::nullPointerCheck(items[i], this, 
+	            "detachItems", "Transformable object");
+	    SharedItemMap::iterator j = sharedItems.find(it0);
+	    bool s0 = (j != sharedItems.end()) 
+	        && ((*j).second > 0);
+	    if (!s0 
+	        && (it0->getNumShares() == 0))
+	        continue;
+	    TransformableObject* it1 = 0;
+	    TransformableGroup* g0 = upcast(it0);
+	    if (g0 != 0)
+	        it1 = &(g0->instance());
+	    else
+	        it1 = it0->copy();
+	    addLocalRef(it1);
+	    items[i] = it1;
+	    if (s0)
+	    {
+	        (*j).second--;
+	        it0->removeShare();
+	    }
+	    removeLocalRef(it0);
+	    result++;
+	}
+	// Release any shares that are not attached to an item.
+	for (SharedItemMap::iterator j = sharedItems.begin(); 
+	    j != sharedItems.end(); j++)
+	{
+	    for (unsigned int k = 0; k < (*j).second; k++)
+	        (*j).first->removeShare();
+	}
+	sharedItems.clear();
+	return result;
+}
+
 Ionflux::GeoUtils::TransformableGroup& TransformableGroup::flatten()
 {
 	TransformableGroup g0;
@@ -418,7 +566,10 @@ removeElement)
 	{
 		items.erase(items.begin() + i);
 		if (currentItem != 0)
+		{
+			releaseSharedItem(currentItem);
 			removeLocalRef(currentItem);
+		}
 	}
 }
 
@@ -429,11 +580,15 @@ void TransformableGroup::removeItemIndex(unsigned int removeIndex)
 	Ionflux::GeoUtils::TransformableObject* e0 = items[removeIndex];
     items.erase(items.begin() + removeIndex);
     if (e0 != 0)
+    {
+        releaseSharedItem(e0);
         removeLocalRef(e0);
+    }
 }
 
 void TransformableGroup::clearItems()
 {
+    releaseSharedItems();
     std::vector<Ionflux::GeoUtils::TransformableObject*>::iterator i;
 	for (i = items.begin(); i != items.end(); i++)
 		if (*i != 0)
@@ -456,6 +611,7 @@ Ionflux::GeoUtils::TransformableGroup& other)
                 "operator=", "Transformable object");
         v0.push_back(ot0->copy());
     }
+    releaseSharedItems();
     clearItems();
     addItems(v0);
 	return *this;
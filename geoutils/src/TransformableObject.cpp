@@ -66,7 +66,7 @@ const Ionflux::ObjectBase::IFClassInfo* TransformableObject::CLASS_INFO = &Trans
 const std::string TransformableObject::XML_ELEMENT_NAME = "transformable_object";
 
 TransformableObject::TransformableObject()
-: boundsCache(0), deferredTransform(0)
+: boundsCache(0), numShares(0), deferredTransform(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -74,7 +74,7 @@ TransformableObject::TransformableObject()
 }
 
 TransformableObject::TransformableObject(const Ionflux::GeoUtils::TransformableObject& other)
-: boundsCache(0), deferredTransform(0)
+: boundsCache(0), numShares(0), deferredTransform(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -326,6 +326,23 @@ Ionflux::GeoUtils::TransformableObject& TransformableObject::duplicate()
 	return *copy();
 }
 
+void TransformableObject::addShare()
+{
+	numShares++;
+}
+
+void TransformableObject::removeShare()
+{
+	if (numShares > 0)
+	    numShares--;
+}
+
+unsigned int TransformableObject::getNumShares() const
+{
+	// TODO: Implementation.
+	return numShares;
+}
+
 Ionflux::GeoUtils::Matrix4* TransformableObject::getTransformMatrix() const
 {
 	Ionflux::ObjectBase::nullPointerCheck(
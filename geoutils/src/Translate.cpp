@@ -159,9 +159,16 @@ std::string Translate::getString() const
 	return status.str();
 }
 
+bool Translate::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return (indexFunc == 0) && (distanceFunc == 0);
+}
+
 void Translate::setOffset(const Ionflux::GeoUtils::Vector3& newOffset)
 {
 	offset = newOffset;
+	touch();
 }
 
 Ionflux::GeoUtils::Vector3 Translate::getOffset() const
@@ -173,12 +180,13 @@ void Translate::setIndexFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newIndexFunc)
 {
 	if (indexFunc == newIndexFunc)
-		return;
-    if (newIndexFunc != 0)
-        addLocalRef(newIndexFunc);
+	    return;
+	if (newIndexFunc != 0)
+	    addLocalRef(newIndexFunc);
 	if (indexFunc != 0)
-		removeLocalRef(indexFunc);
+	    removeLocalRef(indexFunc);
 	indexFunc = newIndexFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* Translate::getIndexFunc() const
@@ -190,12 +198,13 @@ void Translate::setDistanceFunc(Ionflux::GeoUtils::Mapping::Vector3Mapping*
 newDistanceFunc)
 {
 	if (distanceFunc == newDistanceFunc)
-		return;
-    if (newDistanceFunc != 0)
-        addLocalRef(newDistanceFunc);
+	    return;
+	if (newDistanceFunc != 0)
+	    addLocalRef(newDistanceFunc);
 	if (distanceFunc != 0)
-		removeLocalRef(distanceFunc);
+	    removeLocalRef(distanceFunc);
 	distanceFunc = newDistanceFunc;
+	touch();
 }
 
 Ionflux::GeoUtils::Mapping::Vector3Mapping* Translate::getDistanceFunc() 
@@ -208,6 +217,7 @@ Ionflux::GeoUtils::TransformNodes::Translate& Translate::operator=(const
 Ionflux::GeoUtils::TransformNodes::Translate& other)
 {
     TransformNode::operator=(other);
+    offset = other.offset;
     setIndexFunc(other.indexFunc);
     setDistanceFunc(other.distanceFunc);
 	return *this;
@@ -94,6 +94,25 @@ std::string Vector3Mapping::getString() const
 	return status.str();
 }
 
+void Vector3Mapping::callBatch(const
+Ionflux::Mapping::MappingValueVector& values,
+Ionflux::ObjectBase::DoubleVector& targetX,
+Ionflux::ObjectBase::DoubleVector& targetY,
+Ionflux::ObjectBase::DoubleVector& targetZ) const
+{
+	unsigned int n = values.size();
+	targetX.resize(n);
+	targetY.resize(n);
+	targetZ.resize(n);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    Vector3 v0(call(values[i]));
+	    targetX[i] = v0[0];
+	    targetY[i] = v0[1];
+	    targetZ[i] = v0[2];
+	}
+}
+
 Ionflux::GeoUtils::Mapping::Vector3Mapping& Vector3Mapping::operator=(const
 Ionflux::GeoUtils::Mapping::Vector3Mapping& other)
 {
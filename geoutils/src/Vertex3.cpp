@@ -34,6 +34,7 @@
 #include "geoutils/LinearInterpolator.hpp"
 #include "geoutils/Plane3.hpp"
 #include "geoutils/Vector4.hpp"
+#include "geoutils/vecmath.hpp"
 #include "ifobject/utils.hpp"
 #include "ifobject/xmlutils.hpp"
 #include "ifobject/xmlutils_private.hpp"
@@ -360,21 +361,19 @@ void Vertex3::applyTransform(bool recursive)
 Ionflux::GeoUtils::Vertex3& Vertex3::transform(const 
 Ionflux::GeoUtils::Matrix4& matrix)
 {
-	Vector4 t0(getVector());
-	t0 = matrix * t0;
-	setCoords(t0.getV3());
+	Vec4 t0(Mat4(matrix) * Vec4(x, y, z, 1.));
+	setCoords(t0[0], t0[1], t0[2]);
 	return *this;
 }
 
 Ionflux::GeoUtils::Vertex3& Vertex3::transformVI(const 
 Ionflux::GeoUtils::Matrix4& view, const Ionflux::GeoUtils::Matrix4* image)
 {
-	Vector4 t0(getVector());
-	t0 = view * t0;
+	Vec4 t0(Mat4(view) * Vec4(x, y, z, 1.));
 	t0 = t0 / t0[3];
 	if (image != 0)
-	    t0 = (*image) * t0;
-	setCoords(t0.getV3());
+	    t0 = Mat4(*image) * t0;
+	setCoords(t0[0], t0[1], t0[2]);
 	return *this;
 }
 
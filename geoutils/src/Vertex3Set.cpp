@@ -178,8 +178,38 @@ Ionflux::GeoUtils::Vector3 Vertex3Set::getBarycenter()
 
 void Vertex3Set::applyTransform(bool recursive)
 {
-	Ionflux::GeoUtils::applyTransform(*this, vertices, 
-	    recursive, "Vertex");
+	if (!recursive 
+	    && !useTransform() 
+	    && !useVI())
+	{
+	    clearTransformations();
+	    return;
+	}
+	/* Transform the vertex coordinates in a batch. This is equivalent to 
+	   Vertex3::transform() and Vertex3::transformVI(), applied to each 
+	   vertex in turn. */
+	Matrix4* tm0 = 0;
+	Matrix4* vm0 = 0;
+	Matrix4* im0 = 0;
+	if (useTransform())
+	    tm0 = getTransformMatrix();
+	if (useVI())
+	{
+	    vm0 = getViewMatrix();
+	    im0 = getImageMatrix();
+	}
+	Ionflux::GeoUtils::transformVertices(vertices, tm0, vm0, im0);
+	if (recursive)
+	{
+	    for (Vertex3Vector::iterator i = vertices.begin(); 
+	        i != vertices.end(); i++)
+	    {
+	        Vertex3* vt0 = Ionflux::ObjectBase::nullPointerCheck(
+	            *i, this, "applyTransform", "Vertex");
+	        vt0->applyTransform(recursive);
+	    }
+	}
+	clearTransformations();
 }
 
 Ionflux::GeoUtils::Vertex3Set& Vertex3Set::scale(const 
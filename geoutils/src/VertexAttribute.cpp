@@ -41,6 +41,7 @@
 #include "geoutils/VectorSet.hpp"
 #include "geoutils/Vector.hpp"
 #include "geoutils/Face.hpp"
+#include "geoutils/CompactMesh.hpp"
 #include "geoutils/glutils.hpp"
 #include "geoutils/glutils_private.hpp"
 
@@ -68,13 +69,14 @@ const Ionflux::GeoUtils::VertexAttributeTypeID VertexAttribute::TYPE_UNDEFINED =
 const Ionflux::GeoUtils::VertexAttributeTypeID VertexAttribute::TYPE_POSITION = 1;
 const Ionflux::GeoUtils::VertexAttributeTypeID VertexAttribute::TYPE_DATA = 2;
 const Ionflux::GeoUtils::VertexAttributeTypeID VertexAttribute::TYPE_INDEX = 3;
+const Ionflux::GeoUtils::VertexAttributeTypeID VertexAttribute::TYPE_NORMAL = 4;
 
 // run-time type information instance constants
 const VertexAttributeClassInfo VertexAttribute::vertexAttributeClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* VertexAttribute::CLASS_INFO = &VertexAttribute::vertexAttributeClassInfo;
 
 VertexAttribute::VertexAttribute()
-: data(0), dataSize(0), dataType(0), bufferImpl(0), numElements(0), elementSize(0), normalized(false)
+: numBufferRefs(0), data(0), dataSize(0), dataType(0), bufferImpl(0), numElements(0), elementSize(0), normalized(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -82,7 +84,7 @@ VertexAttribute::VertexAttribute()
 }
 
 VertexAttribute::VertexAttribute(const Ionflux::GeoUtils::VertexAttribute& other)
-: data(0), dataSize(0), dataType(0), bufferImpl(0), numElements(0), elementSize(0), normalized(false)
+: numBufferRefs(0), data(0), dataSize(0), dataType(0), bufferImpl(0), numElements(0), elementSize(0), normalized(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -94,6 +96,17 @@ VertexAttribute::~VertexAttribute()
 	cleanup();
 }
 
+void VertexAttribute::checkBufferRefs(const std::string& source) const
+{
+	if (numBufferRefs > 0)
+	{
+	    std::ostringstream status;
+	    status << "Data is referenced by " << numBufferRefs 
+	        << " exported buffer(s).";
+	    throw GeoUtilsError(getErrorString(status.str(), source));
+	}
+}
+
 GLenum VertexAttribute::getOpenGLTarget()
 {
 	if (dataType == DATA_TYPE_FLOAT)
@@ -337,6 +350,7 @@ void VertexAttribute::cleanupData()
 {
 	if (data != 0)
 	{
+	    checkBufferRefs("cleanupData");
 	    if (dataType == DATA_TYPE_FLOAT)
 	    {
 	        GLfloat* d0 = static_cast<GLfloat*>(data);
@@ -520,13 +534,75 @@ faceDataType)
 	}
 	if ((attrType != TYPE_POSITION) 
 	    && (attrType != TYPE_DATA) 
-	    && (attrType != TYPE_INDEX))
+	    && (attrType != TYPE_INDEX) 
+	    && (attrType != TYPE_NORMAL))
 	{
 	    std::ostringstream status;
 	    status << "Invalid vertex attribute type: " << attrType;
 	    throw GeoUtilsError(getErrorString(
 	        status.str(), "setData"));
 	}
+	if (attrType == TYPE_NORMAL)
+	{
+	    /* face normals (from the face geometry of the mesh), one for each 
+	       face vertex, in the same order as the vertex positions */
+	    if (nFaceType != Ionflux::GeoUtils::NFace::TYPE_FACE)
+	    {
+	        throw GeoUtilsError(getErrorString(
+	            "Normals are only available for faces.", "setData"));
+	    }
+	    unsigned int numFaces = mesh.getNumFaces();
+	    if (numFaces == 0)
+	        return 0;
+	    const double* n0 = mesh.getFaceNormalData();
+	    if (n0 == 0)
+	    {
+	        throw GeoUtilsError(getErrorString(
+	            "Face geometry not available (mesh needs to be updated).", 
+	            "setData"));
+	    }
+	    unsigned int numAttr = 0;
+	    unsigned int nv0 = 0;
+	    for (unsigned int i = 0; i < numFaces; i++)
+	    {
+	        Face* f0 = mesh.getFace(i);
+	        if (f0 == 0)
+	            continue;
+	        unsigned int nv1 = f0->getNumVertices();
+	        if (numAttr == 0)
+	            nv0 = nv1;
+	        else
+	        if (nv0 != nv1)
+	        {
+	            std::ostringstream status;
+	            status << "Inconsistent vertex count (type = " 
+	                << Ionflux::GeoUtils::NFace::getNFaceTypeIDString(
+	                    nFaceType) << ", N-face = " << i << ", nv0 = " 
+	                << nv0 << ", nv1 = " << nv1 << ")";
+	            throw GeoUtilsError(getErrorString(
+	                status.str(), "setData"));
+	        }
+	        numAttr += nv1;
+	    }
+	    if (numAttr == 0)
+	        return 0;
+	    allocate(numAttr, 3, DATA_TYPE_FLOAT);
+	    GLfloat* d0 = static_cast<GLfloat*>(data);
+	    for (unsigned int i = 0; i < numFaces; i++)
+	    {
+	        if (mesh.getFace(i) == 0)
+	            continue;
+	        const double* c0 = &(n0[3 * i]);
+	        for (unsigned int k = 0; k < nv0; k++)
+	        {
+	            d0[0] = c0[0];
+	            d0[1] = c0[1];
+	            d0[2] = c0[2];
+	            d0 += 3;
+	        }
+	    }
+	    return numAttr;
+	}
 	unsigned int numNFaces = mesh.getNumNFaces(nFaceType);
 	// <---- DEBUG ----- //
 	std::cerr << "[VertexAttribute::setData] DEBUG: "
@@ -613,6 +689,151 @@ faceDataType)
 	return numAttr;
 }
 
+unsigned int VertexAttribute::setData(const
+Ionflux::GeoUtils::CompactMesh& mesh,
+Ionflux::GeoUtils::VertexAttributeTypeID attrType,
+Ionflux::GeoUtils::NFaceTypeID nFaceType,
+Ionflux::GeoUtils::FaceDataTypeID faceDataType)
+{
+	const unsigned int* iv0 = 0;
+	unsigned int numAttr = 0;
+	if (nFaceType == Ionflux::GeoUtils::NFace::TYPE_FACE)
+	{
+	    if (!mesh.isTriMesh())
+	    {
+	        throw GeoUtilsError(getErrorString(
+	            "Mesh is not a tri-mesh.", "setData"));
+	    }
+	    iv0 = mesh.getIndexData();
+	    numAttr = mesh.getNumIndices();
+	} else
+	if (nFaceType == Ionflux::GeoUtils::NFace::TYPE_EDGE)
+	{
+	    iv0 = mesh.getEdgeIndexData();
+	    numAttr = 2 * mesh.getNumEdges();
+	} else
+	{
+	    std::ostringstream status;
+	    status << "Invalid N-face type: " << nFaceType;
+	    throw GeoUtilsError(getErrorString(
+	        status.str(), "setData"));
+	}
+	if ((attrType != TYPE_POSITION) 
+	    && (attrType != TYPE_DATA) 
+	    && (attrType != TYPE_INDEX) 
+	    && (attrType != TYPE_NORMAL))
+	{
+	    std::ostringstream status;
+	    status << "Invalid vertex attribute type: " << attrType;
+	    throw GeoUtilsError(getErrorString(
+	        status.str(), "setData"));
+	}
+	if ((attrType == TYPE_NORMAL) 
+	    && (nFaceType != Ionflux::GeoUtils::NFace::TYPE_FACE))
+	{
+	    throw GeoUtilsError(getErrorString(
+	        "Normals are only available for faces.", "setData"));
+	}
+	if (numAttr == 0)
+	    return 0;
+	if (attrType == TYPE_POSITION)
+	{
+	    // vertex position
+	    unsigned int numVerts = mesh.getNumVertices();
+	    const double* p0 = mesh.getPositionData();
+	    allocate(numAttr, 3, DATA_TYPE_FLOAT);
+	    GLfloat* d0 = static_cast<GLfloat*>(data);
+	    for (unsigned int i = 0; i < numAttr; i++)
+	    {
+	        if (iv0[i] >= numVerts)
+	        {
+	            std::ostringstream status;
+	            status << "Vertex index out of bounds: " << iv0[i];
+	            throw GeoUtilsError(getErrorString(
+	                status.str(), "setData"));
+	        }
+	        const double* c0 = &(p0[3 * iv0[i]]);
+	        d0[3 * i] = c0[0];
+	        d0[3 * i + 1] = c0[1];
+	        d0[3 * i + 2] = c0[2];
+	    }
+	} else
+	if (attrType == TYPE_DATA)
+	{
+	    // vertex data
+	    int ci = -1;
+	    if (nFaceType == Ionflux::GeoUtils::NFace::TYPE_FACE)
+	        ci = mesh.findChannel(faceDataType);
+	    if (ci < 0)
+	    {
+	        std::ostringstream status;
+	        status << "N-face data not set (type = " 
+	            << FaceData::getTypeIDString(faceDataType) 
+	            << "(" << faceDataType << "))";
+	        throw GeoUtilsError(getErrorString(
+	            status.str(), "setData"));
+	    }
+	    unsigned int nc = mesh.getChannelNumComponents(ci);
+	    unsigned int n0 = numAttr * nc;
+	    const double* c0 = mesh.getChannelData(ci);
+	    allocate(numAttr, nc, DATA_TYPE_FLOAT);
+	    GLfloat* d0 = static_cast<GLfloat*>(data);
+	    for (unsigned int i = 0; i < n0; i++)
+	        d0[i] = c0[i];
+	} else
+	if (attrType == TYPE_INDEX)
+	{
+	    // vertex indices
+	    allocate(numAttr, 1, DATA_TYPE_UINT);
+	    GLuint* d0 = static_cast<GLuint*>(data);
+	    for (unsigned int i = 0; i < numAttr; i++)
+	        d0[i] = iv0[i];
+	} else
+	if (attrType == TYPE_NORMAL)
+	{
+	    // face normals
+	    unsigned int numVerts = mesh.getNumVertices();
+	    const double* p0 = mesh.getPositionData();
+	    allocate(numAttr, 3, DATA_TYPE_FLOAT);
+	    GLfloat* d0 = static_cast<GLfloat*>(data);
+	    for (unsigned int i = 0; i < numAttr; i += 3)
+	    {
+	        const double* c0[3];
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            if (iv0[i + k] >= numVerts)
+	            {
+	                std::ostringstream status;
+	                status << "Vertex index out of bounds: " << iv0[i + k];
+	                throw GeoUtilsError(getErrorString(
+	                    status.str(), "setData"));
+	            }
+	            c0[k] = &(p0[3 * iv0[i + k]]);
+	        }
+	        double e1[3];
+	        double e2[3];
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            e1[k] = c0[1][k] - c0[0][k];
+	            e2[k] = c0[2][k] - c0[0][k];
+	        }
+	        double n0[3];
+	        n0[0] = e1[1] * e2[2] - e1[2] * e2[1];
+	        n0[1] = e1[2] * e2[0] - e1[0] * e2[2];
+	        n0[2] = e1[0] * e2[1] - e1[1] * e2[0];
+	        double l0 = ::sqrt(n0[0] * n0[0] + n0[1] * n0[1] + n0[2] * n0[2]);
+	        for (unsigned int k = 0; k < 3; k++)
+	        {
+	            GLfloat* t0 = &(d0[3 * (i + k)]);
+	            t0[0] = n0[0] / l0;
+	            t0[1] = n0[1] / l0;
+	            t0[2] = n0[2] / l0;
+	        }
+	    }
+	}
+	return numAttr;
+}
+
 float VertexAttribute::getFloat(unsigned int elementIndex, unsigned int 
 componentIndex)
 {
@@ -807,6 +1028,23 @@ unsigned int drawNumPrimitives, unsigned int startIndex)
 	}
 }
 
+void VertexAttribute::addBufferRef()
+{
+	numBufferRefs++;
+}
+
+void VertexAttribute::removeBufferRef()
+{
+	if (numBufferRefs > 0)
+	    numBufferRefs--;
+}
+
+unsigned int VertexAttribute::getNumBufferRefs() const
+{
+	// TODO: Implementation.
+	return numBufferRefs;
+}
+
 std::string VertexAttribute::getValueString() const
 {
 	std::ostringstream status;
@@ -832,6 +1070,9 @@ typeID)
 	else
 	if (typeID == TYPE_INDEX)
 	    return "index";
+	else
+	if (typeID == TYPE_NORMAL)
+	    return "normal";
 	return "<unknown>";
 }
 
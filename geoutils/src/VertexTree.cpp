@@ -0,0 +1,444 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * VertexTree.cpp                  Vertex tree (implementation).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+
+#include "geoutils/VertexTree.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <pthread.h>
+#include <unistd.h>
+#include "ifobject/objectutils.hpp"
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Vertex3.hpp"
+#include "geoutils/Vertex3Set.hpp"
+
+using namespace std;
+using namespace Ionflux::ObjectBase;
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+VertexTreeClassInfo::VertexTreeClassInfo()
+{
+	name = "VertexTree";
+	desc = "Vertex tree";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+VertexTreeClassInfo::~VertexTreeClassInfo()
+{
+}
+
+// run-time type information instance constants
+const VertexTreeClassInfo VertexTree::vertexTreeClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* VertexTree::CLASS_INFO = &VertexTree::vertexTreeClassInfo;
+
+VertexTree::VertexTree()
+: maxLeafVertices(Ionflux::GeoUtils::DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	// TODO: Nothing ATM. ;-)
+}
+
+VertexTree::VertexTree(const Ionflux::GeoUtils::VertexTree& other)
+: maxLeafVertices(Ionflux::GeoUtils::DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	*this = other;
+}
+
+VertexTree::~VertexTree()
+{
+	// TODO: Nothing ATM. ;-)
+}
+
+double VertexTree::getSquaredDistance(unsigned int vertexIndex, const
+double* p) const
+{
+	const double* c0 = &(coords[3 * vertexIndex]);
+	double dx = c0[0] - p[0];
+	double dy = c0[1] - p[1];
+	double dz = c0[2] - p[2];
+	return dx * dx + dy * dy + dz * dz;
+}
+
+void VertexTree::selectMedian(unsigned int first, unsigned int mid,
+unsigned int last, Ionflux::GeoUtils::AxisID axis)
+{
+	int l = first;
+	int r = last - 1;
+	int m = mid;
+	while (l < r)
+	{
+	    double x = coords[3 * indices[m] + axis];
+	    int i = l;
+	    int j = r;
+	    do
+	    {
+	        while (coords[3 * indices[i] + axis] < x)
+	            i++;
+	        while (x < coords[3 * indices[j] + axis])
+	            j--;
+	        if (i <= j)
+	        {
+	            unsigned int tmp = indices[i];
+	            indices[i] = indices[j];
+	            indices[j] = tmp;
+	            i++;
+	            j--;
+	        }
+	    } while (i <= j);
+	    if (j < m)
+	        l = i;
+	    if (m < i)
+	        r = j;
+	}
+}
+
+void VertexTree::buildRange(unsigned int first, unsigned int last,
+unsigned int parallelDepth)
+{
+	if ((last - first) <= maxLeafVertices)
+	    return;
+	double lower[3];
+	double upper[3];
+	for (unsigned int i = first; i < last; i++)
+	{
+	    const double* c0 = &(coords[3 * indices[i]]);
+	    for (unsigned int k = 0; k < 3; k++)
+	    {
+	        if ((i == first) || (c0[k] < lower[k]))
+	            lower[k] = c0[k];
+	        if ((i == first) || (c0[k] > upper[k]))
+	            upper[k] = c0[k];
+	    }
+	}
+	AxisID axis = AXIS_X;
+	for (unsigned int k = 1; k < 3; k++)
+	{
+	    if ((upper[k] - lower[k]) > (upper[axis] - lower[axis]))
+	        axis = k;
+	}
+	unsigned int mid = first + (last - first) / 2;
+	selectMedian(first, mid, last, axis);
+	splitAxes[mid] = axis;
+	unsigned int pd = 0;
+	if (parallelDepth > 0)
+	    pd = parallelDepth - 1;
+	VertexTreeBuildTask tasks[2];
+	for (unsigned int i = 0; i < 2; i++)
+	{
+	    tasks[i].tree = this;
+	    tasks[i].parallelDepth = pd;
+	    tasks[i].error = false;
+	}
+	tasks[0].first = first;
+	tasks[0].last = mid;
+	tasks[1].first = mid + 1;
+	tasks[1].last = last;
+	bool threaded = false;
+	pthread_t thread0;
+	if ((parallelDepth > 0) 
+	    && ((last - first) >= VERTEX_TREE_PARALLEL_MIN_VERTICES))
+	    threaded = (pthread_create(&thread0, 0, buildTask, 
+	        &(tasks[0])) == 0);
+	if (!threaded)
+	    buildTask(&(tasks[0]));
+	buildTask(&(tasks[1]));
+	if (threaded)
+	    pthread_join(thread0, 0);
+	for (unsigned int i = 0; i < 2; i++)
+	{
+	    if (tasks[i].error)
+	        throw GeoUtilsError(tasks[i].errorMessage);
+	}
+}
+
+void* VertexTree::buildTask(void* taskArg)
+{
+	VertexTreeBuildTask* t0 = static_cast<VertexTreeBuildTask*>(taskArg);
+	try
+	{
+	    t0->tree->buildRange(t0->first, t0->last, t0->parallelDepth);
+	} catch (std::exception& e)
+	{
+	    t0->error = true;
+	    t0->errorMessage = e.what();
+	}
+	return 0;
+}
+
+void VertexTree::addCandidate(unsigned int vertexIndex, const double* p,
+unsigned int k, Ionflux::GeoUtils::VertexTreeEntryVector& heap) const
+{
+	double d2 = getSquaredDistance(vertexIndex, p);
+	if (heap.size() < k)
+	{
+	    heap.push_back(VertexTreeEntry(d2, vertexIndex));
+	    std::push_heap(heap.begin(), heap.end());
+	} else
+	if (d2 < heap.front().first)
+	{
+	    std::pop_heap(heap.begin(), heap.end());
+	    heap.back() = VertexTreeEntry(d2, vertexIndex);
+	    std::push_heap(heap.begin(), heap.end());
+	}
+}
+
+void VertexTree::searchNearest(unsigned int first, unsigned int last,
+const double* p, unsigned int k, double f,
+Ionflux::GeoUtils::VertexTreeEntryVector& heap) const
+{
+	if ((last - first) <= maxLeafVertices)
+	{
+	    for (unsigned int i = first; i < last; i++)
+	        addCandidate(indices[i], p, k, heap);
+	    return;
+	}
+	unsigned int mid = first + (last - first) / 2;
+	addCandidate(indices[mid], p, k, heap);
+	double d = p[splitAxes[mid]] - coords[3 * indices[mid] + splitAxes[mid]];
+	if (d < 0.)
+	{
+	    searchNearest(first, mid, p, k, f, heap);
+	    if ((heap.size() < k) 
+	        || ((d * d * f) < heap.front().first))
+	        searchNearest(mid + 1, last, p, k, f, heap);
+	} else
+	{
+	    searchNearest(mid + 1, last, p, k, f, heap);
+	    if ((heap.size() < k) 
+	        || ((d * d * f) < heap.front().first))
+	        searchNearest(first, mid, p, k, f, heap);
+	}
+}
+
+void VertexTree::searchRadius(unsigned int first, unsigned int last,
+const double* p, double r2, Ionflux::ObjectBase::UIntVector& target,
+Ionflux::ObjectBase::DoubleVector* distances) const
+{
+	if ((last - first) <= maxLeafVertices)
+	{
+	    for (unsigned int i = first; i < last; i++)
+	    {
+	        double d2 = getSquaredDistance(indices[i], p);
+	        if (d2 > r2)
+	            continue;
+	        target.push_back(indices[i]);
+	        if (distances != 0)
+	            distances->push_back(::sqrt(d2));
+	    }
+	    return;
+	}
+	unsigned int mid = first + (last - first) / 2;
+	double d2 = getSquaredDistance(indices[mid], p);
+	if (d2 <= r2)
+	{
+	    target.push_back(indices[mid]);
+	    if (distances != 0)
+	        distances->push_back(::sqrt(d2));
+	}
+	double d = p[splitAxes[mid]] - coords[3 * indices[mid] + splitAxes[mid]];
+	if ((d <= 0.) 
+	    || ((d * d) <= r2))
+	    searchRadius(first, mid, p, r2, target, distances);
+	if ((d >= 0.) 
+	    || ((d * d) <= r2))
+	    searchRadius(mid + 1, last, p, r2, target, distances);
+}
+
+void VertexTree::clear()
+{
+	coords.clear();
+	indices.clear();
+	splitAxes.clear();
+}
+
+unsigned int VertexTree::update(Ionflux::GeoUtils::Vertex3Set* vertices,
+unsigned int newMaxLeafVertices, unsigned int numThreads)
+{
+	Ionflux::ObjectBase::nullPointerCheck(vertices, this, 
+	    "update", "Vertex set");
+	if (newMaxLeafVertices < 1)
+	    throw GeoUtilsError(getErrorString(
+	        "Maximum number of vertices per leaf must be at least 1.", 
+	        "update"));
+	clear();
+	maxLeafVertices = newMaxLeafVertices;
+	unsigned int n = vertices->getNumVertices();
+	coords.resize(3 * n);
+	indices.resize(n);
+	splitAxes.resize(n, AXIS_X);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    Vertex3* v0 = Ionflux::ObjectBase::nullPointerCheck(
+	        vertices->getVertex(i), this, "update", "Vertex");
+	    coords[3 * i] = v0->getX();
+	    coords[3 * i + 1] = v0->getY();
+	    coords[3 * i + 2] = v0->getZ();
+	    indices[i] = i;
+	}
+	if (numThreads == 0)
+	{
+	    long np = sysconf(_SC_NPROCESSORS_ONLN);
+	    if (np > 0)
+	        numThreads = np;
+	    else
+	        numThreads = 1;
+	}
+	unsigned int parallelDepth = 0;
+	while ((1U << parallelDepth) < numThreads)
+	    parallelDepth++;
+	buildRange(0, n, parallelDepth);
+	return n;
+}
+
+int VertexTree::findNearest(const Ionflux::GeoUtils::Vector3& p, double
+eps) const
+{
+	if (indices.size() == 0)
+	    return -1;
+	double p0[3] = { p.getX0(), p.getX1(), p.getX2() };
+	VertexTreeEntryVector heap;
+	heap.reserve(1);
+	searchNearest(0, indices.size(), p0, 1, (1. + eps) * (1. + eps), heap);
+	return heap[0].second;
+}
+
+unsigned int VertexTree::findKNearest(const Ionflux::GeoUtils::Vector3&
+p, unsigned int k, Ionflux::ObjectBase::UIntVector& target,
+Ionflux::ObjectBase::DoubleVector* distances, double eps) const
+{
+	if ((indices.size() == 0) 
+	    || (k == 0))
+	    return 0;
+	double p0[3] = { p.getX0(), p.getX1(), p.getX2() };
+	VertexTreeEntryVector heap;
+	heap.reserve(k);
+	searchNearest(0, indices.size(), p0, k, (1. + eps) * (1. + eps), heap);
+	std::sort_heap(heap.begin(), heap.end());
+	for (VertexTreeEntryVector::iterator i = heap.begin(); 
+	    i != heap.end(); i++)
+	{
+	    target.push_back((*i).second);
+	    if (distances != 0)
+	        distances->push_back(::sqrt((*i).first));
+	}
+	return heap.size();
+}
+
+unsigned int VertexTree::findInRadius(const Ionflux::GeoUtils::Vector3&
+p, double r, Ionflux::ObjectBase::UIntVector& target,
+Ionflux::ObjectBase::DoubleVector* distances) const
+{
+	if ((indices.size() == 0) 
+	    || (r < 0.))
+	    return 0;
+	unsigned int n0 = target.size();
+	double p0[3] = { p.getX0(), p.getX1(), p.getX2() };
+	searchRadius(0, indices.size(), p0, r * r, target, distances);
+	return target.size() - n0;
+}
+
+unsigned int VertexTree::getNumVertices() const
+{
+	// TODO: Implementation.
+	return indices.size();
+}
+
+unsigned int VertexTree::getMaxLeafVertices() const
+{
+	// TODO: Implementation.
+	return maxLeafVertices;
+}
+
+std::string VertexTree::getValueString() const
+{
+	ostringstream status;
+	status << "numVertices = " << indices.size() << ", maxLeafVertices = " 
+	    << maxLeafVertices;
+	return status.str();
+}
+
+Ionflux::GeoUtils::VertexTree& VertexTree::operator=(const 
+Ionflux::GeoUtils::VertexTree& other)
+{
+    if (this == &other)
+        return *this;
+    coords = other.coords;
+    indices = other.indices;
+    splitAxes = other.splitAxes;
+    maxLeafVertices = other.maxLeafVertices;
+	return *this;
+}
+
+Ionflux::GeoUtils::VertexTree* VertexTree::copy() const
+{
+    VertexTree* newVertexTree = create();
+    *newVertexTree = *this;
+    return newVertexTree;
+}
+
+Ionflux::GeoUtils::VertexTree* 
+VertexTree::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<VertexTree*>(other);
+}
+
+Ionflux::GeoUtils::VertexTree* 
+VertexTree::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    VertexTree* newObject = new VertexTree();
+    if (newObject == 0)
+    {
+        throw GeoUtilsError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int VertexTree::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+/** \file VertexTree.cpp
+ * \brief Vertex tree implementation.
+ */
@@ -154,6 +154,12 @@ std::string WritePNG::getString() const
 	return status.str();
 }
 
+bool WritePNG::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
 void WritePNG::addStyles(const Ionflux::GeoUtils::SVGShapeStyleVector& 
 newStyles)
 {
@@ -165,6 +171,7 @@ newStyles)
 void WritePNG::setFileName(const std::string& newFileName)
 {
 	fileName = newFileName;
+	touch();
 }
 
 std::string WritePNG::getFileName() const
@@ -217,6 +224,7 @@ std::vector<Ionflux::GeoUtils::SVGShapeStyle*>& WritePNG::getStyles()
 void WritePNG::addStyle(Ionflux::GeoUtils::SVGShapeStyle* addElement)
 {
 	styles.push_back(addElement);
+	touch();
 }
 
 void WritePNG::removeStyle(Ionflux::GeoUtils::SVGShapeStyle* removeElement)
@@ -236,6 +244,7 @@ void WritePNG::removeStyle(Ionflux::GeoUtils::SVGShapeStyle* removeElement)
 	if (found)
 	{
 		styles.erase(styles.begin() + i);
+		touch();
 	}
 }
 
@@ -244,16 +253,19 @@ void WritePNG::removeStyleIndex(unsigned int removeIndex)
     if (removeIndex > styles.size())
         return;
     styles.erase(styles.begin() + removeIndex);
+	touch();
 }
 
 void WritePNG::clearStyles()
 {
     styles.clear();
+	touch();
 }
 
 void WritePNG::setAxis(Ionflux::GeoUtils::AxisID newAxis)
 {
 	axis = newAxis;
+	touch();
 }
 
 Ionflux::GeoUtils::AxisID WritePNG::getAxis() const
@@ -264,6 +276,7 @@ Ionflux::GeoUtils::AxisID WritePNG::getAxis() const
 void WritePNG::setClosePath(bool newClosePath)
 {
 	closePath = newClosePath;
+	touch();
 }
 
 bool WritePNG::getClosePath() const
@@ -274,6 +287,7 @@ bool WritePNG::getClosePath() const
 void WritePNG::setWidth(unsigned int newWidth)
 {
 	width = newWidth;
+	touch();
 }
 
 unsigned int WritePNG::getWidth() const
@@ -284,6 +298,7 @@ unsigned int WritePNG::getWidth() const
 void WritePNG::setHeight(unsigned int newHeight)
 {
 	height = newHeight;
+	touch();
 }
 
 unsigned int WritePNG::getHeight() const
@@ -294,6 +309,7 @@ unsigned int WritePNG::getHeight() const
 void WritePNG::setOriginX(unsigned int newOriginX)
 {
 	originX = newOriginX;
+	touch();
 }
 
 unsigned int WritePNG::getOriginX() const
@@ -304,6 +320,7 @@ unsigned int WritePNG::getOriginX() const
 void WritePNG::setOriginY(unsigned int newOriginY)
 {
 	originY = newOriginY;
+	touch();
 }
 
 unsigned int WritePNG::getOriginY() const
@@ -315,6 +332,7 @@ void WritePNG::setBackgroundColor(const Ionflux::Altjira::Color&
 newBackgroundColor)
 {
 	backgroundColor = newBackgroundColor;
+	touch();
 }
 
 Ionflux::Altjira::Color WritePNG::getBackgroundColor() const
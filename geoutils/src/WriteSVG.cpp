@@ -38,6 +38,7 @@
 #include "geoutils/xmlutils.hpp"
 #include "geoutils/Polygon3Set.hpp"
 #include "geoutils/Polygon3.hpp"
+#include "geoutils/SVGWriter.hpp"
 
 using namespace std;
 using namespace Ionflux::ObjectBase;
@@ -71,7 +72,7 @@ const WriteSVGClassInfo WriteSVG::writeSVGClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* WriteSVG::CLASS_INFO = &WriteSVG::writeSVGClassInfo;
 
 WriteSVG::WriteSVG()
-: fileName(""), elementIDPrefix("polygon"), axis(Ionflux::GeoUtils::AXIS_Z), shapeType(Ionflux::GeoUtils::DEFAULT_SHAPE_TYPE), closePath(true), width(1000), height(1000), originX(500), originY(500), svgTemplate(Ionflux::GeoUtils::SVG_TEMPLATE)
+: fileName(""), elementIDPrefix("polygon"), axis(Ionflux::GeoUtils::AXIS_Z), shapeType(Ionflux::GeoUtils::DEFAULT_SHAPE_TYPE), closePath(true), width(1000), height(1000), originX(500), originY(500), svgTemplate(Ionflux::GeoUtils::SVG_TEMPLATE), coalescePaths(false), precision(Ionflux::GeoUtils::DEFAULT_SVG_PRECISION)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -79,7 +80,7 @@ WriteSVG::WriteSVG()
 }
 
 WriteSVG::WriteSVG(const Ionflux::GeoUtils::TransformNodes::WriteSVG& other)
-: fileName(""), elementIDPrefix("polygon"), axis(Ionflux::GeoUtils::AXIS_Z), shapeType(Ionflux::GeoUtils::DEFAULT_SHAPE_TYPE), closePath(true), width(1000), height(1000), originX(500), originY(500), svgTemplate(Ionflux::GeoUtils::SVG_TEMPLATE)
+: fileName(""), elementIDPrefix("polygon"), axis(Ionflux::GeoUtils::AXIS_Z), shapeType(Ionflux::GeoUtils::DEFAULT_SHAPE_TYPE), closePath(true), width(1000), height(1000), originX(500), originY(500), svgTemplate(Ionflux::GeoUtils::SVG_TEMPLATE), coalescePaths(false), precision(Ionflux::GeoUtils::DEFAULT_SVG_PRECISION)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -97,7 +98,8 @@ Ionflux::ObjectBase::IFObjectID& nodeID)
 elementIDPrefix(initElementIDPrefix), axis(initAxis), 
 shapeType(initShapeType), closePath(initClosePath), width(initWidth), 
 height(initHeight), originX(initOriginX), originY(initOriginY), 
-svgTemplate(initSVGTemplate)
+svgTemplate(initSVGTemplate), coalescePaths(false), 
+precision(Ionflux::GeoUtils::DEFAULT_SVG_PRECISION)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -148,14 +150,30 @@ void WriteSVG::process()
 	/* <---- DEBUG ----- //
 	log(IFLogMessage("Creating SVG...", VL_DEBUG, this, "process"));
 	// ----- DEBUG ----> */
-	std::string svg0 = ps0.getSVG(styles, elementIDPrefix, axis, 
-	    shapeType, closePath);
-	std::string svg1 = Ionflux::GeoUtils::getSVGImage(svg0, 
-	    width, height, originX, originY, svgTemplate);
-	// Write it to the file.
-	ofstream f0;
-	f0.open(fileName.c_str(), ios_base::out);
-	f0 << svg1;
+	if ((ps0.getNumPolygons() >= SVG_WRITER_MIN_POLYGONS) 
+	    || coalescePaths)
+	{
+	    // Stream large polygon sets directly to the file.
+	    SVGWriter w0;
+	    w0.setPrecision(precision);
+	    w0.setCoalescePaths(coalescePaths);
+	    w0.setElementIDPrefix(elementIDPrefix);
+	    w0.setAxis(axis);
+	    w0.setShapeType(shapeType);
+	    w0.setClosePath(closePath);
+	    w0.writeFile(fileName, ps0, &styles, width, height, originX, 
+	        originY, svgTemplate);
+	} else
+	{
+	    std::string svg0 = ps0.getSVG(styles, elementIDPrefix, axis, 
+	        shapeType, closePath);
+	    std::string svg1 = Ionflux::GeoUtils::getSVGImage(svg0, 
+	        width, height, originX, originY, svgTemplate);
+	    // Write it to the file.
+	    ofstream f0;
+	    f0.open(fileName.c_str(), ios_base::out);
+	    f0 << svg1;
+	}
 	addOutput(g0);
 }
 
@@ -167,6 +185,12 @@ std::string WriteSVG::getString() const
 	return status.str();
 }
 
+bool WriteSVG::isThreadSafe() const
+{
+	// TODO: Implementation.
+	return false;
+}
+
 void WriteSVG::addStyles(const Ionflux::GeoUtils::SVGShapeStyleVector& 
 newStyles)
 {
@@ -178,6 +202,7 @@ newStyles)
 void WriteSVG::setFileName(const std::string& newFileName)
 {
 	fileName = newFileName;
+	touch();
 }
 
 std::string WriteSVG::getFileName() const
@@ -230,6 +255,7 @@ std::vector<Ionflux::GeoUtils::SVGShapeStyle*>& WriteSVG::getStyles()
 void WriteSVG::addStyle(Ionflux::GeoUtils::SVGShapeStyle* addElement)
 {
 	styles.push_back(addElement);
+	touch();
 }
 
 void WriteSVG::removeStyle(Ionflux::GeoUtils::SVGShapeStyle* removeElement)
@@ -249,6 +275,7 @@ void WriteSVG::removeStyle(Ionflux::GeoUtils::SVGShapeStyle* removeElement)
 	if (found)
 	{
 		styles.erase(styles.begin() + i);
+		touch();
 	}
 }
 
@@ -257,16 +284,19 @@ void WriteSVG::removeStyleIndex(unsigned int removeIndex)
     if (removeIndex > styles.size())
         return;
     styles.erase(styles.begin() + removeIndex);
+	touch();
 }
 
 void WriteSVG::clearStyles()
 {
     styles.clear();
+	touch();
 }
 
 void WriteSVG::setElementIDPrefix(const std::string& newElementIDPrefix)
 {
 	elementIDPrefix = newElementIDPrefix;
+	touch();
 }
 
 std::string WriteSVG::getElementIDPrefix() const
@@ -277,6 +307,7 @@ std::string WriteSVG::getElementIDPrefix() const
 void WriteSVG::setAxis(Ionflux::GeoUtils::AxisID newAxis)
 {
 	axis = newAxis;
+	touch();
 }
 
 Ionflux::GeoUtils::AxisID WriteSVG::getAxis() const
@@ -287,6 +318,7 @@ Ionflux::GeoUtils::AxisID WriteSVG::getAxis() const
 void WriteSVG::setShapeType(Ionflux::GeoUtils::SVGShapeType newShapeType)
 {
 	shapeType = newShapeType;
+	touch();
 }
 
 Ionflux::GeoUtils::SVGShapeType WriteSVG::getShapeType() const
@@ -297,6 +329,7 @@ Ionflux::GeoUtils::SVGShapeType WriteSVG::getShapeType() const
 void WriteSVG::setClosePath(bool newClosePath)
 {
 	closePath = newClosePath;
+	touch();
 }
 
 bool WriteSVG::getClosePath() const
@@ -307,6 +340,7 @@ bool WriteSVG::getClosePath() const
 void WriteSVG::setWidth(unsigned int newWidth)
 {
 	width = newWidth;
+	touch();
 }
 
 unsigned int WriteSVG::getWidth() const
@@ -317,6 +351,7 @@ unsigned int WriteSVG::getWidth() const
 void WriteSVG::setHeight(unsigned int newHeight)
 {
 	height = newHeight;
+	touch();
 }
 
 unsigned int WriteSVG::getHeight() const
@@ -327,6 +362,7 @@ unsigned int WriteSVG::getHeight() const
 void WriteSVG::setOriginX(unsigned int newOriginX)
 {
 	originX = newOriginX;
+	touch();
 }
 
 unsigned int WriteSVG::getOriginX() const
@@ -337,6 +373,7 @@ unsigned int WriteSVG::getOriginX() const
 void WriteSVG::setOriginY(unsigned int newOriginY)
 {
 	originY = newOriginY;
+	touch();
 }
 
 unsigned int WriteSVG::getOriginY() const
@@ -347,6 +384,7 @@ unsigned int WriteSVG::getOriginY() const
 void WriteSVG::setSvgTemplate(const std::string& newSvgTemplate)
 {
 	svgTemplate = newSvgTemplate;
+	touch();
 }
 
 std::string WriteSVG::getSvgTemplate() const
@@ -354,6 +392,28 @@ std::string WriteSVG::getSvgTemplate() const
     return svgTemplate;
 }
 
+void WriteSVG::setCoalescePaths(bool newCoalescePaths)
+{
+	coalescePaths = newCoalescePaths;
+	touch();
+}
+
+bool WriteSVG::getCoalescePaths() const
+{
+    return coalescePaths;
+}
+
+void WriteSVG::setPrecision(unsigned int newPrecision)
+{
+	precision = newPrecision;
+	touch();
+}
+
+unsigned int WriteSVG::getPrecision() const
+{
+    return precision;
+}
+
 Ionflux::GeoUtils::TransformNodes::WriteSVG& WriteSVG::operator=(const 
 Ionflux::GeoUtils::TransformNodes::WriteSVG& other)
 {
@@ -364,6 +424,8 @@ Ionflux::GeoUtils::TransformNodes::WriteSVG& other)
     axis = other.axis;
     shapeType = other.shapeType;
     closePath = other.closePath;
+    coalescePaths = other.coalescePaths;
+    precision = other.precision;
 	return *this;
 }
 
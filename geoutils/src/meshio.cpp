@@ -0,0 +1,1329 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2013 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * meshio.cpp                     Mesh I/O functions (implementation).
+ * =========================================================================
+ *
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 2 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <climits>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "ifobject/IFIOContext.hpp"
+#include "geoutils/meshio.hpp"
+#include "geoutils/GeoUtilsError.hpp"
+#include "geoutils/Mesh.hpp"
+#include "geoutils/CompactMesh.hpp"
+#include "geoutils/vecmath.hpp"
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+namespace
+{
+
+/// Powers of ten that can be represented exactly.
+const double EXACT_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/// Maximum exponent of an exactly representable power of ten.
+const int EXACT_POWER_OF_TEN_MAX = 22;
+
+/// Maximum number of significant digits for direct conversion.
+const int PARSE_DOUBLE_MAX_DIGITS = 15;
+
+/// Maximum number of decimal places for direct formatting.
+const unsigned int APPEND_DOUBLE_MAX_PRECISION = 15;
+
+/// Maximum absolute value for direct formatting.
+const double APPEND_DOUBLE_MAX_VALUE = 1.0e18;
+
+/// Size of an STL file header.
+const unsigned int STL_HEADER_SIZE = 80;
+
+/// Size of a triangle record in a binary STL file.
+const unsigned int STL_TRIANGLE_SIZE = 50;
+
+/// PLY scalar type: signed integer.
+const int PLY_TYPE_INT = 0;
+/// PLY scalar type: unsigned integer.
+const int PLY_TYPE_UINT = 1;
+/// PLY scalar type: floating point.
+const int PLY_TYPE_FLOAT = 2;
+
+/// PLY scalar type.
+struct PLYScalarType
+{
+    /// Kind (signed, unsigned, floating point).
+    int kind;
+    /// Size in bytes.
+    unsigned int size;
+};
+
+/// PLY property.
+struct PLYProperty
+{
+    /// Name.
+    std::string name;
+    /// Value type.
+    PLYScalarType type;
+    /// List flag.
+    bool isList;
+    /// List count type.
+    PLYScalarType countType;
+};
+
+/// Vector of PLY properties.
+typedef std::vector<PLYProperty> PLYPropertyVector;
+
+/// PLY element.
+struct PLYElement
+{
+    /// Name.
+    std::string name;
+    /// Number of items.
+    unsigned int count;
+    /// Properties.
+    PLYPropertyVector properties;
+};
+
+/// Vector of PLY elements.
+typedef std::vector<PLYElement> PLYElementVector;
+
+/// Releases a mapped file when it goes out of scope.
+struct MappedFileGuard
+{
+    /// Mapped file.
+    MappedFile& file;
+
+    MappedFileGuard(MappedFile& initFile)
+    : file(initFile)
+    {
+    }
+
+    ~MappedFileGuard()
+    {
+        unmapFile(file);
+    }
+};
+
+/// Compares STL triangle corners by coordinates.
+struct CornerCompare
+{
+    /// Corner positions.
+    const double* positions;
+
+    CornerCompare(const double* initPositions)
+    : positions(initPositions)
+    {
+    }
+
+    bool operator()(unsigned int i0, unsigned int i1) const
+    {
+        const double* c0 = positions + 3 * i0;
+        const double* c1 = positions + 3 * i1;
+        for (unsigned int i = 0; i < 3; i++)
+        {
+            if (c0[i] < c1[i])
+                return true;
+            if (c0[i] > c1[i])
+                return false;
+        }
+        return i0 < i1;
+    }
+};
+
+/// Check whether a character is a decimal digit.
+inline bool isDigit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+/// Check whether a character is a blank (space, tab or carriage return).
+inline bool isBlank(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\r');
+}
+
+/// Skip blank characters.
+inline const char* skipBlank(const char* p, const char* last)
+{
+    while ((p < last) && isBlank(*p))
+        p++;
+    return p;
+}
+
+/// Skip to the start of the next line.
+inline const char* skipLine(const char* p, const char* last)
+{
+    if (p >= last)
+        return last;
+    const void* e = memchr(p, '\n', last - p);
+    if (e == 0)
+        return last;
+    return static_cast<const char*>(e) + 1;
+}
+
+/// Check whether a line starts with a keyword followed by a blank.
+inline bool isKeyword(const char* p, const char* last, const char* keyword)
+{
+    unsigned int n = strlen(keyword);
+    return ((p + n) < last) && (strncmp(p, keyword, n) == 0)
+        && isBlank(p[n]);
+}
+
+/// Get the number of threads to be used.
+unsigned int getNumThreads(unsigned int numThreads)
+{
+    if (numThreads == 0)
+    {
+        long np = sysconf(_SC_NPROCESSORS_ONLN);
+        if (np > 0)
+            numThreads = np;
+        else
+            numThreads = 1;
+    }
+    return numThreads;
+}
+
+/// Append the digits of an unsigned integer, padded to minDigits digits.
+void appendDigits(std::string& target, Ionflux::ObjectBase::UInt64 value,
+    unsigned int minDigits = 1)
+{
+    char b0[24];
+    char* e0 = b0 + sizeof(b0);
+    char* p = e0;
+    unsigned int n = 0;
+    do
+    {
+        *(--p) = static_cast<char>('0' + (value % 10));
+        value /= 10;
+        n++;
+    } while (value > 0);
+    while ((n < minDigits) && (p > b0))
+    {
+        *(--p) = '0';
+        n++;
+    }
+    target.append(p, e0 - p);
+}
+
+/// Append a binary value with the specified byte order.
+template<class T>
+void appendBinary(std::string& target, T value, bool swapBytes)
+{
+    char b0[sizeof(T)];
+    memcpy(b0, &value, sizeof(T));
+    if (swapBytes)
+        std::reverse(b0, b0 + sizeof(T));
+    target.append(b0, sizeof(T));
+}
+
+/// Load a binary value with the specified byte order.
+template<class T>
+T loadBinary(const char* source, bool swapBytes)
+{
+    char b0[sizeof(T)];
+    memcpy(b0, source, sizeof(T));
+    if (swapBytes)
+        std::reverse(b0, b0 + sizeof(T));
+    T result;
+    memcpy(&result, b0, sizeof(T));
+    return result;
+}
+
+/// Load a PLY scalar value.
+double loadPLYValue(const char* source, const PLYScalarType& type,
+    bool swapBytes)
+{
+    if (type.kind == PLY_TYPE_FLOAT)
+    {
+        if (type.size == 4)
+            return loadBinary<float>(source, swapBytes);
+        return loadBinary<double>(source, swapBytes);
+    }
+    if (type.kind == PLY_TYPE_INT)
+    {
+        if (type.size == 1)
+            return static_cast<signed char>(*source);
+        if (type.size == 2)
+            return loadBinary<Ionflux::ObjectBase::Int16>(source,
+                swapBytes);
+        return loadBinary<Ionflux::ObjectBase::Int32>(source, swapBytes);
+    }
+    if (type.size == 1)
+        return static_cast<unsigned char>(*source);
+    if (type.size == 2)
+        return loadBinary<Ionflux::ObjectBase::UInt16>(source, swapBytes);
+    return loadBinary<Ionflux::ObjectBase::UInt32>(source, swapBytes);
+}
+
+/// Get a PLY scalar type from its name.
+bool getPLYScalarType(const std::string& name, PLYScalarType& target)
+{
+    if ((name == "char") || (name == "int8"))
+    {
+        target.kind = PLY_TYPE_INT;
+        target.size = 1;
+    } else
+    if ((name == "uchar") || (name == "uint8"))
+    {
+        target.kind = PLY_TYPE_UINT;
+        target.size = 1;
+    } else
+    if ((name == "short") || (name == "int16"))
+    {
+        target.kind = PLY_TYPE_INT;
+        target.size = 2;
+    } else
+    if ((name == "ushort") || (name == "uint16"))
+    {
+        target.kind = PLY_TYPE_UINT;
+        target.size = 2;
+    } else
+    if ((name == "int") || (name == "int32"))
+    {
+        target.kind = PLY_TYPE_INT;
+        target.size = 4;
+    } else
+    if ((name == "uint") || (name == "uint32"))
+    {
+        target.kind = PLY_TYPE_UINT;
+        target.size = 4;
+    } else
+    if ((name == "float") || (name == "float32"))
+    {
+        target.kind = PLY_TYPE_FLOAT;
+        target.size = 4;
+    } else
+    if ((name == "double") || (name == "float64"))
+    {
+        target.kind = PLY_TYPE_FLOAT;
+        target.size = 8;
+    } else
+        return false;
+    return true;
+}
+
+/// Throw an error for a file that cannot be read.
+void throwFileError(const std::string& source, const std::string& message,
+    const std::string& fileName)
+{
+    std::ostringstream status;
+    status << "[" << source << "] " << message << " (file = '"
+        << fileName << "')";
+    throw GeoUtilsError(status.str());
+}
+
+/// Open an output file.
+void openOutputFile(std::ofstream& target, const std::string& fileName,
+    const std::string& source)
+{
+    target.open(fileName.c_str(), std::ios::out | std::ios::binary);
+    if (!target.good())
+        throwFileError(source, "Could not open file for writing", fileName);
+}
+
+/// Write the buffer to an output file and clear it.
+void flushBuffer(std::ofstream& target, std::string& buffer,
+    const std::string& fileName, const std::string& source)
+{
+    if (buffer.size() > 0)
+        target.write(buffer.data(), buffer.size());
+    buffer.clear();
+    if (!target.good())
+        throwFileError(source, "Could not write to file", fileName);
+}
+
+}
+
+const char* parseDouble(const char* first, const char* last,
+    double& target)
+{
+    const char* p = first;
+    bool negative = false;
+    if ((p < last) && ((*p == '-') || (*p == '+')))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+    double m = 0.;
+    int numDigits = 0;
+    int e10 = 0;
+    bool valid = false;
+    bool exact = true;
+    // integer part
+    while ((p < last) && isDigit(*p))
+    {
+        valid = true;
+        if (numDigits < PARSE_DOUBLE_MAX_DIGITS)
+        {
+            m = 10. * m + (*p - '0');
+            if (m > 0.)
+                numDigits++;
+        } else
+        {
+            e10++;
+            if (*p != '0')
+                exact = false;
+        }
+        p++;
+    }
+    // fraction
+    if ((p < last) && (*p == '.'))
+    {
+        p++;
+        while ((p < last) && isDigit(*p))
+        {
+            valid = true;
+            if (numDigits < PARSE_DOUBLE_MAX_DIGITS)
+            {
+                m = 10. * m + (*p - '0');
+                if (m > 0.)
+                    numDigits++;
+                e10--;
+            } else
+            if (*p != '0')
+                exact = false;
+            p++;
+        }
+    }
+    if (!valid)
+    {
+        // not a decimal number (this may still be 'inf' or 'nan')
+        char b0[64];
+        unsigned int n = 0;
+        while (((first + n) < last) && (n < (sizeof(b0) - 1))
+            && !isBlank(first[n]) && (first[n] != '\n'))
+        {
+            b0[n] = first[n];
+            n++;
+        }
+        b0[n] = '\0';
+        char* e0 = 0;
+        double v = strtod(b0, &e0);
+        if (e0 == b0)
+            return first;
+        target = v;
+        return first + (e0 - b0);
+    }
+    // exponent
+    if ((p < last) && ((*p == 'e') || (*p == 'E')))
+    {
+        const char* q = p + 1;
+        bool negExp = false;
+        if ((q < last) && ((*q == '-') || (*q == '+')))
+        {
+            negExp = (*q == '-');
+            q++;
+        }
+        if ((q < last) && isDigit(*q))
+        {
+            int e0 = 0;
+            while ((q < last) && isDigit(*q))
+            {
+                if (e0 < 100000)
+                    e0 = 10 * e0 + (*q - '0');
+                q++;
+            }
+            if (negExp)
+                e10 -= e0;
+            else
+                e10 += e0;
+            p = q;
+        }
+    }
+    if (m == 0.)
+    {
+        target = negative ? -0. : 0.;
+        return p;
+    }
+    if (!exact || (e10 > EXACT_POWER_OF_TEN_MAX)
+        || (e10 < -EXACT_POWER_OF_TEN_MAX))
+    {
+        std::string b0(first, p - first);
+        target = strtod(b0.c_str(), 0);
+        return p;
+    }
+    /* Both the mantissa and the power of ten are exact, so the result
+       is correctly rounded. */
+    if (e10 < 0)
+        m /= EXACT_POWERS_OF_TEN[-e10];
+    else
+        m *= EXACT_POWERS_OF_TEN[e10];
+    target = negative ? -m : m;
+    return p;
+}
+
+void appendDouble(std::string& target, double value,
+    unsigned int precision)
+{
+    double a0 = fabs(value);
+    if ((precision > APPEND_DOUBLE_MAX_PRECISION)
+        || !(a0 < APPEND_DOUBLE_MAX_VALUE))
+    {
+        // large values, high precision, infinity and NaN
+        std::ostringstream d0;
+        d0 << std::fixed << std::setprecision(precision) << value;
+        target.append(d0.str());
+        return;
+    }
+    /* The integer part and the fraction are exact. The fraction is 
+       scaled, and the rounding error of the scaled fraction is 
+       determined exactly, so the result is rounded correctly (with 
+       ties to even, like printf()). */
+    double i0 = floor(a0);
+    double f0 = a0 - i0;
+    double s0 = EXACT_POWERS_OF_TEN[precision];
+    double t0 = f0 * s0;
+    double e0 = fma(f0, s0, -t0);
+    double r0 = floor(t0);
+    double d0 = t0 - r0;
+    if ((d0 > 0.5) 
+        || ((d0 == 0.5) 
+            && ((e0 > 0.) 
+                || ((e0 == 0.) 
+                    && (fmod((precision == 0) ? i0 : r0, 2.) != 0.)))))
+        r0 += 1.;
+    if (r0 >= s0)
+    {
+        i0 += 1.;
+        r0 -= s0;
+    }
+    if ((value < 0.)
+        || ((value == 0.) && ((1. / value) < 0.)))
+        target.push_back('-');
+    appendDigits(target, static_cast<Ionflux::ObjectBase::UInt64>(i0));
+    if (precision == 0)
+        return;
+    target.push_back('.');
+    appendDigits(target, static_cast<Ionflux::ObjectBase::UInt64>(r0), 
+        precision);
+}
+
+void appendUInt(std::string& target, unsigned int value)
+{
+    appendDigits(target, value);
+}
+
+bool isLittleEndian()
+{
+    Ionflux::ObjectBase::UInt16 v0 = 1;
+    unsigned char b0[2];
+    memcpy(b0, &v0, 2);
+    return b0[0] == 1;
+}
+
+void mapFile(const std::string& fileName,
+    Ionflux::GeoUtils::MappedFile& target)
+{
+    target.data = 0;
+    target.size = 0;
+    target.mapping = 0;
+    target.buffer.clear();
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        throwFileError("mapFile", "Could not open file", fileName);
+    struct stat s0;
+    if ((fstat(fd, &s0) == 0) && S_ISREG(s0.st_mode)
+        && (s0.st_size > 0))
+    {
+        size_t size = s0.st_size;
+        void* m0 = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m0 != MAP_FAILED)
+        {
+            madvise(m0, size, MADV_SEQUENTIAL);
+            close(fd);
+            target.mapping = m0;
+            target.data = static_cast<const char*>(m0);
+            target.size = size;
+            return;
+        }
+    }
+    // fall back to reading the file into the buffer
+    std::string b0(MESH_IO_BUFFER_SIZE, '\0');
+    ssize_t n = 0;
+    while ((n = read(fd, &(b0[0]), b0.size())) > 0)
+        target.buffer.append(b0, 0, n);
+    close(fd);
+    if (n < 0)
+    {
+        target.buffer.clear();
+        throwFileError("mapFile", "Could not read file", fileName);
+    }
+    target.data = target.buffer.data();
+    target.size = target.buffer.size();
+}
+
+void unmapFile(Ionflux::GeoUtils::MappedFile& target)
+{
+    if (target.mapping != 0)
+        munmap(target.mapping, target.size);
+    target.data = 0;
+    target.size = 0;
+    target.mapping = 0;
+    target.buffer.clear();
+}
+
+void readOBJ(const std::string& fileName,
+    Ionflux::GeoUtils::CompactMesh& target, unsigned int numThreads)
+{
+    MappedFile f0;
+    mapFile(fileName, f0);
+    MappedFileGuard g0(f0);
+    numThreads = getNumThreads(numThreads);
+    if (f0.size < OBJ_PARSE_PARALLEL_MIN_BYTES)
+        numThreads = 1;
+    // split the file into chunks at line boundaries
+    std::vector<OBJParseTask> tasks(numThreads);
+    const char* end = f0.data + f0.size;
+    const char* first = f0.data;
+    size_t cs = f0.size / numThreads;
+    for (unsigned int i = 0; i < numThreads; i++)
+    {
+        OBJParseTask& t0 = tasks[i];
+        const char* last = end;
+        if (i < (numThreads - 1))
+        {
+            last = f0.data + (i + 1) * cs;
+            if (last < first)
+                last = first;
+            else
+                last = skipLine(last, end);
+        }
+        t0.first = first;
+        t0.last = last;
+        t0.numLines = 0;
+        t0.error = false;
+        first = last;
+    }
+    std::vector<pthread_t> threads(numThreads);
+    std::vector<bool> threaded(numThreads, false);
+    for (unsigned int i = 1; i < numThreads; i++)
+        threaded[i] = (pthread_create(&(threads[i]), 0,
+            readOBJTask, &(tasks[i])) == 0);
+    for (unsigned int i = 0; i < numThreads; i++)
+    {
+        if (!threaded[i])
+            readOBJTask(&(tasks[i]));
+    }
+    for (unsigned int i = 1; i < numThreads; i++)
+    {
+        if (threaded[i])
+            pthread_join(threads[i], 0);
+    }
+    // merge
+    unsigned int numLines = 0;
+    unsigned int numCoords = 0;
+    unsigned int numIndices = 0;
+    unsigned int numFaces = 0;
+    for (unsigned int i = 0; i < numThreads; i++)
+    {
+        const OBJParseTask& t0 = tasks[i];
+        if (t0.error)
+        {
+            std::ostringstream status;
+            status << "[readOBJ] " << t0.errorMessage << " (file = '"
+                << fileName << "', line = " << (numLines + t0.numLines)
+                << ")";
+            throw GeoUtilsError(status.str());
+        }
+        numLines += t0.numLines;
+        numCoords += t0.positions.size();
+        numIndices += t0.indices.size();
+        numFaces += t0.faceOffsets.size();
+    }
+    Ionflux::ObjectBase::DoubleVector positions;
+    positions.reserve(numCoords);
+    Ionflux::ObjectBase::UIntVector indices(numIndices);
+    Ionflux::ObjectBase::UIntVector faceOffsets;
+    faceOffsets.reserve(numFaces + 1);
+    faceOffsets.push_back(0);
+    std::string objectName;
+    unsigned int vertexBase = 0;
+    unsigned int indexBase = 0;
+    for (unsigned int i = 0; i < numThreads; i++)
+    {
+        OBJParseTask& t0 = tasks[i];
+        positions.insert(positions.end(), t0.positions.begin(),
+            t0.positions.end());
+        unsigned int n0 = t0.indices.size();
+        for (unsigned int k = 0; k < n0; k++)
+            indices[indexBase + k] = static_cast<unsigned int>(
+                t0.indices[k]);
+        /* Relative indices refer to the vertices of the chunk. Invalid
+           indices end up out of range and are rejected by the mesh. */
+        for (unsigned int k = 0; k < t0.relIndices.size(); k++)
+        {
+            unsigned int j = t0.relIndices[k];
+            indices[indexBase + j] = static_cast<unsigned int>(
+                t0.indices[j] + static_cast<int>(vertexBase));
+        }
+        for (unsigned int k = 0; k < t0.faceOffsets.size(); k++)
+            faceOffsets.push_back(indexBase + t0.faceOffsets[k]);
+        if ((objectName.size() == 0) && (t0.objectName.size() > 0))
+            objectName = t0.objectName;
+        vertexBase += t0.positions.size() / 3;
+        indexBase += n0;
+        // release the chunk data early
+        Ionflux::ObjectBase::DoubleVector().swap(t0.positions);
+        Ionflux::ObjectBase::IntVector().swap(t0.indices);
+    }
+    target.initFromArrays(positions, indices, faceOffsets);
+    if (objectName.size() > 0)
+        target.setID(objectName);
+}
+
+void readOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& target,
+    unsigned int numThreads)
+{
+    CompactMesh c0;
+    readOBJ(fileName, c0, numThreads);
+    c0.getMesh(target, false);
+    if (c0.getID().size() > 0)
+        target.setID(c0.getID());
+}
+
+void* readOBJTask(void* taskArg)
+{
+    OBJParseTask* t0 = static_cast<OBJParseTask*>(taskArg);
+    const char* p = t0->first;
+    const char* last = t0->last;
+    int numVerts = 0;
+    while (p < last)
+    {
+        t0->numLines++;
+        p = skipBlank(p, last);
+        if (isKeyword(p, last, "v"))
+        {
+            // vertex (an optional w coordinate is ignored)
+            p++;
+            for (unsigned int i = 0; i < 3; i++)
+            {
+                p = skipBlank(p, last);
+                double v0 = 0.;
+                const char* q = parseDouble(p, last, v0);
+                if (q == p)
+                {
+                    t0->error = true;
+                    t0->errorMessage = "Invalid vertex coordinate";
+                    return 0;
+                }
+                t0->positions.push_back(v0);
+                p = q;
+            }
+            numVerts++;
+        } else
+        if (isKeyword(p, last, "f"))
+        {
+            // face
+            p++;
+            unsigned int nfv = 0;
+            while (true)
+            {
+                p = skipBlank(p, last);
+                if ((p >= last) || (*p == '\n') || (*p == '#'))
+                    break;
+                bool negative = false;
+                if ((*p == '-') || (*p == '+'))
+                {
+                    negative = (*p == '-');
+                    p++;
+                }
+                int v0 = 0;
+                while ((p < last) && isDigit(*p) && (v0 < (INT_MAX / 10)))
+                {
+                    v0 = 10 * v0 + (*p - '0');
+                    p++;
+                }
+                if ((v0 == 0)
+                    || ((p < last) && isDigit(*p)))
+                {
+                    t0->error = true;
+                    t0->errorMessage = "Invalid face vertex index";
+                    return 0;
+                }
+                if (negative)
+                {
+                    t0->relIndices.push_back(t0->indices.size());
+                    t0->indices.push_back(numVerts - v0);
+                } else
+                    t0->indices.push_back(v0 - 1);
+                // skip texture coordinate and normal indices
+                while ((p < last) && !isBlank(*p) && (*p != '\n'))
+                    p++;
+                nfv++;
+            }
+            if (nfv < 3)
+            {
+                t0->error = true;
+                t0->errorMessage = "Face has less than three vertices";
+                return 0;
+            }
+            t0->faceOffsets.push_back(t0->indices.size());
+        } else
+        if (isKeyword(p, last, "o") && (t0->objectName.size() == 0))
+        {
+            // object name
+            p = skipBlank(p + 1, last);
+            const char* q = p;
+            while ((q < last) && (*q != '\n'))
+                q++;
+            while ((q > p) && isBlank(*(q - 1)))
+                q--;
+            t0->objectName.assign(p, q - p);
+        }
+        p = skipLine(p, last);
+    }
+    return 0;
+}
+
+void writeOBJ(const std::string& fileName,
+    const Ionflux::GeoUtils::CompactMesh& source, unsigned int precision,
+    bool smoothShading)
+{
+    std::ofstream f0;
+    openOutputFile(f0, fileName, "writeOBJ");
+    Ionflux::ObjectBase::IFIOContext ioCtx;
+    ioCtx.setOutputStream(&f0);
+    /* CompactMesh::writeOBJ() is not const because the I/O context
+       interface of mesh objects is not. */
+    const_cast<CompactMesh&>(source).writeOBJ(ioCtx, precision,
+        smoothShading);
+    ioCtx.setOutputStream(0);
+    f0.close();
+    if (f0.fail())
+        throwFileError("writeOBJ", "Could not write to file", fileName);
+}
+
+void writeOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& source,
+    unsigned int precision, bool smoothShading)
+{
+    std::ofstream f0;
+    openOutputFile(f0, fileName, "writeOBJ");
+    Ionflux::ObjectBase::IFIOContext ioCtx;
+    ioCtx.setOutputStream(&f0);
+    source.writeOBJ(ioCtx, precision, smoothShading);
+    ioCtx.setOutputStream(0);
+    f0.close();
+    if (f0.fail())
+        throwFileError("writeOBJ", "Could not write to file", fileName);
+}
+
+void readPLY(const std::string& fileName,
+    Ionflux::GeoUtils::CompactMesh& target)
+{
+    MappedFile f0;
+    mapFile(fileName, f0);
+    MappedFileGuard g0(f0);
+    const char* p = f0.data;
+    const char* end = f0.data + f0.size;
+    // header
+    PLYElementVector elements;
+    bool little = true;
+    bool haveFormat = false;
+    bool haveEnd = false;
+    unsigned int numLines = 0;
+    while ((p < end) && !haveEnd)
+    {
+        const char* q = skipLine(p, end);
+        std::string l0(p, q - p);
+        p = q;
+        std::istringstream s0(l0);
+        std::string k0;
+        s0 >> k0;
+        numLines++;
+        if (numLines == 1)
+        {
+            if (k0 != "ply")
+                throwFileError("readPLY", "Not a PLY file", fileName);
+        } else
+        if (k0 == "format")
+        {
+            std::string format;
+            s0 >> format;
+            if (format == "binary_little_endian")
+                little = true;
+            else
+            if (format == "binary_big_endian")
+                little = false;
+            else
+                throwFileError("readPLY", "Unsupported format '"
+                    + format + "'", fileName);
+            haveFormat = true;
+        } else
+        if (k0 == "element")
+        {
+            PLYElement e0;
+            s0 >> e0.name >> e0.count;
+            if (s0.fail())
+                throwFileError("readPLY", "Invalid element", fileName);
+            elements.push_back(e0);
+        } else
+        if (k0 == "property")
+        {
+            if (elements.size() == 0)
+                throwFileError("readPLY", "Property outside of element",
+                    fileName);
+            PLYProperty p0;
+            std::string t0;
+            s0 >> t0;
+            p0.isList = (t0 == "list");
+            if (p0.isList)
+            {
+                std::string c0;
+                s0 >> c0 >> t0;
+                if (!getPLYScalarType(c0, p0.countType)
+                    || (p0.countType.kind == PLY_TYPE_FLOAT))
+                    throwFileError("readPLY", "Invalid list count type '"
+                        + c0 + "'", fileName);
+            }
+            if (!getPLYScalarType(t0, p0.type))
+                throwFileError("readPLY", "Invalid property type '"
+                    + t0 + "'", fileName);
+            s0 >> p0.name;
+            elements.back().properties.push_back(p0);
+        } else
+        if (k0 == "end_header")
+            haveEnd = true;
+    }
+    if (!haveFormat || !haveEnd)
+        throwFileError("readPLY", "Incomplete header", fileName);
+    bool swapBytes = (little != isLittleEndian());
+    unsigned int numVerts = 0;
+    for (PLYElementVector::const_iterator i = elements.begin();
+        i != elements.end(); i++)
+    {
+        if ((*i).name == "vertex")
+            numVerts = (*i).count;
+    }
+    // data
+    Ionflux::ObjectBase::DoubleVector positions;
+    Ionflux::ObjectBase::UIntVector indices;
+    Ionflux::ObjectBase::UIntVector faceOffsets;
+    faceOffsets.push_back(0);
+    for (PLYElementVector::const_iterator i = elements.begin();
+        i != elements.end(); i++)
+    {
+        const PLYElement& e0 = *i;
+        const PLYPropertyVector& props = e0.properties;
+        bool isVertex = (e0.name == "vertex");
+        bool isFace = (e0.name == "face");
+        // fixed size items
+        bool fixed = true;
+        size_t itemSize = 0;
+        int coordProps[3] = { -1, -1, -1 };
+        size_t coordOffsets[3] = { 0, 0, 0 };
+        for (unsigned int k = 0; k < props.size(); k++)
+        {
+            const PLYProperty& p0 = props[k];
+            if (p0.isList)
+            {
+                fixed = false;
+                continue;
+            }
+            if (isVertex)
+            {
+                int c0 = -1;
+                if (p0.name == "x")
+                    c0 = 0;
+                else
+                if (p0.name == "y")
+                    c0 = 1;
+                else
+                if (p0.name == "z")
+                    c0 = 2;
+                if (c0 >= 0)
+                {
+                    coordProps[c0] = k;
+                    coordOffsets[c0] = itemSize;
+                }
+            }
+            itemSize += p0.type.size;
+        }
+        if (isVertex)
+        {
+            if (!fixed || (coordProps[0] < 0) || (coordProps[1] < 0)
+                || (coordProps[2] < 0))
+                throwFileError("readPLY", "Unsupported vertex element",
+                    fileName);
+            if (e0.count > static_cast<size_t>(end - p) / itemSize)
+                throwFileError("readPLY", "Unexpected end of file",
+                    fileName);
+            positions.resize(3 * e0.count);
+            double* c0 = positions.size() > 0 ? &(positions[0]) : 0;
+            for (unsigned int k = 0; k < e0.count; k++)
+            {
+                for (unsigned int j = 0; j < 3; j++)
+                    c0[3 * k + j] = loadPLYValue(p + coordOffsets[j],
+                        props[coordProps[j]].type, swapBytes);
+                p += itemSize;
+            }
+            continue;
+        }
+        if (fixed)
+        {
+            // skip the element
+            if ((itemSize > 0)
+                && (e0.count > static_cast<size_t>(end - p) / itemSize))
+                throwFileError("readPLY", "Unexpected end of file",
+                    fileName);
+            p += static_cast<size_t>(e0.count) * itemSize;
+            continue;
+        }
+        for (unsigned int k = 0; k < e0.count; k++)
+        {
+            for (unsigned int j = 0; j < props.size(); j++)
+            {
+                const PLYProperty& p0 = props[j];
+                if (!p0.isList)
+                {
+                    if (static_cast<size_t>(end - p) < p0.type.size)
+                        throwFileError("readPLY", "Unexpected end of file",
+                            fileName);
+                    p += p0.type.size;
+                    continue;
+                }
+                if (static_cast<size_t>(end - p) < p0.countType.size)
+                    throwFileError("readPLY", "Unexpected end of file",
+                        fileName);
+                double c0 = loadPLYValue(p, p0.countType, swapBytes);
+                p += p0.countType.size;
+                /* Compare the count against the remaining data before 
+                   computing the list size, so the size cannot overflow. */
+                size_t r0 = static_cast<size_t>(end - p) / p0.type.size;
+                if ((c0 < 0.) || (c0 > r0))
+                    throwFileError("readPLY", "Unexpected end of file",
+                        fileName);
+                size_t n0 = static_cast<size_t>(c0);
+                size_t s0 = n0 * p0.type.size;
+                if (isFace && ((p0.name == "vertex_indices")
+                    || (p0.name == "vertex_index")))
+                {
+                    for (size_t m = 0; m < n0; m++)
+                    {
+                        double v0 = loadPLYValue(p + m * p0.type.size,
+                            p0.type, swapBytes);
+                        // This also rejects NaN values.
+                        if (!((v0 >= 0.) && (v0 < numVerts)))
+                            throwFileError("readPLY",
+                                "Invalid vertex index", fileName);
+                        indices.push_back(static_cast<unsigned int>(v0));
+                    }
+                    faceOffsets.push_back(indices.size());
+                }
+                p += s0;
+            }
+        }
+    }
+    target.initFromArrays(positions, indices, faceOffsets);
+}
+
+void readPLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& target)
+{
+    CompactMesh c0;
+    readPLY(fileName, c0);
+    c0.getMesh(target, false);
+}
+
+void writePLY(const std::string& fileName,
+    const Ionflux::GeoUtils::CompactMesh& source, bool doublePrecision)
+{
+    unsigned int numVerts = source.getNumVertices();
+    unsigned int numFaces = source.getNumFaces();
+    unsigned int maxFaceVerts = 0;
+    for (unsigned int i = 0; i < numFaces; i++)
+        maxFaceVerts = std::max(maxFaceVerts,
+            source.getNumFaceVertices(i));
+    bool countUChar = (maxFaceVerts <= UCHAR_MAX);
+    std::ofstream f0;
+    openOutputFile(f0, fileName, "writePLY");
+    std::string b0;
+    b0.reserve(MESH_IO_BUFFER_SIZE + 1024);
+    b0.append("ply\nformat binary_little_endian 1.0\n");
+    std::string id0 = source.getID();
+    if ((id0.size() > 0)
+        && (id0.find('\n') == std::string::npos))
+        b0.append("obj_info " + id0 + "\n");
+    b0.append("element vertex ");
+    appendUInt(b0, numVerts);
+    if (doublePrecision)
+        b0.append("\nproperty double x\nproperty double y\n"
+            "property double z\n");
+    else
+        b0.append("\nproperty float x\nproperty float y\n"
+            "property float z\n");
+    b0.append("element face ");
+    appendUInt(b0, numFaces);
+    if (countUChar)
+        b0.append("\nproperty list uchar int vertex_indices\n");
+    else
+        b0.append("\nproperty list int int vertex_indices\n");
+    b0.append("end_header\n");
+    bool swapBytes = !isLittleEndian();
+    // vertices
+    const double* c0 = source.getPositionData();
+    for (unsigned int i = 0; i < 3 * numVerts; i++)
+    {
+        if (doublePrecision)
+            appendBinary(b0, c0[i], swapBytes);
+        else
+            appendBinary(b0, static_cast<float>(c0[i]), swapBytes);
+        if (b0.size() >= MESH_IO_BUFFER_SIZE)
+            flushBuffer(f0, b0, fileName, "writePLY");
+    }
+    // faces
+    const unsigned int* fi = source.getIndexData();
+    const unsigned int* fo = source.getFaceOffsetData();
+    for (unsigned int i = 0; i < numFaces; i++)
+    {
+        unsigned int n0 = fo[i + 1] - fo[i];
+        if (countUChar)
+            b0.push_back(static_cast<char>(n0));
+        else
+            appendBinary(b0, static_cast<Ionflux::ObjectBase::Int32>(n0),
+                swapBytes);
+        for (unsigned int k = fo[i]; k < fo[i + 1]; k++)
+            appendBinary(b0, static_cast<Ionflux::ObjectBase::Int32>(
+                fi[k]), swapBytes);
+        if (b0.size() >= MESH_IO_BUFFER_SIZE)
+            flushBuffer(f0, b0, fileName, "writePLY");
+    }
+    flushBuffer(f0, b0, fileName, "writePLY");
+}
+
+void writePLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& source,
+    bool doublePrecision)
+{
+    CompactMesh c0;
+    c0.initFromMesh(source);
+    c0.setID(source.getID());
+    writePLY(fileName, c0, doublePrecision);
+}
+
+void readSTL(const std::string& fileName,
+    Ionflux::GeoUtils::CompactMesh& target, bool weldVertices)
+{
+    MappedFile f0;
+    mapFile(fileName, f0);
+    MappedFileGuard g0(f0);
+    const char* end = f0.data + f0.size;
+    // triangle corners
+    Ionflux::ObjectBase::DoubleVector corners;
+    bool binary = false;
+    if (f0.size >= (STL_HEADER_SIZE + 4))
+    {
+        Ionflux::ObjectBase::UInt32 n0 =
+            loadBinary<Ionflux::ObjectBase::UInt32>(
+                f0.data + STL_HEADER_SIZE, !isLittleEndian());
+        binary = ((f0.size - STL_HEADER_SIZE - 4)
+            == (static_cast<size_t>(n0) * STL_TRIANGLE_SIZE));
+        if (binary)
+        {
+            bool swapBytes = !isLittleEndian();
+            corners.resize(9 * n0);
+            const char* p = f0.data + STL_HEADER_SIZE + 4;
+            for (unsigned int i = 0; i < n0; i++)
+            {
+                // skip the normal
+                const char* q = p + 12;
+                for (unsigned int k = 0; k < 9; k++)
+                    corners[9 * i + k] = loadBinary<float>(q + 4 * k,
+                        swapBytes);
+                p += STL_TRIANGLE_SIZE;
+            }
+        }
+    }
+    if (!binary)
+    {
+        const char* p = skipBlank(f0.data, end);
+        if (((end - p) < 5) || (strncmp(p, "solid", 5) != 0))
+            throwFileError("readSTL", "Not an STL file", fileName);
+        while (p < end)
+        {
+            p = skipBlank(p, end);
+            if (isKeyword(p, end, "vertex"))
+            {
+                p += 6;
+                for (unsigned int k = 0; k < 3; k++)
+                {
+                    p = skipBlank(p, end);
+                    double v0 = 0.;
+                    const char* q = parseDouble(p, end, v0);
+                    if (q == p)
+                        throwFileError("readSTL",
+                            "Invalid vertex coordinate", fileName);
+                    corners.push_back(v0);
+                    p = q;
+                }
+            }
+            p = skipLine(p, end);
+        }
+        if ((corners.size() % 9) != 0)
+            throwFileError("readSTL", "Incomplete triangle", fileName);
+    }
+    unsigned int numCorners = corners.size() / 3;
+    Ionflux::ObjectBase::UIntVector indices(numCorners);
+    Ionflux::ObjectBase::UIntVector faceOffsets(numCorners / 3 + 1);
+    for (unsigned int i = 0; i < faceOffsets.size(); i++)
+        faceOffsets[i] = 3 * i;
+    if (!weldVertices || (numCorners == 0))
+    {
+        for (unsigned int i = 0; i < numCorners; i++)
+            indices[i] = i;
+        target.initFromArrays(corners, indices, faceOffsets);
+        return;
+    }
+    /* Sort the corners by coordinates. Each group of identical corners
+       is represented by its first corner, and the vertices are numbered
+       in order of first appearance. */
+    Ionflux::ObjectBase::UIntVector order(numCorners);
+    for (unsigned int i = 0; i < numCorners; i++)
+        order[i] = i;
+    const double* c0 = &(corners[0]);
+    std::sort(order.begin(), order.end(), CornerCompare(c0));
+    Ionflux::ObjectBase::UIntVector reps(numCorners);
+    unsigned int r0 = order[0];
+    for (unsigned int i = 0; i < numCorners; i++)
+    {
+        const double* c1 = c0 + 3 * order[i];
+        const double* c2 = c0 + 3 * r0;
+        if ((c1[0] != c2[0]) || (c1[1] != c2[1]) || (c1[2] != c2[2]))
+            r0 = order[i];
+        reps[order[i]] = r0;
+    }
+    Ionflux::ObjectBase::UIntVector vertexIndices(numCorners, UINT_MAX);
+    Ionflux::ObjectBase::DoubleVector positions;
+    unsigned int numVerts = 0;
+    for (unsigned int i = 0; i < numCorners; i++)
+    {
+        unsigned int r1 = reps[i];
+        if (vertexIndices[r1] == UINT_MAX)
+        {
+            vertexIndices[r1] = numVerts;
+            positions.insert(positions.end(), c0 + 3 * r1,
+                c0 + 3 * r1 + 3);
+            numVerts++;
+        }
+        indices[i] = vertexIndices[r1];
+    }
+    target.initFromArrays(positions, indices, faceOffsets);
+}
+
+void readSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& target,
+    bool weldVertices)
+{
+    CompactMesh c0;
+    readSTL(fileName, c0, weldVertices);
+    c0.getMesh(target, false);
+}
+
+void writeSTL(const std::string& fileName,
+    const Ionflux::GeoUtils::CompactMesh& source)
+{
+    unsigned int numFaces = source.getNumFaces();
+    const double* c0 = source.getPositionData();
+    const unsigned int* fi = source.getIndexData();
+    const unsigned int* fo = source.getFaceOffsetData();
+    Ionflux::ObjectBase::UInt32 numTris = 0;
+    for (unsigned int i = 0; i < numFaces; i++)
+    {
+        unsigned int n0 = fo[i + 1] - fo[i];
+        if (n0 >= 3)
+            numTris += n0 - 2;
+    }
+    std::ofstream f0;
+    openOutputFile(f0, fileName, "writeSTL");
+    std::string b0;
+    b0.reserve(MESH_IO_BUFFER_SIZE + STL_HEADER_SIZE
+        + STL_TRIANGLE_SIZE);
+    // the header must not start with 'solid' (ASCII STL)
+    std::string h0("binary STL");
+    std::string id0 = source.getID();
+    if (id0.size() > 0)
+        h0.append(": " + id0);
+    h0.resize(STL_HEADER_SIZE, '\0');
+    b0.append(h0);
+    bool swapBytes = !isLittleEndian();
+    appendBinary(b0, numTris, swapBytes);
+    for (unsigned int i = 0; i < numFaces; i++)
+    {
+        unsigned int n0 = fo[i + 1] - fo[i];
+        // triangle fan
+        for (unsigned int k = 2; k < n0; k++)
+        {
+            const double* t0[3] = {
+                c0 + 3 * fi[fo[i]],
+                c0 + 3 * fi[fo[i] + k - 1],
+                c0 + 3 * fi[fo[i] + k]
+            };
+            Vec3 p0(t0[0][0], t0[0][1], t0[0][2]);
+            Vec3 n1 = (Vec3(t0[1][0], t0[1][1], t0[1][2]) - p0).cross(
+                Vec3(t0[2][0], t0[2][1], t0[2][2]) - p0);
+            if (n1.length() > 0.)
+                n1 = n1.normalize();
+            for (unsigned int j = 0; j < 3; j++)
+                appendBinary(b0, static_cast<float>(n1[j]), swapBytes);
+            for (unsigned int j = 0; j < 3; j++)
+            {
+                for (unsigned int m = 0; m < 3; m++)
+                    appendBinary(b0, static_cast<float>(t0[j][m]),
+                        swapBytes);
+            }
+            appendBinary(b0, static_cast<Ionflux::ObjectBase::UInt16>(0),
+                swapBytes);
+            if (b0.size() >= MESH_IO_BUFFER_SIZE)
+                flushBuffer(f0, b0, fileName, "writeSTL");
+        }
+    }
+    flushBuffer(f0, b0, fileName, "writeSTL");
+}
+
+void writeSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& source)
+{
+    CompactMesh c0;
+    c0.initFromMesh(source);
+    c0.setID(source.getID());
+    writeSTL(fileName, c0);
+}
+
+}
+
+}
+
+/** \file meshio.cpp
+ * \brief Mesh I/O functions (implementation).
+ */
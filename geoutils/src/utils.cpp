@@ -29,10 +29,16 @@
 #include <cstdlib>
 #include <algorithm>
 #include <cmath>
+#include <unistd.h>
+#include <pthread.h>
 #include <gsl/gsl_poly.h>
 #include "geoutils/utils.hpp"
+#include "ifobject/objectutils.hpp"
 #include "geoutils/Vertex3.hpp"
 #include "geoutils/Vertex3Set.hpp"
+#include "geoutils/Matrix3.hpp"
+#include "geoutils/Matrix4.hpp"
+#include "geoutils/vecmath.hpp"
 #include "geoutils/GeoUtilsError.hpp"
 #include "geoutils/BoxBoundsItemCompare.hpp"
 #include "geoutils/BoxBoundsItemCompareAxis.hpp"
@@ -874,6 +880,166 @@ void calculateOuterBezierControlPoint(
     *p1 = pc0.getPoint();
 }
 
+void transformPoints(double* x, double* y, double* z, 
+    unsigned int numPoints, const Ionflux::GeoUtils::Matrix4* matrix, 
+    const Ionflux::GeoUtils::Matrix4* view, 
+    const Ionflux::GeoUtils::Matrix4* image, unsigned int numThreads)
+{
+    if ((numPoints == 0) 
+        || ((matrix == 0) && (view == 0)))
+        return;
+    Mat4 m0;
+    Mat4 v0;
+    Mat4 i0;
+    PointTransformTask t0;
+    t0.x = x;
+    t0.y = y;
+    t0.z = z;
+    t0.numPoints = numPoints;
+    t0.matrix = 0;
+    t0.view = 0;
+    t0.image = 0;
+    if (matrix != 0)
+    {
+        m0 = Mat4(*matrix);
+        t0.matrix = m0.m;
+    }
+    if (view != 0)
+    {
+        v0 = Mat4(*view);
+        t0.view = v0.m;
+        if (image != 0)
+        {
+            i0 = Mat4(*image);
+            t0.image = i0.m;
+        }
+    }
+    if (numThreads == 0)
+    {
+        long np = sysconf(_SC_NPROCESSORS_ONLN);
+        if (np > 0)
+            numThreads = np;
+        else
+            numThreads = 1;
+    }
+    if ((numThreads < 2) 
+        || (numPoints < VERTEX_TRANSFORM_PARALLEL_MIN_VERTICES))
+    {
+        transformPointsTask(&t0);
+        return;
+    }
+    // split the points into chunks that are multiples of the SIMD width
+    unsigned int cs = numPoints / numThreads;
+    cs -= cs % PACKED_DOUBLE_WIDTH;
+    if (cs == 0)
+        cs = PACKED_DOUBLE_WIDTH;
+    std::vector<PointTransformTask> tasks;
+    unsigned int first = 0;
+    while (first < numPoints)
+    {
+        PointTransformTask t1 = t0;
+        t1.x = x + first;
+        t1.y = y + first;
+        t1.z = z + first;
+        t1.numPoints = cs;
+        if ((tasks.size() == (numThreads - 1)) 
+            || ((first + cs) > numPoints))
+            t1.numPoints = numPoints - first;
+        tasks.push_back(t1);
+        first += t1.numPoints;
+    }
+    std::vector<pthread_t> threads(tasks.size());
+    std::vector<bool> threaded(tasks.size(), false);
+    for (unsigned int i = 1; i < tasks.size(); i++)
+        threaded[i] = (pthread_create(&(threads[i]), 0, 
+            transformPointsTask, &(tasks[i])) == 0);
+    for (unsigned int i = 0; i < tasks.size(); i++)
+    {
+        if (!threaded[i])
+            transformPointsTask(&(tasks[i]));
+    }
+    for (unsigned int i = 1; i < tasks.size(); i++)
+    {
+        if (threaded[i])
+            pthread_join(threads[i], 0);
+    }
+}
+
+void transformPoints(double* x, double* y, double* z, 
+    unsigned int numPoints, const Ionflux::GeoUtils::Matrix3& matrix, 
+    unsigned int numThreads)
+{
+    Matrix4 m0(matrix);
+    transformPoints(x, y, z, numPoints, &m0, 0, 0, numThreads);
+}
+
+/// Transform a packed set of points (see transformPoints()).
+template<class T>
+void transformPointsPacked(const PointTransformTask& task, T& x, T& y, 
+    T& z)
+{
+    if (task.matrix != 0)
+        transformPointPacked(task.matrix, x, y, z);
+    if (task.view != 0)
+    {
+        transformPointProjectivePacked(task.view, x, y, z);
+        if (task.image != 0)
+            transformPointPacked(task.image, x, y, z);
+    }
+}
+
+void* transformPointsTask(void* taskArg)
+{
+    PointTransformTask* t0 = static_cast<PointTransformTask*>(taskArg);
+    unsigned int n0 = t0->numPoints 
+        - (t0->numPoints % PACKED_DOUBLE_WIDTH);
+    for (unsigned int i = 0; i < n0; i += PACKED_DOUBLE_WIDTH)
+    {
+        PackedDouble x0;
+        PackedDouble y0;
+        PackedDouble z0;
+        packedLoad(x0, t0->x + i);
+        packedLoad(y0, t0->y + i);
+        packedLoad(z0, t0->z + i);
+        transformPointsPacked(*t0, x0, y0, z0);
+        packedStore(t0->x + i, x0);
+        packedStore(t0->y + i, y0);
+        packedStore(t0->z + i, z0);
+    }
+    // remaining points
+    for (unsigned int i = n0; i < t0->numPoints; i++)
+        transformPointsPacked(*t0, t0->x[i], t0->y[i], t0->z[i]);
+    return 0;
+}
+
+void transformVertices(Ionflux::GeoUtils::Vertex3Vector& vertices, 
+    const Ionflux::GeoUtils::Matrix4* matrix, 
+    const Ionflux::GeoUtils::Matrix4* view, 
+    const Ionflux::GeoUtils::Matrix4* image, unsigned int numThreads)
+{
+    unsigned int n = vertices.size();
+    if ((n == 0) 
+        || ((matrix == 0) && (view == 0)))
+        return;
+    // gather
+    std::vector<double> c0(3 * n);
+    double* x = &(c0[0]);
+    double* y = x + n;
+    double* z = y + n;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        Vertex3* v0 = Ionflux::ObjectBase::nullPointerCheck(vertices[i], 
+            "transformVertices", "Vertex");
+        x[i] = v0->getX();
+        y[i] = v0->getY();
+        z[i] = v0->getZ();
+    }
+    transformPoints(x, y, z, n, matrix, view, image, numThreads);
+    // scatter
+    for (unsigned int i = 0; i < n; i++)
+        vertices[i]->setCoords(x[i], y[i], z[i]);
+}
+
 namespace TransformNodes
 {
 
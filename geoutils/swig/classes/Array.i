@@ -65,6 +65,8 @@ class Array
         const Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Array();
         virtual std::string getString() const;
+        virtual void getInstanceTransforms(unsigned int numItems,
+        Ionflux::GeoUtils::InstanceTransforms& target);
 		virtual Ionflux::GeoUtils::TransformNodes::Array* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Array* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -61,6 +61,9 @@ class Batch
         nodeID = "");
         virtual ~Batch();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool isDirty() const;
+        virtual unsigned int getTotalParamVersion() const;
         virtual void addControls(Ionflux::GeoUtils::ParamControlVector& 
         newControls);
 		virtual Ionflux::GeoUtils::TransformNodes::Batch* copy() const;
@@ -102,6 +105,8 @@ class Batch
         virtual void removeDimension(unsigned int removeElement);
 		virtual void removeDimensionIndex(unsigned int removeIndex);
 		virtual void clearDimensions();
+        virtual void setNumThreads(unsigned int newNumThreads);
+        virtual unsigned int getNumThreads() const;
 };
 
 }
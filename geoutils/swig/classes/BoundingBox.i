@@ -80,6 +80,16 @@ class BoundingBox
         unsigned int minItems = 0, unsigned int maxLevel = 0, unsigned int 
         splitLevel = 0, double t = Ionflux::GeoUtils::DEFAULT_TOLERANCE, 
         bool preferLongestAxis = false, double longestAxisTolerance = 0.1);
+        virtual Ionflux::GeoUtils::SplitResult splitSAH(unsigned int 
+        maxLeafItems = Ionflux::GeoUtils::DEFAULT_SAH_MAX_LEAF_ITEMS, 
+        unsigned int numBins = Ionflux::GeoUtils::DEFAULT_SAH_NUM_BINS, 
+        unsigned int maxLevel = 0, unsigned int numThreads = 0);
+        virtual double refit(bool updateItems = true, double refArea = 0.,
+        double maxAreaRatio =
+        Ionflux::GeoUtils::DEFAULT_REFIT_MAX_AREA_RATIO, unsigned int
+        maxPasses = 1);
+        virtual unsigned int rotate(unsigned int maxPasses = 1);
+        virtual double getTotalArea() const;
         virtual Ionflux::GeoUtils::BoxBoundsItemSet 
         getItemsAbovePlane(Ionflux::GeoUtils::Plane3& plane, double t = 
         Ionflux::GeoUtils::DEFAULT_TOLERANCE);
@@ -0,0 +1,95 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * BoxBoundsTree.i                 Box bounds tree (interface).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+%{
+#include "geoutils/BoxBoundsTree.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Line3;
+class Sphere3;
+class BoxBoundsItem;
+class BoundingBox;
+
+class BoxBoundsTreeClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        BoxBoundsTreeClassInfo();
+        virtual ~BoxBoundsTreeClassInfo();
+};
+
+class BoxBoundsTree
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        BoxBoundsTree();
+		BoxBoundsTree(const Ionflux::GeoUtils::BoxBoundsTree& other);
+        virtual ~BoxBoundsTree();
+        virtual void clear();
+        virtual unsigned int update(Ionflux::GeoUtils::BoundingBox* root,
+        double t = Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual void refit(bool updateItems = true);
+        virtual unsigned int getItemsOnRay(const Ionflux::GeoUtils::Line3&
+        ray, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getItemsOnLine(const Ionflux::GeoUtils::Line3&
+        line, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual Ionflux::GeoUtils::BoxBoundsItem* getFirstItemOnRay(const
+        Ionflux::GeoUtils::Line3& ray, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual Ionflux::GeoUtils::BoxBoundsItem* getAnyItemOnRay(const
+        Ionflux::GeoUtils::Line3& ray, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getItemsInSphere(const
+        Ionflux::GeoUtils::Sphere3& sphere,
+        Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getItemsInBox(Ionflux::GeoUtils::BoxBoundsItem&
+        box, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getNumNodes() const;
+        virtual unsigned int getNumItems() const;
+        virtual Ionflux::GeoUtils::BoxBoundsItem* getItem(unsigned int
+        elementIndex) const;
+        virtual unsigned int getDepth() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::BoxBoundsTree* copy() const;
+		static Ionflux::GeoUtils::BoxBoundsTree* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::BoxBoundsTree* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
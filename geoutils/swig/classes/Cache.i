@@ -57,6 +57,7 @@ class Cache
         Cache(const Ionflux::ObjectBase::IFObjectID& nodeID);
         virtual ~Cache();
         virtual std::string getString() const;
+        virtual bool sharesItems() const;
         virtual void cleanup();
         virtual void update();
 		virtual Ionflux::GeoUtils::TransformNodes::Cache* copy() const;
@@ -59,6 +59,7 @@ class Clone
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Clone();
         virtual std::string getString() const;
+        virtual bool sharesItems() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Clone* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Clone* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
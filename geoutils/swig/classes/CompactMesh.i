@@ -0,0 +1,108 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * CompactMesh.i                   Compact mesh (interface).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+%{
+#include "geoutils/CompactMesh.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Vector;
+class Vector3;
+class Mesh;
+
+class CompactMeshClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        CompactMeshClassInfo();
+        virtual ~CompactMeshClassInfo();
+};
+
+class CompactMesh
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        CompactMesh();
+		CompactMesh(const Ionflux::GeoUtils::CompactMesh& other);
+        virtual ~CompactMesh();
+        virtual void clear();
+        virtual void initFromMesh(Ionflux::GeoUtils::Mesh& mesh);
+        virtual void getMesh(Ionflux::GeoUtils::Mesh& target, bool
+        copyChannels = true) const;
+        virtual void initFromArrays(Ionflux::ObjectBase::DoubleVector&
+        newPositions, Ionflux::ObjectBase::UIntVector& newIndices,
+        Ionflux::ObjectBase::UIntVector& newFaceOffsets);
+        virtual unsigned int addVertex(double x, double y, double z);
+        virtual unsigned int addFace(const Ionflux::ObjectBase::UIntVector&
+        faceVertices);
+        virtual unsigned int addEdge(unsigned int v0, unsigned int v1);
+        virtual unsigned int addChannel(Ionflux::GeoUtils::FaceDataTypeID
+        dataType, unsigned int numComponents);
+        virtual int findChannel(Ionflux::GeoUtils::FaceDataTypeID dataType,
+        unsigned int index = 0) const;
+        virtual unsigned int getNumVertices() const;
+        virtual unsigned int getNumFaces() const;
+        virtual unsigned int getNumFaceVertices(unsigned int faceIndex)
+        const;
+        virtual unsigned int getNumIndices() const;
+        virtual unsigned int getNumEdges() const;
+        virtual unsigned int getNumChannels() const;
+        virtual Ionflux::GeoUtils::Vector3 getVertex(unsigned int
+        vertexIndex) const;
+        virtual unsigned int getFace(unsigned int faceIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual Ionflux::GeoUtils::FaceDataTypeID
+        getChannelDataType(unsigned int channelIndex) const;
+        virtual unsigned int getChannelNumComponents(unsigned int
+        channelIndex) const;
+        virtual bool isTriMesh() const;
+        virtual const double* getPositionData() const;
+        virtual const unsigned int* getIndexData() const;
+        virtual const unsigned int* getFaceOffsetData() const;
+        virtual const unsigned int* getEdgeIndexData() const;
+        virtual const double* getChannelData(unsigned int channelIndex)
+        const;
+        virtual void addBufferRef();
+        virtual void removeBufferRef();
+        virtual unsigned int getNumBufferRefs() const;
+        virtual void writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx,
+        unsigned int precision = 6, bool smoothShading = false);
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::CompactMesh* copy() const;
+		static Ionflux::GeoUtils::CompactMesh* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::CompactMesh* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
@@ -62,6 +62,10 @@ class Compose3
         virtual void setFuncsEqual(Ionflux::Mapping::Mapping* newFunc = 0);
         virtual Ionflux::GeoUtils::Vector3 
         call(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::ObjectBase::DoubleVector& targetX,
+        Ionflux::ObjectBase::DoubleVector& targetY,
+        Ionflux::ObjectBase::DoubleVector& targetZ) const;
         virtual std::string getString() const;
 		virtual Ionflux::GeoUtils::Mapping::Compose3* copy() const;
 		static Ionflux::GeoUtils::Mapping::Compose3* 
@@ -61,6 +61,8 @@ class Duplicate
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Duplicate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool sharesItems() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Duplicate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Duplicate* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -64,9 +64,13 @@ class Face
         Ionflux::GeoUtils::FaceData* initVertexColors = 0);
         virtual ~Face();
         virtual void update();
+        virtual void updateFromBounds(const Ionflux::GeoUtils::Range3&
+        newBounds);
         virtual void clearTangentSpace();
         virtual void clear();
         virtual void setFaceVertexNormals(bool flip0 = false);
+        virtual void setVertexNormals(const Ionflux::GeoUtils::Vector3&
+        normal);
         virtual void setVertexColors(const Ionflux::GeoUtils::Vector4& 
         color);
         virtual Ionflux::GeoUtils::Vector3 getTangent();
@@ -59,6 +59,8 @@ class Iterate
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Iterate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool isDirty() const;
         virtual void updateInputs();
 		virtual Ionflux::GeoUtils::TransformNodes::Iterate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Iterate* 
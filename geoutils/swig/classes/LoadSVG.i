@@ -56,6 +56,7 @@ class LoadSVG
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~LoadSVG();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::LoadSVG* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::LoadSVG* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
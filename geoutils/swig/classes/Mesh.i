@@ -65,6 +65,21 @@ Ionflux::GeoUtils::TransformableObject
         virtual void copyVertices();
         virtual void update(bool updateFaces = true, bool updateEdges = 
         true);
+        virtual void updateGeometry(unsigned int numThreads = 0);
+        virtual void clearFaceGeometry();
+        virtual bool hasFaceGeometry() const;
+        virtual Ionflux::GeoUtils::Vector3 getFaceNormal(unsigned int
+        faceIndex) const;
+        virtual Ionflux::GeoUtils::Vector3 getFaceTangent(unsigned int
+        faceIndex) const;
+        virtual Ionflux::GeoUtils::Vector3 getFaceBinormal(unsigned int
+        faceIndex) const;
+        virtual Ionflux::GeoUtils::Range3 getFaceBounds(unsigned int
+        faceIndex) const;
+        virtual const double* getFaceNormalData() const;
+        virtual const double* getFaceTangentData() const;
+        virtual const double* getFaceBinormalData() const;
+        virtual void updateBounds();
         virtual void clear();
         virtual void clearData();
         virtual void setFaceIDs();
@@ -131,6 +146,8 @@ Ionflux::GeoUtils::TransformableObject
         virtual bool isTriMesh() const;
         virtual unsigned int createEdges();
         virtual void merge(Ionflux::GeoUtils::Mesh& other);
+        virtual unsigned int weld(double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE, unsigned int numThreads = 0);
         virtual void writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx, 
         unsigned int precision = 6, bool smoothShading = false);
         virtual std::string getValueString() const;
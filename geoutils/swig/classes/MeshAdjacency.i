@@ -0,0 +1,112 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * MeshAdjacency.i                 Mesh adjacency (interface).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+%{
+#include "geoutils/MeshAdjacency.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Mesh;
+class CompactMesh;
+
+class MeshAdjacencyClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        MeshAdjacencyClassInfo();
+        virtual ~MeshAdjacencyClassInfo();
+};
+
+class MeshAdjacency
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        MeshAdjacency();
+		MeshAdjacency(const Ionflux::GeoUtils::MeshAdjacency& other);
+        virtual ~MeshAdjacency();
+        virtual void clear();
+        virtual unsigned int update(const Ionflux::GeoUtils::Mesh& mesh,
+        unsigned int numThreads = 0);
+        virtual unsigned int update(const Ionflux::GeoUtils::CompactMesh&
+        mesh, unsigned int numThreads = 0);
+        virtual unsigned int getNumVertices() const;
+        virtual unsigned int getNumFaces() const;
+        virtual unsigned int getNumHalfEdges() const;
+        virtual unsigned int getNumEdges() const;
+        virtual unsigned int getHalfEdgeSource(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getHalfEdgeTarget(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getNextHalfEdge(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getPrevHalfEdge(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getTwin(unsigned int halfEdgeIndex) const;
+        virtual unsigned int getHalfEdgeFace(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getHalfEdgeEdge(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getFaceHalfEdge(unsigned int faceIndex) const;
+        virtual unsigned int getEdgeHalfEdge(unsigned int edgeIndex,
+        unsigned int index = 0) const;
+        virtual unsigned int getEdgeNumFaces(unsigned int edgeIndex) const;
+        virtual bool isBoundaryEdge(unsigned int edgeIndex) const;
+        virtual bool isNonManifoldEdge(unsigned int edgeIndex) const;
+        virtual unsigned int getEdgeFaces(unsigned int edgeIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getFaceNeighbors(unsigned int faceIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getVertexHalfEdges(unsigned int vertexIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getVertexFaces(unsigned int vertexIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getVertexNeighbors(unsigned int vertexIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int
+        getBoundaryEdges(Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int
+        getNonManifoldEdges(Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int
+        getBoundaryLoops(Ionflux::ObjectBase::UIntVector& target,
+        Ionflux::ObjectBase::UIntVector& offsets) const;
+        virtual bool isClosed() const;
+        virtual bool isManifold() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::MeshAdjacency* copy() const;
+		static Ionflux::GeoUtils::MeshAdjacency* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::MeshAdjacency* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
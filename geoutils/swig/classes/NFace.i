@@ -70,6 +70,9 @@ Ionflux::GeoUtils::TransformableObject
         virtual ~NFace();
         virtual void copyVertices();
         virtual void update();
+        virtual void updateBounds();
+        virtual void updateFromBounds(const Ionflux::GeoUtils::Range3&
+        newBounds);
         virtual void clearPolygon();
         virtual void clear();
         virtual void addVertices(unsigned int v0, unsigned int v1 = 
@@ -134,6 +137,8 @@ Ionflux::GeoUtils::TransformableObject
         virtual void getEdge(Ionflux::GeoUtils::Edge& target) const;
         virtual Ionflux::GeoUtils::Edge getEdge0() const;
         virtual void applyVertexIndexOffset(int offset);
+        virtual void applyVertexIndexMap(const
+        Ionflux::ObjectBase::UIntVector& indexMap);
         virtual void getTris(Ionflux::GeoUtils::NFaceVector& target);
         virtual void getTris(Ionflux::GeoUtils::NFaceSet& target);
         virtual Ionflux::GeoUtils::NFaceVector getTris0();
@@ -58,6 +58,8 @@ class ParamControl
         COORDINATE_NOT_SET);
         virtual ~ParamControl();
         virtual void call(Ionflux::Mapping::MappingValue value) const;
+        virtual Ionflux::Mapping::MappingValue
+        getValue(Ionflux::Mapping::MappingValue value) const;
         virtual void operator()(Ionflux::Mapping::MappingValue value) 
         const;
         virtual std::string getString() const;
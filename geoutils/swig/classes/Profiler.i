@@ -0,0 +1,91 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * Profiler.i                      Transform node profiler (interface).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+%{
+#include "geoutils/Profiler.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+namespace TransformNodes
+{
+
+class ProfilerClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        ProfilerClassInfo();
+        virtual ~ProfilerClassInfo();
+};
+
+class Profiler
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        Profiler();
+		Profiler(const Ionflux::GeoUtils::TransformNodes::Profiler& other);
+        virtual ~Profiler();
+        virtual void clear();
+        virtual void begin(Ionflux::GeoUtils::TransformNodes::TransformNode*
+        node);
+        virtual void end(Ionflux::GeoUtils::TransformNodes::TransformNode*
+        node, Ionflux::ObjectBase::UInt64 numInputItems = 0);
+        virtual void
+        cancel(Ionflux::GeoUtils::TransformNodes::TransformNode* node);
+        virtual void
+        removeNode(Ionflux::GeoUtils::TransformNodes::TransformNode* node);
+        virtual unsigned int getNumProfiles() const;
+        virtual Ionflux::GeoUtils::TransformNodeProfile getProfile(unsigned
+        int index) const;
+        virtual int
+        findProfile(Ionflux::GeoUtils::TransformNodes::TransformNode* node)
+        const;
+        virtual unsigned int getNumEvents() const;
+        virtual Ionflux::GeoUtils::TransformProfilerEvent getEvent(unsigned
+        int index) const;
+        virtual unsigned int getNumThreads() const;
+        virtual std::string getSummary(unsigned int maxProfiles = 0) const;
+        virtual std::string getJSON() const;
+        virtual void writeJSON(const std::string& fileName) const;
+        virtual std::string getTrace() const;
+        virtual void writeTrace(const std::string& fileName) const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::TransformNodes::Profiler* copy() const;
+		static Ionflux::GeoUtils::TransformNodes::Profiler* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::TransformNodes::Profiler* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+}
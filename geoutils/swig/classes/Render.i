@@ -66,6 +66,7 @@ class Render
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Render();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
         virtual void addStyles(const 
         Ionflux::GeoUtils::SVGShapeStyleVector& newStyles);
 		virtual Ionflux::GeoUtils::TransformNodes::Render* copy() const;
@@ -100,6 +101,11 @@ class Render
         virtual void setBackgroundColor(const Ionflux::Altjira::Color& 
         newBackgroundColor);
         virtual Ionflux::Altjira::Color getBackgroundColor() const;
+        virtual void setBackend(Ionflux::GeoUtils::RenderBackendID 
+        newBackend);
+        virtual Ionflux::GeoUtils::RenderBackendID getBackend() const;
+        virtual void setNumThreads(unsigned int newNumThreads);
+        virtual unsigned int getNumThreads() const;
 };
 
 }
@@ -64,6 +64,7 @@ class Rotate
         CENTER_ORIGIN, const Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Rotate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Rotate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Rotate* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
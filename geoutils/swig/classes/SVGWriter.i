@@ -0,0 +1,83 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * SVGWriter.i                     SVG writer (interface).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+%{
+#include "geoutils/SVGWriter.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Polygon3;
+class Polygon3Set;
+
+class SVGWriterClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        SVGWriterClassInfo();
+        virtual ~SVGWriterClassInfo();
+};
+
+class SVGWriter
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        SVGWriter();
+		SVGWriter(const Ionflux::GeoUtils::SVGWriter& other);
+        virtual ~SVGWriter();
+        virtual void writeFile(const std::string& fileName,
+        Ionflux::GeoUtils::Polygon3Set& polygons, const
+        Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0, unsigned int
+        width = 1000, unsigned int height = 1000, int originX = 500, int
+        originY = 500, const std::string& svgTemplate =
+        Ionflux::GeoUtils::SVG_TEMPLATE);
+        virtual std::string getString() const;
+		virtual Ionflux::GeoUtils::SVGWriter* copy() const;
+		static Ionflux::GeoUtils::SVGWriter* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::SVGWriter* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+        virtual void setPrecision(unsigned int newPrecision);
+        virtual unsigned int getPrecision() const;
+        virtual void setCoalescePaths(bool newCoalescePaths);
+        virtual bool getCoalescePaths() const;
+        virtual void setElementIDPrefix(const std::string& newElementIDPrefix);
+        virtual std::string getElementIDPrefix() const;
+        virtual void setAxis(Ionflux::GeoUtils::AxisID newAxis);
+        virtual Ionflux::GeoUtils::AxisID getAxis() const;
+        virtual void setShapeType(Ionflux::GeoUtils::SVGShapeType newShapeType);
+        virtual Ionflux::GeoUtils::SVGShapeType getShapeType() const;
+        virtual void setClosePath(bool newClosePath);
+        virtual bool getClosePath() const;
+};
+
+}
+
+}
@@ -63,6 +63,7 @@ class Scale
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Scale();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Scale* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Scale* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -77,6 +77,10 @@ class Scatter
         "");
         virtual ~Scatter();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual void
+        getInstanceTransforms(Ionflux::GeoUtils::TransformableGroup& source,
+        Ionflux::GeoUtils::InstanceTransforms& target);
         static Ionflux::GeoUtils::Mapping::Vector3Mapping* 
         createLUT(unsigned int numEntries = DEFAULT_NUM_LUT_ENTRIES, const 
         Ionflux::GeoUtils::Vector3& stdDev = 
@@ -97,6 +97,21 @@ class TransformGraph
         Ionflux::GeoUtils::TransformNodes::InputNodeSpec& newInput, 
         unsigned int inputID = INPUT_NEXT_FREE);
         virtual void update();
+        virtual void getSchedule(Ionflux::GeoUtils::TransformNodeVector&
+        target);
+        virtual unsigned int getNumNodeUpdates() const;
+        virtual unsigned int getNumEliminatedUpdates() const;
+        virtual bool isThreadSafe() const;
+        virtual bool sharesItems() const;
+        virtual Ionflux::GeoUtils::TransformNodes::TransformNode*
+        createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap) const;
+        virtual void remapInputs(const Ionflux::GeoUtils::TransformNodeMap&
+        nodeMap);
+        virtual bool isDirty() const;
+        virtual unsigned int getTotalParamVersion() const;
+        virtual void
+        setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler*
+        newProfiler);
 		virtual Ionflux::GeoUtils::TransformNodes::TransformGraph* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::TransformGraph* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -172,6 +187,10 @@ class TransformGraph
         newDrain);
         virtual Ionflux::GeoUtils::TransformNodes::TransformNode* 
         getDrain() const;
+        virtual void setNumThreads(unsigned int newNumThreads);
+        virtual unsigned int getNumThreads() const;
+        virtual void setIncremental(bool newIncremental);
+        virtual bool getIncremental() const;
 };
 
 }
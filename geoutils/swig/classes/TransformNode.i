@@ -68,6 +68,15 @@ class TransformNode
         virtual void cleanup();
         virtual void update();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool sharesItems() const;
+        virtual Ionflux::GeoUtils::TransformNodes::TransformNode*
+        createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap) const;
+        virtual void remapInputs(const Ionflux::GeoUtils::TransformNodeMap&
+        nodeMap);
+        virtual void touch();
+        virtual bool isDirty() const;
+        virtual unsigned int getTotalParamVersion() const;
         virtual std::string getDebugInfo(bool expand = true);
         virtual void enableDebugMode(bool newDebugMode = true, bool expand 
         = false);
@@ -111,6 +120,17 @@ class TransformNode
         virtual unsigned int getMaxNumInputs() const;
         virtual void setUpdateCounter(unsigned int newUpdateCounter);
         virtual unsigned int getUpdateCounter() const;
+        virtual void setScheduled(bool newScheduled);
+        virtual bool getScheduled() const;
+        virtual void setPendingConsumers(unsigned int newPendingConsumers);
+        virtual unsigned int getPendingConsumers() const;
+        virtual void setParamVersion(unsigned int newParamVersion);
+        virtual unsigned int getParamVersion() const;
+        virtual void 
+        setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler* 
+        newProfiler);
+        virtual Ionflux::GeoUtils::TransformNodes::Profiler* getProfiler() 
+        const;
 };
 
 }
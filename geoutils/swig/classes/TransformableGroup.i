@@ -71,7 +71,13 @@ class TransformableGroup
         virtual Ionflux::GeoUtils::TransformableGroup& transformVI(const 
         Ionflux::GeoUtils::Matrix4& view, const Ionflux::GeoUtils::Matrix4*
         image = 0);
+        virtual void transformItems(const
+        Ionflux::GeoUtils::InstanceTransforms& transforms);
         virtual Ionflux::GeoUtils::TransformableGroup& duplicate();
+        virtual Ionflux::GeoUtils::TransformableGroup& instance();
+        virtual void addSharedItem(Ionflux::GeoUtils::TransformableObject*
+        addElement);
+        virtual unsigned int detachItems();
         virtual Ionflux::GeoUtils::TransformableGroup& flatten();
         virtual void getLeafItems(Ionflux::GeoUtils::TransformableGroup& 
         target, unsigned int level = 0);
@@ -93,6 +93,9 @@ class TransformableObject
         virtual bool transformChanged() const;
         virtual bool viChanged() const;
         virtual Ionflux::GeoUtils::TransformableObject& duplicate();
+        virtual void addShare();
+        virtual void removeShare();
+        virtual unsigned int getNumShares() const;
         virtual Ionflux::GeoUtils::Matrix4* getTransformMatrix() const;
         virtual Ionflux::GeoUtils::Matrix4* getViewMatrix() const;
         virtual Ionflux::GeoUtils::Matrix4* getImageMatrix() const;
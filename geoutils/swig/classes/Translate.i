@@ -60,6 +60,7 @@ class Translate
         const Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Translate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Translate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Translate* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
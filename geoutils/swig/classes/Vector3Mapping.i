@@ -58,6 +58,10 @@ class Vector3Mapping
         virtual Ionflux::GeoUtils::Vector3 
         call(Ionflux::Mapping::MappingValue value) const = 0;
         virtual std::string getString() const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::ObjectBase::DoubleVector& targetX,
+        Ionflux::ObjectBase::DoubleVector& targetY,
+        Ionflux::ObjectBase::DoubleVector& targetZ) const;
 		static Ionflux::GeoUtils::Mapping::Vector3Mapping* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
 };
@@ -54,6 +54,7 @@ class VertexAttribute
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_POSITION;
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_DATA;
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_INDEX;
+		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_NORMAL;
         
         VertexAttribute();
 		VertexAttribute(const Ionflux::GeoUtils::VertexAttribute& other);
@@ -85,6 +86,12 @@ class VertexAttribute
         Ionflux::GeoUtils::NFace::TYPE_FACE, 
         Ionflux::GeoUtils::FaceDataTypeID faceDataType = 
         FaceData::TYPE_VERTEX_NORMAL);
+        virtual unsigned int setData(const Ionflux::GeoUtils::CompactMesh&
+        mesh, Ionflux::GeoUtils::VertexAttributeTypeID attrType =
+        TYPE_POSITION, Ionflux::GeoUtils::NFaceTypeID nFaceType =
+        Ionflux::GeoUtils::NFace::TYPE_FACE,
+        Ionflux::GeoUtils::FaceDataTypeID faceDataType =
+        FaceData::TYPE_VERTEX_NORMAL);
         virtual float getFloat(unsigned int elementIndex, unsigned int 
         componentIndex = 0);
         virtual unsigned int getUInt(unsigned int elementIndex, unsigned 
@@ -101,6 +108,9 @@ class VertexAttribute
         int v0, unsigned int v1, unsigned int v2 = 0, unsigned int v3 = 0);
         virtual void draw(Ionflux::GeoUtils::PrimitiveID primitiveID, 
         unsigned int drawNumPrimitives = 0, unsigned int startIndex = 0);
+        virtual void addBufferRef();
+        virtual void removeBufferRef();
+        virtual unsigned int getNumBufferRefs() const;
         virtual std::string getValueString() const;
         static std::string 
         getTypeIDString(Ionflux::GeoUtils::VertexAttributeTypeID typeID);
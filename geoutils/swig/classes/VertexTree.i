@@ -0,0 +1,81 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * VertexTree.i                    Vertex tree (interface).
+ * =========================================================================
+ * 
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is free software; you can 
+ * redistribute it and/or modify it under the terms of the GNU General 
+ * Public License as published by the Free Software Foundation; either 
+ * version 3 of the License, or (at your option) any later version.
+ * 
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it 
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied 
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See 
+ * the GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License along 
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free 
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 
+ * 02111-1307 USA
+ * 
+ * ========================================================================== */
+%{
+#include "geoutils/VertexTree.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Vector3;
+class Vertex3Set;
+
+class VertexTreeClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        VertexTreeClassInfo();
+        virtual ~VertexTreeClassInfo();
+};
+
+class VertexTree
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        VertexTree();
+		VertexTree(const Ionflux::GeoUtils::VertexTree& other);
+        virtual ~VertexTree();
+        virtual void clear();
+        virtual unsigned int update(Ionflux::GeoUtils::Vertex3Set* vertices,
+        unsigned int newMaxLeafVertices =
+        Ionflux::GeoUtils::DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES, unsigned
+        int numThreads = 0);
+        virtual int findNearest(const Ionflux::GeoUtils::Vector3& p, double
+        eps = 0.) const;
+        virtual unsigned int findKNearest(const Ionflux::GeoUtils::Vector3&
+        p, unsigned int k, Ionflux::ObjectBase::UIntVector& target,
+        Ionflux::ObjectBase::DoubleVector* distances = 0, double eps = 0.)
+        const;
+        virtual unsigned int findInRadius(const Ionflux::GeoUtils::Vector3&
+        p, double r, Ionflux::ObjectBase::UIntVector& target,
+        Ionflux::ObjectBase::DoubleVector* distances = 0) const;
+        virtual unsigned int getNumVertices() const;
+        virtual unsigned int getMaxLeafVertices() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::VertexTree* copy() const;
+		static Ionflux::GeoUtils::VertexTree* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::VertexTree* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
@@ -64,6 +64,7 @@ class WritePNG
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~WritePNG();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
         virtual void addStyles(const 
         Ionflux::GeoUtils::SVGShapeStyleVector& newStyles);
 		virtual Ionflux::GeoUtils::TransformNodes::WritePNG* copy() const;
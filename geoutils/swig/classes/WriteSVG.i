@@ -66,6 +66,7 @@ class WriteSVG
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~WriteSVG();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
         virtual void addStyles(const 
         Ionflux::GeoUtils::SVGShapeStyleVector& newStyles);
 		virtual Ionflux::GeoUtils::TransformNodes::WriteSVG* copy() const;
@@ -109,6 +110,10 @@ class WriteSVG
         virtual unsigned int getOriginY() const;
         virtual void setSvgTemplate(const std::string& newSvgTemplate);
         virtual std::string getSvgTemplate() const;
+        virtual void setCoalescePaths(bool newCoalescePaths);
+        virtual bool getCoalescePaths() const;
+        virtual void setPrecision(unsigned int newPrecision);
+        virtual unsigned int getPrecision() const;
 };
 
 }
@@ -167,6 +167,11 @@ Ionflux::GeoUtils::TransformableObject
         const Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0, 
         Ionflux::GeoUtils::AxisID axis = Ionflux::GeoUtils::AXIS_Y, bool 
         closePath = true, int originX = 0, int originY = 0);
+        virtual void rasterizePolygons(Ionflux::GeoUtils::Polygon3Set& 
+        polygons, const Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0, 
+        Ionflux::GeoUtils::AxisID axis = Ionflux::GeoUtils::AXIS_Y, int 
+        originX = 0, int originY = 0, unsigned int numThreads = 0, unsigned 
+        int tileSize = Ionflux::GeoUtils::DEFAULT_RASTER_TILE_SIZE);
         virtual void drawSVG(Ionflux::GeoUtils::SVG& svg, int originX = 0, 
         int originY = 0);
         virtual void drawImage(Ionflux::GeoUtils::Image* image, int originX
@@ -193,6 +198,24 @@ Ionflux::GeoUtils::TransformableObject
         markPixels, const Ionflux::Altjira::Color& color = 
         Ionflux::Altjira::Color::BLUE, const 
         Ionflux::Altjira::ColorBlender* blender = 0);
+        virtual unsigned int getPixelSpansOnRay(const
+        Ionflux::GeoUtils::Line3& ray, Ionflux::GeoUtils::PixelSpanVector&
+        target, double t = Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getPixelSpansInSphere(const
+        Ionflux::GeoUtils::Sphere3& sphere,
+        Ionflux::GeoUtils::PixelSpanVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getPixelSpansInBox(const
+        Ionflux::GeoUtils::BoxBoundsItem& box,
+        Ionflux::GeoUtils::PixelSpanVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int
+        getPixelSpansInPolygon(Ionflux::GeoUtils::Polygon3& polygon,
+        Ionflux::GeoUtils::PixelSpanVector& target);
+        virtual void markPixelSpans(const
+        Ionflux::GeoUtils::PixelSpanVector& spans, const
+        Ionflux::Altjira::Color& color = Ionflux::Altjira::Color::BLUE,
+        const Ionflux::Altjira::ColorBlender* blender = 0);
 		virtual Ionflux::GeoUtils::Image* copy() const;
 		static Ionflux::GeoUtils::Image* upcast(Ionflux::ObjectBase::IFObject* 
 		other);
@@ -238,6 +261,7 @@ class LoadSVG
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~LoadSVG();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::LoadSVG* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::LoadSVG* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -305,6 +329,7 @@ class WritePNG
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~WritePNG();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
         virtual void addStyles(const 
         Ionflux::GeoUtils::SVGShapeStyleVector& newStyles);
 		virtual Ionflux::GeoUtils::TransformNodes::WritePNG* copy() const;
@@ -393,6 +418,7 @@ class Render
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Render();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
         virtual void addStyles(const 
         Ionflux::GeoUtils::SVGShapeStyleVector& newStyles);
 		virtual Ionflux::GeoUtils::TransformNodes::Render* copy() const;
@@ -427,6 +453,11 @@ class Render
         virtual void setBackgroundColor(const Ionflux::Altjira::Color& 
         newBackgroundColor);
         virtual Ionflux::Altjira::Color getBackgroundColor() const;
+        virtual void setBackend(Ionflux::GeoUtils::RenderBackendID 
+        newBackend);
+        virtual Ionflux::GeoUtils::RenderBackendID getBackend() const;
+        virtual void setNumThreads(unsigned int newNumThreads);
+        virtual unsigned int getNumThreads() const;
 };
 
 }
@@ -0,0 +1,185 @@
+/* ==========================================================================
+ * GeoUtils - Ionflux' Geometry Library
+ * Copyright © 2009-2013 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * buffer.i                        Exported buffers (interface).
+ * =========================================================================
+ *
+ * This file is part of GeoUtils - Ionflux' Geometry Library.
+ *
+ * GeoUtils - Ionflux' Geometry Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * GeoUtils - Ionflux' Geometry Library is distributed in the hope that it
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with GeoUtils - Ionflux' Geometry Library; if not, write to the Free
+ * Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+ *
+ * ========================================================================== */
+
+/* Buffer exporter.
+ *
+ * Define a Python buffer type that exports data owned by an object of
+ * type OWNER_TYPE without copying, and the functions
+ * create<PREFIX>Buffer() and get<PREFIX>BufferOwner() for creating
+ * memory views of that data. OWNER_TYPE must provide addBufferRef() and
+ * removeBufferRef(). The buffer keeps the owner alive and the data of the
+ * owner cannot be reallocated until all views of the buffer have been
+ * released. If READ_ONLY is 1, requests for writable views are rejected.
+ *
+ * PREFIX           Prefix for type and function names.
+ * OWNER_TYPE       Owner type.
+ * OWNER_DESCRIPTOR SWIG type descriptor of the owner type.
+ * OWNER_NAME       Owner type name (string, for messages).
+ * TYPE_NAME        Python type name (string).
+ * READ_ONLY        Read-only flag (0 or 1).
+ */
+%define %buffer_exporter(PREFIX, OWNER_TYPE, OWNER_DESCRIPTOR, OWNER_NAME, TYPE_NAME, READ_ONLY)
+%{
+/* Exported buffer. */
+struct PREFIX##Buffer
+{
+    PyObject_HEAD
+    /* Owner (Python object). */
+    PyObject* owner;
+    /* Owner. */
+    OWNER_TYPE* ownerObject;
+    /* Data. */
+    char* data;
+    /* Number of dimensions. */
+    int numDims;
+    /* Shape. */
+    Py_ssize_t shape[2];
+    /* Strides. */
+    Py_ssize_t strides[2];
+    /* Item size. */
+    Py_ssize_t itemSize;
+    /* Format. */
+    const char* format;
+};
+
+void delete##PREFIX##Buffer(PyObject* obj)
+{
+    PREFIX##Buffer* b0 = reinterpret_cast<PREFIX##Buffer*>(obj);
+    b0->ownerObject->removeBufferRef();
+    b0->ownerObject->removeRef();
+    Py_XDECREF(b0->owner);
+    Py_TYPE(obj)->tp_free(obj);
+}
+
+int get##PREFIX##BufferView(PyObject* obj, Py_buffer* view, int flags)
+{
+    PREFIX##Buffer* b0 = reinterpret_cast<PREFIX##Buffer*>(obj);
+    if (READ_ONLY
+        && ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE))
+    {
+        PyErr_SetString(PyExc_BufferError, "Buffer is read-only.");
+        view->obj = 0;
+        return -1;
+    }
+    view->obj = obj;
+    Py_INCREF(obj);
+    view->buf = b0->data;
+    view->len = b0->shape[0] * b0->strides[0];
+    view->readonly = READ_ONLY;
+    view->itemsize = b0->itemSize;
+    view->format = 0;
+    if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+        view->format = const_cast<char*>(b0->format);
+    view->ndim = 1;
+    view->shape = 0;
+    if ((flags & PyBUF_ND) == PyBUF_ND)
+    {
+        view->ndim = b0->numDims;
+        view->shape = b0->shape;
+    }
+    view->strides = 0;
+    if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+        view->strides = b0->strides;
+    view->suboffsets = 0;
+    view->internal = 0;
+    return 0;
+}
+
+PyTypeObject* get##PREFIX##BufferType()
+{
+    static PyBufferProcs bufferProcs;
+    static PyTypeObject bufferType = { PyVarObject_HEAD_INIT(0, 0) };
+    static bool ready = false;
+    if (!ready)
+    {
+        bufferProcs.bf_getbuffer = get##PREFIX##BufferView;
+        bufferType.tp_name = TYPE_NAME;
+        bufferType.tp_basicsize = sizeof(PREFIX##Buffer);
+        bufferType.tp_dealloc = delete##PREFIX##Buffer;
+        bufferType.tp_as_buffer = &bufferProcs;
+        bufferType.tp_flags = Py_TPFLAGS_DEFAULT;
+        bufferType.tp_doc = OWNER_NAME " data buffer.";
+        if (PyType_Ready(&bufferType) < 0)
+            return 0;
+        ready = true;
+    }
+    return &bufferType;
+}
+
+OWNER_TYPE* get##PREFIX##BufferOwner(PyObject* owner)
+{
+    void* p0 = 0;
+    if (!SWIG_IsOK(SWIG_ConvertPtr(owner, &p0, OWNER_DESCRIPTOR, 0))
+        || (p0 == 0))
+    {
+        PyErr_SetString(PyExc_TypeError,
+            "Buffer owner is not a " OWNER_NAME ".");
+        return 0;
+    }
+    return static_cast<OWNER_TYPE*>(p0);
+}
+
+PyObject* create##PREFIX##Buffer(PyObject* owner, OWNER_TYPE* ownerObject,
+    const void* data, Py_ssize_t numElements, Py_ssize_t elementSize,
+    Py_ssize_t itemSize, const char* format)
+{
+    static char empty0 = 0;
+    PyTypeObject* t0 = get##PREFIX##BufferType();
+    if (t0 == 0)
+        return 0;
+    PREFIX##Buffer* b0 = PyObject_New(PREFIX##Buffer, t0);
+    if (b0 == 0)
+        return 0;
+    b0->data = static_cast<char*>(const_cast<void*>(data));
+    if ((b0->data == 0)
+        || (numElements == 0))
+    {
+        b0->data = &empty0;
+        numElements = 0;
+    }
+    b0->numDims = 1;
+    if ((numElements > 0)
+        && (elementSize > 1))
+        b0->numDims = 2;
+    b0->shape[0] = numElements;
+    b0->shape[1] = elementSize;
+    b0->strides[0] = elementSize * itemSize;
+    b0->strides[1] = itemSize;
+    b0->itemSize = itemSize;
+    b0->format = format;
+    Py_INCREF(owner);
+    b0->owner = owner;
+    ownerObject->addRef();
+    ownerObject->addBufferRef();
+    b0->ownerObject = ownerObject;
+    PyObject* result = PyMemoryView_FromObject(
+        reinterpret_cast<PyObject*>(b0));
+    Py_DECREF(b0);
+    return result;
+}
+%}
+%enddef
@@ -94,6 +94,8 @@ typedef std::vector<Ionflux::GeoUtils::BoxBoundsItem*> BoxBoundsItemVector;
 typedef std::set<Ionflux::GeoUtils::BoundingBox*> BoundingBoxSet;
 typedef std::vector<Ionflux::GeoUtils::BoundingBox*> BoundingBoxVector;
 
+typedef int BoxBoundsTreeQueryID;
+
 struct SplitTestResult
 {
     Ionflux::GeoUtils::BoxBoundsItemSet items0;
@@ -155,10 +157,36 @@ typedef std::map<std::string, Ionflux::GeoUtils::SVGShapeStyle*>
 
 typedef int SVGShapeType;
 
+typedef int RenderBackendID;
+
+struct PixelSpan
+{
+    unsigned int y;
+    unsigned int x0;
+    unsigned int x1;
+};
+
+typedef std::vector<Ionflux::GeoUtils::PixelSpan> PixelSpanVector;
+
+struct InstanceTransforms
+{
+    Ionflux::ObjectBase::DoubleVector offsetX;
+    Ionflux::ObjectBase::DoubleVector offsetY;
+    Ionflux::ObjectBase::DoubleVector offsetZ;
+    Ionflux::ObjectBase::DoubleVector scaleX;
+    Ionflux::ObjectBase::DoubleVector scaleY;
+    Ionflux::ObjectBase::DoubleVector scaleZ;
+    Ionflux::ObjectBase::DoubleVector centerX;
+    Ionflux::ObjectBase::DoubleVector centerY;
+    Ionflux::ObjectBase::DoubleVector centerZ;
+};
+
 class TransformableObject;
 
 typedef std::vector<Ionflux::GeoUtils::TransformableObject*> 
     TransformableObjectVector;
+typedef std::map<Ionflux::GeoUtils::TransformableObject*, unsigned int> 
+    SharedItemMap;
 typedef std::vector<Ionflux::GeoUtils::Vector3*> Vector3Vector;
 typedef std::vector<Ionflux::GeoUtils::TransformableGroup*> 
     TransformableGroupVector;
@@ -176,6 +204,8 @@ namespace TransformNodes
 class TransformNode;
 class Connection;
 class ParamControl;
+class Source;
+class Profiler;
 
 struct InputNodeSpec
 {
@@ -193,6 +223,30 @@ typedef std::vector<Ionflux::GeoUtils::TransformNodes::Connection*>
     ConnectionVector;
 typedef std::vector<Ionflux::GeoUtils::TransformNodes::ParamControl*> 
     ParamControlVector;
+typedef std::map<Ionflux::GeoUtils::TransformNodes::TransformNode*, 
+    Ionflux::GeoUtils::TransformNodes::TransformNode*> TransformNodeMap;
+
+struct TransformNodeProfile
+{
+    Ionflux::GeoUtils::TransformNodes::TransformNode* node;
+    std::string label;
+    unsigned int numCalls;
+    double inclusiveTime;
+    double exclusiveTime;
+    Ionflux::ObjectBase::UInt64 numInputItems;
+    Ionflux::ObjectBase::UInt64 numOutputItems;
+    Ionflux::ObjectBase::UInt64 outputObjectBytes;
+};
+
+struct TransformProfilerEvent
+{
+    unsigned int profileIndex;
+    unsigned int threadIndex;
+    unsigned int depth;
+    double startTime;
+    double duration;
+    double childTime;
+};
 
 class Vector;
 class VectorSet;
@@ -323,6 +377,14 @@ const Ionflux::GeoUtils::SVGShapeType SHAPE_TYPE_POLYGON = 0;
 const Ionflux::GeoUtils::SVGShapeType SHAPE_TYPE_PATH = 1;
 const Ionflux::GeoUtils::SVGShapeType DEFAULT_SHAPE_TYPE = SHAPE_TYPE_POLYGON;
 
+const Ionflux::GeoUtils::RenderBackendID RENDER_BACKEND_CAIRO = 0;
+const Ionflux::GeoUtils::RenderBackendID RENDER_BACKEND_SCANLINE = 1;
+const unsigned int DEFAULT_RASTER_TILE_SIZE = 64;
+const unsigned int DEFAULT_SVG_PRECISION = 3;
+const unsigned int SVG_WRITER_MAX_PRECISION = 17;
+const unsigned int SVG_WRITER_BUFFER_SIZE = 65536;
+const unsigned int SVG_WRITER_MIN_POLYGONS = 10000;
+
 const unsigned int COORDINATE_NOT_SET = UINT_MAX;
 
 const Ionflux::GeoUtils::MatrixSamplingMethod SAMPLE_AVERAGE = 0;
@@ -333,6 +395,23 @@ const Ionflux::GeoUtils::QuadInterpolationTypeID
 const Ionflux::GeoUtils::QuadInterpolationTypeID 
     QUAD_INTERPOLATION_BILINEAR = 1;
 
+const unsigned int DEFAULT_SAH_NUM_BINS = 16;
+const unsigned int DEFAULT_SAH_MAX_LEAF_ITEMS = 4;
+const unsigned int SAH_PARALLEL_MIN_ITEMS = 4096;
+const double DEFAULT_REFIT_MAX_AREA_RATIO = 1.25;
+const unsigned int DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES = 8;
+const unsigned int VERTEX_TREE_PARALLEL_MIN_VERTICES = 8192;
+const unsigned int HALF_EDGE_NONE = UINT_MAX;
+const unsigned int MESH_ADJACENCY_PARALLEL_MIN_HALF_EDGES = 65536;
+const unsigned int VERTEX_TRANSFORM_PARALLEL_MIN_VERTICES = 65536;
+const unsigned int OBJ_PARSE_PARALLEL_MIN_BYTES = 4194304;
+const unsigned int MESH_IO_BUFFER_SIZE = 1048576;
+const unsigned int MESH_UPDATE_PARALLEL_MIN_FACES = 8192;
+
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_ALL = 0;
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_FIRST = 1;
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_ANY = 2;
+
 namespace TransformNodes
 {
 
@@ -484,6 +563,36 @@ void getSVGPolygons(const std::string& fileName,
 void getBoundingBox(const std::string& fileName, const std::string& elementID, 
     Ionflux::GeoUtils::BoundingBox& target);
 
+// meshio.hpp
+
+class Mesh;
+class CompactMesh;
+
+void readOBJ(const std::string& fileName, 
+    Ionflux::GeoUtils::CompactMesh& target, unsigned int numThreads = 0);
+void readOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& target, 
+    unsigned int numThreads = 0);
+void writeOBJ(const std::string& fileName, 
+    const Ionflux::GeoUtils::CompactMesh& source, 
+    unsigned int precision = 6, bool smoothShading = false);
+void writeOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& source, 
+    unsigned int precision = 6, bool smoothShading = false);
+void readPLY(const std::string& fileName, 
+    Ionflux::GeoUtils::CompactMesh& target);
+void readPLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& target);
+void writePLY(const std::string& fileName, 
+    const Ionflux::GeoUtils::CompactMesh& source, 
+    bool doublePrecision = false);
+void writePLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& source, 
+    bool doublePrecision = false);
+void readSTL(const std::string& fileName, 
+    Ionflux::GeoUtils::CompactMesh& target, bool weldVertices = true);
+void readSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& target, 
+    bool weldVertices = true);
+void writeSTL(const std::string& fileName, 
+    const Ionflux::GeoUtils::CompactMesh& source);
+void writeSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& source);
+
 // Classes
 
 %rename(mult2) operator*(double, const Ionflux::GeoUtils::Vector2&);
@@ -2151,6 +2260,9 @@ class TransformableObject
         virtual bool transformChanged() const;
         virtual bool viChanged() const;
         virtual Ionflux::GeoUtils::TransformableObject& duplicate();
+        virtual void addShare();
+        virtual void removeShare();
+        virtual unsigned int getNumShares() const;
         virtual Ionflux::GeoUtils::Matrix4* getTransformMatrix() const;
         virtual Ionflux::GeoUtils::Matrix4* getViewMatrix() const;
         virtual Ionflux::GeoUtils::Matrix4* getImageMatrix() const;
@@ -2227,7 +2339,13 @@ class TransformableGroup
         virtual Ionflux::GeoUtils::TransformableGroup& transformVI(const 
         Ionflux::GeoUtils::Matrix4& view, const Ionflux::GeoUtils::Matrix4*
         image = 0);
+        virtual void transformItems(const
+        Ionflux::GeoUtils::InstanceTransforms& transforms);
         virtual Ionflux::GeoUtils::TransformableGroup& duplicate();
+        virtual Ionflux::GeoUtils::TransformableGroup& instance();
+        virtual void addSharedItem(Ionflux::GeoUtils::TransformableObject*
+        addElement);
+        virtual unsigned int detachItems();
         virtual Ionflux::GeoUtils::TransformableGroup& flatten();
         virtual void getLeafItems(Ionflux::GeoUtils::TransformableGroup& 
         target, unsigned int level = 0);
@@ -2827,6 +2945,63 @@ namespace GeoUtils
 }
 
 
+%{
+#include "geoutils/VertexTree.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Vector3;
+class Vertex3Set;
+
+class VertexTreeClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        VertexTreeClassInfo();
+        virtual ~VertexTreeClassInfo();
+};
+
+class VertexTree
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        VertexTree();
+		VertexTree(const Ionflux::GeoUtils::VertexTree& other);
+        virtual ~VertexTree();
+        virtual void clear();
+        virtual unsigned int update(Ionflux::GeoUtils::Vertex3Set* vertices,
+        unsigned int newMaxLeafVertices =
+        Ionflux::GeoUtils::DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES, unsigned
+        int numThreads = 0);
+        virtual int findNearest(const Ionflux::GeoUtils::Vector3& p, double
+        eps = 0.) const;
+        virtual unsigned int findKNearest(const Ionflux::GeoUtils::Vector3&
+        p, unsigned int k, Ionflux::ObjectBase::UIntVector& target,
+        Ionflux::ObjectBase::DoubleVector* distances = 0, double eps = 0.)
+        const;
+        virtual unsigned int findInRadius(const Ionflux::GeoUtils::Vector3&
+        p, double r, Ionflux::ObjectBase::UIntVector& target,
+        Ionflux::ObjectBase::DoubleVector* distances = 0) const;
+        virtual unsigned int getNumVertices() const;
+        virtual unsigned int getMaxLeafVertices() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::VertexTree* copy() const;
+		static Ionflux::GeoUtils::VertexTree* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::VertexTree* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+
 %{
 #include "geoutils/Plane3.hpp"
 %}
@@ -3629,6 +3804,64 @@ class Polygon3Set
 }
 
 
+%{
+#include "geoutils/SVGWriter.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Polygon3;
+class Polygon3Set;
+
+class SVGWriterClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        SVGWriterClassInfo();
+        virtual ~SVGWriterClassInfo();
+};
+
+class SVGWriter
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        SVGWriter();
+		SVGWriter(const Ionflux::GeoUtils::SVGWriter& other);
+        virtual ~SVGWriter();
+        virtual void writeFile(const std::string& fileName,
+        Ionflux::GeoUtils::Polygon3Set& polygons, const
+        Ionflux::GeoUtils::SVGShapeStyleVector* styles = 0, unsigned int
+        width = 1000, unsigned int height = 1000, int originX = 500, int
+        originY = 500, const std::string& svgTemplate =
+        Ionflux::GeoUtils::SVG_TEMPLATE);
+        virtual std::string getString() const;
+		virtual Ionflux::GeoUtils::SVGWriter* copy() const;
+		static Ionflux::GeoUtils::SVGWriter* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::SVGWriter* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+        virtual void setPrecision(unsigned int newPrecision);
+        virtual unsigned int getPrecision() const;
+        virtual void setCoalescePaths(bool newCoalescePaths);
+        virtual bool getCoalescePaths() const;
+        virtual void setElementIDPrefix(const std::string& newElementIDPrefix);
+        virtual std::string getElementIDPrefix() const;
+        virtual void setAxis(Ionflux::GeoUtils::AxisID newAxis);
+        virtual Ionflux::GeoUtils::AxisID getAxis() const;
+        virtual void setShapeType(Ionflux::GeoUtils::SVGShapeType newShapeType);
+        virtual Ionflux::GeoUtils::SVGShapeType getShapeType() const;
+        virtual void setClosePath(bool newClosePath);
+        virtual bool getClosePath() const;
+};
+
+}
+
+}
+
 %{
 #include "geoutils/Line3.hpp"
 %}
@@ -4347,6 +4580,16 @@ class BoundingBox
         unsigned int minItems = 0, unsigned int maxLevel = 0, unsigned int 
         splitLevel = 0, double t = Ionflux::GeoUtils::DEFAULT_TOLERANCE, 
         bool preferLongestAxis = false, double longestAxisTolerance = 0.1);
+        virtual Ionflux::GeoUtils::SplitResult splitSAH(unsigned int 
+        maxLeafItems = Ionflux::GeoUtils::DEFAULT_SAH_MAX_LEAF_ITEMS, 
+        unsigned int numBins = Ionflux::GeoUtils::DEFAULT_SAH_NUM_BINS, 
+        unsigned int maxLevel = 0, unsigned int numThreads = 0);
+        virtual double refit(bool updateItems = true, double refArea = 0.,
+        double maxAreaRatio =
+        Ionflux::GeoUtils::DEFAULT_REFIT_MAX_AREA_RATIO, unsigned int
+        maxPasses = 1);
+        virtual unsigned int rotate(unsigned int maxPasses = 1);
+        virtual double getTotalArea() const;
         virtual Ionflux::GeoUtils::BoxBoundsItemSet 
         getItemsAbovePlane(Ionflux::GeoUtils::Plane3& plane, double t = 
         Ionflux::GeoUtils::DEFAULT_TOLERANCE);
@@ -4405,6 +4648,77 @@ class BoundingBox
 }
 
 
+%{
+#include "geoutils/BoxBoundsTree.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Line3;
+class Sphere3;
+class BoxBoundsItem;
+class BoundingBox;
+
+class BoxBoundsTreeClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        BoxBoundsTreeClassInfo();
+        virtual ~BoxBoundsTreeClassInfo();
+};
+
+class BoxBoundsTree
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        BoxBoundsTree();
+		BoxBoundsTree(const Ionflux::GeoUtils::BoxBoundsTree& other);
+        virtual ~BoxBoundsTree();
+        virtual void clear();
+        virtual unsigned int update(Ionflux::GeoUtils::BoundingBox* root,
+        double t = Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual void refit(bool updateItems = true);
+        virtual unsigned int getItemsOnRay(const Ionflux::GeoUtils::Line3&
+        ray, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getItemsOnLine(const Ionflux::GeoUtils::Line3&
+        line, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual Ionflux::GeoUtils::BoxBoundsItem* getFirstItemOnRay(const
+        Ionflux::GeoUtils::Line3& ray, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual Ionflux::GeoUtils::BoxBoundsItem* getAnyItemOnRay(const
+        Ionflux::GeoUtils::Line3& ray, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getItemsInSphere(const
+        Ionflux::GeoUtils::Sphere3& sphere,
+        Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getItemsInBox(Ionflux::GeoUtils::BoxBoundsItem&
+        box, Ionflux::GeoUtils::BoxBoundsItemVector& target, double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE);
+        virtual unsigned int getNumNodes() const;
+        virtual unsigned int getNumItems() const;
+        virtual Ionflux::GeoUtils::BoxBoundsItem* getItem(unsigned int
+        elementIndex) const;
+        virtual unsigned int getDepth() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::BoxBoundsTree* copy() const;
+		static Ionflux::GeoUtils::BoxBoundsTree* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::BoxBoundsTree* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+
 %{
 #include "geoutils/Camera.hpp"
 %}
@@ -4682,6 +4996,9 @@ Ionflux::GeoUtils::TransformableObject
         virtual ~NFace();
         virtual void copyVertices();
         virtual void update();
+        virtual void updateBounds();
+        virtual void updateFromBounds(const Ionflux::GeoUtils::Range3&
+        newBounds);
         virtual void clearPolygon();
         virtual void clear();
         virtual void addVertices(unsigned int v0, unsigned int v1 = 
@@ -4746,6 +5063,8 @@ Ionflux::GeoUtils::TransformableObject
         virtual void getEdge(Ionflux::GeoUtils::Edge& target) const;
         virtual Ionflux::GeoUtils::Edge getEdge0() const;
         virtual void applyVertexIndexOffset(int offset);
+        virtual void applyVertexIndexMap(const
+        Ionflux::ObjectBase::UIntVector& indexMap);
         virtual void getTris(Ionflux::GeoUtils::NFaceVector& target);
         virtual void getTris(Ionflux::GeoUtils::NFaceSet& target);
         virtual Ionflux::GeoUtils::NFaceVector getTris0();
@@ -4935,9 +5254,13 @@ class Face
         Ionflux::GeoUtils::FaceData* initVertexColors = 0);
         virtual ~Face();
         virtual void update();
+        virtual void updateFromBounds(const Ionflux::GeoUtils::Range3&
+        newBounds);
         virtual void clearTangentSpace();
         virtual void clear();
         virtual void setFaceVertexNormals(bool flip0 = false);
+        virtual void setVertexNormals(const Ionflux::GeoUtils::Vector3&
+        normal);
         virtual void setVertexColors(const Ionflux::GeoUtils::Vector4& 
         color);
         virtual Ionflux::GeoUtils::Vector3 getTangent();
@@ -5036,6 +5359,21 @@ Ionflux::GeoUtils::TransformableObject
         virtual void copyVertices();
         virtual void update(bool updateFaces = true, bool updateEdges = 
         true);
+        virtual void updateGeometry(unsigned int numThreads = 0);
+        virtual void clearFaceGeometry();
+        virtual bool hasFaceGeometry() const;
+        virtual Ionflux::GeoUtils::Vector3 getFaceNormal(unsigned int
+        faceIndex) const;
+        virtual Ionflux::GeoUtils::Vector3 getFaceTangent(unsigned int
+        faceIndex) const;
+        virtual Ionflux::GeoUtils::Vector3 getFaceBinormal(unsigned int
+        faceIndex) const;
+        virtual Ionflux::GeoUtils::Range3 getFaceBounds(unsigned int
+        faceIndex) const;
+        virtual const double* getFaceNormalData() const;
+        virtual const double* getFaceTangentData() const;
+        virtual const double* getFaceBinormalData() const;
+        virtual void updateBounds();
         virtual void clear();
         virtual void clearData();
         virtual void setFaceIDs();
@@ -5102,6 +5440,8 @@ Ionflux::GeoUtils::TransformableObject
         virtual bool isTriMesh() const;
         virtual unsigned int createEdges();
         virtual void merge(Ionflux::GeoUtils::Mesh& other);
+        virtual unsigned int weld(double t =
+        Ionflux::GeoUtils::DEFAULT_TOLERANCE, unsigned int numThreads = 0);
         virtual void writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx, 
         unsigned int precision = 6, bool smoothShading = false);
         virtual std::string getValueString() const;
@@ -5191,6 +5531,260 @@ Ionflux::GeoUtils::TransformableObject
 }
 
 
+%{
+#include "geoutils/CompactMesh.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Vector;
+class Vector3;
+class Mesh;
+
+class CompactMeshClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        CompactMeshClassInfo();
+        virtual ~CompactMeshClassInfo();
+};
+
+class CompactMesh
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        CompactMesh();
+		CompactMesh(const Ionflux::GeoUtils::CompactMesh& other);
+        virtual ~CompactMesh();
+        virtual void clear();
+        virtual void initFromMesh(Ionflux::GeoUtils::Mesh& mesh);
+        virtual void getMesh(Ionflux::GeoUtils::Mesh& target, bool
+        copyChannels = true) const;
+        virtual void initFromArrays(Ionflux::ObjectBase::DoubleVector&
+        newPositions, Ionflux::ObjectBase::UIntVector& newIndices,
+        Ionflux::ObjectBase::UIntVector& newFaceOffsets);
+        virtual unsigned int addVertex(double x, double y, double z);
+        virtual unsigned int addFace(const Ionflux::ObjectBase::UIntVector&
+        faceVertices);
+        virtual unsigned int addEdge(unsigned int v0, unsigned int v1);
+        virtual unsigned int addChannel(Ionflux::GeoUtils::FaceDataTypeID
+        dataType, unsigned int numComponents);
+        virtual int findChannel(Ionflux::GeoUtils::FaceDataTypeID dataType,
+        unsigned int index = 0) const;
+        virtual unsigned int getNumVertices() const;
+        virtual unsigned int getNumFaces() const;
+        virtual unsigned int getNumFaceVertices(unsigned int faceIndex)
+        const;
+        virtual unsigned int getNumIndices() const;
+        virtual unsigned int getNumEdges() const;
+        virtual unsigned int getNumChannels() const;
+        virtual Ionflux::GeoUtils::Vector3 getVertex(unsigned int
+        vertexIndex) const;
+        virtual unsigned int getFace(unsigned int faceIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual Ionflux::GeoUtils::FaceDataTypeID
+        getChannelDataType(unsigned int channelIndex) const;
+        virtual unsigned int getChannelNumComponents(unsigned int
+        channelIndex) const;
+        virtual bool isTriMesh() const;
+        virtual const double* getPositionData() const;
+        virtual const unsigned int* getIndexData() const;
+        virtual const unsigned int* getFaceOffsetData() const;
+        virtual const unsigned int* getEdgeIndexData() const;
+        virtual const double* getChannelData(unsigned int channelIndex)
+        const;
+        virtual void addBufferRef();
+        virtual void removeBufferRef();
+        virtual unsigned int getNumBufferRefs() const;
+        virtual void writeOBJ(Ionflux::ObjectBase::IFIOContext& ioCtx,
+        unsigned int precision = 6, bool smoothShading = false);
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::CompactMesh* copy() const;
+		static Ionflux::GeoUtils::CompactMesh* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::CompactMesh* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+// Buffer access
+
+%include "geoutils/buffer.i"
+
+%buffer_exporter(GeoUtils, Ionflux::GeoUtils::CompactMesh, SWIGTYPE_p_Ionflux__GeoUtils__CompactMesh, "CompactMesh", "CGeoUtils.Buffer", 1)
+
+%{
+PyObject* getCompactMeshPositionBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getPositionData(), 
+        cm0->getNumVertices(), 3, sizeof(double), "d");
+}
+
+PyObject* getCompactMeshIndexBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getIndexData(), 
+        cm0->getNumIndices(), 1, sizeof(unsigned int), "I");
+}
+
+PyObject* getCompactMeshFaceOffsetBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    unsigned int n0 = cm0->getNumFaces();
+    if (n0 > 0)
+        n0++;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getFaceOffsetData(), 
+        n0, 1, sizeof(unsigned int), "I");
+}
+
+PyObject* getCompactMeshEdgeIndexBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getEdgeIndexData(), 
+        cm0->getNumEdges(), 2, sizeof(unsigned int), "I");
+}
+
+PyObject* getCompactMeshChannelBuffer(PyObject* compactMesh, unsigned int channelIndex)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getChannelData(channelIndex), 
+        cm0->getNumIndices(), cm0->getChannelNumComponents(channelIndex), sizeof(double), "d");
+}
+%}
+
+PyObject* getCompactMeshPositionBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshIndexBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshFaceOffsetBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshEdgeIndexBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshChannelBuffer(PyObject* compactMesh, unsigned int channelIndex);
+
+%extend Ionflux::GeoUtils::CompactMesh {
+%pythoncode %{
+    def getPositionBuffer(self):
+        return getCompactMeshPositionBuffer(self)
+    def getIndexBuffer(self):
+        return getCompactMeshIndexBuffer(self)
+    def getFaceOffsetBuffer(self):
+        return getCompactMeshFaceOffsetBuffer(self)
+    def getEdgeIndexBuffer(self):
+        return getCompactMeshEdgeIndexBuffer(self)
+    def getChannelBuffer(self, channelIndex):
+        return getCompactMeshChannelBuffer(self, channelIndex)
+%}
+}
+
+
+%{
+#include "geoutils/MeshAdjacency.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+class Mesh;
+class CompactMesh;
+
+class MeshAdjacencyClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        MeshAdjacencyClassInfo();
+        virtual ~MeshAdjacencyClassInfo();
+};
+
+class MeshAdjacency
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        MeshAdjacency();
+		MeshAdjacency(const Ionflux::GeoUtils::MeshAdjacency& other);
+        virtual ~MeshAdjacency();
+        virtual void clear();
+        virtual unsigned int update(const Ionflux::GeoUtils::Mesh& mesh,
+        unsigned int numThreads = 0);
+        virtual unsigned int update(const Ionflux::GeoUtils::CompactMesh&
+        mesh, unsigned int numThreads = 0);
+        virtual unsigned int getNumVertices() const;
+        virtual unsigned int getNumFaces() const;
+        virtual unsigned int getNumHalfEdges() const;
+        virtual unsigned int getNumEdges() const;
+        virtual unsigned int getHalfEdgeSource(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getHalfEdgeTarget(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getNextHalfEdge(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getPrevHalfEdge(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getTwin(unsigned int halfEdgeIndex) const;
+        virtual unsigned int getHalfEdgeFace(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getHalfEdgeEdge(unsigned int halfEdgeIndex)
+        const;
+        virtual unsigned int getFaceHalfEdge(unsigned int faceIndex) const;
+        virtual unsigned int getEdgeHalfEdge(unsigned int edgeIndex,
+        unsigned int index = 0) const;
+        virtual unsigned int getEdgeNumFaces(unsigned int edgeIndex) const;
+        virtual bool isBoundaryEdge(unsigned int edgeIndex) const;
+        virtual bool isNonManifoldEdge(unsigned int edgeIndex) const;
+        virtual unsigned int getEdgeFaces(unsigned int edgeIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getFaceNeighbors(unsigned int faceIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getVertexHalfEdges(unsigned int vertexIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getVertexFaces(unsigned int vertexIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int getVertexNeighbors(unsigned int vertexIndex,
+        Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int
+        getBoundaryEdges(Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int
+        getNonManifoldEdges(Ionflux::ObjectBase::UIntVector& target) const;
+        virtual unsigned int
+        getBoundaryLoops(Ionflux::ObjectBase::UIntVector& target,
+        Ionflux::ObjectBase::UIntVector& offsets) const;
+        virtual bool isClosed() const;
+        virtual bool isManifold() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::MeshAdjacency* copy() const;
+		static Ionflux::GeoUtils::MeshAdjacency* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::MeshAdjacency* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+
 %{
 #include "geoutils/Voxel.hpp"
 %}
@@ -5283,6 +5877,10 @@ class Vector3Mapping
         virtual Ionflux::GeoUtils::Vector3 
         call(Ionflux::Mapping::MappingValue value) const = 0;
         virtual std::string getString() const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::ObjectBase::DoubleVector& targetX,
+        Ionflux::ObjectBase::DoubleVector& targetY,
+        Ionflux::ObjectBase::DoubleVector& targetZ) const;
 		static Ionflux::GeoUtils::Mapping::Vector3Mapping* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
 };
@@ -5332,6 +5930,10 @@ class Compose3
         virtual void setFuncsEqual(Ionflux::Mapping::Mapping* newFunc = 0);
         virtual Ionflux::GeoUtils::Vector3 
         call(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::ObjectBase::DoubleVector& targetX,
+        Ionflux::ObjectBase::DoubleVector& targetY,
+        Ionflux::ObjectBase::DoubleVector& targetZ) const;
         virtual std::string getString() const;
 		virtual Ionflux::GeoUtils::Mapping::Compose3* copy() const;
 		static Ionflux::GeoUtils::Mapping::Compose3* 
@@ -5554,6 +6156,10 @@ class Lookup3
         newEntries, unsigned int numEntries = 0);
         virtual Ionflux::GeoUtils::Vector3 
         call(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::ObjectBase::DoubleVector& targetX,
+        Ionflux::ObjectBase::DoubleVector& targetY,
+        Ionflux::ObjectBase::DoubleVector& targetZ) const;
         virtual std::string getString() const;
 		virtual Ionflux::GeoUtils::Mapping::Lookup3* copy() const;
 		static Ionflux::GeoUtils::Mapping::Lookup3* 
@@ -5687,6 +6293,15 @@ class TransformNode
         virtual void cleanup();
         virtual void update();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool sharesItems() const;
+        virtual Ionflux::GeoUtils::TransformNodes::TransformNode*
+        createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap) const;
+        virtual void remapInputs(const Ionflux::GeoUtils::TransformNodeMap&
+        nodeMap);
+        virtual void touch();
+        virtual bool isDirty() const;
+        virtual unsigned int getTotalParamVersion() const;
         virtual std::string getDebugInfo(bool expand = true);
         virtual void enableDebugMode(bool newDebugMode = true, bool expand 
         = false);
@@ -5730,6 +6345,17 @@ class TransformNode
         virtual unsigned int getMaxNumInputs() const;
         virtual void setUpdateCounter(unsigned int newUpdateCounter);
         virtual unsigned int getUpdateCounter() const;
+        virtual void setScheduled(bool newScheduled);
+        virtual bool getScheduled() const;
+        virtual void setPendingConsumers(unsigned int newPendingConsumers);
+        virtual unsigned int getPendingConsumers() const;
+        virtual void setParamVersion(unsigned int newParamVersion);
+        virtual unsigned int getParamVersion() const;
+        virtual void 
+        setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler* 
+        newProfiler);
+        virtual Ionflux::GeoUtils::TransformNodes::Profiler* getProfiler() 
+        const;
 };
 
 }
@@ -5841,6 +6467,8 @@ class ParamControl
         COORDINATE_NOT_SET);
         virtual ~ParamControl();
         virtual void call(Ionflux::Mapping::MappingValue value) const;
+        virtual Ionflux::Mapping::MappingValue
+        getValue(Ionflux::Mapping::MappingValue value) const;
         virtual void operator()(Ionflux::Mapping::MappingValue value) 
         const;
         virtual std::string getString() const;
@@ -5869,6 +6497,72 @@ class ParamControl
 
 }
 
+%{
+#include "geoutils/Profiler.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace GeoUtils
+{
+
+namespace TransformNodes
+{
+
+class ProfilerClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        ProfilerClassInfo();
+        virtual ~ProfilerClassInfo();
+};
+
+class Profiler
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        Profiler();
+		Profiler(const Ionflux::GeoUtils::TransformNodes::Profiler& other);
+        virtual ~Profiler();
+        virtual void clear();
+        virtual void begin(Ionflux::GeoUtils::TransformNodes::TransformNode*
+        node);
+        virtual void end(Ionflux::GeoUtils::TransformNodes::TransformNode*
+        node, Ionflux::ObjectBase::UInt64 numInputItems = 0);
+        virtual void
+        cancel(Ionflux::GeoUtils::TransformNodes::TransformNode* node);
+        virtual void
+        removeNode(Ionflux::GeoUtils::TransformNodes::TransformNode* node);
+        virtual unsigned int getNumProfiles() const;
+        virtual Ionflux::GeoUtils::TransformNodeProfile getProfile(unsigned
+        int index) const;
+        virtual int
+        findProfile(Ionflux::GeoUtils::TransformNodes::TransformNode* node)
+        const;
+        virtual unsigned int getNumEvents() const;
+        virtual Ionflux::GeoUtils::TransformProfilerEvent getEvent(unsigned
+        int index) const;
+        virtual unsigned int getNumThreads() const;
+        virtual std::string getSummary(unsigned int maxProfiles = 0) const;
+        virtual std::string getJSON() const;
+        virtual void writeJSON(const std::string& fileName) const;
+        virtual std::string getTrace() const;
+        virtual void writeTrace(const std::string& fileName) const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::GeoUtils::TransformNodes::Profiler* copy() const;
+		static Ionflux::GeoUtils::TransformNodes::Profiler* upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::GeoUtils::TransformNodes::Profiler* create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+}
+
 
 %{
 #include "geoutils/TransformGraph.hpp"
@@ -5943,6 +6637,21 @@ class TransformGraph
         Ionflux::GeoUtils::TransformNodes::InputNodeSpec& newInput, 
         unsigned int inputID = INPUT_NEXT_FREE);
         virtual void update();
+        virtual void getSchedule(Ionflux::GeoUtils::TransformNodeVector&
+        target);
+        virtual unsigned int getNumNodeUpdates() const;
+        virtual unsigned int getNumEliminatedUpdates() const;
+        virtual bool isThreadSafe() const;
+        virtual bool sharesItems() const;
+        virtual Ionflux::GeoUtils::TransformNodes::TransformNode*
+        createClone(Ionflux::GeoUtils::TransformNodeMap& nodeMap) const;
+        virtual void remapInputs(const Ionflux::GeoUtils::TransformNodeMap&
+        nodeMap);
+        virtual bool isDirty() const;
+        virtual unsigned int getTotalParamVersion() const;
+        virtual void
+        setProfiler(Ionflux::GeoUtils::TransformNodes::Profiler*
+        newProfiler);
 		virtual Ionflux::GeoUtils::TransformNodes::TransformGraph* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::TransformGraph* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -6018,6 +6727,10 @@ class TransformGraph
         newDrain);
         virtual Ionflux::GeoUtils::TransformNodes::TransformNode* 
         getDrain() const;
+        virtual void setNumThreads(unsigned int newNumThreads);
+        virtual unsigned int getNumThreads() const;
+        virtual void setIncremental(bool newIncremental);
+        virtual bool getIncremental() const;
 };
 
 }
@@ -6069,6 +6782,7 @@ class WriteSVG
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~WriteSVG();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
         virtual void addStyles(const 
         Ionflux::GeoUtils::SVGShapeStyleVector& newStyles);
 		virtual Ionflux::GeoUtils::TransformNodes::WriteSVG* copy() const;
@@ -6112,6 +6826,10 @@ class WriteSVG
         virtual unsigned int getOriginY() const;
         virtual void setSvgTemplate(const std::string& newSvgTemplate);
         virtual std::string getSvgTemplate() const;
+        virtual void setCoalescePaths(bool newCoalescePaths);
+        virtual bool getCoalescePaths() const;
+        virtual void setPrecision(unsigned int newPrecision);
+        virtual unsigned int getPrecision() const;
 };
 
 }
@@ -6158,6 +6876,8 @@ class Duplicate
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Duplicate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool sharesItems() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Duplicate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Duplicate* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -6277,6 +6997,7 @@ class Rotate
         CENTER_ORIGIN, const Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Rotate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Rotate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Rotate* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -6354,6 +7075,7 @@ class Translate
         const Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Translate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Translate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Translate* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -6421,6 +7143,7 @@ class Scale
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Scale();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Scale* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Scale* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -6607,6 +7330,8 @@ class Array
         const Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Array();
         virtual std::string getString() const;
+        virtual void getInstanceTransforms(unsigned int numItems,
+        Ionflux::GeoUtils::InstanceTransforms& target);
 		virtual Ionflux::GeoUtils::TransformNodes::Array* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Array* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -6912,6 +7637,8 @@ class Iterate
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Iterate();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool isDirty() const;
         virtual void updateInputs();
 		virtual Ionflux::GeoUtils::TransformNodes::Iterate* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Iterate* 
@@ -7014,6 +7741,7 @@ class Cache
         Cache(const Ionflux::ObjectBase::IFObjectID& nodeID);
         virtual ~Cache();
         virtual std::string getString() const;
+        virtual bool sharesItems() const;
         virtual void cleanup();
         virtual void update();
 		virtual Ionflux::GeoUtils::TransformNodes::Cache* copy() const;
@@ -7066,6 +7794,7 @@ class Clone
         Ionflux::ObjectBase::IFObjectID& nodeID = "");
         virtual ~Clone();
         virtual std::string getString() const;
+        virtual bool sharesItems() const;
 		virtual Ionflux::GeoUtils::TransformNodes::Clone* copy() const;
 		static Ionflux::GeoUtils::TransformNodes::Clone* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
@@ -7120,6 +7849,9 @@ class Batch
         nodeID = "");
         virtual ~Batch();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual bool isDirty() const;
+        virtual unsigned int getTotalParamVersion() const;
         virtual void addControls(Ionflux::GeoUtils::ParamControlVector& 
         newControls);
 		virtual Ionflux::GeoUtils::TransformNodes::Batch* copy() const;
@@ -7161,6 +7893,8 @@ class Batch
         virtual void removeDimension(unsigned int removeElement);
 		virtual void removeDimensionIndex(unsigned int removeIndex);
 		virtual void clearDimensions();
+        virtual void setNumThreads(unsigned int newNumThreads);
+        virtual unsigned int getNumThreads() const;
 };
 
 }
@@ -7223,6 +7957,10 @@ class Scatter
         "");
         virtual ~Scatter();
         virtual std::string getString() const;
+        virtual bool isThreadSafe() const;
+        virtual void
+        getInstanceTransforms(Ionflux::GeoUtils::TransformableGroup& source,
+        Ionflux::GeoUtils::InstanceTransforms& target);
         static Ionflux::GeoUtils::Mapping::Vector3Mapping* 
         createLUT(unsigned int numEntries = DEFAULT_NUM_LUT_ENTRIES, const 
         Ionflux::GeoUtils::Vector3& stdDev = 
@@ -9013,10 +9751,12 @@ class CameraXMLFactory
 %template(InputNodeSpecVector) std::vector<Ionflux::GeoUtils::TransformNodes::InputNodeSpec>;
 %template(Vector3Vector) std::vector<Ionflux::GeoUtils::Vector3*>;
 %template(ParamControlVector) std::vector<Ionflux::GeoUtils::TransformNodes::ParamControl*>;
+%template(TransformNodeMap) std::map<Ionflux::GeoUtils::TransformNodes::TransformNode*, Ionflux::GeoUtils::TransformNodes::TransformNode*>;
 %template(VectorVector) std::vector<Ionflux::GeoUtils::Vector*>;
 %template(VectorSetVector) std::vector<Ionflux::GeoUtils::VectorSet*>;
 %template(NFaceVector) std::vector<Ionflux::GeoUtils::NFace*>;
 %template(FaceVector) std::vector<Ionflux::GeoUtils::Face*>;
 %template(EdgeObjSet) std::set<Ionflux::GeoUtils::Edge>;
 %template(AAPlanePairIntersectionVector) std::vector<Ionflux::GeoUtils::AAPlanePairIntersection>;
+%template(PixelSpanVector) std::vector<Ionflux::GeoUtils::PixelSpan>;
 
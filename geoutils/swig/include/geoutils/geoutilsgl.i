@@ -205,6 +205,7 @@ class VertexAttribute
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_POSITION;
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_DATA;
 		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_INDEX;
+		static const Ionflux::GeoUtils::VertexAttributeTypeID TYPE_NORMAL;
         
         VertexAttribute();
 		VertexAttribute(const Ionflux::GeoUtils::VertexAttribute& other);
@@ -236,6 +237,12 @@ class VertexAttribute
         Ionflux::GeoUtils::NFace::TYPE_FACE, 
         Ionflux::GeoUtils::FaceDataTypeID faceDataType = 
         FaceData::TYPE_VERTEX_NORMAL);
+        virtual unsigned int setData(const Ionflux::GeoUtils::CompactMesh&
+        mesh, Ionflux::GeoUtils::VertexAttributeTypeID attrType =
+        TYPE_POSITION, Ionflux::GeoUtils::NFaceTypeID nFaceType =
+        Ionflux::GeoUtils::NFace::TYPE_FACE,
+        Ionflux::GeoUtils::FaceDataTypeID faceDataType =
+        FaceData::TYPE_VERTEX_NORMAL);
         virtual float getFloat(unsigned int elementIndex, unsigned int 
         componentIndex = 0);
         virtual unsigned int getUInt(unsigned int elementIndex, unsigned 
@@ -252,6 +259,9 @@ class VertexAttribute
         int v0, unsigned int v1, unsigned int v2 = 0, unsigned int v3 = 0);
         virtual void draw(Ionflux::GeoUtils::PrimitiveID primitiveID, 
         unsigned int drawNumPrimitives = 0, unsigned int startIndex = 0);
+        virtual void addBufferRef();
+        virtual void removeBufferRef();
+        virtual unsigned int getNumBufferRefs() const;
         virtual std::string getValueString() const;
         static std::string 
         getTypeIDString(Ionflux::GeoUtils::VertexAttributeTypeID typeID);
@@ -593,3 +603,36 @@ class Viewer
 %template(VertexAttributeVector) std::vector<Ionflux::GeoUtils::VertexAttribute*>;
 %template(ViewerEventVector) std::vector<Ionflux::GeoUtils::ViewerEvent*>;
 
+// Buffer access
+
+%include "geoutils/buffer.i"
+
+%buffer_exporter(GeoUtilsGL, Ionflux::GeoUtils::VertexAttribute, SWIGTYPE_p_Ionflux__GeoUtils__VertexAttribute, "VertexAttribute", "GeoUtilsGL.Buffer", 0)
+
+%{
+PyObject* getVertexAttributeBuffer(PyObject* vertexAttribute)
+{
+    Ionflux::GeoUtils::VertexAttribute* va0 = 
+        getGeoUtilsGLBufferOwner(vertexAttribute);
+    if (va0 == 0)
+        return 0;
+    Py_ssize_t itemSize = sizeof(GLfloat);
+    const char* format = "f";
+    if (va0->getDataType() == Ionflux::GeoUtils::DATA_TYPE_UINT)
+    {
+        itemSize = sizeof(GLuint);
+        format = "I";
+    }
+    return createGeoUtilsGLBuffer(vertexAttribute, va0, va0->getData(), 
+        va0->getNumElements(), va0->getElementSize(), itemSize, format);
+}
+%}
+
+PyObject* getVertexAttributeBuffer(PyObject* vertexAttribute);
+
+%extend Ionflux::GeoUtils::VertexAttribute {
+%pythoncode %{
+    def getBuffer(self):
+        return getVertexAttributeBuffer(self)
+%}
+}
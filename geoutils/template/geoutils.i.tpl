@@ -94,6 +94,8 @@ typedef std::vector<Ionflux::GeoUtils::BoxBoundsItem*> BoxBoundsItemVector;
 typedef std::set<Ionflux::GeoUtils::BoundingBox*> BoundingBoxSet;
 typedef std::vector<Ionflux::GeoUtils::BoundingBox*> BoundingBoxVector;
 
+typedef int BoxBoundsTreeQueryID;
+
 struct SplitTestResult
 {
     Ionflux::GeoUtils::BoxBoundsItemSet items0;
@@ -155,10 +157,36 @@ typedef std::map<std::string, Ionflux::GeoUtils::SVGShapeStyle*>
 
 typedef int SVGShapeType;
 
+typedef int RenderBackendID;
+
+struct PixelSpan
+{
+    unsigned int y;
+    unsigned int x0;
+    unsigned int x1;
+};
+
+typedef std::vector<Ionflux::GeoUtils::PixelSpan> PixelSpanVector;
+
+struct InstanceTransforms
+{
+    Ionflux::ObjectBase::DoubleVector offsetX;
+    Ionflux::ObjectBase::DoubleVector offsetY;
+    Ionflux::ObjectBase::DoubleVector offsetZ;
+    Ionflux::ObjectBase::DoubleVector scaleX;
+    Ionflux::ObjectBase::DoubleVector scaleY;
+    Ionflux::ObjectBase::DoubleVector scaleZ;
+    Ionflux::ObjectBase::DoubleVector centerX;
+    Ionflux::ObjectBase::DoubleVector centerY;
+    Ionflux::ObjectBase::DoubleVector centerZ;
+};
+
 class TransformableObject;
 
 typedef std::vector<Ionflux::GeoUtils::TransformableObject*> 
     TransformableObjectVector;
+typedef std::map<Ionflux::GeoUtils::TransformableObject*, unsigned int> 
+    SharedItemMap;
 typedef std::vector<Ionflux::GeoUtils::Vector3*> Vector3Vector;
 typedef std::vector<Ionflux::GeoUtils::TransformableGroup*> 
     TransformableGroupVector;
@@ -176,6 +204,8 @@ namespace TransformNodes
 class TransformNode;
 class Connection;
 class ParamControl;
+class Source;
+class Profiler;
 
 struct InputNodeSpec
 {
@@ -193,6 +223,30 @@ typedef std::vector<Ionflux::GeoUtils::TransformNodes::Connection*>
     ConnectionVector;
 typedef std::vector<Ionflux::GeoUtils::TransformNodes::ParamControl*> 
     ParamControlVector;
+typedef std::map<Ionflux::GeoUtils::TransformNodes::TransformNode*, 
+    Ionflux::GeoUtils::TransformNodes::TransformNode*> TransformNodeMap;
+
+struct TransformNodeProfile
+{
+    Ionflux::GeoUtils::TransformNodes::TransformNode* node;
+    std::string label;
+    unsigned int numCalls;
+    double inclusiveTime;
+    double exclusiveTime;
+    Ionflux::ObjectBase::UInt64 numInputItems;
+    Ionflux::ObjectBase::UInt64 numOutputItems;
+    Ionflux::ObjectBase::UInt64 outputObjectBytes;
+};
+
+struct TransformProfilerEvent
+{
+    unsigned int profileIndex;
+    unsigned int threadIndex;
+    unsigned int depth;
+    double startTime;
+    double duration;
+    double childTime;
+};
 
 class Vector;
 class VectorSet;
@@ -323,6 +377,14 @@ const Ionflux::GeoUtils::SVGShapeType SHAPE_TYPE_POLYGON = 0;
 const Ionflux::GeoUtils::SVGShapeType SHAPE_TYPE_PATH = 1;
 const Ionflux::GeoUtils::SVGShapeType DEFAULT_SHAPE_TYPE = SHAPE_TYPE_POLYGON;
 
+const Ionflux::GeoUtils::RenderBackendID RENDER_BACKEND_CAIRO = 0;
+const Ionflux::GeoUtils::RenderBackendID RENDER_BACKEND_SCANLINE = 1;
+const unsigned int DEFAULT_RASTER_TILE_SIZE = 64;
+const unsigned int DEFAULT_SVG_PRECISION = 3;
+const unsigned int SVG_WRITER_MAX_PRECISION = 17;
+const unsigned int SVG_WRITER_BUFFER_SIZE = 65536;
+const unsigned int SVG_WRITER_MIN_POLYGONS = 10000;
+
 const unsigned int COORDINATE_NOT_SET = UINT_MAX;
 
 const Ionflux::GeoUtils::MatrixSamplingMethod SAMPLE_AVERAGE = 0;
@@ -333,6 +395,23 @@ const Ionflux::GeoUtils::QuadInterpolationTypeID
 const Ionflux::GeoUtils::QuadInterpolationTypeID 
     QUAD_INTERPOLATION_BILINEAR = 1;
 
+const unsigned int DEFAULT_SAH_NUM_BINS = 16;
+const unsigned int DEFAULT_SAH_MAX_LEAF_ITEMS = 4;
+const unsigned int SAH_PARALLEL_MIN_ITEMS = 4096;
+const double DEFAULT_REFIT_MAX_AREA_RATIO = 1.25;
+const unsigned int DEFAULT_VERTEX_TREE_MAX_LEAF_VERTICES = 8;
+const unsigned int VERTEX_TREE_PARALLEL_MIN_VERTICES = 8192;
+const unsigned int HALF_EDGE_NONE = UINT_MAX;
+const unsigned int MESH_ADJACENCY_PARALLEL_MIN_HALF_EDGES = 65536;
+const unsigned int VERTEX_TRANSFORM_PARALLEL_MIN_VERTICES = 65536;
+const unsigned int OBJ_PARSE_PARALLEL_MIN_BYTES = 4194304;
+const unsigned int MESH_IO_BUFFER_SIZE = 1048576;
+const unsigned int MESH_UPDATE_PARALLEL_MIN_FACES = 8192;
+
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_ALL = 0;
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_FIRST = 1;
+const Ionflux::GeoUtils::BoxBoundsTreeQueryID BOX_BOUNDS_TREE_QUERY_ANY = 2;
+
 namespace TransformNodes
 {
 
@@ -484,6 +563,36 @@ void getSVGPolygons(const std::string& fileName,
 void getBoundingBox(const std::string& fileName, const std::string& elementID, 
     Ionflux::GeoUtils::BoundingBox& target);
 
+// meshio.hpp
+
+class Mesh;
+class CompactMesh;
+
+void readOBJ(const std::string& fileName, 
+    Ionflux::GeoUtils::CompactMesh& target, unsigned int numThreads = 0);
+void readOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& target, 
+    unsigned int numThreads = 0);
+void writeOBJ(const std::string& fileName, 
+    const Ionflux::GeoUtils::CompactMesh& source, 
+    unsigned int precision = 6, bool smoothShading = false);
+void writeOBJ(const std::string& fileName, Ionflux::GeoUtils::Mesh& source, 
+    unsigned int precision = 6, bool smoothShading = false);
+void readPLY(const std::string& fileName, 
+    Ionflux::GeoUtils::CompactMesh& target);
+void readPLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& target);
+void writePLY(const std::string& fileName, 
+    const Ionflux::GeoUtils::CompactMesh& source, 
+    bool doublePrecision = false);
+void writePLY(const std::string& fileName, Ionflux::GeoUtils::Mesh& source, 
+    bool doublePrecision = false);
+void readSTL(const std::string& fileName, 
+    Ionflux::GeoUtils::CompactMesh& target, bool weldVertices = true);
+void readSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& target, 
+    bool weldVertices = true);
+void writeSTL(const std::string& fileName, 
+    const Ionflux::GeoUtils::CompactMesh& source);
+void writeSTL(const std::string& fileName, Ionflux::GeoUtils::Mesh& source);
+
 // Classes
 
 %rename(mult2) operator*(double, const Ionflux::GeoUtils::Vector2&);
@@ -632,6 +741,7 @@ namespace GeoUtils
 
 }
 
+$VertexTree
 $Plane3
 $Polygon3
 $Polygon3Compare
@@ -644,6 +754,7 @@ $SVGShapeStyleMap
 $SVGShapeStyleVectorSource
 $SVGImageProperties
 $Polygon3Set
+$SVGWriter
 $Line3
 $Shape3
 $Object3
@@ -656,12 +767,97 @@ $BoxBoundsItemCompareDistancePlane3
 $ItemSource
 $SplitSet
 $BoundingBox
+$BoxBoundsTree
 $Camera
 $Vertex
 $NFace
 $NFaceSet
 $Face
 $Mesh
+$CompactMesh
+// Buffer access
+
+%include "geoutils/buffer.i"
+
+%buffer_exporter(GeoUtils, Ionflux::GeoUtils::CompactMesh, SWIGTYPE_p_Ionflux__GeoUtils__CompactMesh, "CompactMesh", "CGeoUtils.Buffer", 1)
+
+%{
+PyObject* getCompactMeshPositionBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getPositionData(), 
+        cm0->getNumVertices(), 3, sizeof(double), "d");
+}
+
+PyObject* getCompactMeshIndexBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getIndexData(), 
+        cm0->getNumIndices(), 1, sizeof(unsigned int), "I");
+}
+
+PyObject* getCompactMeshFaceOffsetBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    unsigned int n0 = cm0->getNumFaces();
+    if (n0 > 0)
+        n0++;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getFaceOffsetData(), 
+        n0, 1, sizeof(unsigned int), "I");
+}
+
+PyObject* getCompactMeshEdgeIndexBuffer(PyObject* compactMesh)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getEdgeIndexData(), 
+        cm0->getNumEdges(), 2, sizeof(unsigned int), "I");
+}
+
+PyObject* getCompactMeshChannelBuffer(PyObject* compactMesh, unsigned int channelIndex)
+{
+    Ionflux::GeoUtils::CompactMesh* cm0 = 
+        getGeoUtilsBufferOwner(compactMesh);
+    if (cm0 == 0)
+        return 0;
+    return createGeoUtilsBuffer(compactMesh, cm0, cm0->getChannelData(channelIndex), 
+        cm0->getNumIndices(), cm0->getChannelNumComponents(channelIndex), sizeof(double), "d");
+}
+%}
+
+PyObject* getCompactMeshPositionBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshIndexBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshFaceOffsetBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshEdgeIndexBuffer(PyObject* compactMesh);
+PyObject* getCompactMeshChannelBuffer(PyObject* compactMesh, unsigned int channelIndex);
+
+%extend Ionflux::GeoUtils::CompactMesh {
+%pythoncode %{
+    def getPositionBuffer(self):
+        return getCompactMeshPositionBuffer(self)
+    def getIndexBuffer(self):
+        return getCompactMeshIndexBuffer(self)
+    def getFaceOffsetBuffer(self):
+        return getCompactMeshFaceOffsetBuffer(self)
+    def getEdgeIndexBuffer(self):
+        return getCompactMeshEdgeIndexBuffer(self)
+    def getChannelBuffer(self, channelIndex):
+        return getCompactMeshChannelBuffer(self, channelIndex)
+%}
+}
+
+$MeshAdjacency
 $Voxel
 $Vector3Mapping
 $Compose3
@@ -673,6 +869,7 @@ $Vector3MappingSet
 $TransformNode
 $Connection
 $ParamControl
+$Profiler
 $TransformGraph
 $WriteSVG
 $Duplicate
@@ -744,10 +941,12 @@ $CameraXMLFactory
 %template(InputNodeSpecVector) std::vector<Ionflux::GeoUtils::TransformNodes::InputNodeSpec>;
 %template(Vector3Vector) std::vector<Ionflux::GeoUtils::Vector3*>;
 %template(ParamControlVector) std::vector<Ionflux::GeoUtils::TransformNodes::ParamControl*>;
+%template(TransformNodeMap) std::map<Ionflux::GeoUtils::TransformNodes::TransformNode*, Ionflux::GeoUtils::TransformNodes::TransformNode*>;
 %template(VectorVector) std::vector<Ionflux::GeoUtils::Vector*>;
 %template(VectorSetVector) std::vector<Ionflux::GeoUtils::VectorSet*>;
 %template(NFaceVector) std::vector<Ionflux::GeoUtils::NFace*>;
 %template(FaceVector) std::vector<Ionflux::GeoUtils::Face*>;
 %template(EdgeObjSet) std::set<Ionflux::GeoUtils::Edge>;
 %template(AAPlanePairIntersectionVector) std::vector<Ionflux::GeoUtils::AAPlanePairIntersection>;
+%template(PixelSpanVector) std::vector<Ionflux::GeoUtils::PixelSpan>;
 
@@ -105,3 +105,36 @@ $Viewer
 %template(VertexAttributeVector) std::vector<Ionflux::GeoUtils::VertexAttribute*>;
 %template(ViewerEventVector) std::vector<Ionflux::GeoUtils::ViewerEvent*>;
 
+// Buffer access
+
+%include "geoutils/buffer.i"
+
+%buffer_exporter(GeoUtilsGL, Ionflux::GeoUtils::VertexAttribute, SWIGTYPE_p_Ionflux__GeoUtils__VertexAttribute, "VertexAttribute", "GeoUtilsGL.Buffer", 0)
+
+%{
+PyObject* getVertexAttributeBuffer(PyObject* vertexAttribute)
+{
+    Ionflux::GeoUtils::VertexAttribute* va0 = 
+        getGeoUtilsGLBufferOwner(vertexAttribute);
+    if (va0 == 0)
+        return 0;
+    Py_ssize_t itemSize = sizeof(GLfloat);
+    const char* format = "f";
+    if (va0->getDataType() == Ionflux::GeoUtils::DATA_TYPE_UINT)
+    {
+        itemSize = sizeof(GLuint);
+        format = "I";
+    }
+    return createGeoUtilsGLBuffer(vertexAttribute, va0, va0->getData(), 
+        va0->getNumElements(), va0->getElementSize(), itemSize, format);
+}
+%}
+
+PyObject* getVertexAttributeBuffer(PyObject* vertexAttribute);
+
+%extend Ionflux::GeoUtils::VertexAttribute {
+%pythoncode %{
+    def getBuffer(self):
+        return getVertexAttributeBuffer(self)
+%}
+}
@@ -0,0 +1,51 @@
+import math
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Box bounds item (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Checking line and ray intersections...")
+
+b0 = cg.BoxBoundsItem(cg.Vector3(1., 2., 3.), cg.Vector3(0.5, 1., 2.),
+    "b0")
+
+l0 = cg.Line3(cg.Vector3(-5., 2., 3.), cg.Vector3(1., 0., 0.))
+assert b0.checkLine(l0)
+assert b0.checkRay(l0)
+
+# ray pointing away from the box
+l1 = cg.Line3(cg.Vector3(5., 2., 3.), cg.Vector3(1., 0., 0.))
+assert b0.checkLine(l1)
+assert not b0.checkRay(l1)
+
+# ray starting inside the box
+l2 = cg.Line3(cg.Vector3(1., 2., 3.), cg.Vector3(0., 1., 1.))
+assert b0.checkRay(l2)
+
+# line parallel to an axis, outside of the box
+l3 = cg.Line3(cg.Vector3(-5., 3.5, 3.), cg.Vector3(1., 0., 0.))
+assert not b0.checkLine(l3)
+assert not b0.checkRay(l3)
+
+# diagonal line that misses the box
+l4 = cg.Line3(cg.Vector3(0., 0., 0.), cg.Vector3(1., -1., 0.))
+assert not b0.checkLine(l4)
+
+print("  Checking vertex set transformations...")
+
+vs0 = cg.Vertex3Set.create()
+mm.addLocalRef(vs0)
+vs0.addVertex().setCoords(1., 0., 0.)
+vs0.addVertex().setCoords(0., 2., 0.)
+vs0.rotate(0.5 * math.pi, cg.AXIS_Z)
+vs0.translate(cg.Vector3(1., 1., 1.))
+vs0.applyTransform()
+assert vs0.getVertex(0).eq(cg.Vertex3(1., 2., 1.))
+assert vs0.getVertex(1).eq(cg.Vertex3(-1., 1., 1.))
+
+print("All tests passed.")
@@ -0,0 +1,63 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Box bounds tree (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+gridSubDivs = 32
+numRays = 200
+
+print("  Creating mesh...")
+
+m0 = cg.Mesh.grid(gridSubDivs, gridSubDivs)
+mm.addLocalRef(m0)
+m0.makeTris()
+m0.update(True, False)
+numFaces = m0.getNumFaces()
+
+print("    numFaces = %d" % numFaces)
+
+print("  Building hierarchy...")
+
+bb0 = cg.BoundingBox.create()
+mm.addLocalRef(bb0)
+for i in range(0, numFaces):
+    bb0.addItem(m0.getFace(i))
+r0 = bb0.splitSAH(4, 16, 0, 1)
+assert r0.success
+
+print("  Building tree...")
+
+bt0 = cg.BoxBoundsTree.create()
+mm.addLocalRef(bt0)
+bt0.update(bb0)
+assert bt0.getNumItems() == numFaces
+
+print("    %s" % bt0.getValueString())
+
+print("  Comparing ray queries...")
+
+b0 = m0.getBounds()
+c0 = b0.getCenter()
+e0 = b0.getExtent()
+for i in range(0, numRays):
+    s = float(i) / numRays
+    p = cg.Vector3(c0.getX0() + (s - 0.5) * e0.getX0(),
+        c0.getX1() + (0.5 - s) * 0.7 * e0.getX1(), 1.)
+    u = cg.Vector3(0.1 * s, -0.2 * s, -1.).normalize()
+    l0 = cg.Line3(p, u)
+    h0 = bb0.getItemsOnRay(l0)
+    h1 = cg.BoxBoundsItemVector()
+    n1 = bt0.getItemsOnRay(l0, h1)
+    assert n1 == h0.size()
+    assert n1 > 0
+    assert bt0.getAnyItemOnRay(l0) is not None
+    assert bt0.getFirstItemOnRay(l0) is not None
+    l1 = cg.Line3(p, cg.Vector3(0., 0., 1.))
+    assert bt0.getAnyItemOnRay(l1) is None
+
+print("All tests passed.")
@@ -0,0 +1,67 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Bounding box hierarchy (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+gridSubDivs = 32
+numRays = 200
+
+print("  Creating mesh...")
+
+m0 = cg.Mesh.grid(gridSubDivs, gridSubDivs)
+mm.addLocalRef(m0)
+m0.makeTris()
+m0.update(True, False)
+numFaces = m0.getNumFaces()
+
+print("    numFaces = %d" % numFaces)
+
+def createRoot(m):
+    b = cg.BoundingBox.create()
+    mm.addLocalRef(b)
+    for i in range(0, m.getNumFaces()):
+        b.addItem(m.getFace(i))
+    return b
+
+print("  Building hierarchy (split)...")
+
+bb0 = createRoot(m0)
+sp0 = cg.SplitSet.create()
+mm.addLocalRef(sp0)
+sp0.addSplits(cg.AXIS_X, 1)
+sp0.addSplits(cg.AXIS_Y, 1)
+sp0.addSplits(cg.AXIS_Z, 1)
+bb0.split(sp0, True, 4, 0, 0, cg.DEFAULT_TOLERANCE, True)
+
+print("  Building hierarchy (splitSAH)...")
+
+bb1 = createRoot(m0)
+r0 = bb1.splitSAH(4, 16, 0, 4)
+assert r0.success
+
+ls0 = cg.BoxBoundsItemSet()
+bb1.getLeaves(ls0)
+assert ls0.size() == numFaces
+
+print("  Comparing ray queries...")
+
+b0 = m0.getBounds()
+c0 = b0.getCenter()
+e0 = b0.getExtent()
+for i in range(0, numRays):
+    s = float(i) / numRays
+    p = cg.Vector3(c0.getX0() + (s - 0.5) * e0.getX0(),
+        c0.getX1() + (0.5 - s) * 0.7 * e0.getX1(), 1.)
+    u = cg.Vector3(0.1 * s, -0.2 * s, -1.).normalize()
+    l0 = cg.Line3(p, u)
+    h0 = bb0.getItemsOnRay(l0)
+    h1 = bb1.getItemsOnRay(l0)
+    assert h0.size() == h1.size()
+    assert h1.size() > 0
+
+print("All tests passed.")
@@ -0,0 +1,94 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Bounding box hierarchy (02)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+gridSubDivs = 32
+numRays = 200
+
+print("  Creating mesh...")
+
+m0 = cg.Mesh.grid(gridSubDivs, gridSubDivs)
+mm.addLocalRef(m0)
+m0.makeTris()
+m0.update(True, False)
+numFaces = m0.getNumFaces()
+
+print("    numFaces = %d" % numFaces)
+
+def createRoot(m):
+    b = cg.BoundingBox.create()
+    mm.addLocalRef(b)
+    for i in range(0, m.getNumFaces()):
+        b.addItem(m.getFace(i))
+    return b
+
+def compareRays(m, b0, b1, t0):
+    b = m.getBounds()
+    c = b.getCenter()
+    e = b.getExtent()
+    for i in range(0, numRays):
+        s = float(i) / numRays
+        p = cg.Vector3(c.getX0() + (s - 0.5) * e.getX0(),
+            c.getX1() + (0.5 - s) * 0.7 * e.getX1(), c.getX2() + 1.)
+        u = cg.Vector3(0.1 * s, -0.2 * s, -1.).normalize()
+        l0 = cg.Line3(p, u)
+        h0 = b0.getItemsOnRay(l0)
+        h1 = b1.getItemsOnRay(l0)
+        h2 = cg.BoxBoundsItemVector()
+        t0.getItemsOnRay(l0, h2)
+        assert h0.size() == h1.size()
+        assert h0.size() == h2.size()
+        assert h0.size() > 0
+
+print("  Building hierarchy...")
+
+bb0 = createRoot(m0)
+r0 = bb0.splitSAH(4, 16, 0, 1)
+assert r0.success
+a0 = bb0.getTotalArea()
+bt0 = cg.BoxBoundsTree.create()
+mm.addLocalRef(bt0)
+bt0.update(bb0)
+
+print("    area = %f" % a0)
+
+print("  Moving vertices...")
+
+m0.scale(cg.Vector3(2., 0.5, 1.))
+m0.translate(cg.Vector3(3., -1., 2.))
+m0.applyTransform()
+
+print("  Refitting...")
+
+a1 = bb0.refit(True, a0)
+ls0 = cg.BoxBoundsItemSet()
+bb0.getLeaves(ls0)
+assert ls0.size() == numFaces
+assert bb0.validate()
+bt0.refit(False)
+
+print("    area = %f" % a1)
+
+print("  Comparing ray queries...")
+
+bb1 = createRoot(m0)
+bb1.splitSAH(4, 16, 0, 1)
+compareRays(m0, bb1, bb0, bt0)
+
+print("  Rotating...")
+
+n0 = bb0.rotate(0)
+a2 = bb0.getTotalArea()
+assert a2 <= a1
+assert bb0.validate()
+compareRays(m0, bb1, bb0, bt0)
+
+print("    rotations = %d, area = %f" % (n0, a2))
+
+print("All tests passed.")
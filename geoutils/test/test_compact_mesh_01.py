@@ -0,0 +1,105 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Compact mesh (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Creating mesh...")
+
+m0 = cg.Mesh.cube()
+mm.addLocalRef(m0)
+m0.makeTris()
+m0.setFaceVertexNormals()
+m0.createEdges()
+m0.scale(cg.Vector3(2., 3., 4.))
+
+print("  Converting mesh to compact mesh...")
+
+cm0 = cg.CompactMesh.create()
+mm.addLocalRef(cm0)
+cm0.initFromMesh(m0)
+m0.applyTransform()
+
+print("    %s" % cm0.getValueString())
+
+assert cm0.getNumVertices() == m0.getNumVertices()
+assert cm0.getNumFaces() == m0.getNumFaces()
+assert cm0.getNumEdges() == m0.getNumEdges()
+assert cm0.getNumIndices() == 3 * m0.getNumFaces()
+assert cm0.getNumChannels() == 1
+assert cm0.isTriMesh()
+c0 = cm0.findChannel(cg.FaceData.TYPE_VERTEX_NORMAL)
+assert c0 == 0
+assert cm0.getChannelNumComponents(c0) == 3
+assert cm0.findChannel(cg.FaceData.TYPE_TEX_COORD) == -1
+
+for i in range(0, m0.getNumVertices()):
+    assert cm0.getVertex(i) == m0.getVertex(i).getVector()
+
+print("  Converting compact mesh to mesh...")
+
+m1 = cg.Mesh.create()
+mm.addLocalRef(m1)
+cm0.getMesh(m1)
+
+assert m1.getNumVertices() == m0.getNumVertices()
+assert m1.getNumFaces() == m0.getNumFaces()
+assert m1.getNumEdges() == m0.getNumEdges()
+for i in range(0, m0.getNumVertices()):
+    assert m1.getVertex(i).getVector() == m0.getVertex(i).getVector()
+for i in range(0, m0.getNumFaces()):
+    f0 = m0.getFace(i)
+    f1 = m1.getFace(i)
+    assert f1.getNumVertices() == f0.getNumVertices()
+    n0 = f0.getVertexNormals0()
+    n1 = f1.getVertexNormals0()
+    for k in range(0, f0.getNumVertices()):
+        assert f1.getVertex(k) == f0.getVertex(k)
+        assert n1.getVector(k).eq(n0.getVector(k))
+for i in range(0, m0.getNumEdges()):
+    e0 = m0.getEdge(i)
+    e1 = m1.getEdge(i)
+    assert e1.getVertex(0) == e0.getVertex(0)
+    assert e1.getVertex(1) == e0.getVertex(1)
+
+print("  Building compact mesh...")
+
+cm1 = cg.CompactMesh.create()
+mm.addLocalRef(cm1)
+for i in range(0, 4):
+    cm1.addVertex(i % 2, i // 2, 0.)
+fv0 = ib.UIntVector()
+fv0.push_back(0)
+fv0.push_back(1)
+fv0.push_back(3)
+fv0.push_back(2)
+assert cm1.addFace(fv0) == 0
+assert cm1.getNumFaceVertices(0) == 4
+assert not cm1.isTriMesh()
+assert cm1.addChannel(cg.FaceData.TYPE_TEX_COORD, 2) == 0
+fv1 = ib.UIntVector()
+assert cm1.getFace(0, fv1) == 4
+assert list(fv1) == [0, 1, 3, 2]
+
+print("  Checking buffer lifetime...")
+
+b0 = cm1.getPositionBuffer()
+assert b0.shape == (4, 3)
+assert b0.readonly
+assert b0.tolist()[3] == [1., 1., 0.]
+assert cm1.getNumBufferRefs() == 1
+try:
+    cm1.addVertex(2., 0., 0.)
+    assert False
+except RuntimeError:
+    pass
+assert cm1.getNumVertices() == 4
+del b0
+assert cm1.getNumBufferRefs() == 0
+assert cm1.addVertex(2., 0., 0.) == 4
+
+print("All tests passed.")
@@ -0,0 +1,182 @@
+import IFObjectBase as ib
+import IFMapping as im
+import CGeoUtils as cg
+
+testName = "Instance transforms (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+numItems = 6
+tolerance = 1e-9
+
+def createGroup():
+    g0 = cg.TransformableGroup.create()
+    mm.addLocalRef(g0)
+    for i in range(0, numItems):
+        p0 = cg.Polygon3.square()
+        p0.scale(cg.Vector3(1. + 0.5 * i, 2., 1.))
+        p0.translate(cg.Vector3(0.25 * i, -0.5 * i, 0.1 * i))
+        g0.addItem(p0)
+    return g0
+
+def update(nodes):
+    graph = cg.TransformGraph.create()
+    mm.addLocalRef(graph)
+    for it in nodes:
+        graph.addNode(it)
+    graph.chain()
+    graph.setIO()
+    graph.update()
+    return graph.getOutput(0)
+
+def checkVector(v0, v1):
+    for k in range(0, 3):
+        assert abs(v0[k] - v1[k]) <= tolerance
+
+print("  Evaluating mappings...")
+
+m0 = im.Linear.create()
+m0.setLower(-2.)
+m0.setUpper(3.)
+v0 = ib.DoubleVector()
+for i in range(0, numItems):
+    v0.push_back(i / (numItems - 1.))
+r0 = ib.DoubleVector()
+m0.callBatch(v0, r0)
+assert r0.size() == numItems
+for i in range(0, numItems):
+    assert abs(r0[i] - m0(v0[i])) <= tolerance
+
+def checkBatch(m, values):
+    r = ib.DoubleVector()
+    m.callBatch(values, r)
+    assert r.size() == values.size()
+    for i in range(0, values.size()):
+        assert abs(r[i] - m(values[i])) <= tolerance
+
+m3 = im.Linear.create()
+m3.setLower(1.)
+m3.setUpper(-1.)
+m3.setScale(0.5)
+m3.setOffset(0.25)
+m3.setResultScale(2.)
+m3.setResultOffset(-0.5)
+checkBatch(m3, v0)
+m3.setFunc(m0)
+checkBatch(m3, v0)
+
+m4 = im.Lookup.create()
+for i in range(0, 5):
+    m4.addEntry(0.5 * i * i - 1.)
+checkBatch(m4, v0)
+
+m5 = im.Piecewise.create()
+for m, t in [ (m0, 0.), (m4, 0.3), (None, 0.6), (m3, 0.8) ]:
+    p0 = im.Piece.create()
+    if m is not None:
+        p0.setMapping(m)
+    p0.setParam(t)
+    m5.addPiece(p0)
+checkBatch(m5, v0)
+
+m6 = cg.Lookup3.create()
+for i in range(0, 4):
+    m6.addEntry(cg.Vector3.create(i, -2. * i, 0.5 + i))
+rx = ib.DoubleVector()
+ry = ib.DoubleVector()
+rz = ib.DoubleVector()
+m6.callBatch(v0, rx, ry, rz)
+assert rx.size() == numItems
+for i in range(0, numItems):
+    checkVector((rx[i], ry[i], rz[i]), m6(v0[i]))
+
+m1 = im.Linear.create()
+m1.setLower(0.5)
+m1.setUpper(1.5)
+m2 = cg.Compose3.create()
+m2.setFuncX0(m0)
+m2.setFuncX1(m1)
+rx = ib.DoubleVector()
+ry = ib.DoubleVector()
+rz = ib.DoubleVector()
+m2.callBatch(v0, rx, ry, rz)
+for i in range(0, numItems):
+    # The Z component falls back to the Y component mapping.
+    checkVector((rx[i], ry[i], rz[i]), m2(v0[i]))
+
+print("  Arranging elements (Array)...")
+
+n0 = cg.Source.create()
+n0.setSource(createGroup())
+n1 = cg.Array.create()
+n1.setNumRows(2)
+n1.setNumColumns(3)
+n1.setCellWidth(2.)
+n1.setCellHeight(4.)
+n1.setOffset(cg.Vector3(1., 2., 3.))
+t0 = cg.InstanceTransforms()
+n1.getInstanceTransforms(numItems, t0)
+assert t0.offsetX.size() == numItems
+assert t0.scaleX.size() == 0
+o0 = update([ n0, n1 ])
+g0 = createGroup()
+for i in range(0, numItems):
+    row = i // 3
+    col = i % 3
+    v1 = cg.Vector3(-3. + (col + 0.5) * 2. + 1.,
+        -4. + (2 - row - 0.5) * 4. + 2., 3.)
+    checkVector((t0.offsetX[i], t0.offsetY[i], t0.offsetZ[i]), v1)
+    c0 = g0.getItem(i).getBounds().getCenter()
+    checkVector(o0.getItem(i).getBounds().getCenter(), c0 + v1)
+
+print("  Scattering elements (Scatter)...")
+
+def createScatter(centeringMethod):
+    n2 = cg.Scatter.create()
+    n2.setOffsetFunc(m2)
+    n2.setOffsetScale(cg.Vector3(2., 1., 0.5))
+    n2.setOffsetDeltaScaleFactor(0.1)
+    n2.setElementScale(cg.Vector3(1.5, 0.5, 2.))
+    n2.setElementDeltaScaleFactor(-0.05)
+    n2.setElementScaleIndexFunc(m2)
+    n2.setCenteringMethod(centeringMethod)
+    return n2
+
+for cm in [ cg.CENTER_BOUNDS, cg.CENTER_BARYCENTER, cg.CENTER_ORIGIN ]:
+    n0 = cg.Source.create()
+    n0.setSource(createGroup())
+    n2 = createScatter(cm)
+    o0 = update([ n0, n2 ])
+    assert o0.getNumItems() == numItems
+    # Transform each element individually for comparison.
+    g0 = createGroup()
+    t0 = cg.InstanceTransforms()
+    n2.getInstanceTransforms(g0, t0)
+    assert t0.scaleX.size() == numItems
+    for i in range(0, numItems):
+        it0 = g0.getItem(i)
+        f = 1. + 0.1 * i
+        v1 = cg.Vector3(2. * f, f, 0.5 * f).multElements(
+            m2(i / (numItems - 1.)))
+        checkVector((t0.offsetX[i], t0.offsetY[i], t0.offsetZ[i]), v1)
+        it0.translate(v1)
+        if cm == cg.CENTER_BOUNDS:
+            c0 = it0.getBounds().getCenter()
+        elif cm == cg.CENTER_BARYCENTER:
+            c0 = it0.getBarycenter()
+        else:
+            c0 = cg.Vector3.ZERO
+        s0 = (cg.Vector3(1.5, 0.5, 2.) * (1. - 0.05 * i)).multElements(
+            m2(i / (numItems - 1.)))
+        it0.translate(c0.flip())
+        it0.scale(s0)
+        it0.translate(c0)
+        b0 = it0.getBounds()
+        b1 = o0.getItem(i).getBounds()
+        checkVector(b1.getCenter(), b0.getCenter())
+        checkVector(b1.getRadius(), b0.getRadius())
+
+print("All tests passed.")
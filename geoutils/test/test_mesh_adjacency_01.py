@@ -0,0 +1,83 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Mesh adjacency (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Building adjacency for closed mesh...")
+
+m0 = cg.Mesh.cube()
+mm.addLocalRef(m0)
+
+a0 = cg.MeshAdjacency.create()
+mm.addLocalRef(a0)
+assert a0.update(m0) == 12
+
+print("    %s" % a0.getValueString())
+
+assert a0.getNumVertices() == 8
+assert a0.getNumFaces() == 6
+assert a0.getNumHalfEdges() == 24
+assert a0.getNumEdges() == 12
+assert a0.isClosed()
+assert a0.isManifold()
+for i in range(0, a0.getNumHalfEdges()):
+    t0 = a0.getTwin(i)
+    assert t0 != cg.HALF_EDGE_NONE
+    assert a0.getTwin(t0) == i
+    assert a0.getHalfEdgeSource(t0) == a0.getHalfEdgeTarget(i)
+    assert a0.getHalfEdgeTarget(t0) == a0.getHalfEdgeSource(i)
+    assert a0.getPrevHalfEdge(a0.getNextHalfEdge(i)) == i
+for i in range(0, a0.getNumFaces()):
+    n0 = ib.UIntVector()
+    assert a0.getFaceNeighbors(i, n0) == 4
+    assert not i in list(n0)
+for i in range(0, a0.getNumVertices()):
+    n0 = ib.UIntVector()
+    assert a0.getVertexNeighbors(i, n0) == 3
+
+print("  Building adjacency for open mesh...")
+
+cm0 = cg.CompactMesh.create()
+mm.addLocalRef(cm0)
+for i in range(0, 6):
+    cm0.addVertex(i % 3, i // 3, 0.)
+fv0 = ib.UIntVector()
+for i in [0, 1, 4, 3]:
+    fv0.push_back(i)
+cm0.addFace(fv0)
+fv1 = ib.UIntVector()
+for i in [1, 2, 5, 4]:
+    fv1.push_back(i)
+cm0.addFace(fv1)
+
+a1 = cg.MeshAdjacency.create()
+mm.addLocalRef(a1)
+assert a1.update(cm0) == 7
+assert not a1.isClosed()
+assert a1.isManifold()
+be0 = ib.UIntVector()
+assert a1.getBoundaryEdges(be0) == 6
+lv0 = ib.UIntVector()
+lo0 = ib.UIntVector()
+assert a1.getBoundaryLoops(lv0, lo0) == 1
+assert len(lv0) == 6
+n1 = ib.UIntVector()
+assert a1.getFaceNeighbors(0, n1) == 1
+assert list(n1) == [1]
+
+print("  Creating mesh edges...")
+
+assert m0.createEdges() == 12
+assert m0.getNumEdges() == 12
+for i in range(0, m0.getNumEdges()):
+    e0 = m0.getEdge(i)
+    h0 = a0.getEdgeHalfEdge(i)
+    assert e0.getVertex(0) == a0.getHalfEdgeSource(h0)
+    assert e0.getVertex(1) == a0.getHalfEdgeTarget(h0)
+
+print("All tests passed.")
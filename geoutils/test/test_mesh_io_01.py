@@ -0,0 +1,123 @@
+import os
+import struct
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Mesh I/O (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+outFilePrefix = 'temp' + os.path.sep + 'meshio01'
+
+m0 = cg.Mesh.cube()
+mm.addLocalRef(m0)
+m0.setID("cube")
+
+cm0 = cg.CompactMesh.create()
+mm.addLocalRef(cm0)
+cm0.initFromMesh(m0)
+cm0.setID("cube")
+
+def checkMesh(cm1, numVerts, numFaces, checkIndices = True):
+    assert cm1.getNumVertices() == numVerts
+    assert cm1.getNumFaces() == numFaces
+    if checkIndices:
+        for i in range(0, cm0.getNumFaces()):
+            f0 = ib.UIntVector()
+            f1 = ib.UIntVector()
+            cm0.getFace(i, f0)
+            cm1.getFace(i, f1)
+            assert list(f0) == list(f1)
+        for i in range(0, numVerts):
+            assert cm1.getVertex(i).eq(cm0.getVertex(i))
+
+print("  Writing and reading OBJ file...")
+
+cg.writeOBJ(outFilePrefix + '.obj', cm0)
+cm1 = cg.CompactMesh.create()
+mm.addLocalRef(cm1)
+cg.readOBJ(outFilePrefix + '.obj', cm1)
+checkMesh(cm1, 8, 6)
+assert cm1.getID() == "cube"
+
+m1 = cg.Mesh.create()
+mm.addLocalRef(m1)
+cg.readOBJ(outFilePrefix + '.obj', m1)
+assert m1.getNumVertices() == 8
+assert m1.getNumFaces() == 6
+
+print("  Writing and reading PLY file...")
+
+cg.writePLY(outFilePrefix + '.ply', cm0)
+cg.readPLY(outFilePrefix + '.ply', cm1)
+checkMesh(cm1, 8, 6)
+cg.writePLY(outFilePrefix + '.ply', m0, True)
+cg.readPLY(outFilePrefix + '.ply', cm1)
+checkMesh(cm1, 8, 6)
+
+print("  Reading malformed PLY files...")
+
+def checkInvalidPLY(name, header, data):
+    fn = outFilePrefix + '_' + name + '.ply'
+    f = open(fn, 'wb')
+    f.write(("ply\nformat binary_little_endian 1.0\n" + header 
+        + "end_header\n").encode('ascii'))
+    f.write(data)
+    f.close()
+    try:
+        cg.readPLY(fn, cm1)
+    except RuntimeError:
+        return
+    assert False
+
+vertexHeader = ("element vertex 3\nproperty float x\nproperty float y\n"
+    "property float z\n")
+vertexData = struct.pack('<9f', 0., 0., 0., 1., 0., 0., 0., 1., 0.)
+# List count that overflows the list size.
+checkInvalidPLY('overflow', vertexHeader 
+    + "element face 1\nproperty list uint int vertex_indices\n", 
+    vertexData + struct.pack('<I3i', 0x40000001, 0, 1, 2))
+# Scalar property of a list element past the end of the file.
+checkInvalidPLY('truncated', vertexHeader 
+    + "element face 1\nproperty list uchar int vertex_indices\n"
+    "property double quality\n", 
+    vertexData + struct.pack('<B3i', 3, 0, 1, 2) + b'\0\0\0\0')
+# Negative vertex index.
+checkInvalidPLY('negative', vertexHeader 
+    + "element face 1\nproperty list uchar int vertex_indices\n", 
+    vertexData + struct.pack('<B3i', 3, 0, -1, 2))
+# Vertex index out of range.
+checkInvalidPLY('range', vertexHeader 
+    + "element face 1\nproperty list uchar int vertex_indices\n", 
+    vertexData + struct.pack('<B3i', 3, 0, 1, 3))
+# Vertex element past the end of the file.
+checkInvalidPLY('vertices', "element vertex 4294967295\n"
+    "property double x\nproperty double y\nproperty double z\n", 
+    vertexData)
+
+print("  Writing and reading STL file...")
+
+cg.writeSTL(outFilePrefix + '.stl', cm0)
+cg.readSTL(outFilePrefix + '.stl', cm1)
+checkMesh(cm1, 8, 12, False)
+cg.readSTL(outFilePrefix + '.stl', cm1, False)
+checkMesh(cm1, 36, 12, False)
+
+print("  Reading OBJ file with relative indices...")
+
+f = open(outFilePrefix + '_rel.obj', 'w')
+f.write("# triangles\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\n"
+    "f -3/1 -2/1 -1/1\nf 1//1 2//1 3//1\n")
+f.close()
+cg.readOBJ(outFilePrefix + '_rel.obj', cm1)
+assert cm1.getNumVertices() == 3
+assert cm1.getNumFaces() == 2
+for i in range(0, 2):
+    f0 = ib.UIntVector()
+    cm1.getFace(i, f0)
+    assert list(f0) == [0, 1, 2]
+
+print("All tests passed.")
@@ -0,0 +1,115 @@
+import math
+import IFObjectBase as ib
+import CGeoUtils as cg
+import GeoUtilsGL as ggl
+
+testName = "Mesh update (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+def checkFaceGeometry(m0):
+    assert m0.hasFaceGeometry()
+    for i in range(0, m0.getNumFaces()):
+        f0 = m0.getFace(i)
+        b0 = m0.getFaceBounds(i)
+        assert b0 == f0.getBounds()
+        n0 = m0.getFaceNormal(i)
+        t0 = m0.getFaceTangent(i)
+        bn0 = m0.getFaceBinormal(i)
+        # Tangent space calculated by the face (after the bulk update).
+        assert n0.eq(f0.getNormal())
+        assert t0.eq(f0.getTangent())
+        assert bn0.eq(f0.getBinormal())
+
+print("  Updating cube mesh...")
+
+m0 = cg.Mesh.cube()
+mm.addLocalRef(m0)
+m0.update()
+checkFaceGeometry(m0)
+assert m0.getBounds() == m0.getVertexSource().getBounds()
+
+print("  Updating grid mesh (parallel)...")
+
+m1 = cg.Mesh.grid(100, 100)
+mm.addLocalRef(m1)
+m1.updateGeometry(4)
+assert m1.getNumFaces() >= cg.MESH_UPDATE_PARALLEL_MIN_FACES
+checkFaceGeometry(m1)
+assert m1.getBounds() == m1.getVertexSource().getBounds()
+
+print("  Updating transformed faces...")
+
+m1.getFace(5).translate(cg.Vector3(0., 0., 2.))
+m1.update()
+checkFaceGeometry(m1)
+b0 = m1.getFaceBounds(5)
+assert b0.getZ().getRMin() == 2.
+
+print("  Setting face vertex normals...")
+
+m0.setFaceVertexNormals(True)
+for i in range(0, m0.getNumFaces()):
+    f0 = m0.getFace(i)
+    vn0 = f0.getVertexNormals0()
+    n0 = m0.getFaceNormal(i).flip()
+    for k in range(0, f0.getNumVertices()):
+        assert vn0.getVector(k).eq(n0)
+
+print("  Setting vertex attribute normals...")
+
+va0 = ggl.VertexAttribute.create()
+mm.addLocalRef(va0)
+# The vertex attribute layout only supports triangles.
+try:
+    va0.setData(m0, ggl.VertexAttribute.TYPE_NORMAL, cg.Mesh.NFACE_TYPE_FACE)
+    assert False
+except RuntimeError:
+    pass
+m2 = cg.Mesh.cube()
+mm.addLocalRef(m2)
+m2.makeTris()
+m2.update()
+n = va0.setData(m2, ggl.VertexAttribute.TYPE_NORMAL, cg.Mesh.NFACE_TYPE_FACE)
+va1 = ggl.VertexAttribute.create()
+mm.addLocalRef(va1)
+assert n == va1.setData(m2, ggl.VertexAttribute.TYPE_POSITION, 
+    cg.Mesh.NFACE_TYPE_FACE)
+assert n == 3 * m2.getNumFaces()
+assert va0.getNumElements() == n
+for i in range(0, m2.getNumFaces()):
+    n0 = m2.getFaceNormal(i)
+    for k in range(0, 3):
+        for j in range(0, 3):
+            assert abs(va0.getFloat(3 * i + k, j) - n0[j]) < 1e-6
+
+print("  Applying transformations...")
+
+m3 = cg.Mesh.cube()
+mm.addLocalRef(m3)
+m3.update()
+n1 = [ m3.getFaceNormal(i) for i in range(0, m3.getNumFaces()) ]
+# Rotation about the Z axis: (x, y, z) -> (-y, x, z)
+m3.rotate(0.5 * math.pi, cg.AXIS_Z)
+m3.applyTransform()
+assert not m3.hasFaceGeometry()
+m3.update()
+checkFaceGeometry(m3)
+for i in range(0, m3.getNumFaces()):
+    n0 = m3.getFaceNormal(i)
+    n2 = cg.Vector3(-n1[i][1], n1[i][0], n1[i][2])
+    for k in range(0, 3):
+        assert abs(n0[k] - n2[k]) < 1e-9
+
+print("  Clearing face geometry...")
+
+m0.clearFaceGeometry()
+assert not m0.hasFaceGeometry()
+m0.addFace(cg.Face.create(0, 1, 2))
+m0.update(False)
+assert not m0.hasFaceGeometry()
+
+print("All tests passed.")
@@ -0,0 +1,129 @@
+import math
+import IFObjectBase as ib
+import CGeoUtils as cg
+import Altjira as ai
+import AltjiraGeoUtils as ag
+
+testName = "Pixel spans (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+width = 24
+height = 16
+
+def createImage():
+    img = ag.Image.create()
+    mm.addLocalRef(img)
+    img.createNewData(width, height)
+    img.fill(ai.Color.WHITE)
+    return img
+
+img0 = createImage()
+
+def getTreePixels(items):
+    bb1 = cg.BoundingBox.create()
+    mm.addLocalRef(bb1)
+    bb1.addItems(items)
+    bs1 = cg.BoxBoundsItemSet()
+    bb1.getLeaves(bs1)
+    result = set()
+    for it in bs1:
+        c0 = it.getCenter()
+        result.add((int(c0.getX0()), int(c0.getX1())))
+    return result
+
+def getSpanPixels(spans, numPixels):
+    result = set()
+    for i in range(0, spans.size()):
+        s = spans[i]
+        assert s.x0 < s.x1
+        for x in range(s.x0, s.x1):
+            assert not (x, s.y) in result
+            result.add((x, s.y))
+    assert len(result) == numPixels
+    return result
+
+print("  Creating pixel tree...")
+
+bb0 = cg.BoundingBox.create()
+mm.addLocalRef(bb0)
+img0.getPixelTree(bb0)
+assert bb0.getNumItems() == width * height
+
+print("  Checking ray queries...")
+
+l0 = cg.Line3.create()
+mm.addLocalRef(l0)
+for p, phi in [ ((3.3, 2.7, 0.), 0.3), ((20.2, 1.4, 0.), 2.1),
+    ((-4.1, 8.3, 0.), -0.2), ((12.6, 7.7, 0.), math.pi * 0.5) ]:
+    l0.setP(cg.Vector3(*p))
+    l0.setU(cg.Vector3(math.cos(phi), math.sin(phi), 0.))
+    s0 = cg.PixelSpanVector()
+    n0 = img0.getPixelSpansOnRay(l0, s0)
+    assert n0 > 0
+    assert getSpanPixels(s0, n0) == getTreePixels(bb0.getItemsOnRay(l0))
+
+print("  Checking sphere queries...")
+
+sp0 = cg.Sphere3.create()
+mm.addLocalRef(sp0)
+for p, r in [ ((5.2, 4.9, 0.), 3.1), ((22.3, 14.1, 0.4), 2.) ]:
+    sp0.setP(cg.Vector3(*p))
+    sp0.setR(r)
+    s0 = cg.PixelSpanVector()
+    n0 = img0.getPixelSpansInSphere(sp0, s0)
+    assert getSpanPixels(s0, n0) == getTreePixels(
+        bb0.getItemsInSphere(sp0))
+
+print("  Checking box queries...")
+
+b0 = cg.BoxBoundsItem(cg.Vector3(10.3, 6.2, 0.),
+    cg.Vector3(4.1, 2.6, 1.))
+mm.addLocalRef(b0)
+s0 = cg.PixelSpanVector()
+n0 = img0.getPixelSpansInBox(b0, s0)
+assert getSpanPixels(s0, n0) == getTreePixels(bb0.getItemsInBox(b0))
+
+print("  Checking polygon queries...")
+
+p0 = cg.Polygon3.create()
+mm.addLocalRef(p0)
+for v in [ (2., 2., 0.), (12., 2., 0.), (12., 6., 0.), (2., 6., 0.) ]:
+    p0.addVertex(cg.Vertex3(*v))
+s0 = cg.PixelSpanVector()
+n0 = img0.getPixelSpansInPolygon(p0, s0)
+assert n0 == 40
+assert getSpanPixels(s0, n0) == set([ (x, y) for x in range(2, 12)
+    for y in range(2, 6) ])
+
+print("  Marking pixels...")
+
+markColor = ai.Color(0., 0., 1., 0.2)
+l0.setP(cg.Vector3(3.3, 2.7, 0.))
+l0.setU(cg.Vector3(math.cos(0.3), math.sin(0.3), 0.))
+img1 = createImage()
+bs0 = cg.BoxBoundsItemSet()
+bb1 = cg.BoundingBox.create()
+mm.addLocalRef(bb1)
+bb1.addItems(bb0.getItemsOnRay(l0))
+bb1.getLeaves(bs0)
+img1.markPixels(bs0, markColor)
+img2 = createImage()
+s0 = cg.PixelSpanVector()
+img2.getPixelSpansOnRay(l0, s0)
+img2.markPixelSpans(s0, markColor)
+c1 = ai.ByteColor()
+c1.space = ai.Color.SPACE_RGB
+c2 = ai.ByteColor()
+c2.space = ai.Color.SPACE_RGB
+for x in range(0, width):
+    for y in range(0, height):
+        img1.getPixel(x, y, c1)
+        img2.getPixel(x, y, c2)
+        assert (c1.c0, c1.c1, c1.c2, c1.alpha) == (c2.c0, c2.c1, c2.c2,
+            c2.alpha)
+
+print("All tests passed.")
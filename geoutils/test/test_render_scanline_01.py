@@ -0,0 +1,119 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+import Altjira as ai
+import AltjiraGeoUtils as ag
+
+testName = "Render (scanline) (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+width = 64
+height = 64
+
+s0 = cg.getSVGShapeStyle("#ff0000", 1., "#000000", 1., 0.)
+s1 = cg.getSVGShapeStyle("#0000ff", 0.5, "#000000", 1., 0.)
+styles = cg.SVGShapeStyleVector()
+styles.push_back(s0)
+styles.push_back(s1)
+
+def createImage():
+    img0 = ag.Image.create()
+    mm.addLocalRef(img0)
+    img0.createNewData(width, height)
+    img0.fill(ai.Color.TRANSPARENT)
+    return img0
+
+def createPolygons():
+    ps0 = cg.Polygon3Set.create()
+    mm.addLocalRef(ps0)
+    # Polygon 0: 32x32 square, centered.
+    p0 = cg.Polygon3.square()
+    p0.scale(cg.Vector3(32., 1., 32.))
+    ps0.addPolygon(p0)
+    # Polygon 1: 16x16 square, overlapping the right half of polygon 0.
+    p1 = cg.Polygon3.square()
+    p1.scale(cg.Vector3(16., 1., 16.))
+    p1.translate(cg.Vector3(16.5, 0., 0.))
+    ps0.addPolygon(p1)
+    return ps0
+
+def getPixel(img, x, y):
+    c0 = ai.ByteColor()
+    c0.space = ai.Color.SPACE_RGB
+    img.getPixel(x, y, c0)
+    return (c0.c0, c0.c1, c0.c2, c0.alpha)
+
+def getPixels(img):
+    return [ getPixel(img, x, y) for x in range(0, width) 
+        for y in range(0, height) ]
+
+print("  Rasterizing polygons...")
+
+img0 = createImage()
+img0.rasterizePolygons(createPolygons(), styles, cg.AXIS_Y)
+# Inside polygon 0.
+assert getPixel(img0, 20, 32) == (255, 0, 0, 255)
+# Outside all polygons.
+assert getPixel(img0, 2, 2)[3] == 0
+assert getPixel(img0, 15, 32)[3] == 0
+# Polygon edges on pixel boundaries.
+assert getPixel(img0, 16, 32) == (255, 0, 0, 255)
+assert getPixel(img0, 32, 16) == (255, 0, 0, 255)
+assert getPixel(img0, 32, 15)[3] == 0
+# Polygon 1 is composited over polygon 0.
+c0 = getPixel(img0, 44, 32)
+assert (c0[0] > 120) and (c0[0] < 135)
+assert (c0[2] > 120) and (c0[2] < 135)
+assert c0[3] == 255
+# Polygon 1 partially covers column 56 and has half opacity.
+c0 = getPixel(img0, 56, 32)
+assert c0[2] == 255
+assert (c0[3] > 55) and (c0[3] < 72)
+
+print("  Checking tiles and threads...")
+
+p0 = getPixels(img0)
+for numThreads, tileSize in [ (1, 64), (1, 7), (4, 5), (0, 16) ]:
+    img1 = createImage()
+    img1.rasterizePolygons(createPolygons(), styles, cg.AXIS_Y, 0, 0, 
+        numThreads, tileSize)
+    assert getPixels(img1) == p0
+
+print("  Comparing with cairo...")
+
+img1 = createImage()
+img1.begin()
+img1.drawPolygons(createPolygons(), styles, cg.AXIS_Y)
+img1.finish()
+p1 = getPixels(img1)
+for i in range(0, len(p0)):
+    # Anti-aliasing may differ slightly at the edges.
+    assert abs(p0[i][3] - p1[i][3]) <= 4
+
+print("  Rendering (transform node)...")
+
+g0 = cg.TransformableGroup.create()
+ps0 = createPolygons()
+for i in range(0, ps0.getNumPolygons()):
+    g0.addItem(ps0.getPolygon(i))
+n0 = cg.Source.create()
+n0.setSource(g0)
+img2 = createImage()
+n1 = ag.Render.create()
+n1.setImage(img2)
+n1.setAxis(cg.AXIS_Y)
+n1.addStyles(styles)
+n1.setBackend(cg.RENDER_BACKEND_SCANLINE)
+graph = cg.TransformGraph.create()
+mm.addLocalRef(graph)
+graph.addNode(n0)
+graph.addNode(n1)
+graph.chain()
+graph.setIO()
+graph.update()
+assert getPixels(img2) == p0
+
+print("All tests passed.")
@@ -0,0 +1,162 @@
+import os
+import re
+import tempfile
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "SVG writer (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+numPolygons = 6
+
+s0 = cg.getSVGShapeStyle("#ff0000", 1., "#000000", 1., 0.)
+s1 = cg.getSVGShapeStyle("#0000ff", 0.5, "#000000", 1., 0.)
+s2 = cg.getSVGShapeStyle("#ff0000", 1., "#000000", 1., 0.)
+
+def createPolygons():
+    ps0 = cg.Polygon3Set.create()
+    mm.addLocalRef(ps0)
+    for i in range(0, numPolygons):
+        p0 = cg.Polygon3.square()
+        p0.scale(cg.Vector3(10.123456, 1., 10.))
+        p0.translate(cg.Vector3(20. * i - 0.5, 0., 0.25))
+        ps0.addPolygon(p0)
+    return ps0
+
+def createStyles(styleList):
+    sv = cg.SVGShapeStyleVector()
+    for it in styleList:
+        sv.push_back(it)
+    return sv
+
+def writeSVG(w, ps, styles = None):
+    f0 = tempfile.mkstemp(suffix = ".svg")
+    os.close(f0[0])
+    w.writeFile(f0[1], ps, styles)
+    with open(f0[1]) as f:
+        d = f.read()
+    os.remove(f0[1])
+    return d
+
+def getElements(svg, tag):
+    return re.findall('<%s id="([^"]*)"[^>]*(?:points|d)="([^"]*)" />'
+        % tag, svg)
+
+def getCoords(data):
+    return [ float(it) for it in re.findall(r'-?[0-9.]+(?:e[-+]?[0-9]+)?',
+        data) ]
+
+print("  Writing polygons...")
+
+ps0 = createPolygons()
+w0 = cg.SVGWriter.create()
+mm.addLocalRef(w0)
+svg0 = writeSVG(w0, ps0)
+assert svg0.startswith('<?xml')
+e0 = getElements(svg0, "polygon")
+assert len(e0) == numPolygons
+assert [ it[0] for it in e0 ] == [ "polygon%08d" % i
+    for i in range(0, numPolygons) ]
+# Compare the coordinates with the existing SVG output.
+e1 = getElements(createPolygons().getSVG(cg.SVG_DEFAULT_POLY_STYLE,
+    "polygon", cg.AXIS_Y), "polygon")
+assert len(e1) == numPolygons
+for i in range(0, numPolygons):
+    c0 = getCoords(e0[i][1])
+    c1 = getCoords(e1[i][1])
+    assert len(c0) == len(c1)
+    for k in range(0, len(c0)):
+        assert abs(c0[k] - c1[k]) <= 0.0011
+
+print("  Checking precision...")
+
+w0.setPrecision(1)
+svg1 = writeSVG(w0, createPolygons())
+for it in getElements(svg1, "polygon"):
+    for c in it[1].replace(",", " ").split():
+        assert re.match(r'^-?[0-9]+(\.[0-9])?$', c)
+w0.setPrecision(0)
+svg1 = writeSVG(w0, createPolygons())
+for it in getElements(svg1, "polygon"):
+    for c in it[1].replace(",", " ").split():
+        assert re.match(r'^-?[0-9]+$', c)
+
+def formatNumber(v, precision):
+    s = "%.*f" % (precision, v)
+    if "." in s:
+        s = s.rstrip("0").rstrip(".")
+    if s == "-0":
+        s = "0"
+    return s
+
+# Coordinates are rounded like printf(), with trailing zeros and the sign
+# of zero omitted.
+ps1 = createPolygons()
+p0 = cg.Polygon3.square()
+p0.translate(cg.Vector3(0.5001, 0., 0.4999))
+ps1.addPolygon(p0)
+for precision in [ 3, 17 ]:
+    w0.setPrecision(precision)
+    svg1 = writeSVG(w0, ps1)
+    c0 = set()
+    for i in range(0, ps1.getNumPolygons()):
+        p1 = ps1.getPolygon(i)
+        for k in range(0, p1.getNumVertices()):
+            v0 = p1.getVertex(k)
+            for c in [ v0.getX(), v0.getY(), v0.getZ() ]:
+                c0.add(formatNumber(c, precision))
+    for it in getElements(svg1, "polygon"):
+        for c in it[1].replace(",", " ").split():
+            assert c in c0
+            assert c != "-0"
+w0.setPrecision(cg.DEFAULT_SVG_PRECISION)
+
+print("  Coalescing paths...")
+
+w0.setCoalescePaths(True)
+svg2 = writeSVG(w0, createPolygons())
+e2 = getElements(svg2, "path")
+assert len(e2) == 1
+assert e2[0][0] == "polygon00000000"
+assert e2[0][1].count("M ") == numPolygons
+assert e2[0][1].count(" z") == numPolygons
+# Alternating styles can not be coalesced without changing the paint
+# order.
+svg2 = writeSVG(w0, createPolygons(), createStyles([ s0, s1 ]))
+assert len(getElements(svg2, "path")) == numPolygons
+# Distinct styles with identical attributes are coalesced.
+svg2 = writeSVG(w0, createPolygons(), createStyles([ s0, s2 ]))
+assert len(getElements(svg2, "path")) == 1
+
+print("  Writing SVG (transform node)...")
+
+g0 = cg.TransformableGroup.create()
+ps0 = createPolygons()
+for i in range(0, ps0.getNumPolygons()):
+    g0.addItem(ps0.getPolygon(i))
+n0 = cg.Source.create()
+n0.setSource(g0)
+f0 = tempfile.mkstemp(suffix = ".svg")
+os.close(f0[0])
+n1 = cg.WriteSVG.create()
+n1.setFileName(f0[1])
+n1.setAxis(cg.AXIS_Y)
+n1.setCoalescePaths(True)
+graph = cg.TransformGraph.create()
+mm.addLocalRef(graph)
+graph.addNode(n0)
+graph.addNode(n1)
+graph.chain()
+graph.setIO()
+graph.update()
+with open(f0[1]) as f:
+    svg3 = f.read()
+os.remove(f0[1])
+assert len(getElements(svg3, "path")) == 1
+assert svg3.rstrip().endswith("</svg>")
+
+print("All tests passed.")
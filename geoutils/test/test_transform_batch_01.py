@@ -0,0 +1,72 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Batch vertex transforms (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+m0 = (cg.Matrix4.translate(1., -2., 0.5) * cg.Matrix4.rotate(0.3, cg.AXIS_Y)
+    * cg.Matrix4.scale(2., 3., 0.5))
+v0 = cg.Matrix4.perspective(4.)
+
+def checkVertexSet(n, useVI):
+    vs0 = cg.Vertex3Set.create()
+    mm.addLocalRef(vs0)
+    vs1 = cg.Vertex3Set.create()
+    mm.addLocalRef(vs1)
+    for i in range(0, n):
+        x = 0.001 * i
+        y = 1. - 0.002 * i
+        z = 0.5 * (i % 17)
+        vs0.addVertex().setCoords(x, y, z)
+        vs1.addVertex().setCoords(x, y, z)
+    vs0.transform(m0)
+    if useVI:
+        vs0.transformVI(v0)
+    vs0.applyTransform()
+    for i in range(0, n):
+        c0 = vs1.getVertex(i)
+        c0.transform(m0)
+        if useVI:
+            c0.transformVI(v0)
+        assert vs0.getVertex(i).eq(c0)
+    mm.removeLocalRef(vs0)
+    mm.removeLocalRef(vs1)
+
+print("  Transforming vertex sets...")
+
+for n in [1, 3, 4, 7, 100]:
+    checkVertexSet(n, False)
+    checkVertexSet(n, True)
+
+print("  Transforming large vertex set...")
+
+checkVertexSet(70000, True)
+
+print("  Transforming polygon set...")
+
+ps0 = cg.Polygon3Set()
+ps1 = cg.Polygon3Set()
+for i in range(0, 3):
+    for ps in [ps0, ps1]:
+        p0 = ps.addPolygon()
+        p0.addVertex().setCoords(i, 0., 0.)
+        p0.addVertex().setCoords(i, 1., 0.)
+        p0.addVertex().setCoords(i, 1., 1.)
+# one polygon with a transformation of its own
+ps0.getPolygon(1).translate(cg.Vector3(0., 0., 2.))
+ps1.getPolygon(1).translate(cg.Vector3(0., 0., 2.))
+ps0.transform(m0)
+ps0.applyTransform(True)
+for i in range(0, ps1.getNumPolygons()):
+    p1 = ps1.getPolygon(i)
+    p1.transform(m0)
+    p1.applyTransform(True)
+    p0 = ps0.getPolygon(i)
+    for k in range(0, p1.getNumVertices()):
+        assert p0.getVertex(k).eq(p1.getVertex(k))
+
+print("All tests passed.")
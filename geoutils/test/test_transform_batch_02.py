@@ -0,0 +1,157 @@
+import IFObjectBase as ib
+import IFMapping as im
+import CGeoUtils as cg
+
+testName = "Batch (parallel) (02)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+numGroups = 12
+
+def createGraph(numThreads):
+    g0 = cg.TransformableGroup.create()
+    for i in range(0, numGroups):
+        p0 = cg.Polygon3.square()
+        p0.translate(cg.Vector3(0., 0., float(i)))
+        g0.addItem(p0)
+    n0 = cg.Source.create()
+    n0.setSource(g0)
+    n1 = cg.Explode.create()
+    n1.setElementsPerGroup(1)
+    # processor
+    n2 = cg.Translate.create()
+    n2.setOffset(cg.Vector3(1., 0., 0.))
+    n3 = cg.Scale.create()
+    n3.setScale(cg.Vector3(1., 1., 1.))
+    p0 = cg.TransformGraph.create()
+    mm.addLocalRef(p0)
+    p0.addNode(n2)
+    p0.addNode(n3)
+    p0.connect(n2, n3)
+    p0.setSource(n2)
+    p0.setDrain(n3)
+    c0 = cg.ParamControl.create()
+    c0.setNode(n3)
+    c0.setParamID("scaleFactor")
+    c0.setFunc(im.Linear.create(1., 2.))
+    n4 = cg.Batch.create()
+    n4.setProcessor(p0)
+    n4.addControl(c0)
+    n4.setNumThreads(numThreads)
+    graph = cg.TransformGraph.create()
+    mm.addLocalRef(graph)
+    for it in [ n0, n1, n4 ]:
+        graph.addNode(it)
+    graph.connect(n0, n1)
+    graph.connectRange(n1, n4, numGroups)
+    graph.setSource(n0)
+    graph.setDrain(n4)
+    return graph, p0
+
+print("  Cloning processor...")
+
+graph0, p0 = createGraph(1)
+assert p0.isThreadSafe()
+m0 = cg.TransformNodeMap()
+p1 = p0.createClone(m0)
+mm.addLocalRef(p1)
+assert p1.getNumNodes() == p0.getNumNodes()
+assert p1.getNumConnections() == p0.getNumConnections()
+# The graph and each of its nodes have been cloned.
+assert m0.size() == 3
+
+print("  Processing batch (serial)...")
+
+graph0.update()
+assert graph0.getNumOutputs() == numGroups
+b0 = [ graph0.getOutput(k).getBounds() for k in range(0, numGroups) ]
+for k in range(1, numGroups):
+    w0 = b0[k - 1].getX().getRMax() - b0[k - 1].getX().getRMin()
+    w1 = b0[k].getX().getRMax() - b0[k].getX().getRMin()
+    assert w1 > w0
+
+print("  Processing batch (parallel)...")
+
+graph1, p1 = createGraph(4)
+for i in range(0, 2):
+    graph1.update()
+    assert graph1.getNumOutputs() == numGroups
+    # Output groups are in input order, with the same parameters.
+    for k in range(0, numGroups):
+        assert graph1.getOutput(k).getBounds() == b0[k]
+
+def createGraph2(numThreads, useIndexFunc):
+    g0 = cg.TransformableGroup.create()
+    for i in range(0, numGroups):
+        p0 = cg.Polygon3.square()
+        p0.translate(cg.Vector3(0., 0., float(i)))
+        g0.addItem(p0)
+    n0 = cg.Source.create()
+    n0.setSource(g0)
+    n1 = cg.Explode.create()
+    n1.setElementsPerGroup(1)
+    # processor
+    n2 = cg.Duplicate.create()
+    n2.setNumDuplicates(3)
+    n3 = cg.Array.create()
+    n3.setNumRows(1)
+    n3.setNumColumns(3)
+    n3.setCellWidth(2.)
+    n3.setCellHeight(2.)
+    n4 = cg.Rotate.create()
+    n4.setAxis(cg.AXIS_Z)
+    if useIndexFunc:
+        n4.setIndexFunc(im.Linear.create(0., 0.5))
+    n5 = cg.Center.create()
+    p0 = cg.TransformGraph.create()
+    mm.addLocalRef(p0)
+    for it in [ n2, n3, n4, n5 ]:
+        p0.addNode(it)
+    p0.chain()
+    p0.setIO()
+    c0 = cg.ParamControl.create()
+    c0.setNode(n4)
+    c0.setParamID("angle")
+    c0.setFunc(im.Linear.create(0., 1.5))
+    n6 = cg.Batch.create()
+    n6.setProcessor(p0)
+    n6.addControl(c0)
+    n6.setNumThreads(numThreads)
+    graph = cg.TransformGraph.create()
+    mm.addLocalRef(graph)
+    for it in [ n0, n1, n6 ]:
+        graph.addNode(it)
+    graph.connect(n0, n1)
+    graph.connectRange(n1, n6, numGroups)
+    graph.setSource(n0)
+    graph.setDrain(n6)
+    return graph, p0
+
+def checkGraph2(useIndexFunc):
+    graph0, p0 = createGraph2(1, useIndexFunc)
+    assert p0.isThreadSafe() == (not useIndexFunc)
+    graph0.update()
+    assert graph0.getNumOutputs() == numGroups
+    b0 = [ graph0.getOutput(k).getBounds() for k in range(0, numGroups) ]
+    graph1, p1 = createGraph2(4, useIndexFunc)
+    for i in range(0, 2):
+        graph1.update()
+        assert graph1.getNumOutputs() == numGroups
+        for k in range(0, numGroups):
+            o0 = graph1.getOutput(k)
+            assert o0.getNumItems() == 3
+            assert o0.getBounds() == b0[k]
+
+print("  Processing batch with processor graph (parallel)...")
+
+checkGraph2(False)
+
+print("  Processing batch with processor graph (serial fallback)...")
+
+# Processors that are not thread-safe are updated serially.
+checkGraph2(True)
+
+print("All tests passed.")
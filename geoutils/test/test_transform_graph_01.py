@@ -0,0 +1,76 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Transform graph (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Creating diamond graph...")
+
+g0 = cg.TransformableGroup.create()
+g0.addItem(cg.Polygon3.square())
+
+n0 = cg.Source.create()
+n0.setSource(g0)
+n0.setID('n0')
+
+n1 = cg.Scale.create()
+n1.setScale(cg.Vector3(2., 2., 1.))
+n1.setID('n1')
+
+n2 = cg.Translate.create()
+n2.setOffset(cg.Vector3(0., 0., 3.))
+n2.setID('n2')
+
+n3 = cg.Merge.create()
+n3.setID('n3')
+
+graph = cg.TransformGraph()
+for it in [ n0, n1, n2, n3 ]:
+    graph.addNode(it)
+graph.connect(n0, n1)
+graph.connect(n0, n2)
+graph.connect(n1, n3)
+graph.connect(n2, n3)
+graph.setSource(n0)
+graph.setDrain(n3)
+
+print("  Checking schedule...")
+
+s0 = cg.TransformNodeVector()
+graph.getSchedule(s0)
+assert s0.size() == 4
+order = [ s0[i].getID() for i in range(0, s0.size()) ]
+assert order[0] == 'n0'
+assert order[3] == 'n3'
+
+print("  Updating graph...")
+
+for i in range(0, 3):
+    c0 = n0.getUpdateCounter()
+    graph.update()
+    # Each node is processed exactly once per update.
+    assert n0.getUpdateCounter() == c0 + 1
+    assert graph.getNumNodeUpdates() == 4
+    assert graph.getNumEliminatedUpdates() == 1
+    o0 = graph.getOutput(0)
+    assert o0.getNumItems() == 2
+    for k in range(0, 4):
+        assert not s0[k].getScheduled()
+        assert s0[k].getPendingConsumers() == 0
+
+print("  Checking outputs...")
+
+# Both branches must see the unmodified source group.
+b0 = o0.getItem(0).getBounds()
+b1 = o0.getItem(1).getBounds()
+if b0.getZ().getRMin() == 2.5:
+    b0, b1 = b1, b0
+assert b0.getZ().getRMin() == -0.5
+assert b1.getZ().getRMin() == 2.5
+assert b0.getX().getRMax() == 2. * b1.getX().getRMax()
+
+print("All tests passed.")
@@ -0,0 +1,114 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Transform graph (02)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+numBranches = 16
+
+def createGraph(numThreads):
+    g0 = cg.TransformableGroup.create()
+    g0.addItem(cg.Polygon3.square())
+    n0 = cg.Source.create()
+    n0.setSource(g0)
+    n1 = cg.Merge.create()
+    graph = cg.TransformGraph.create()
+    mm.addLocalRef(graph)
+    graph.addNode(n0)
+    graph.addNode(n1)
+    for i in range(0, numBranches):
+        n2 = cg.Translate.create()
+        n2.setOffset(cg.Vector3(0., 0., float(i)))
+        n3 = cg.Scale.create()
+        n3.setScale(cg.Vector3(i + 1., 1., 1.))
+        graph.addNode(n2)
+        graph.addNode(n3)
+        graph.connect(n0, n2)
+        graph.connect(n2, n3)
+        graph.connect(n3, n1)
+    graph.setSource(n0)
+    graph.setDrain(n1)
+    graph.setNumThreads(numThreads)
+    return graph
+
+def createDiamondGraph(numThreads):
+    # Source -> Translate -> {Center, Normalize} -> Merge
+    g0 = cg.TransformableGroup.create()
+    g0.addItem(cg.Polygon3.square())
+    n0 = cg.Source.create()
+    n0.setSource(g0)
+    n1 = cg.Merge.create()
+    graph = cg.TransformGraph.create()
+    mm.addLocalRef(graph)
+    graph.addNode(n0)
+    graph.addNode(n1)
+    for i in range(0, numBranches):
+        n2 = cg.Translate.create()
+        n2.setOffset(cg.Vector3(float(i), 2., 0.))
+        # Both nodes apply transformations to their input groups.
+        n3 = cg.Center.create()
+        n4 = cg.Normalize.create()
+        for it in [ n2, n3, n4 ]:
+            graph.addNode(it)
+        graph.connect(n0, n2)
+        graph.connect(n2, n3)
+        graph.connect(n2, n4)
+        graph.connect(n3, n1)
+        graph.connect(n4, n1)
+    graph.setSource(n0)
+    graph.setDrain(n1)
+    graph.setNumThreads(numThreads)
+    return graph
+
+print("  Checking thread safety...")
+
+n0 = cg.Scale.create()
+mm.addLocalRef(n0)
+assert n0.isThreadSafe()
+n1 = cg.Iterate.create()
+mm.addLocalRef(n1)
+assert not n1.isThreadSafe()
+
+print("  Updating graph (serial)...")
+
+graph0 = createGraph(1)
+graph0.update()
+o0 = graph0.getOutput(0)
+assert o0.getNumItems() == numBranches
+
+print("  Updating graph (parallel)...")
+
+graph1 = createGraph(4)
+assert graph1.isThreadSafe()
+for k in range(0, 3):
+    graph1.update()
+    assert graph1.getNumNodeUpdates() == 2 * numBranches + 2
+    o1 = graph1.getOutput(0)
+    assert o1.getNumItems() == numBranches
+    # The output order does not depend on the order of node updates.
+    for i in range(0, numBranches):
+        b0 = o0.getItem(i).getBounds()
+        b1 = o1.getItem(i).getBounds()
+        assert b1 == b0
+        assert b1.getZ().getRMin() == float(i) - 0.5
+
+print("  Updating diamond graph (parallel)...")
+
+graph2 = createDiamondGraph(1)
+graph2.update()
+o2 = graph2.getOutput(0)
+assert o2.getNumItems() == 2 * numBranches
+graph3 = createDiamondGraph(4)
+for k in range(0, 3):
+    graph3.update()
+    assert graph3.getNumNodeUpdates() == 3 * numBranches + 2
+    o3 = graph3.getOutput(0)
+    assert o3.getNumItems() == 2 * numBranches
+    for i in range(0, 2 * numBranches):
+        assert o3.getItem(i).getBounds() == o2.getItem(i).getBounds()
+
+print("All tests passed.")
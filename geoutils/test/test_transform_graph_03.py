@@ -0,0 +1,192 @@
+import IFObjectBase as ib
+import IFMapping as im
+import CGeoUtils as cg
+
+testName = "Transform graph (03)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Creating graph...")
+
+g0 = cg.TransformableGroup.create()
+g0.addItem(cg.Polygon3.square())
+
+n0 = cg.Source.create()
+n0.setSource(g0)
+
+n1 = cg.Translate.create()
+n1.setOffset(cg.Vector3(0., 0., 1.))
+
+n2 = cg.Scale.create()
+n2.setScale(cg.Vector3(2., 2., 1.))
+
+n3 = cg.Scale.create()
+n3.setScale(cg.Vector3(1., 1., 1.))
+
+n4 = cg.Merge.create()
+
+graph = cg.TransformGraph.create()
+mm.addLocalRef(graph)
+for it in [ n0, n1, n2, n3, n4 ]:
+    graph.addNode(it)
+graph.connect(n0, n1)
+graph.connect(n1, n2)
+graph.connect(n2, n4)
+graph.connect(n0, n3)
+graph.connect(n3, n4)
+graph.setSource(n0)
+graph.setDrain(n4)
+graph.setIncremental(True)
+
+f0 = im.Linear.create(0., 1.)
+c0 = cg.ParamControl.create()
+mm.addLocalRef(c0)
+c0.setNode(n3)
+c0.setParamID("scaleFactor")
+c0.setFunc(f0)
+
+print("  Initial update...")
+
+graph.update()
+assert graph.getNumNodeUpdates() == 5
+assert graph.getOutput(0).getNumItems() == 2
+b0 = graph.getOutput(0).getItem(1).getBounds()
+
+print("  Update without changes...")
+
+assert not graph.isDirty()
+graph.update()
+assert graph.getNumNodeUpdates() == 0
+assert graph.getOutput(0).getNumItems() == 2
+
+print("  Update after parameter change...")
+
+u1 = n1.getUpdateCounter()
+u2 = n2.getUpdateCounter()
+c0.call(2.)
+assert n3.isDirty()
+assert not n2.isDirty()
+graph.update()
+# Only the changed node and the nodes downstream are updated.
+assert graph.getNumNodeUpdates() == 2
+assert n1.getUpdateCounter() == u1
+assert n2.getUpdateCounter() == u2
+o0 = graph.getOutput(0)
+assert o0.getNumItems() == 2
+b1 = o0.getItem(1).getBounds()
+assert b1.getX().getRMax() == 2. * b0.getX().getRMax()
+
+print("  Update after setting a property...")
+
+n1.setOffset(cg.Vector3(0., 0., 3.))
+assert n1.isDirty()
+graph.update()
+assert graph.getNumNodeUpdates() == 3
+assert graph.getOutput(0).getItem(0).getBounds().getZ().getRMin() == 2.5
+
+print("  Update after setting a parameter...")
+
+n3.setParam("scaleFactor", 3.)
+assert n3.isDirty()
+graph.update()
+assert graph.getNumNodeUpdates() == 2
+b1 = graph.getOutput(0).getItem(1).getBounds()
+assert b1.getX().getRMax() == 3. * b0.getX().getRMax()
+
+print("  Update after touching a node...")
+
+n2.touch()
+assert n2.isDirty()
+graph.update()
+assert graph.getNumNodeUpdates() == 2
+
+print("  Creating batch graph...")
+
+numGroups = 4
+
+g1 = cg.TransformableGroup.create()
+for i in range(0, numGroups):
+    p0 = cg.Polygon3.square()
+    p0.translate(cg.Vector3(0., 0., float(i)))
+    g1.addItem(p0)
+
+n5 = cg.Source.create()
+n5.setSource(g1)
+
+n6 = cg.Explode.create()
+n6.setElementsPerGroup(1)
+
+# processor
+n7 = cg.Translate.create()
+n7.setOffset(cg.Vector3(1., 0., 0.))
+
+n8 = cg.Scale.create()
+n8.setScale(cg.Vector3(1., 1., 1.))
+
+p1 = cg.TransformGraph.create()
+mm.addLocalRef(p1)
+p1.addNode(n7)
+p1.addNode(n8)
+p1.connect(n7, n8)
+p1.setSource(n7)
+p1.setDrain(n8)
+
+c1 = cg.ParamControl.create()
+c1.setNode(n8)
+c1.setParamID("scaleFactor")
+c1.setFunc(im.Linear.create(1., 2.))
+
+n9 = cg.Batch.create()
+n9.setProcessor(p1)
+n9.addControl(c1)
+
+graph1 = cg.TransformGraph.create()
+mm.addLocalRef(graph1)
+for it in [ n5, n6, n9 ]:
+    graph1.addNode(it)
+graph1.connect(n5, n6)
+graph1.connectRange(n6, n9, numGroups)
+graph1.setSource(n5)
+graph1.setDrain(n9)
+graph1.setIncremental(True)
+
+def getWidth(b):
+    return b.getX().getRMax() - b.getX().getRMin()
+
+graph1.update()
+assert graph1.getNumNodeUpdates() == 3
+assert graph1.getNumOutputs() == numGroups
+b2 = graph1.getOutput(0).getBounds()
+assert not graph1.isDirty()
+graph1.update()
+assert graph1.getNumNodeUpdates() == 0
+
+print("  Update after changing a batch control...")
+
+c2 = cg.ParamControl.create()
+c2.setNode(n8)
+c2.setParamID("scaleFactor")
+c2.setFunc(im.Linear.create(2., 3.))
+n9.clearControls()
+n9.addControl(c2)
+assert n9.isDirty()
+graph1.update()
+# Only the batch node is updated.
+assert graph1.getNumNodeUpdates() == 1
+b3 = graph1.getOutput(0).getBounds()
+assert getWidth(b3) > getWidth(b2)
+
+print("  Update after changing a batch processor parameter...")
+
+n7.setOffset(cg.Vector3(2., 0., 0.))
+assert n9.isDirty()
+graph1.update()
+assert graph1.getNumNodeUpdates() == 1
+b4 = graph1.getOutput(0).getBounds()
+assert b4.getX().getRMin() > b3.getX().getRMin()
+assert not graph1.isDirty()
+
+print("All tests passed.")
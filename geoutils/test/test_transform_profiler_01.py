@@ -0,0 +1,175 @@
+import json
+import os
+import tempfile
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Profiler (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Creating graph...")
+
+g0 = cg.TransformableGroup.create()
+g0.addItem(cg.Polygon3.square())
+n0 = cg.Source.create()
+n0.setSource(g0)
+n1 = cg.Translate.create()
+n1.setOffset(cg.Vector3(1., 0., 0.))
+n2 = cg.Scale.create()
+n2.setScale(cg.Vector3(2., 2., 2.))
+graph = cg.TransformGraph.create()
+mm.addLocalRef(graph)
+for it in [ n0, n1, n2 ]:
+    graph.addNode(it)
+graph.chain()
+graph.setIO()
+
+pr = cg.Profiler.create()
+mm.addLocalRef(pr)
+graph.setProfiler(pr)
+for it in [ n0, n1, n2 ]:
+    assert it.getProfiler() == pr
+
+print("  Profiling updates...")
+
+numUpdates = 2
+for i in range(0, numUpdates):
+    graph.update()
+
+# One profile for each node and one for the graph itself.
+assert pr.getNumProfiles() == 4
+assert pr.getNumEvents() == 4 * numUpdates
+assert pr.getNumThreads() == 1
+for it in [ n0, n1, n2, graph ]:
+    k = pr.findProfile(it)
+    assert k >= 0
+    p0 = pr.getProfile(k)
+    assert p0.numCalls == numUpdates
+    assert p0.inclusiveTime >= p0.exclusiveTime
+    assert p0.numOutputItems == numUpdates
+p0 = pr.getProfile(pr.findProfile(n1))
+assert p0.numInputItems == numUpdates
+assert p0.outputObjectBytes > 0
+# Node updates are nested within the graph update.
+for k in range(0, pr.getNumEvents()):
+    e0 = pr.getEvent(k)
+    assert e0.duration >= 0.
+    if (e0.profileIndex == pr.findProfile(graph)):
+        assert e0.depth == 0
+    else:
+        assert e0.depth == 1
+
+print("  Checking reports...")
+
+assert len(pr.getSummary()) > 0
+d0 = json.loads(pr.getJSON())
+assert d0["numThreads"] == 1
+assert d0["numEvents"] == pr.getNumEvents()
+assert len(d0["nodes"]) == pr.getNumProfiles()
+for it in d0["nodes"]:
+    assert it["numCalls"] == numUpdates
+    assert it["outputObjectBytes"] >= 0
+d1 = json.loads(pr.getTrace())
+e0 = [ it for it in d1["traceEvents"] if it["ph"] == "X" ]
+assert len(e0) == pr.getNumEvents()
+
+f0 = tempfile.mkstemp(suffix = ".json")
+os.close(f0[0])
+pr.writeTrace(f0[1])
+with open(f0[1]) as f:
+    assert json.load(f) == d1
+os.remove(f0[1])
+
+print("  Profiling failed updates...")
+
+# A scale node without inputs fails in process().
+n3 = cg.Scale.create()
+mm.addLocalRef(n3)
+n3.setProfiler(pr)
+k0 = pr.getNumEvents()
+failed = False
+try:
+    n3.update()
+except RuntimeError:
+    failed = True
+assert failed
+# The event is closed, so the next update is not nested within it.
+assert pr.getNumEvents() == k0 + 1
+assert pr.getEvent(k0).duration >= 0.
+n0.update()
+assert pr.getEvent(k0 + 1).depth == 0
+n3.setProfiler(None)
+
+print("  Removing nodes...")
+
+n4 = cg.Source.create()
+mm.addLocalRef(n4)
+n4.setSource(g0)
+n4.setProfiler(pr)
+n4.update()
+k1 = pr.findProfile(n4)
+assert k1 >= 0
+n4.setProfiler(None)
+# The profile is kept, but no longer associated with the node.
+assert pr.findProfile(n4) < 0
+assert pr.getProfile(k1).node is None
+assert pr.getProfile(k1).numCalls == 1
+n4.setProfiler(pr)
+n4.update()
+k2 = pr.findProfile(n4)
+assert k2 > k1
+mm.removeLocalRef(n4)
+# Destroyed nodes are removed from the profiler.
+assert pr.getProfile(k2).node is None
+
+print("  Profiling parallel batches...")
+
+g1 = cg.TransformableGroup.create()
+for i in range(0, 8):
+    p1 = cg.Polygon3.square()
+    p1.translate(cg.Vector3(0., 0., float(i)))
+    g1.addItem(p1)
+n5 = cg.Source.create()
+n5.setSource(g1)
+n6 = cg.Explode.create()
+n6.setElementsPerGroup(1)
+n7 = cg.Translate.create()
+n7.setOffset(cg.Vector3(1., 0., 0.))
+n8 = cg.Batch.create()
+n8.setProcessor(n7)
+n8.setNumThreads(4)
+graph1 = cg.TransformGraph.create()
+mm.addLocalRef(graph1)
+for it in [ n5, n6, n8 ]:
+    graph1.addNode(it)
+graph1.connect(n5, n6)
+graph1.connectRange(n6, n8, 8)
+graph1.setSource(n5)
+graph1.setDrain(n8)
+graph1.setProfiler(pr)
+for i in range(0, numUpdates):
+    graph1.update()
+# Profiles of processor clones are not reused by later nodes.
+for k in range(0, pr.getNumProfiles()):
+    p0 = pr.getProfile(k)
+    if p0.node is not None:
+        assert pr.findProfile(p0.node) == k
+        assert p0.label == p0.node.getString()
+graph1.setProfiler(None)
+
+print("  Clearing profiler...")
+
+pr.clear()
+assert pr.getNumProfiles() == 0
+assert pr.getNumEvents() == 0
+graph.setProfiler(None)
+for it in [ n0, n1, n2 ]:
+    assert it.getProfiler() is None
+graph.update()
+assert pr.getNumEvents() == 0
+
+print("All tests passed.")
@@ -0,0 +1,124 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+
+testName = "Transformable group (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+print("  Creating instance...")
+
+g0 = cg.TransformableGroup.create()
+mm.addLocalRef(g0)
+g0.addItem(cg.Polygon3.square())
+b0 = g0.getBounds()
+
+g1 = g0.instance()
+mm.addLocalRef(g1)
+assert g1.getNumItems() == 1
+# The instance shares the item of the source group.
+assert g0.getItem(0).getNumRefs() == 2
+assert g0.getItem(0).getNumShares() == 1
+
+print("  Transforming instance...")
+
+g1.translate(cg.Vector3(0., 0., 1.))
+assert g1.getBounds().getZ().getRMin() == 0.5
+assert g0.getBounds() == b0
+assert g0.getItem(0).getNumRefs() == 2
+
+print("  Applying instance transformations...")
+
+g1.applyTransform()
+# The shared item has been copied before it was modified.
+assert g0.getItem(0).getNumRefs() == 1
+assert g1.getItem(0).getNumRefs() == 1
+assert g0.getItem(0).getNumShares() == 0
+assert g1.getItem(0).getBounds().getZ().getRMin() == 0.5
+assert g0.getItem(0).getBounds() == b0
+assert g1.detachItems() == 0
+
+print("  Transforming referenced items...")
+
+p0 = cg.Polygon3.square()
+mm.addLocalRef(p0)
+g2 = cg.TransformableGroup.create()
+mm.addLocalRef(g2)
+g2.addItem(p0)
+g3 = cg.TransformableGroup.create()
+mm.addLocalRef(g3)
+g3.addItem(p0)
+assert p0.getNumRefs() == 3
+g2.translate(cg.Vector3(0., 0., 1.))
+g2.applyTransform()
+# Items that are referenced elsewhere, but not shared, are not copied.
+assert p0.getNumRefs() == 3
+assert p0.getBounds().getZ().getRMin() == 0.5
+assert g3.getBounds().getZ().getRMin() == 0.5
+
+print("  Removing shared items...")
+
+p1 = cg.Polygon3.square()
+mm.addLocalRef(p1)
+g4 = cg.TransformableGroup.create()
+mm.addLocalRef(g4)
+g4.addItem(p1)
+g4.addItem(cg.Polygon3.square())
+g5 = g4.instance()
+mm.addLocalRef(g5)
+assert p1.getNumShares() == 1
+g5.removeItem(p1)
+# Removing an item from the instance releases the share.
+assert p1.getNumShares() == 0
+assert g4.getItem(1).getNumShares() == 1
+g5.removeItemIndex(0)
+assert g5.getNumItems() == 0
+assert g4.getItem(1).getNumShares() == 0
+g6 = g4.instance()
+mm.addLocalRef(g6)
+assert p1.getNumShares() == 1
+g6.clearItems()
+assert p1.getNumShares() == 0
+assert g4.getItem(1).getNumShares() == 0
+# Items that are no longer shared are not copied.
+assert g4.detachItems() == 0
+assert p1.getNumRefs() == 2
+
+print("  Duplicating elements...")
+
+n0 = cg.Source.create()
+n0.setSource(g0)
+
+n1 = cg.Duplicate.create()
+n1.setNumDuplicates(4)
+assert n1.sharesItems()
+
+n2 = cg.Array.create()
+n2.setNumRows(1)
+n2.setNumColumns(4)
+n2.setCellWidth(2.)
+n2.setCellHeight(2.)
+
+graph = cg.TransformGraph.create()
+mm.addLocalRef(graph)
+for it in [ n0, n1, n2 ]:
+    graph.addNode(it)
+graph.chain()
+graph.setIO()
+assert graph.sharesItems()
+
+graph.update()
+o0 = graph.getOutput(0)
+assert o0.getNumItems() == 4
+# Each duplicate has been detached before it was translated.
+xs = []
+for i in range(0, 4):
+    it0 = o0.getItem(i)
+    assert it0.getNumRefs() == 1
+    xs.append(it0.getBounds().getCenter().getX0())
+assert xs == [ -3., -1., 1., 3. ]
+assert g0.getBounds() == b0
+
+print("All tests passed.")
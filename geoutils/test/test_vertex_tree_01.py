@@ -0,0 +1,78 @@
+import IFObjectBase as ib
+import CGeoUtils as cg
+import random
+
+testName = "Vertex tree (01)"
+
+print("GeoUtils test: %s" % testName)
+
+# memory management
+mm = ib.IFObject()
+
+numVerts = 2000
+numQueries = 100
+k = 5
+
+random.seed(1)
+
+print("  Creating vertices...")
+
+vs0 = cg.Vertex3Set.create()
+mm.addLocalRef(vs0)
+for i in range(0, numVerts):
+    vs0.addVertex(cg.Vertex3.create(random.random(), random.random(), 
+        random.random()))
+
+print("  Building tree...")
+
+vt0 = cg.VertexTree.create()
+mm.addLocalRef(vt0)
+assert vt0.update(vs0) == numVerts
+
+print("    %s" % vt0.getValueString())
+
+def getDistances(p):
+    d = []
+    for i in range(0, numVerts):
+        d.append((vs0.getVertex(i).getVector() - p).norm())
+    d.sort()
+    return d
+
+print("  Comparing queries...")
+
+for i in range(0, numQueries):
+    p = cg.Vector3(random.random(), random.random(), random.random())
+    d0 = getDistances(p)
+    r0 = ib.UIntVector()
+    d1 = ib.DoubleVector()
+    assert vt0.findKNearest(p, k, r0, d1) == k
+    for j in range(0, k):
+        assert abs(d0[j] - d1[j]) < 1e-9
+    n0 = vt0.findNearest(p)
+    assert abs((vs0.getVertex(n0).getVector() - p).norm() - d0[0]) < 1e-9
+    r1 = ib.UIntVector()
+    n1 = vt0.findInRadius(p, 0.1, r1)
+    assert n1 == len([d for d in d0 if d <= 0.1])
+
+print("  Welding vertices...")
+
+gridSubDivs = 8
+
+m0 = cg.Mesh.grid(gridSubDivs, gridSubDivs)
+mm.addLocalRef(m0)
+m1 = cg.Mesh.grid(gridSubDivs, gridSubDivs)
+mm.addLocalRef(m1)
+numVerts0 = m0.getNumVertices()
+numFaces0 = m0.getNumFaces()
+m0.merge(m1)
+m0.update()
+assert m0.getNumVertices() == 2 * numVerts0
+assert m0.weld() == numVerts0
+assert m0.getNumVertices() == numVerts0
+assert m0.getNumFaces() == 2 * numFaces0
+for i in range(0, m0.getNumFaces()):
+    f0 = m0.getFace(i)
+    for j in range(0, f0.getNumVertices()):
+        assert f0.getVertex(j) < numVerts0
+
+print("All tests passed.")
@@ -151,6 +151,31 @@ class ChainableMapping
 		virtual Ionflux::Mapping::MappingValue 
 		call(Ionflux::Mapping::MappingValue value) const;
 		
+		/** Call the mapping (batch).
+		 *
+		 * Calls the mapping with each of the specified parameters, using the
+		 * conventions for chainable mappings (see call()), and stores the
+		 * mapped values in the target vector. The source mapping and
+		 * callWithParamBatch() are each called once for all parameters.
+		 *
+		 * \param values Values.
+		 * \param target Where to store the mapped values.
+		 */
+		virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+		values, Ionflux::Mapping::MappingValueVector& target) const;
+		
+		/** Call the mapping (batch).
+		 *
+		 * Calls callWithParam() with each of the specified parameters and
+		 * replaces the parameters with the results. Mappings that can evaluate
+		 * a whole vector of parameters more efficiently than one parameter at a
+		 * time may override this.
+		 *
+		 * \param values Values.
+		 */
+		virtual void callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+		values) const;
+		
 		/** Assignment operator.
 		 *
 		 * Assign an object.
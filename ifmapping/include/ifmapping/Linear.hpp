@@ -125,6 +125,16 @@ class Linear
 		virtual Ionflux::Mapping::MappingValue 
 		callWithParam(Ionflux::Mapping::MappingValue value) const;
 		
+		/** Call the mapping (batch).
+		 *
+		 * Calls the mapping with each of the specified parameters and replaces
+		 * the parameters with the results.
+		 *
+		 * \param values Values.
+		 */
+		virtual void callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+		values) const;
+		
 		/** Create linear mapping.
 		 *
 		 * Create linear mapping
@@ -117,6 +117,21 @@ class Mapping
 		virtual Ionflux::Mapping::Sample sample(Ionflux::Mapping::MappingValue 
 		value) const;
 		
+		/** Call the mapping (batch).
+		 *
+		 * Calls the mapping with each of the specified parameters and stores
+		 * the mapped values in the target vector, which is resized to the
+		 * number of parameters. The target vector may be the same as the
+		 * parameter vector. Mappings that can evaluate a whole vector of
+		 * parameters more efficiently than one parameter at a time may override
+		 * this.
+		 *
+		 * \param values Values.
+		 * \param target Where to store the mapped values.
+		 */
+		virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+		values, Ionflux::Mapping::MappingValueVector& target) const;
+		
 		/** Upcast.
 		 *
 		 * Cast an IFObject to the most specific type.
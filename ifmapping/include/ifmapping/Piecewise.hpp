@@ -155,6 +155,18 @@ class Piecewise
 		virtual Ionflux::Mapping::MappingValue 
 		callWithParam(Ionflux::Mapping::MappingValue value) const;
 		
+		/** Call the mapping (batch).
+		 *
+		 * Calls the mapping with each of the specified parameters and replaces
+		 * the parameters with the results. The parameters are grouped by the
+		 * mapping of the piece they fall into, and the mapping of each piece is
+		 * called once for all of its parameters.
+		 *
+		 * \param values Values.
+		 */
+		virtual void callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+		values) const;
+		
 		/** Create sawtooth function.
 		 *
 		 * Create a sawtooth function over the interval [0...1]. This is a 
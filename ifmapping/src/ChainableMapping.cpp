@@ -109,6 +109,31 @@ ChainableMapping::call(Ionflux::Mapping::MappingValue value) const
 	return resultScale * callWithParam(t0) + resultOffset;;
 }
 
+void ChainableMapping::callBatch(const
+Ionflux::Mapping::MappingValueVector& values,
+Ionflux::Mapping::MappingValueVector& target) const
+{
+	unsigned int n = values.size();
+	if (func == 0)
+	{
+	    target.resize(n);
+	    for (unsigned int i = 0; i < n; i++)
+	        target[i] = scale * values[i] + offset;
+	} else
+	    func->callBatch(values, target);
+	callWithParamBatch(target);
+	for (unsigned int i = 0; i < n; i++)
+	    target[i] = resultScale * target[i] + resultOffset;
+}
+
+void
+ChainableMapping::callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+values) const
+{
+	for (unsigned int i = 0; i < values.size(); i++)
+	    values[i] = callWithParam(values[i]);
+}
+
 void ChainableMapping::setFunc(Ionflux::Mapping::Mapping* newFunc)
 {
 	if (func == newFunc)
@@ -106,6 +106,14 @@ Linear::callWithParam(Ionflux::Mapping::MappingValue value) const
 	return value * (upper - lower) + lower;
 }
 
+void Linear::callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+values) const
+{
+	MappingValue d = upper - lower;
+	for (unsigned int i = 0; i < values.size(); i++)
+	    values[i] = values[i] * d + lower;
+}
+
 Ionflux::Mapping::Linear* Linear::create(Ionflux::Mapping::MappingValue 
 initLower, Ionflux::Mapping::MappingValue initUpper)
 {
@@ -141,6 +141,22 @@ Lookup::callWithParam(Ionflux::Mapping::MappingValue value) const
 	return entries[i];
 }
 
+void Lookup::callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+values) const
+{
+	if (entries.size() == 0)
+	    throw MappingError("Lookup table is empty.");
+	unsigned int n = entries.size();
+	for (unsigned int i = 0; i < values.size(); i++)
+	{
+	    unsigned int k = static_cast<unsigned int>(
+	        Ionflux::Mapping::clamp(values[i], CLAMP_RANGE) * n);
+	    if (k >= n)
+	        k = n - 1;
+	    values[i] = entries[k];
+	}
+}
+
 unsigned int Lookup::getNumEntries() const
 {
 	return entries.size();
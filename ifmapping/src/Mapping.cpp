@@ -90,6 +90,15 @@ value) const
 	return ts;
 }
 
+void Mapping::callBatch(const Ionflux::Mapping::MappingValueVector&
+values, Ionflux::Mapping::MappingValueVector& target) const
+{
+	unsigned int n = values.size();
+	target.resize(n);
+	for (unsigned int i = 0; i < n; i++)
+	    target[i] = call(values[i]);
+}
+
 Ionflux::Mapping::Mapping* Mapping::upcast(Ionflux::ObjectBase::IFObject* 
 other)
 {
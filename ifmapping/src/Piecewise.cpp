@@ -27,6 +27,7 @@
 
 #include "ifmapping/Piecewise.hpp"
 #include <sstream>
+#include <map>
 #include "ifmapping/utils.hpp"
 #include "ifmapping/MappingError.hpp"
 #include "ifmapping/Piece.hpp"
@@ -168,6 +169,42 @@ Piecewise::callWithParam(Ionflux::Mapping::MappingValue value) const
 	return (*p.getMapping())(p.getParam());
 }
 
+void Piecewise::callWithParamBatch(Ionflux::Mapping::MappingValueVector&
+values) const
+{
+	unsigned int n = values.size();
+	// Group the parameters by the mapping of their piece.
+	std::map<Mapping*, std::vector<unsigned int> > g0;
+	MappingValueVector p0(n);
+	for (unsigned int i = 0; i < n; i++)
+	{
+	    Piece p = getPieceForT(values[i]);
+	    p0[i] = p.getParam();
+	    g0[p.getMapping()].push_back(i);
+	}
+	MappingValueVector v0;
+	MappingValueVector r0;
+	for (std::map<Mapping*, std::vector<unsigned int> >::const_iterator j = 
+	    g0.begin(); j != g0.end(); j++)
+	{
+	    Mapping* m0 = (*j).first;
+	    const std::vector<unsigned int>& i0 = (*j).second;
+	    unsigned int k0 = i0.size();
+	    if (m0 == 0)
+	    {
+	        for (unsigned int k = 0; k < k0; k++)
+	            values[i0[k]] = 0.;
+	        continue;
+	    }
+	    v0.resize(k0);
+	    for (unsigned int k = 0; k < k0; k++)
+	        v0[k] = p0[i0[k]];
+	    m0->callBatch(v0, r0);
+	    for (unsigned int k = 0; k < k0; k++)
+	        values[i0[k]] = r0[k];
+	}
+}
+
 Ionflux::Mapping::Piecewise* 
 Piecewise::sawtooth(Ionflux::Mapping::MappingValue freq, 
 Ionflux::Mapping::MappingValue ampMin, Ionflux::Mapping::MappingValue 
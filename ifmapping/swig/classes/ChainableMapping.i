@@ -60,6 +60,11 @@ class ChainableMapping
         callWithParam(Ionflux::Mapping::MappingValue value) const = 0;
         virtual Ionflux::Mapping::MappingValue 
         call(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::Mapping::MappingValueVector& target) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
 		static Ionflux::Mapping::ChainableMapping* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
         virtual void setFunc(Ionflux::Mapping::Mapping* newFunc);
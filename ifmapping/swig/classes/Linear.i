@@ -58,6 +58,9 @@ class Linear
         virtual std::string getString() const;
         virtual Ionflux::Mapping::MappingValue 
         callWithParam(Ionflux::Mapping::MappingValue value) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
         static Ionflux::Mapping::Linear* 
         create(Ionflux::Mapping::MappingValue initLower, 
         Ionflux::Mapping::MappingValue initUpper);
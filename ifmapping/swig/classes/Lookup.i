@@ -67,6 +67,9 @@ class Lookup
         newEntries, unsigned int numEntries = 0);
         virtual Ionflux::Mapping::MappingValue 
         callWithParam(Ionflux::Mapping::MappingValue value) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
 		virtual Ionflux::Mapping::Lookup* copy() const;
 		static Ionflux::Mapping::Lookup* upcast(Ionflux::ObjectBase::IFObject* 
 		other);
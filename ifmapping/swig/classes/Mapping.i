@@ -56,6 +56,8 @@ class Mapping
         call(Ionflux::Mapping::MappingValue value) const = 0;
         virtual Ionflux::Mapping::Sample 
         sample(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::Mapping::MappingValueVector& target) const;
 		static Ionflux::Mapping::Mapping* upcast(Ionflux::ObjectBase::IFObject* 
 		other);
 };
@@ -68,6 +68,9 @@ class Piecewise
         Ionflux::Mapping::DEFAULT_TOLERANCE) const;
         virtual Ionflux::Mapping::MappingValue 
         callWithParam(Ionflux::Mapping::MappingValue value) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
         static Ionflux::Mapping::Piecewise* 
         sawtooth(Ionflux::Mapping::MappingValue freq = 1., 
         Ionflux::Mapping::MappingValue ampMin = 0., 
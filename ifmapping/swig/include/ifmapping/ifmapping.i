@@ -432,6 +432,8 @@ class Mapping
         call(Ionflux::Mapping::MappingValue value) const = 0;
         virtual Ionflux::Mapping::Sample 
         sample(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::Mapping::MappingValueVector& target) const;
 		static Ionflux::Mapping::Mapping* upcast(Ionflux::ObjectBase::IFObject* 
 		other);
 };
@@ -533,6 +535,11 @@ class ChainableMapping
         callWithParam(Ionflux::Mapping::MappingValue value) const = 0;
         virtual Ionflux::Mapping::MappingValue 
         call(Ionflux::Mapping::MappingValue value) const;
+        virtual void callBatch(const Ionflux::Mapping::MappingValueVector&
+        values, Ionflux::Mapping::MappingValueVector& target) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
 		static Ionflux::Mapping::ChainableMapping* 
 		upcast(Ionflux::ObjectBase::IFObject* other);
         virtual void setFunc(Ionflux::Mapping::Mapping* newFunc);
@@ -1068,6 +1075,9 @@ class Linear
         virtual std::string getString() const;
         virtual Ionflux::Mapping::MappingValue 
         callWithParam(Ionflux::Mapping::MappingValue value) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
         static Ionflux::Mapping::Linear* 
         create(Ionflux::Mapping::MappingValue initLower, 
         Ionflux::Mapping::MappingValue initUpper);
@@ -1279,6 +1289,9 @@ class Piecewise
         Ionflux::Mapping::DEFAULT_TOLERANCE) const;
         virtual Ionflux::Mapping::MappingValue 
         callWithParam(Ionflux::Mapping::MappingValue value) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
         static Ionflux::Mapping::Piecewise* 
         sawtooth(Ionflux::Mapping::MappingValue freq = 1., 
         Ionflux::Mapping::MappingValue ampMin = 0., 
@@ -2129,6 +2142,9 @@ class Lookup
         newEntries, unsigned int numEntries = 0);
         virtual Ionflux::Mapping::MappingValue 
         callWithParam(Ionflux::Mapping::MappingValue value) const;
+        virtual void
+        callWithParamBatch(Ionflux::Mapping::MappingValueVector& values)
+        const;
 		virtual Ionflux::Mapping::Lookup* copy() const;
 		static Ionflux::Mapping::Lookup* upcast(Ionflux::ObjectBase::IFObject* 
 		other);
@@ -0,0 +1,447 @@
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * bench_octree_01.cpp             IFVG benchmark: Octree pipeline.
+ * ==========================================================================
+ *
+ * This file is part of IFVG - Ionflux' Volumetric Graphics Library.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with IFVG - Ionflux' Volumetric Graphics Library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+
+ * ========================================================================== */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include "ifobject/utils.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Range3.hpp"
+#include "geoutils/Mesh.hpp"
+#include "geoutils/Clock.hpp"
+#include "geoutils/VertexAttribute.hpp"
+#include "ifvg/utils.hpp"
+#include "ifvg/stats.hpp"
+#include "ifvg/Context.hpp"
+#include "ifvg/Node.hpp"
+#include "ifvg/NodeFilter.hpp"
+#include "ifvg/NodeVoxelizationProcessor.hpp"
+#include "ifvg/NodeIntersectionProcessor.hpp"
+#include "ifvg/NodeIOBEvalProcessor.hpp"
+#include "ifvg/IFVGError.hpp"
+
+using namespace Ionflux::VolGfx;
+
+// Name of the benchmark.
+const std::string BENCH_NAME = "IFVG benchmark: Octree pipeline";
+// Default output file.
+const std::string DEFAULT_OUTPUT_FILE = "bench_octree_01.json";
+
+// Octree parameters.
+const unsigned int OCTREE_MAX_NUM_LEVELS = 8;
+const unsigned int OCTREE_ORDER = 2;
+const double OCTREE_SCALE = 4.;
+// Fraction of the octree covered by a scene.
+const double SCENE_SCALE = 0.8;
+// Target depth for voxelization and classification.
+const int VOXELIZE_DEPTH = 7;
+// Depth of the tree for the construction benchmark.
+const int FILL_DEPTH = 5;
+
+// Synthetic scene.
+struct Scene
+{
+    // Name.
+    std::string name;
+    // Mesh type ("cube", "grid" or "fiber").
+    std::string meshType;
+    // Mesh parameters.
+    unsigned int param0;
+    unsigned int param1;
+};
+
+// Benchmark result.
+struct BenchResult
+{
+    // Benchmark name.
+    std::string name;
+    // Scene name.
+    std::string scene;
+    // Number of items processed.
+    unsigned int numItems;
+    // Item unit.
+    std::string itemUnit;
+    // Time (seconds).
+    double time;
+    // Allocated size of the node hierarchy (bytes).
+    unsigned int memSize;
+    // Growth of the resident set size since the start of the scene
+    // (kilobytes).
+    long rssDelta;
+};
+
+typedef std::vector<BenchResult> BenchResultVector;
+
+long getPeakRSS()
+{
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0)
+        return 0;
+    return ru.ru_maxrss;
+}
+
+long getCurrentRSS()
+{
+    std::ifstream f0("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (!(f0 >> size >> resident))
+        return 0;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+void addResult(BenchResultVector* target, const std::string& name,
+    const std::string& scene, unsigned int numItems,
+    const std::string& itemUnit, double time, unsigned int memSize,
+    long rss0)
+{
+    // Results of the statistics pass are not recorded.
+    if (target == 0)
+        return;
+    BenchResult r0;
+    r0.name = name;
+    r0.scene = scene;
+    r0.numItems = numItems;
+    r0.itemUnit = itemUnit;
+    r0.time = time;
+    r0.memSize = memSize;
+    r0.rssDelta = getCurrentRSS() - rss0;
+    target->push_back(r0);
+    double tp = 0.;
+    if (time > 0.)
+        tp = numItems / time;
+    std::cout << "    " << std::left << std::setw(20) << name
+        << std::right << std::setw(10) << numItems << " "
+        << std::left << std::setw(8) << itemUnit << std::right
+        << " in " << std::fixed << std::setprecision(6) << time
+        << " secs (" << std::setprecision(1) << tp << " " << itemUnit
+        << "/sec, RSS delta " << r0.rssDelta << " KB)" << std::endl;
+    std::cout.unsetf(std::ios_base::floatfield);
+}
+
+Ionflux::GeoUtils::Mesh* createSceneMesh(const Scene& scene)
+{
+    Ionflux::GeoUtils::Mesh* m0 = 0;
+    if (scene.meshType == "cube")
+        m0 = Ionflux::GeoUtils::Mesh::cube();
+    else
+    if (scene.meshType == "grid")
+        m0 = Ionflux::GeoUtils::Mesh::grid(scene.param0, scene.param1);
+    else
+    if (scene.meshType == "fiber")
+        m0 = Ionflux::GeoUtils::Mesh::fiber(scene.param0, scene.param1,
+            1., 0.1);
+    if (m0 == 0)
+        throw IFVGError("Unknown mesh type: " + scene.meshType);
+    m0->makeTris();
+    // Fit the mesh into the center of the octree.
+    Ionflux::GeoUtils::Range3 b0 = m0->getBounds();
+    Ionflux::GeoUtils::Vector3 e0 = b0.getExtent();
+    double s0 = e0.getX0();
+    if (e0.getX1() > s0)
+        s0 = e0.getX1();
+    if (e0.getX2() > s0)
+        s0 = e0.getX2();
+    s0 = SCENE_SCALE * OCTREE_SCALE / s0;
+    double c0 = 0.5 * OCTREE_SCALE;
+    m0->translate(b0.getCenter().flip());
+    m0->scale(Ionflux::GeoUtils::Vector3(s0, s0, s0));
+    m0->translate(Ionflux::GeoUtils::Vector3(c0, c0, c0));
+    m0->applyTransform(true);
+    m0->update(false, false);
+    return m0;
+}
+
+void runConstruction(Context* ctx, BenchResultVector* results)
+{
+    Ionflux::ObjectBase::IFObject mm;
+    Ionflux::GeoUtils::Clock clock0;
+    long rss0 = getCurrentRSS();
+    Node* root0 = Node::create(ctx);
+    mm.addLocalRef(root0);
+    clock0.start();
+    int numNodes = root0->fill(false, true, FILL_DEPTH);
+    clock0.stop();
+    addResult(results, "construct", "fill", numNodes, "nodes",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    clock0.start();
+    root0->clear();
+    clock0.stop();
+    addResult(results, "destruct", "fill", numNodes, "nodes",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+}
+
+void runScene(Context* ctx, const Scene& scene,
+    BenchResultVector* results)
+{
+    Ionflux::ObjectBase::IFObject mm;
+    Ionflux::GeoUtils::Clock clock0;
+    std::cout << "  Scene '" << scene.name << "'..." << std::endl;
+    long rss0 = getCurrentRSS();
+    Ionflux::GeoUtils::Mesh* m0 = createSceneMesh(scene);
+    mm.addLocalRef(m0);
+    unsigned int numFaces = m0->getNumFaces();
+    // voxelize
+    Node* root0 = Node::create(ctx);
+    mm.addLocalRef(root0);
+    NodeVoxelizationProcessor* vp0 = NodeVoxelizationProcessor::create();
+    mm.addLocalRef(vp0);
+    vp0->setTarget(VOXELIZATION_TARGET_CLASS);
+    clock0.start();
+    unsigned int nfi0 = root0->voxelizeInsertFaces(*m0, SEPARABILITY_26);
+    clock0.stop();
+    addResult(results, "voxelizeInsertFaces", scene.name, nfi0, "faces",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    clock0.start();
+    unsigned int nv0 = root0->voxelizeFaces(vp0, VOXELIZE_DEPTH,
+        SEPARABILITY_26);
+    clock0.stop();
+    addResult(results, "voxelizeFaces", scene.name, nv0, "voxels",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    // IOB classification
+    NodeFilter* nf0 = NodeFilter::create(ctx);
+    mm.addLocalRef(nf0);
+    nf0->setLeafStatus(NODE_LEAF);
+    NodeIntersectionProcessor* ip0 = NodeIntersectionProcessor::create();
+    mm.addLocalRef(ip0);
+    ip0->setContext(ctx);
+    ip0->setHitDataType(Node::DATA_TYPE_VOXEL_IOB);
+    ip0->setVoxelClassHit(VOXEL_CLASS_HIT);
+    ip0->setEnableBoundaryData(true);
+    ip0->setTargetDepth(VOXELIZE_DEPTH);
+    unsigned int numRaysXY = static_cast<unsigned int>(
+        OCTREE_SCALE / ctx->getVoxelSize(VOXELIZE_DEPTH));
+    unsigned int numRays = 3 * numRaysXY * numRaysXY;
+    clock0.start();
+    unsigned int ni0 = root0->castRayGrid(Ionflux::GeoUtils::AXIS_X,
+        VOXELIZE_DEPTH, Node::DEFAULT_RAY_PLANE_OFFSET, ip0, nf0);
+    ni0 += root0->castRayGrid(Ionflux::GeoUtils::AXIS_Y,
+        VOXELIZE_DEPTH, Node::DEFAULT_RAY_PLANE_OFFSET, ip0, nf0);
+    ni0 += root0->castRayGrid(Ionflux::GeoUtils::AXIS_Z,
+        VOXELIZE_DEPTH, Node::DEFAULT_RAY_PLANE_OFFSET, ip0, nf0);
+    clock0.stop();
+    addResult(results, "castRayGrid", scene.name, numRays, "rays",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    addResult(results, "castRayGridNodes", scene.name, ni0, "nodes",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    NodeIOBEvalProcessor* iob0 = NodeIOBEvalProcessor::create(ctx);
+    mm.addLocalRef(iob0);
+    clock0.start();
+    unsigned int np0 = root0->process(0, nf0, iob0, true);
+    clock0.stop();
+    addResult(results, "iobEval", scene.name, np0, "nodes",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    // serialize/deserialize
+    std::ostringstream os0;
+    clock0.start();
+    root0->serializeHierarchy(os0);
+    clock0.stop();
+    std::string data0(os0.str());
+    addResult(results, "serialize", scene.name, data0.size(), "bytes",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    Node* root1 = Node::create(ctx);
+    mm.addLocalRef(root1);
+    std::istringstream is0(data0);
+    clock0.start();
+    root1->deserializeHierarchy(is0);
+    clock0.stop();
+    addResult(results, "deserialize", scene.name, data0.size(), "bytes",
+        clock0.getElapsedTime(), root1->getMemSize(true), rss0);
+    // merge
+    clock0.start();
+    unsigned int nm0 = root0->merge(*root1);
+    clock0.stop();
+    addResult(results, "merge", scene.name, nm0, "nodes",
+        clock0.getElapsedTime(), root0->getMemSize(true), rss0);
+    // vertex attributes
+    Ionflux::GeoUtils::VertexAttribute* va0 =
+        Ionflux::GeoUtils::VertexAttribute::create();
+    mm.addLocalRef(va0);
+    Ionflux::GeoUtils::VertexAttribute* va1 =
+        Ionflux::GeoUtils::VertexAttribute::create();
+    mm.addLocalRef(va1);
+    Ionflux::GeoUtils::VertexAttribute* va2 =
+        Ionflux::GeoUtils::VertexAttribute::create();
+    mm.addLocalRef(va2);
+    clock0.start();
+    root0->getVertexAttributes(va0, va1, va2,
+        Ionflux::GeoUtils::NFace::TYPE_FACE,
+        Context::DEFAULT_BOX_INSET, 0, 0, 0, COLOR_INDEX_UNSPECIFIED,
+        COLOR_INDEX_UNSPECIFIED, 0, 0, 0, nf0, true);
+    clock0.stop();
+    addResult(results, "getVertexAttributes", scene.name,
+        va0->getNumElements(), "vertices", clock0.getElapsedTime(),
+        root0->getMemSize(true), rss0);
+    std::cout << "    (" << numFaces << " faces, " << data0.size()
+        << " bytes serialized)" << std::endl;
+}
+
+std::string getResultsJSON(const BenchResultVector& results,
+    const std::vector<Scene>& scenes, long processPeakRSS)
+{
+    std::ostringstream status;
+    status << std::setprecision(9);
+    status << "{" << std::endl
+        << "    \"benchmark\": \"bench_octree_01\"," << std::endl
+        << "    \"octree\": {\"maxNumLevels\": " << OCTREE_MAX_NUM_LEVELS
+        << ", \"order\": " << OCTREE_ORDER << ", \"scale\": "
+        << OCTREE_SCALE << ", \"voxelizeDepth\": " << VOXELIZE_DEPTH
+        << ", \"fillDepth\": " << FILL_DEPTH << "}," << std::endl
+        << "    \"scenes\": [";
+    for (unsigned int i = 0; i < scenes.size(); i++)
+    {
+        const Scene& s0 = scenes[i];
+        if (i > 0)
+            status << ",";
+        status << std::endl << "        {\"name\": \"" << s0.name
+            << "\", \"mesh\": \"" << s0.meshType << "\", \"params\": ["
+            << s0.param0 << ", " << s0.param1 << "]}";
+    }
+    status << std::endl << "    ]," << std::endl
+        << "    \"results\": [";
+    for (unsigned int i = 0; i < results.size(); i++)
+    {
+        const BenchResult& r0 = results[i];
+        double tp = 0.;
+        if (r0.time > 0.)
+            tp = r0.numItems / r0.time;
+        if (i > 0)
+            status << ",";
+        status << std::endl << "        {\"name\": \"" << r0.name
+            << "\", \"scene\": \"" << r0.scene << "\", \"items\": "
+            << r0.numItems << ", \"unit\": \"" << r0.itemUnit
+            << "\", \"time\": " << r0.time << ", \"throughput\": " << tp
+            << ", \"memSize\": " << r0.memSize << ", \"rssDelta\": "
+            << r0.rssDelta << "}";
+    }
+    std::string s1(getStatsJSON());
+    if ((s1.size() > 0)
+        && (s1[s1.size() - 1] == '\n'))
+        s1.erase(s1.size() - 1);
+    status << std::endl << "    ]," << std::endl
+        << "    \"stats\": " << s1 << "," << std::endl
+        << "    \"processPeakRSS\": " << processPeakRSS << std::endl
+        << "}" << std::endl;
+    return status.str();
+}
+
+int main(int argc, char* argv[])
+{
+    std::cout << "IFVG benchmark: " << BENCH_NAME << std::endl;
+    std::string outputFile = DEFAULT_OUTPUT_FILE;
+    if (argc > 1)
+        outputFile = argv[1];
+    // memory management
+    Ionflux::ObjectBase::IFObject mm;
+
+    std::cout << "  Creating context..." << std::endl;
+
+    Context* ctx = Context::create(OCTREE_MAX_NUM_LEVELS, OCTREE_ORDER,
+        OCTREE_SCALE);
+    mm.addLocalRef(ctx);
+
+    std::vector<Scene> scenes;
+    Scene s0;
+    s0.meshType = "cube";
+    s0.name = "cube";
+    s0.param0 = 0;
+    s0.param1 = 0;
+    scenes.push_back(s0);
+    s0.meshType = "grid";
+    unsigned int gridSubDivs[] = { 16, 64, 256 };
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        std::ostringstream name0;
+        name0 << "grid_" << gridSubDivs[i];
+        s0.name = name0.str();
+        s0.param0 = gridSubDivs[i];
+        s0.param1 = gridSubDivs[i];
+        scenes.push_back(s0);
+    }
+    s0.meshType = "fiber";
+    unsigned int fiberSubDivs[] = { 16, 64, 256 };
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        std::ostringstream name0;
+        name0 << "fiber_" << fiberSubDivs[i];
+        s0.name = name0.str();
+        s0.param0 = fiberSubDivs[i];
+        s0.param1 = fiberSubDivs[i];
+        scenes.push_back(s0);
+    }
+
+    // Statistics collection is disabled for the timed runs.
+    setStatsEnabled(false);
+    BenchResultVector results;
+    long processPeakRSS = 0;
+    try
+    {
+        std::cout << "  Tree construction..." << std::endl;
+        runConstruction(ctx, &results);
+        for (unsigned int i = 0; i < scenes.size(); i++)
+            runScene(ctx, scenes[i], &results);
+        processPeakRSS = getPeakRSS();
+        // Separate untimed pass for the pipeline statistics.
+        std::cout << "  Collecting statistics..." << std::endl;
+        resetStats();
+        setStatsEnabled(true);
+        runConstruction(ctx, 0);
+        for (unsigned int i = 0; i < scenes.size(); i++)
+            runScene(ctx, scenes[i], 0);
+        setStatsEnabled(false);
+    } catch (IFVGError& e)
+    {
+        std::cout << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "  Writing results to '" << outputFile << "'..."
+        << std::endl;
+
+    std::ofstream f0;
+    f0.open(outputFile.c_str(), std::ios_base::out);
+    if (!f0)
+    {
+        std::cout << "Could not open output file: " << outputFile
+            << std::endl;
+        return 1;
+    }
+    f0 << getResultsJSON(results, scenes, processPeakRSS);
+
+	std::cout << "All done!" << std::endl;
+	return 0;
+}
+
+/** \file bench_octree_01.cpp
+ * \brief IFVG benchmark: Octree pipeline.
+ */
@@ -77,6 +77,8 @@ class Context
 		int maxNumLeafChildNodesPerDimension;
 		/// Length scale factor.
 		double scale;
+		/// Frozen tree flag.
+		bool frozen;
 		
 		/** Clear masks.
 		 *
@@ -949,6 +951,20 @@ class Context
 		 * \param newScale New value of length scale factor.
 		 */
 		virtual void setScale(double newScale);
+		
+		/** Get frozen tree flag.
+		 *
+		 * \return Current value of frozen tree flag.
+		 */
+		virtual bool getFrozen() const;
+		
+		/** Set frozen tree flag.
+		 *
+		 * Set new value of frozen tree flag.
+		 *
+		 * \param newFrozen New value of frozen tree flag.
+		 */
+		virtual void setFrozen(bool newFrozen);
 };
 
 }
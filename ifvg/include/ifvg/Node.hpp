@@ -17,6 +17,7 @@
 #include "geoutils/Range3.hpp"
 #include "geoutils/Line3.hpp"
 #include "geoutils/Mesh.hpp"
+#include "geoutils/CompactMesh.hpp"
 #include "geoutils/NFace.hpp"
 #include "ifvg/types.hpp"
 #include "ifvg/constants.hpp"
@@ -67,11 +68,24 @@ class Node
 	private:
 		
 	protected:
+		/// Node implementation reference flag.
+		bool implRef;
+		/// Context reference flag.
+		bool contextRef;
 		/// Node implementation.
 		Ionflux::VolGfx::NodeImpl* impl;
 		/// Voxel tree context.
 		Ionflux::VolGfx::Context* context;
 		
+		/** Check mutable.
+		 *
+		 * Check whether the node may be modified. If the voxel tree context 
+		 * is frozen, an exception will be thrown.
+		 *
+		 * \param source Source (for error messages).
+		 */
+		virtual void checkMutable(const std::string& source) const;
+		
 	public:
 		/// Node data type: unknown.
 		static const Ionflux::VolGfx::NodeDataType DATA_TYPE_UNKNOWN;
@@ -574,85 +588,101 @@ class Node
 		
 		/** Locate child node.
 		 *
-		 * Locate the child node that contains the specified location index. 
-		 * If \c maxDepth not negative, the search for the node stops at the 
-		 * specified maximum depth. The caller is responsible for managing the
-		 * returned object.
+		 * Locate the child node that contains the specified location index. If 
+		 * \c maxDepth not negative, the search for the node stops at the 
+		 * specified maximum depth. The caller is responsible for managing the 
+		 * returned object. If \c target is not 0, it is set to the node that 
+		 * was found and returned instead of a new node object (see wrapImpl()).
 		 *
 		 * \param loc Node data.
 		 * \param maxDepth Maximum depth.
+		 * \param target Node object to be reused for the result.
 		 *
 		 * \return Leaf node containing the specified location, or 0 if no 
 		 * suitable node was found.
 		 */
 		virtual Ionflux::VolGfx::Node* locateChild(const 
-		Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED);
+		Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED, 
+		Ionflux::VolGfx::Node* target = 0);
 		
 		/** Locate child node.
 		 *
 		 * Locate the child node that contains the specified point. If \c 
-		 * maxDepth is greater than zero, the search for the node stops at the
-		 * specified maximum depth. The caller is responsible for managing the
-		 * returned object.
+		 * maxDepth is greater than zero, the search for the node stops at the 
+		 * specified maximum depth. The caller is responsible for managing the 
+		 * returned object. If \c target is not 0, it is set to the node that 
+		 * was found and returned instead of a new node object (see wrapImpl()).
 		 *
 		 * \param p Point.
 		 * \param maxDepth Maximum depth.
+		 * \param target Node object to be reused for the result.
 		 *
 		 * \return Leaf node containing the specified location, or 0 if no 
 		 * suitable node was found.
 		 */
 		virtual Ionflux::VolGfx::Node* locateChild(const 
-		Ionflux::GeoUtils::Vector3& p, int maxDepth = DEPTH_UNSPECIFIED);
+		Ionflux::GeoUtils::Vector3& p, int maxDepth = DEPTH_UNSPECIFIED, 
+		Ionflux::VolGfx::Node* target = 0);
 		
 		/** Locate region.
 		 *
-		 * Locate the node that contains the specified region. If \c maxDepth 
-		 * is not negative, the search for the node stops at the specified 
-		 * maximum depth. The caller is responsible for managing the returned 
-		 * object.
+		 * Locate the node that contains the specified region. If \c maxDepth is 
+		 * not negative, the search for the node stops at the specified maximum 
+		 * depth. The caller is responsible for managing the returned object. If 
+		 * \c target is not 0, it is set to the node that was found and returned 
+		 * instead of a new node object (see wrapImpl()).
 		 *
 		 * \param region Region.
 		 * \param maxDepth Maximum depth.
+		 * \param target Node object to be reused for the result.
 		 *
 		 * \return Node containing the specified region, or 0 if no suitable node
 		 * was found.
 		 */
 		virtual Ionflux::VolGfx::Node* locateRegion(const 
-		Ionflux::VolGfx::Region3& region, int maxDepth = DEPTH_UNSPECIFIED);
+		Ionflux::VolGfx::Region3& region, int maxDepth = DEPTH_UNSPECIFIED, 
+		Ionflux::VolGfx::Node* target = 0);
 		
 		/** Locate region.
 		 *
-		 * Locate the node that contains the specified region. If \c maxDepth 
-		 * is not negative, the search for the node stops at the specified 
-		 * maximum depth. The caller is responsible for managing the returned 
-		 * object.
+		 * Locate the node that contains the specified region. If \c maxDepth is 
+		 * not negative, the search for the node stops at the specified maximum 
+		 * depth. The caller is responsible for managing the returned object. If 
+		 * \c target is not 0, it is set to the node that was found and returned 
+		 * instead of a new node object (see wrapImpl()).
 		 *
 		 * \param range Range.
 		 * \param maxDepth Maximum depth.
+		 * \param target Node object to be reused for the result.
 		 *
 		 * \return Node containing the specified region, or 0 if no suitable node
 		 * was found.
 		 */
 		virtual Ionflux::VolGfx::Node* locateRegion(const 
-		Ionflux::GeoUtils::Range3& range, int maxDepth = DEPTH_UNSPECIFIED);
+		Ionflux::GeoUtils::Range3& range, int maxDepth = DEPTH_UNSPECIFIED, 
+		Ionflux::VolGfx::Node* target = 0);
 		
 		/** Locate node.
 		 *
 		 * Locate the node that contains the specified location index. If \c 
 		 * maxDepth is not negative, the search for the node stops at the 
-		 * specified maximum depth. This function will search the ancestors of
-		 * the current node implementation upwards if the specified location 
-		 * is not contained in this node. The caller is responsible for 
-		 * managing the returned object.
+		 * specified maximum depth. This function will search the ancestors of 
+		 * the current node implementation upwards if the specified location is 
+		 * not contained in this node. The caller is responsible for managing 
+		 * the returned object. If \c target is not 0, it is set to the node 
+		 * that was found and returned instead of a new node object (see 
+		 * wrapImpl()).
 		 *
 		 * \param loc Location.
 		 * \param maxDepth Maximum depth.
+		 * \param target Node object to be reused for the result.
 		 *
 		 * \return Node containing the specified location, or 0 if no suitable 
 		 * node was found.
 		 */
 		virtual Ionflux::VolGfx::Node* locateNode(const 
-		Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED);
+		Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED, 
+		Ionflux::VolGfx::Node* target = 0);
 		
 		/** Get depth.
 		 *
@@ -981,6 +1011,27 @@ class Node
 		virtual unsigned int voxelizeInsertFaces(const Ionflux::GeoUtils::Mesh& 
 		mesh, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
 		
+		/** Insert faces for voxelization (compact mesh).
+		 *
+		 * Insert faces from the compact mesh into the node hierarchy for
+		 * voxelization. Each face will be attached to the deepest node that
+		 * completely contains its voxelization. The node hierarchy keeps
+		 * references to the faces, so faces are created in the target mesh,
+		 * which must not be destroyed or modified while the node hierarchy
+		 * refers to its faces. Attribute channels of the compact mesh are not
+		 * copied to the target mesh.
+		 *
+		 * \param mesh compact mesh.
+		 * \param target where to store the faces.
+		 * \param sep separability.
+		 * \param fill0 Create a full set of child nodes if one is missing.
+		 *
+		 * \return number of faces that were inserted into the node hierarchy.
+		 */
+		virtual unsigned int voxelizeInsertFaces(const
+		Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh& target,
+		Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
+		
 		/** Voxelize faces.
 		 *
 		 * Voxelize faces that are attached to the node hierarchy. The 
@@ -1368,19 +1419,38 @@ class Node
 		static Ionflux::ObjectBase::UInt16 unrefImpl(Ionflux::VolGfx::NodeImpl* 
 		otherImpl);
 		
+		/** Get node implementation reference count.
+		 *
+		 * Get the reference count of a node implementation.
+		 *
+		 * \param otherImpl Node implementation.
+		 *
+		 * \return Reference count of the node implementation.
+		 */
+		static Ionflux::ObjectBase::UInt16 
+		getImplRefCount(Ionflux::VolGfx::NodeImpl* otherImpl);
+		
 		/** Wrap node implementation.
 		 *
 		 * Wrap a node implementation in a new node object. If the node 
 		 * implementation is 0, no node object will be created. The caller is 
-		 * responsible for managing the returned object.
+		 * responsible for managing the returned object. If \c target is not 0, 
+		 * the node implementation is set on \c target, which is returned 
+		 * instead of a new node object. Since wrappers for nodes within a 
+		 * frozen tree reference neither the node implementation nor the 
+		 * context, this neither allocates memory nor modifies the tree, so a 
+		 * single wrapper can be reused for a series of queries on a frozen 
+		 * tree.
 		 *
 		 * \param otherImpl Node implementation.
 		 * \param context Voxel tree context.
+		 * \param target Node object to be reused for the result.
 		 *
-		 * \return New node object, or 0 if the node implementation is 0.
+		 * \return Node object, or 0 if the node implementation is 0.
 		 */
 		static Ionflux::VolGfx::Node* wrapImpl(Ionflux::VolGfx::NodeImpl* 
-		otherImpl, Ionflux::VolGfx::Context* context);
+		otherImpl, Ionflux::VolGfx::Context* context, Ionflux::VolGfx::Node* 
+		target = 0);
 		
 		/** Set node implementation parent node.
 		 *
@@ -2449,6 +2519,30 @@ class Node
 		Ionflux::GeoUtils::Mesh& mesh, Ionflux::VolGfx::SeparabilityID sep, bool 
 		fill0 = false);
 		
+		/** Insert faces for voxelization (compact mesh).
+		 *
+		 * Insert faces from the compact mesh into the node hierarchy for
+		 * voxelization. Each face will be attached to the deepest node that
+		 * completely contains its voxelization. The node hierarchy keeps
+		 * references to the faces, so faces are created in the target mesh,
+		 * which must not be destroyed or modified while the node hierarchy
+		 * refers to its faces. Attribute channels of the compact mesh are not
+		 * copied to the target mesh.
+		 *
+		 * \param otherImpl Node implementation.
+		 * \param context Voxel tree context.
+		 * \param mesh compact mesh.
+		 * \param target where to store the faces.
+		 * \param sep separability.
+		 * \param fill0 Create a full set of child nodes if one is missing.
+		 *
+		 * \return number of faces that were inserted into the node hierarchy.
+		 */
+		static unsigned int voxelizeImplInsertFaces(Ionflux::VolGfx::NodeImpl*
+		otherImpl, Ionflux::VolGfx::Context* context, const
+		Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh& target,
+		Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
+		
 		/** Voxelize faces.
 		 *
 		 * Voxelize faces that are attached to the node hierarchy. The 
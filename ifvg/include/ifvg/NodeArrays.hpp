@@ -0,0 +1,274 @@
+#ifndef IONFLUX_VOLGFX_NODEARRAYS
+#define IONFLUX_VOLGFX_NODEARRAYS
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * NodeArrays.hpp                  Node arrays (header).
+ * ========================================================================== */
+
+#include "ifvg/types.hpp"
+#include "ifvg/constants.hpp"
+#include "ifobject/IFObject.hpp"
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+class Node;
+class NodeFilter;
+class Context;
+
+/// Class information for class NodeArrays.
+class NodeArraysClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+	public:
+		/// Constructor.
+		NodeArraysClassInfo();
+		/// Destructor.
+		virtual ~NodeArraysClassInfo();
+};
+
+/** Node arrays.
+ * \ingroup ifvg
+ *
+ * Contiguous arrays of location codes, depths, voxel classes and color
+ * indices for the nodes of a hierarchy. The arrays can be accessed without
+ * copying (for example, from Python via the buffer protocol), which is
+ * much faster than iterating over a NodeSet for large hierarchies.
+ * Pointers to the array data are valid until the arrays are updated or
+ * cleared, or the object is destroyed.
+ */
+class NodeArrays
+: public Ionflux::ObjectBase::IFObject
+{
+	private:
+
+	protected:
+		/// Location codes (x, y, z for each node).
+		std::vector<Ionflux::ObjectBase::UInt16> locs;
+		/// Depths.
+		std::vector<Ionflux::ObjectBase::UInt8> depths;
+		/// Voxel classes.
+		std::vector<Ionflux::VolGfx::VoxelClassID> voxelClasses;
+		/// Color indices.
+		std::vector<Ionflux::VolGfx::ColorIndex> colorIndices;
+		/// Number of exported buffer references.
+		unsigned int numBufferRefs;
+
+		/** Append node implementation.
+		 *
+		 * Append a node implementation that passes the filter to the arrays.
+		 * If \c recursive is set to \c true, child node implementations are
+		 * appended recursively.
+		 *
+		 * \param otherImpl Node implementation.
+		 * \param context Voxel tree context.
+		 * \param filter Node filter.
+		 * \param recursive Append node implementations recursively.
+		 * \param depth Depth of the node implementation.
+		 *
+		 * \return Number of node implementations that have been appended.
+		 */
+		virtual unsigned int appendImpl(Ionflux::VolGfx::NodeImpl* otherImpl,
+		Ionflux::VolGfx::Context* context, Ionflux::VolGfx::NodeFilter* filter,
+		bool recursive, int depth);
+
+		/** Check buffer references.
+		 *
+		 * Check whether the data of the object can be reallocated. An exception
+		 * is thrown if the data is referenced by an exported buffer.
+		 *
+		 * \param source Source function.
+		 */
+		void checkBufferRefs(const std::string& source) const;
+		
+	public:
+		/// Class information instance.
+		static const NodeArraysClassInfo nodeArraysClassInfo;
+		/// Class information.
+		static const Ionflux::ObjectBase::IFClassInfo* CLASS_INFO;
+
+		/** Constructor.
+		 *
+		 * Construct new NodeArrays object.
+		 */
+		NodeArrays();
+
+		/** Constructor.
+		 *
+		 * Construct new NodeArrays object.
+		 *
+		 * \param other Other object.
+		 */
+		NodeArrays(const Ionflux::VolGfx::NodeArrays& other);
+
+		/** Destructor.
+		 *
+		 * Destruct NodeArrays object.
+		 */
+		virtual ~NodeArrays();
+
+		/** Clear.
+		 *
+		 * Clear all arrays.
+		 */
+		virtual void clear();
+
+		/** Update.
+		 *
+		 * Update the arrays from the node hierarchy starting at the specified
+		 * node. Nodes that pass the filter are added to the arrays in
+		 * depth-first order. If no filter is specified, all leaf nodes are
+		 * added. Existing array data is replaced. Pointers to the previous
+		 * array data become invalid.
+		 *
+		 * \param node Node.
+		 * \param filter Node filter.
+		 * \param recursive Add nodes recursively.
+		 *
+		 * \return Number of nodes that have been added.
+		 */
+		virtual unsigned int update(Ionflux::VolGfx::Node* node,
+		Ionflux::VolGfx::NodeFilter* filter = 0, bool recursive = true);
+
+		/** Get number of nodes.
+		 *
+		 * Get the number of nodes in the arrays.
+		 *
+		 * \return Number of nodes.
+		 */
+		virtual unsigned int getNumNodes() const;
+
+		/** Add buffer reference.
+		 *
+		 * Record that the data of the object is referenced by an exported
+		 * buffer. The data cannot be reallocated until the reference is
+		 * removed.
+		 */
+		virtual void addBufferRef();
+		
+		/** Remove buffer reference.
+		 *
+		 * Record that an exported buffer no longer references the data of the
+		 * object.
+		 */
+		virtual void removeBufferRef();
+		
+		/** Get number of buffer references.
+		 *
+		 * Get the number of exported buffers that reference the data of the
+		 * object.
+		 *
+		 * \return Number of buffer references.
+		 */
+		virtual unsigned int getNumBufferRefs() const;
+		
+		/** Get location code data.
+		 *
+		 * Get the location code array. The array contains three location
+		 * codes (x, y, z) for each node. If the arrays are empty, 0 is
+		 * returned.
+		 *
+		 * \return Location code data.
+		 */
+		virtual Ionflux::ObjectBase::UInt16* getLocData();
+
+		/** Get depth data.
+		 *
+		 * Get the depth array. If the arrays are empty, 0 is returned.
+		 *
+		 * \return Depth data.
+		 */
+		virtual Ionflux::ObjectBase::UInt8* getDepthData();
+
+		/** Get voxel class data.
+		 *
+		 * Get the voxel class array. If the arrays are empty, 0 is returned.
+		 *
+		 * \return Voxel class data.
+		 */
+		virtual Ionflux::VolGfx::VoxelClassID* getVoxelClassData();
+
+		/** Get color index data.
+		 *
+		 * Get the color index array. Nodes without a color index have the
+		 * color index COLOR_INDEX_UNSPECIFIED. If the arrays are empty, 0 is
+		 * returned.
+		 *
+		 * \return Color index data.
+		 */
+		virtual Ionflux::VolGfx::ColorIndex* getColorIndexData();
+
+		/** Get string representation of value.
+		 *
+		 * Get a string representation of the value of the object.
+		 *
+		 * \return String representation.
+		 */
+		virtual std::string getValueString() const;
+
+		/** Assignment operator.
+		 *
+		 * Assign an object.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The object itself.
+		 */
+		virtual Ionflux::VolGfx::NodeArrays& operator=(const
+		Ionflux::VolGfx::NodeArrays& other);
+
+		/** Copy.
+		 *
+		 * Create a copy of the object.
+		 *
+		 * \return Newly allocated copy of the object.
+		 */
+		virtual Ionflux::VolGfx::NodeArrays* copy() const;
+
+		/** Upcast.
+		 *
+		 * Cast an IFObject to the most specific type.
+		 *
+		 * \param other Other object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		static Ionflux::VolGfx::NodeArrays*
+		upcast(Ionflux::ObjectBase::IFObject* other);
+
+		/** Create instance.
+		 *
+		 * Create a new instance of the class. If the optional parent object
+		 * is specified, a local reference for the new object will be added
+		 * to the parent object.
+		 *
+		 * \param parentObject Parent object.
+		 *
+		 * \return Pointer to the new instance.
+		 */
+		static Ionflux::VolGfx::NodeArrays*
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+
+		/** Get allocated size in memory.
+		 *
+		 * Get the allocated size in memory for the object.
+		 *
+		 * \return The more specific object, or 0 if the cast failed.
+		 */
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+/** \file NodeArrays.hpp
+ * \brief Node arrays (header).
+ */
+#endif
@@ -119,6 +119,39 @@ const Ionflux::VolGfx::MergePolicyID MERGE_POLICY_KEEP_TARGET = 0;
 /// Merge policy ID: take over source.
 const Ionflux::VolGfx::MergePolicyID MERGE_POLICY_TAKE_OVER_SOURCE = 1;
 
+/// Statistics phase ID: other (outside of any instrumented phase).
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_OTHER = 0;
+/// Statistics phase ID: insert faces for voxelization.
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_VOXELIZE_INSERT_FACES = 1;
+/// Statistics phase ID: voxelize faces.
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_VOXELIZE_FACES = 2;
+/// Statistics phase ID: cast ray grid.
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_CAST_RAY_GRID = 3;
+/// Statistics phase ID: merge.
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_MERGE = 4;
+/// Number of statistics phases.
+const int NUM_STATS_PHASES = 5;
+
+/// Statistics counter ID: nodes created.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_NODES_CREATED = 0;
+/// Statistics counter ID: faces tested.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_FACES_TESTED = 1;
+/// Statistics counter ID: voxelization point tests.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_POINT_TESTS = 2;
+/// Statistics counter ID: voxelization point test hits.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_POINT_TEST_HITS = 3;
+/// Statistics counter ID: rays cast.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_RAYS_CAST = 4;
+/// Statistics counter ID: intersections processed.
+const Ionflux::VolGfx::StatsCounterID 
+    STATS_COUNTER_INTERSECTIONS_PROCESSED = 5;
+/// Statistics counter ID: nodes pruned.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_NODES_PRUNED = 6;
+/// Statistics counter ID: bytes allocated.
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_BYTES_ALLOCATED = 7;
+/// Number of statistics counters.
+const int NUM_STATS_COUNTERS = 8;
+
 }
 
 }
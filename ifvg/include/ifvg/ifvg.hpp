@@ -38,6 +38,7 @@
 #include "ifvg/IOContext.hpp"
 #include "ifvg/Node.hpp"
 #include "ifvg/NodeSet.hpp"
+#include "ifvg/NodeArrays.hpp"
 #include "ifvg/Mesh.hpp"
 #include "ifvg/NodeProcessor.hpp"
 #include "ifvg/NodeFilter.hpp"
@@ -47,6 +48,8 @@
 #include "ifvg/NodeFillProcessor.hpp"
 #include "ifvg/NodeIOBEvalProcessor.hpp"
 #include "ifvg/NodeIOBWallThicknessProcessor.hpp"
+#include "ifvg/staticprocessors.hpp"
+#include "ifvg/stats.hpp"
 
 /** \file ifvg.hpp
  * \brief IFVG library (header).
@@ -0,0 +1,740 @@
+#ifndef IONFLUX_VOLGFX_STATICPROCESSORS
+#define IONFLUX_VOLGFX_STATICPROCESSORS
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * staticprocessors.hpp          Statically composed node processors
+ *                               (header).
+ * =========================================================================
+ *
+ * This file is part of IFVG - Ionflux' Volumetric Graphics Library.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with IFVG - Ionflux' Volumetric Graphics Library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+ *
+ * ========================================================================== */
+#include <algorithm>
+#include "ifobject/objectutils.hpp"
+#include "geoutils/Range3.hpp"
+#include "geoutils/Line3.hpp"
+#include "ifvg/types.hpp"
+#include "ifvg/constants.hpp"
+#include "ifvg/utils.hpp"
+#include "ifvg/Context.hpp"
+#include "ifvg/Node.hpp"
+#include "ifvg/NodeProcessor.hpp"
+#include "ifvg/ChainableNodeProcessor.hpp"
+#include "ifvg/NodeFilter.hpp"
+#include "ifvg/NodeIntersectionProcessor.hpp"
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+/** \addtogroup ifvg
+ *
+ * Static node processors are functors that can be composed at compile
+ * time and passed to the static traversal functions findImplStatic(),
+ * processImplStatic() and intersectRayImplStatic(). They use the same
+ * result flags as NodeProcessor, ChainableNodeProcessor and NodeFilter,
+ * but the calls are resolved at compile time and can be inlined, which
+ * avoids a chain of virtual calls for every node of a large hierarchy.
+ *
+ * A static node processor is any object that provides
+ *
+ * \code
+ * NodeProcessingResultID operator()(NodeImpl* nodeImpl, void* userData,
+ *     int depth);
+ * \endcode
+ *
+ * The static traversal functions determine the depth of the start node
+ * once and pass the depth of each node implementation down the hierarchy,
+ * so static processors and filters that need the depth do not have to
+ * walk up the tree for every node. Processors that do not need the depth
+ * can ignore it. The depth may be DEPTH_UNSPECIFIED if a processor is
+ * invoked outside of a traversal.
+ *
+ * A static node filter additionally provides
+ *
+ * \code
+ * int getMaxDepth() const;
+ * \endcode
+ *
+ * A static intersection processor provides
+ *
+ * \code
+ * NodeProcessingResultID operator()(const NodeIntersection& intersection,
+ *     void* userData);
+ * \endcode
+ *
+ * The virtual NodeProcessor interface can be used within a static
+ * pipeline by means of the StaticProcessorRef, StaticFilterRef and
+ * StaticIntersectionProcessorRef adapters.
+ *
+ * @{
+ */
+
+/// Check processing result flags (inline).
+inline bool checkResultFlags(Ionflux::VolGfx::NodeProcessingResultID result,
+    Ionflux::VolGfx::NodeProcessingResultID flags)
+{
+    return (result & flags) != 0;
+}
+
+/** Static pass filter.
+ *
+ * A static node filter that passes all nodes. This is equivalent to
+ * passing a null filter to the Node traversal functions.
+ */
+struct StaticPassFilter
+{
+    /// Process node implementation.
+    Ionflux::VolGfx::NodeProcessingResultID operator()(
+        Ionflux::VolGfx::NodeImpl* nodeImpl, void* userData = 0,
+        int depth = DEPTH_UNSPECIFIED) const
+    {
+        return NodeProcessor::RESULT_OK | NodeFilter::RESULT_PASS;
+    }
+
+    /// Get maximum depth.
+    int getMaxDepth() const
+    {
+        return DEPTH_UNSPECIFIED;
+    }
+};
+
+/** Static null processor.
+ *
+ * A static node processor that does nothing. This is equivalent to
+ * passing a null processor to the Node traversal functions.
+ */
+struct StaticNullProcessor
+{
+    /// Process node implementation.
+    Ionflux::VolGfx::NodeProcessingResultID operator()(
+        Ionflux::VolGfx::NodeImpl* nodeImpl, void* userData = 0,
+        int depth = DEPTH_UNSPECIFIED) const
+    {
+        return NodeProcessor::RESULT_OK;
+    }
+
+    /// Process node intersection.
+    Ionflux::VolGfx::NodeProcessingResultID operator()(
+        const Ionflux::VolGfx::NodeIntersection& intersection,
+        void* userData = 0) const
+    {
+        return NodeProcessor::RESULT_OK;
+    }
+};
+
+/** Static processor reference.
+ *
+ * Adapter for using a (virtual) NodeProcessor within a static processor
+ * pipeline. If the processor is null, the adapter behaves like
+ * StaticNullProcessor.
+ */
+class StaticProcessorRef
+{
+    protected:
+        /// Node processor.
+        Ionflux::VolGfx::NodeProcessor* processor;
+
+    public:
+        /// Constructor.
+        StaticProcessorRef(Ionflux::VolGfx::NodeProcessor* initProcessor = 0)
+        : processor(initProcessor)
+        { }
+
+        /// Process node implementation.
+        Ionflux::VolGfx::NodeProcessingResultID operator()(
+            Ionflux::VolGfx::NodeImpl* nodeImpl, void* userData = 0,
+            int depth = DEPTH_UNSPECIFIED) const
+        {
+            if (processor == 0)
+                return NodeProcessor::RESULT_OK;
+            return processor->process(nodeImpl, userData);
+        }
+
+        /// Get node processor.
+        Ionflux::VolGfx::NodeProcessor* getProcessor() const
+        {
+            return processor;
+        }
+};
+
+/** Static filter reference.
+ *
+ * Adapter for using a (virtual) NodeFilter within a static processor
+ * pipeline. If the filter is null, the adapter behaves like
+ * StaticPassFilter.
+ */
+class StaticFilterRef
+{
+    protected:
+        /// Node filter.
+        Ionflux::VolGfx::NodeFilter* filter;
+
+    public:
+        /// Constructor.
+        StaticFilterRef(Ionflux::VolGfx::NodeFilter* initFilter = 0)
+        : filter(initFilter)
+        { }
+
+        /// Process node implementation.
+        Ionflux::VolGfx::NodeProcessingResultID operator()(
+            Ionflux::VolGfx::NodeImpl* nodeImpl, void* userData = 0,
+            int depth = DEPTH_UNSPECIFIED) const
+        {
+            if (filter == 0)
+                return NodeProcessor::RESULT_OK | NodeFilter::RESULT_PASS;
+            return filter->process(nodeImpl, userData);
+        }
+
+        /// Get maximum depth.
+        int getMaxDepth() const
+        {
+            if (filter == 0)
+                return DEPTH_UNSPECIFIED;
+            return filter->getMaxDepth();
+        }
+
+        /// Get node filter.
+        Ionflux::VolGfx::NodeFilter* getFilter() const
+        {
+            return filter;
+        }
+};
+
+/** Static intersection processor reference.
+ *
+ * Adapter for using a (virtual) NodeIntersectionProcessor within a static
+ * processor pipeline. If the processor is null, the adapter behaves like
+ * StaticNullProcessor.
+ */
+class StaticIntersectionProcessorRef
+{
+    protected:
+        /// Node intersection processor.
+        Ionflux::VolGfx::NodeIntersectionProcessor* processor;
+
+    public:
+        /// Constructor.
+        StaticIntersectionProcessorRef(
+            Ionflux::VolGfx::NodeIntersectionProcessor* initProcessor = 0)
+        : processor(initProcessor)
+        { }
+
+        /// Process node intersection.
+        Ionflux::VolGfx::NodeProcessingResultID operator()(
+            const Ionflux::VolGfx::NodeIntersection& intersection,
+            void* userData = 0) const
+        {
+            if (processor == 0)
+                return NodeProcessor::RESULT_OK;
+            return processor->processIntersection(intersection, userData);
+        }
+
+        /// Get node intersection processor.
+        Ionflux::VolGfx::NodeIntersectionProcessor* getProcessor() const
+        {
+            return processor;
+        }
+};
+
+/** Static node filter.
+ *
+ * A non-virtual node filter with the same filter criteria and result
+ * flags as NodeFilter. A static node filter can be initialized from a
+ * NodeFilter. Note that the source processor of the NodeFilter is not
+ * taken into account. Use StaticChain to combine the static node filter
+ * with a source processor. The region is not owned by the static node
+ * filter and must remain valid while the filter is in use.
+ */
+class StaticNodeFilter
+{
+    protected:
+        /// Voxel tree context.
+        Ionflux::VolGfx::Context* context;
+        /// Minimum depth.
+        int minDepth;
+        /// Maximum depth.
+        int maxDepth;
+        /// Leaf status.
+        Ionflux::VolGfx::LeafStatusID leafStatus;
+        /// Node data type.
+        Ionflux::VolGfx::NodeDataType dataType;
+        /// Voxel class.
+        Ionflux::VolGfx::VoxelClassID voxelClass;
+        /// Region.
+        Ionflux::GeoUtils::Range3* region;
+
+    public:
+        /// Constructor.
+        StaticNodeFilter(Ionflux::VolGfx::Context* initContext = 0,
+            int initMinDepth = DEPTH_UNSPECIFIED,
+            int initMaxDepth = DEPTH_UNSPECIFIED,
+            Ionflux::VolGfx::LeafStatusID initLeafStatus = NODE_ANY,
+            Ionflux::VolGfx::NodeDataType initDataType =
+                Node::DATA_TYPE_UNKNOWN,
+            Ionflux::VolGfx::VoxelClassID initVoxelClass =
+                VOXEL_CLASS_UNDEFINED,
+            Ionflux::GeoUtils::Range3* initRegion = 0)
+        : context(initContext), minDepth(initMinDepth),
+          maxDepth(initMaxDepth), leafStatus(initLeafStatus),
+          dataType(initDataType), voxelClass(initVoxelClass),
+          region(initRegion)
+        { }
+
+        /// Constructor.
+        StaticNodeFilter(const Ionflux::VolGfx::NodeFilter& other)
+        : context(other.getContext()), minDepth(other.getMinDepth()),
+          maxDepth(other.getMaxDepth()), leafStatus(other.getLeafStatus()),
+          dataType(other.getDataType()),
+          voxelClass(other.getVoxelClass()), region(other.getRegion())
+        { }
+
+        /** Filter node implementation.
+         *
+         * Check whether the node implementation passes the filter. This
+         * uses the same criteria as NodeFilter::filter(). If the depth
+         * of the node implementation is unspecified, it is determined
+         * from the node implementation if the filter needs it.
+         *
+         * \param nodeImpl Node implementation.
+         * \param userData User data.
+         * \param depth depth of the node implementation (if known).
+         *
+         * \return \c true if the node passes the filter, \c false otherwise.
+         */
+        bool filter(Ionflux::VolGfx::NodeImpl* nodeImpl,
+            void* userData = 0, int depth = DEPTH_UNSPECIFIED) const
+        {
+            if (context != 0)
+            {
+                if ((depth == DEPTH_UNSPECIFIED)
+                    && ((minDepth != DEPTH_UNSPECIFIED)
+                        || (maxDepth != DEPTH_UNSPECIFIED)
+                        || (region != 0)))
+                    depth = Node::getImplDepth(nodeImpl, context);
+                // depth check
+                if ((minDepth != DEPTH_UNSPECIFIED)
+                    || (maxDepth != DEPTH_UNSPECIFIED))
+                {
+                    if ((minDepth != DEPTH_UNSPECIFIED)
+                        && (depth < minDepth))
+                            return false;
+                    if ((maxDepth != DEPTH_UNSPECIFIED)
+                        && (depth > maxDepth))
+                            return false;
+                }
+                if (region != 0)
+                {
+                    // region check.
+                    Ionflux::GeoUtils::Range3 r0;
+                    context->getVoxelRange(nodeImpl->loc, depth, r0);
+                    if (!region->isInRange(r0.getCenter()))
+                        return false;
+                }
+            }
+            if ((dataType != Node::DATA_TYPE_UNKNOWN)
+                && !Node::hasImplDataType(nodeImpl, dataType))
+                // data type check
+                return false;
+            if ((leafStatus != NODE_ANY)
+                && (leafStatus != Node::getImplLeafStatus(nodeImpl)))
+                // leaf check
+                return false;
+            if ((voxelClass != VOXEL_CLASS_UNDEFINED)
+                && !Node::hasImplVoxelClass(nodeImpl, voxelClass))
+                // voxel class check
+                return false;
+            return true;
+        }
+
+        /// Process node implementation.
+        Ionflux::VolGfx::NodeProcessingResultID operator()(
+            Ionflux::VolGfx::NodeImpl* nodeImpl, void* userData = 0,
+            int depth = DEPTH_UNSPECIFIED) const
+        {
+            if (filter(nodeImpl, userData, depth))
+                return NodeProcessor::RESULT_OK | NodeFilter::RESULT_PASS;
+            return NodeProcessor::RESULT_OK
+                | ChainableNodeProcessor::RESULT_FINISHED;
+        }
+
+        /// Get maximum depth.
+        int getMaxDepth() const
+        {
+            return maxDepth;
+        }
+
+        /// Get minimum depth.
+        int getMinDepth() const
+        {
+            return minDepth;
+        }
+
+        /// Get voxel tree context.
+        Ionflux::VolGfx::Context* getContext() const
+        {
+            return context;
+        }
+};
+
+/** Static processor chain.
+ *
+ * Chains two static node processors with the same semantics as
+ * ChainableNodeProcessor: The source processor is invoked first. If the
+ * result of the source processor does not have the
+ * ChainableNodeProcessor::RESULT_FINISHED flag set, the processor is
+ * invoked and its result is returned. Otherwise, the result of the source
+ * processor is returned.
+ *
+ * If the processor is a static filter, the chain can be used as a static
+ * filter as well. In that case, the maximum depth of the chain is the
+ * maximum depth of the processor, as with a NodeFilter that has a source
+ * processor. Chains can be nested to build longer pipelines.
+ */
+template<class SourceT, class ProcessorT>
+class StaticChain
+{
+    public:
+        /// Source processor.
+        SourceT source;
+        /// Processor.
+        ProcessorT processor;
+
+        /// Constructor.
+        StaticChain(const SourceT& initSource = SourceT(),
+            const ProcessorT& initProcessor = ProcessorT())
+        : source(initSource), processor(initProcessor)
+        { }
+
+        /// Process node implementation.
+        Ionflux::VolGfx::NodeProcessingResultID operator()(
+            Ionflux::VolGfx::NodeImpl* nodeImpl, void* userData = 0,
+            int depth = DEPTH_UNSPECIFIED)
+        {
+            NodeProcessingResultID result = source(nodeImpl, userData,
+                depth);
+            if (!checkResultFlags(result,
+                ChainableNodeProcessor::RESULT_FINISHED))
+                result = processor(nodeImpl, userData, depth);
+            return result;
+        }
+
+        /// Get maximum depth.
+        int getMaxDepth() const
+        {
+            return processor.getMaxDepth();
+        }
+};
+
+/// Create static processor chain.
+template<class SourceT, class ProcessorT>
+inline Ionflux::VolGfx::StaticChain<SourceT, ProcessorT>
+makeStaticChain(const SourceT& source, const ProcessorT& processor)
+{
+    return StaticChain<SourceT, ProcessorT>(source, processor);
+}
+
+/// Create static processor chain.
+template<class SourceT, class ProcessorT0, class ProcessorT1>
+inline Ionflux::VolGfx::StaticChain<
+    Ionflux::VolGfx::StaticChain<SourceT, ProcessorT0>, ProcessorT1>
+makeStaticChain(const SourceT& source, const ProcessorT0& processor0,
+    const ProcessorT1& processor1)
+{
+    return makeStaticChain(makeStaticChain(source, processor0),
+        processor1);
+}
+
+/** Static node filter chain.
+ *
+ * Static equivalent of a NodeFilter together with its source processor.
+ */
+typedef Ionflux::VolGfx::StaticChain<Ionflux::VolGfx::StaticProcessorRef,
+    Ionflux::VolGfx::StaticNodeFilter> StaticNodeFilterChain;
+
+/** Check for static node filter.
+ *
+ * Check whether the node filter can be replaced by a static node filter
+ * chain. This is the case if the filter is a plain NodeFilter, since a
+ * derived class may override NodeFilter::filter().
+ *
+ * \param filter node filter.
+ *
+ * \return \c true if the filter can be replaced by a static node filter
+ * chain, \c false otherwise.
+ */
+inline bool isStaticNodeFilter(const Ionflux::VolGfx::NodeFilter* filter)
+{
+    return (filter != 0) && (filter->getClass() == NodeFilter::CLASS_INFO);
+}
+
+/// Create static node filter chain.
+inline Ionflux::VolGfx::StaticNodeFilterChain makeStaticNodeFilterChain(
+    const Ionflux::VolGfx::NodeFilter& filter)
+{
+    return StaticNodeFilterChain(StaticProcessorRef(filter.getSource()),
+        StaticNodeFilter(filter));
+}
+
+/** Check static filter depth.
+ *
+ * Check whether the specified depth is within the depth range of the
+ * static filter.
+ *
+ * \param context Voxel tree context.
+ * \param filter static node filter.
+ * \param depth depth of the node implementation.
+ *
+ * \return \c true if the depth is within range, \c false otherwise.
+ */
+template<class FilterT>
+inline bool checkStaticFilterDepth(Ionflux::VolGfx::Context* context,
+    const FilterT& filter, int depth)
+{
+    int maxDepth = filter.getMaxDepth();
+    if (maxDepth == DEPTH_UNSPECIFIED)
+        return true;
+    return context->checkDepthRange(depth, 0, maxDepth);
+}
+
+/** Find node implementations (static).
+ *
+ * Find node implementations that pass the specified static filter. This
+ * has the same semantics as Node::findImpl(). If \c target is 0, nodes
+ * will be counted but not added to the target set.
+ *
+ * \param otherImpl Node implementation.
+ * \param context Voxel tree context.
+ * \param target Where to store the node implementations.
+ * \param filter static node filter.
+ * \param recursive find nodes recursively.
+ * \param depth depth of the node implementation (if known). If the
+ * depth is unspecified, it is determined once for \c otherImpl and then
+ * passed down to the child nodes.
+ *
+ * \return number of node implementations found.
+ */
+template<class FilterT>
+unsigned int findImplStatic(Ionflux::VolGfx::NodeImpl* otherImpl,
+    Ionflux::VolGfx::Context* context,
+    Ionflux::VolGfx::NodeImplVector* target, FilterT& filter,
+    bool recursive = true, int depth = DEPTH_UNSPECIFIED)
+{
+    if (depth == DEPTH_UNSPECIFIED)
+        depth = Node::getImplDepth(otherImpl, context);
+    if (!checkStaticFilterDepth(context, filter, depth))
+        return 0;
+    unsigned int numNodes = 0;
+    if (checkResultFlags(filter(otherImpl, 0, depth),
+        NodeFilter::RESULT_PASS))
+    {
+        // add this node implementation
+        if (target != 0)
+            target->push_back(otherImpl);
+        numNodes++;
+    }
+    if (!recursive)
+        return numNodes;
+    // find nodes recursively
+    depth++;
+    int n0 = Node::getImplNumChildNodes(otherImpl);
+    for (int i = 0; i < n0; i++)
+    {
+        NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
+            Node::getImplChildByValidIndex(otherImpl, i),
+            "findImplStatic", "Child node implementation");
+        numNodes += findImplStatic(cn0, context, target, filter, true,
+            depth);
+    }
+    return numNodes;
+}
+
+/** Process node implementations (static).
+ *
+ * Process node implementations that pass the specified static filter
+ * using the specified static node processors. This has the same
+ * semantics as Node::processImpl(). The \c preProcessor is invoked before
+ * the recursion. The \c postProcessor is invoked after the recursion.
+ * Recursive traversal stops when the \c preProcessor returns
+ * ChainableNodeProcessor::RESULT_FINISHED, or when the maximum depth as
+ * set on the \c filter is reached.
+ *
+ * \param otherImpl Node implementation.
+ * \param context Voxel tree context.
+ * \param preProcessor static node processor (pre).
+ * \param filter static node filter.
+ * \param postProcessor static node processor (post).
+ * \param recursive process nodes recursively.
+ * \param depth depth of the node implementation (if known). If the
+ * depth is unspecified, it is determined once for \c otherImpl and then
+ * passed down to the child nodes.
+ *
+ * \return number of node implementations processed.
+ */
+template<class PreProcessorT, class FilterT, class PostProcessorT>
+unsigned int processImplStatic(Ionflux::VolGfx::NodeImpl* otherImpl,
+    Ionflux::VolGfx::Context* context, PreProcessorT& preProcessor,
+    FilterT& filter, PostProcessorT& postProcessor, bool recursive = true,
+    int depth = DEPTH_UNSPECIFIED)
+{
+    if (depth == DEPTH_UNSPECIFIED)
+        depth = Node::getImplDepth(otherImpl, context);
+    if (!checkStaticFilterDepth(context, filter, depth))
+        return 0;
+    unsigned int numNodes = 0;
+    NodeProcessingResultID result = NodeProcessor::RESULT_OK;
+    bool process0 = false;
+    if (checkResultFlags(filter(otherImpl, 0, depth),
+        NodeFilter::RESULT_PASS))
+    {
+        // process this node (pre)
+        result = preProcessor(otherImpl, 0, depth);
+        numNodes++;
+        process0 = true;
+    }
+    if (!recursive
+        || checkResultFlags(result, ChainableNodeProcessor::RESULT_FINISHED))
+        return numNodes;
+    // process nodes recursively
+    depth++;
+    int n0 = Node::getImplNumChildNodes(otherImpl);
+    for (int i = 0; i < n0; i++)
+    {
+        NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
+            Node::getImplChildByValidIndex(otherImpl, i),
+            "processImplStatic", "Child node implementation");
+        numNodes += processImplStatic(cn0, context, preProcessor, filter,
+            postProcessor, true, depth);
+    }
+    if (process0)
+    {
+        // process this node (post)
+        postProcessor(otherImpl, 0, depth);
+    }
+    return numNodes;
+}
+
+/** Intersect ray (static).
+ *
+ * Find intersections between the node and the specified ray. This has the
+ * same semantics as Node::intersectRayImpl(). Node intersections are
+ * passed to the specified static intersection processor in order of
+ * occurence along the ray. Ray traversal stops when the processor returns
+ * ChainableNodeProcessor::RESULT_FINISHED. Only intersections for nodes
+ * that pass the filter will be processed. However, if \c recursive is
+ * \c true, child nodes of nodes that intersect the ray but do not pass
+ * the filter are still be processed, up to the maximum depth specified on
+ * the filter.
+ *
+ * \param otherImpl Node implementation.
+ * \param context Voxel tree context.
+ * \param ray ray.
+ * \param processor static node intersection processor.
+ * \param filter static node filter.
+ * \param recursive intersect nodes recursively.
+ * \param t tolerance.
+ * \param pcIntersection precomputed node intersection.
+ * \param fill0 create a full set of child nodes for nodes that intersect
+ * the ray.
+ * \param pruneEmpty0 prune empty child nodes after processing an
+ * intersection.
+ * \param depth depth of the node implementation (if known). If the
+ * depth is unspecified, it is determined once for \c otherImpl and then
+ * passed down to the child nodes.
+ *
+ * \return number of nodes that have intersections.
+ */
+template<class ProcessorT, class FilterT>
+unsigned int intersectRayImplStatic(Ionflux::VolGfx::NodeImpl* otherImpl,
+    Ionflux::VolGfx::Context* context, const Ionflux::GeoUtils::Line3& ray,
+    ProcessorT& processor, FilterT& filter, bool recursive = true,
+    double t = DEFAULT_TOLERANCE,
+    const Ionflux::VolGfx::NodeIntersection* pcIntersection = 0,
+    bool fill0 = false, bool pruneEmpty0 = false,
+    int depth = DEPTH_UNSPECIFIED)
+{
+    if (depth == DEPTH_UNSPECIFIED)
+        depth = Node::getImplDepth(otherImpl, context);
+    if (!checkStaticFilterDepth(context, filter, depth))
+        return 0;
+    bool atMaxDepth = (depth == filter.getMaxDepth());
+    // get intersections for this node
+    NodeIntersection ni0;
+    if (pcIntersection != 0)
+        ni0 = *pcIntersection;
+    else
+        Node::intersectRayImpl(otherImpl, context, ray, ni0, t);
+    if (!ni0.intersection.valid)
+        return 0;
+    if (fill0 && !atMaxDepth)
+        Node::fillImpl(otherImpl, context);
+    unsigned int numNodes = 0;
+    NodeProcessingResultID result = NodeProcessor::RESULT_OK;
+    if (checkResultFlags(filter(otherImpl, 0, depth),
+        NodeFilter::RESULT_PASS))
+    {
+        // process this node intersection
+        result = processor(ni0, 0);
+        numNodes++;
+    }
+    if (!recursive
+        || atMaxDepth
+        || checkResultFlags(result, ChainableNodeProcessor::RESULT_FINISHED))
+        return numNodes;
+    // get intersection order for child nodes
+    NodeIntersectionVector niv0;
+    int n0 = Node::getImplNumChildNodes(otherImpl);
+    for (int i = 0; i < n0; i++)
+    {
+        NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
+            Node::getImplChildByValidIndex(otherImpl, i),
+            "intersectRayImplStatic", "Child node implementation");
+        if (Node::intersectRayImpl(cn0, context, ray, ni0, t))
+            niv0.push_back(ni0);
+    }
+    NodeIntersectionCompare cmp0;
+    std::sort(niv0.begin(), niv0.end(), cmp0);
+    // intersect nodes recursively
+    depth++;
+    for (NodeIntersectionVector::iterator i = niv0.begin();
+        i != niv0.end(); i++)
+    {
+        NodeIntersection& ci = *i;
+        numNodes += intersectRayImplStatic(ci.nodeImpl, context, ray,
+            processor, filter, true, t, &ci, fill0, pruneEmpty0, depth);
+    }
+    if (pruneEmpty0)
+        Node::pruneEmptyImpl(otherImpl, context);
+    return numNodes;
+}
+
+/// @}
+
+}
+
+}
+
+/** \file staticprocessors.hpp
+ * \brief Statically composed node processors (header).
+ */
+#endif
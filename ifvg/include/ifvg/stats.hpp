@@ -0,0 +1,280 @@
+#ifndef IONFLUX_VOLGFX_STATS
+#define IONFLUX_VOLGFX_STATS
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * stats.hpp                     Pipeline statistics (header).
+ * =========================================================================
+ *
+ * This file is part of IFVG - Ionflux' Volumetric Graphics Library.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with IFVG - Ionflux' Volumetric Graphics Library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+ *
+ * ========================================================================== */
+#include <string>
+#include "ifobject/types.hpp"
+#include "ifvg/types.hpp"
+#include "ifvg/constants.hpp"
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+/** \addtogroup ifvg
+ *
+ * Pipeline statistics.
+ *
+ * Timers and counters for the voxelization, classification and merge
+ * pipeline. Statistics are collected per thread and attributed to the
+ * innermost active phase of that thread. Collection is disabled by
+ * default; while it is disabled, each instrumentation point costs one
+ * flag check.
+ *
+ * Statistics should be queried or reset while no instrumented
+ * operations are running.
+ *
+ * @{
+ */
+
+/// Statistics enabled flag (use isStatsEnabled()).
+extern int statsEnabledFlag;
+
+/** Check whether statistics are enabled.
+ *
+ * Check whether collection of pipeline statistics is enabled.
+ *
+ * \return \c true if statistics are enabled, \c false otherwise.
+ */
+inline bool isStatsEnabled()
+{
+    return __atomic_load_n(&statsEnabledFlag, __ATOMIC_RELAXED) != 0;
+}
+
+/** Enable statistics.
+ *
+ * Enable or disable collection of pipeline statistics.
+ *
+ * \param enable Enable statistics.
+ */
+void setStatsEnabled(bool enable = true);
+
+/** Get statistics enabled flag.
+ *
+ * Check whether collection of pipeline statistics is enabled.
+ *
+ * \return \c true if statistics are enabled, \c false otherwise.
+ */
+bool getStatsEnabled();
+
+/** Reset statistics.
+ *
+ * Reset the statistics for all threads.
+ */
+void resetStats();
+
+/** Add to statistics counter (implementation).
+ *
+ * Add a value to a counter for the current phase of the calling thread.
+ * Use addStatsCount() instead, which checks whether statistics are
+ * enabled first.
+ *
+ * \param counter Counter ID.
+ * \param value Value.
+ */
+void addStatsCountImpl(Ionflux::VolGfx::StatsCounterID counter,
+    Ionflux::ObjectBase::UInt64 value);
+
+/** Add to statistics counter.
+ *
+ * Add a value to a counter for the current phase of the calling thread.
+ * This does nothing if statistics are disabled.
+ *
+ * \param counter Counter ID.
+ * \param value Value.
+ */
+inline void addStatsCount(Ionflux::VolGfx::StatsCounterID counter,
+    Ionflux::ObjectBase::UInt64 value = 1)
+{
+    if (isStatsEnabled())
+        addStatsCountImpl(counter, value);
+}
+
+/** Begin statistics phase.
+ *
+ * Begin a phase for the calling thread. If the phase is already active
+ * (for example, in a recursive call), only the nesting level is updated.
+ *
+ * \param phase Phase ID.
+ *
+ * \return Previous phase of the calling thread.
+ */
+Ionflux::VolGfx::StatsPhaseID beginStatsPhase(
+    Ionflux::VolGfx::StatsPhaseID phase);
+
+/** End statistics phase.
+ *
+ * End a phase for the calling thread. The time is accumulated when the
+ * outermost call for the phase ends.
+ *
+ * \param phase Phase ID.
+ * \param previousPhase Phase to be restored.
+ */
+void endStatsPhase(Ionflux::VolGfx::StatsPhaseID phase,
+    Ionflux::VolGfx::StatsPhaseID previousPhase);
+
+/** Get number of statistics threads.
+ *
+ * Get the number of threads for which statistics have been recorded.
+ *
+ * \return Number of threads.
+ */
+unsigned int getNumStatsThreads();
+
+/** Get statistics.
+ *
+ * Get statistics for a phase. If \c threadIndex is negative, the
+ * statistics for all threads are accumulated.
+ *
+ * \param phase Phase ID.
+ * \param threadIndex Thread index.
+ *
+ * \return Statistics for the phase.
+ */
+Ionflux::VolGfx::PhaseStats getStats(Ionflux::VolGfx::StatsPhaseID phase,
+    int threadIndex = -1);
+
+/** Get statistics counter value.
+ *
+ * Get the value of a counter from a phase statistics record.
+ *
+ * \param stats Phase statistics.
+ * \param counter Counter ID.
+ *
+ * \return Counter value.
+ */
+Ionflux::ObjectBase::UInt64 getStatsCounter(
+    const Ionflux::VolGfx::PhaseStats& stats,
+    Ionflux::VolGfx::StatsCounterID counter);
+
+/** Get statistics phase name.
+ *
+ * Get the name of a statistics phase.
+ *
+ * \param phase Phase ID.
+ *
+ * \return Phase name.
+ */
+std::string getStatsPhaseName(Ionflux::VolGfx::StatsPhaseID phase);
+
+/** Get statistics counter name.
+ *
+ * Get the name of a statistics counter.
+ *
+ * \param counter Counter ID.
+ *
+ * \return Counter name.
+ */
+std::string getStatsCounterName(Ionflux::VolGfx::StatsCounterID counter);
+
+/** Get statistics string.
+ *
+ * Get a human-readable summary of the statistics for all threads.
+ *
+ * \return Statistics string.
+ */
+std::string getStatsString();
+
+/** Get statistics JSON.
+ *
+ * Get the statistics as a JSON document. If \c perThread is \c true,
+ * the statistics of each thread are included in addition to the
+ * accumulated statistics.
+ *
+ * \param perThread Include per-thread statistics.
+ *
+ * \return JSON document.
+ */
+std::string getStatsJSON(bool perThread = false);
+
+/** Write statistics JSON.
+ *
+ * Write the statistics as a JSON document to a file.
+ *
+ * \param fileName File name.
+ * \param perThread Include per-thread statistics.
+ */
+void writeStatsJSON(const std::string& fileName, bool perThread = false);
+
+/** Statistics phase timer.
+ *
+ * Scoped timer for a statistics phase. The phase is active for the
+ * lifetime of the timer object. If statistics are disabled when the timer
+ * is created, the timer does nothing.
+ */
+class StatsPhaseTimer
+{
+    protected:
+        /// Phase ID.
+        Ionflux::VolGfx::StatsPhaseID phase;
+        /// Previous phase ID.
+        Ionflux::VolGfx::StatsPhaseID previousPhase;
+        /// Active flag.
+        bool active;
+
+    public:
+        /** Constructor.
+         *
+         * Construct new StatsPhaseTimer object.
+         *
+         * \param initPhase Phase ID.
+         */
+        StatsPhaseTimer(Ionflux::VolGfx::StatsPhaseID initPhase)
+        : phase(initPhase), previousPhase(STATS_PHASE_OTHER),
+          active(isStatsEnabled())
+        {
+            if (active)
+                previousPhase = beginStatsPhase(phase);
+        }
+
+        /** Destructor.
+         *
+         * Destruct StatsPhaseTimer object.
+         */
+        ~StatsPhaseTimer()
+        {
+            if (active)
+                endStatsPhase(phase, previousPhase);
+        }
+
+    private:
+        StatsPhaseTimer(const StatsPhaseTimer& other);
+        StatsPhaseTimer& operator=(const StatsPhaseTimer& other);
+};
+
+/// @}
+
+}
+
+}
+
+/** \file stats.hpp
+ * \brief Pipeline statistics (header).
+ */
+#endif
@@ -320,6 +320,37 @@ typedef Ionflux::ObjectBase::UInt8 LeafStatusID;
 /// Merge policy ID.
 typedef Ionflux::ObjectBase::UInt8 MergePolicyID;
 
+/// Statistics phase ID.
+typedef int StatsPhaseID;
+
+/// Statistics counter ID.
+typedef int StatsCounterID;
+
+/// Pipeline statistics for a phase.
+struct PhaseStats
+{
+    /// Number of calls.
+    Ionflux::ObjectBase::UInt64 numCalls;
+    /// Time (seconds).
+    double time;
+    /// Number of nodes created.
+    Ionflux::ObjectBase::UInt64 nodesCreated;
+    /// Number of faces tested.
+    Ionflux::ObjectBase::UInt64 facesTested;
+    /// Number of voxelization point tests.
+    Ionflux::ObjectBase::UInt64 pointTests;
+    /// Number of voxelization point test hits.
+    Ionflux::ObjectBase::UInt64 pointTestHits;
+    /// Number of rays cast.
+    Ionflux::ObjectBase::UInt64 raysCast;
+    /// Number of intersections processed.
+    Ionflux::ObjectBase::UInt64 intersectionsProcessed;
+    /// Number of nodes pruned.
+    Ionflux::ObjectBase::UInt64 nodesPruned;
+    /// Number of bytes allocated.
+    Ionflux::ObjectBase::UInt64 bytesAllocated;
+};
+
 /// Flags for node intersection processing.
 struct NodeIntersectionProcessingFlags
 {
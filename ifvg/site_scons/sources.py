@@ -10,12 +10,15 @@ ifvgLibHeaders = [
 	'include/ifvg/types.hpp', 
 	'include/ifvg/utils.hpp', 
 	'include/ifvg/serialize.hpp', 
+	'include/ifvg/staticprocessors.hpp', 
+	'include/ifvg/stats.hpp', 
 	'include/ifvg/ifvg.hpp', 
     'include/ifvg/IFVGError.hpp', 
     'include/ifvg/Context.hpp', 
     'include/ifvg/IOContext.hpp', 
     'include/ifvg/Node.hpp',
     'include/ifvg/NodeSet.hpp', 
+    'include/ifvg/NodeArrays.hpp', 
     'include/ifvg/Mesh.hpp', 
     'include/ifvg/NodeProcessor.hpp', 
     'include/ifvg/ChainableNodeProcessor.hpp', 
@@ -30,11 +33,13 @@ ifvgLibHeaders = [
 ifvgLibSources = [
     'build/utils.cpp', 
     'build/serialize.cpp', 
+    'build/stats.cpp', 
     'build/IFVGError.cpp', 
     'build/Context.cpp', 
     'build/IOContext.cpp', 
     'build/Node.cpp', 
     'build/NodeSet.cpp', 
+    'build/NodeArrays.cpp', 
     'build/Mesh.cpp', 
     'build/NodeProcessor.cpp', 
     'build/ChainableNodeProcessor.cpp', 
@@ -52,6 +57,7 @@ ifvgLibClasses = [
     'IOContext', 
     'Node', 
     'NodeSet', 
+    'NodeArrays', 
     'Mesh', 
     'NodeProcessor', 
     'ChainableNodeProcessor', 
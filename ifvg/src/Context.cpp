@@ -17,6 +17,7 @@
 #include "geoutils/utils.hpp"
 #include "geoutils/imageutils.hpp"
 #include "geoutils/Vertex3.hpp"
+#include "geoutils/vecmath.hpp"
 #include "ifvg/IFVGError.hpp"
 #include "ifvg/Node.hpp"
 #include "ifvg/utils.hpp"
@@ -55,7 +56,7 @@ const ContextClassInfo Context::contextClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* Context::CLASS_INFO = &Context::contextClassInfo;
 
 Context::Context()
-: depthMask(0), locMask(0), voxelSize(0), maxNumLevels(DEFAULT_MAX_NUM_LEVELS), order(DEFAULT_ORDER), tolerance(DEFAULT_TOLERANCE), validBits(0), maxNumLeafChildNodesPerNode(0), maxNumLeafChildNodesPerDimension(0), scale(1.)
+: depthMask(0), locMask(0), voxelSize(0), maxNumLevels(DEFAULT_MAX_NUM_LEVELS), order(DEFAULT_ORDER), tolerance(DEFAULT_TOLERANCE), validBits(0), maxNumLeafChildNodesPerNode(0), maxNumLeafChildNodesPerDimension(0), scale(1.), frozen(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -63,7 +64,7 @@ Context::Context()
 }
 
 Context::Context(const Ionflux::VolGfx::Context& other)
-: depthMask(0), locMask(0), voxelSize(0), maxNumLevels(DEFAULT_MAX_NUM_LEVELS), order(DEFAULT_ORDER), tolerance(DEFAULT_TOLERANCE), validBits(0), maxNumLeafChildNodesPerNode(0), maxNumLeafChildNodesPerDimension(0), scale(1.)
+: depthMask(0), locMask(0), voxelSize(0), maxNumLevels(DEFAULT_MAX_NUM_LEVELS), order(DEFAULT_ORDER), tolerance(DEFAULT_TOLERANCE), validBits(0), maxNumLeafChildNodesPerNode(0), maxNumLeafChildNodesPerDimension(0), scale(1.), frozen(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -74,7 +75,7 @@ Context::Context(int initMaxNumLevels, int initOrder, double initScale,
 double initTolerance)
 : depthMask(0), locMask(0), voxelSize(0), maxNumLevels(initMaxNumLevels), 
 order(initOrder), tolerance(initTolerance), maxNumLeafChildNodesPerNode(0),
-maxNumLeafChildNodesPerDimension(0), scale(initScale)
+maxNumLeafChildNodesPerDimension(0), scale(initScale), frozen(false)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -642,66 +643,74 @@ Ionflux::VolGfx::SeparabilityID sep, int depth, bool checkBounds0)
 	Ionflux::GeoUtils::Vertex3* v2 = 
 	    Ionflux::ObjectBase::nullPointerCheck(face.getVertexData(2), 
 	        this, "initTriangleVoxelizationData", "Vertex (2)");
+	/* The data is computed using value types and stored in the target 
+	   vectors at the end, which avoids temporary vector objects. */
 	// triangle data
-	target.tri.v0 = v0->getVector();
-	target.tri.v1 = v1->getVector();
-	target.tri.v2 = v2->getVector();
-	Ionflux::GeoUtils::Vector3 n0 = 
-	    (target.tri.v1 - target.tri.v0).cross(
-	        target.tri.v2 - target.tri.v0).normalize();
-	target.plane.p = target.tri.v0;
-	target.plane.normal = n0;
+	Ionflux::GeoUtils::Vec3 p0(v0->getX(), v0->getY(), v0->getZ());
+	Ionflux::GeoUtils::Vec3 p1(v1->getX(), v1->getY(), v1->getZ());
+	Ionflux::GeoUtils::Vec3 p2(v2->getX(), v2->getY(), v2->getZ());
+	Ionflux::GeoUtils::Vec3 n0((p1 - p0).cross(p2 - p0).normalize());
+	p0.get(target.tri.v0);
+	p1.get(target.tri.v1);
+	p2.get(target.tri.v2);
+	p0.get(target.plane.p);
+	n0.get(target.plane.normal);
 	// separability factors
 	target.sep = sep;
 	double s0 = getVoxelSize(depth);
 	target.voxelSize = s0;
 	if (sep == SEPARABILITY_26)
 	{
-	    Ionflux::GeoUtils::Vector3* d0 = getMatchingVoxelDiag(n0);
-	    target.t = 0.5 * s0 * SQRT_3 * n0.angleCos(*d0);
+	    Ionflux::GeoUtils::Vec3 d0(
+	        *getMatchingVoxelDiag(target.plane.normal));
+	    target.t = 0.5 * s0 * SQRT_3 * n0.angleCos(d0);
 	    target.r_c = 0.5 * SQRT_3 * s0;
 	} else
 	if (sep == SEPARABILITY_6)
 	{
-	    Ionflux::GeoUtils::Vector3* n1 = getMatchingVoxelNormal(n0);
-	    target.t = 0.5 * s0 * n0.angleCos(*n1);
+	    Ionflux::GeoUtils::Vec3 n1(
+	        *getMatchingVoxelNormal(target.plane.normal));
+	    target.t = 0.5 * s0 * n0.angleCos(n1);
 	    target.r_c = 0.5 * s0;
 	}
 	// offset planes
 	// upper offset plane
-	target.planeU.p = target.tri.v0 + (n0 * target.t);
-	target.planeU.normal = n0;
+	(p0 + n0 * target.t).get(target.planeU.p);
+	n0.get(target.planeU.normal);
 	// lower offset plane
-	target.planeL.p = target.tri.v0 - (n0 * target.t);
-	target.planeL.normal = n0.flip();
+	(p0 - n0 * target.t).get(target.planeL.p);
+	(-n0).get(target.planeL.normal);
 	// edge shapes
+	Ionflux::GeoUtils::Vec3 e0(p1 - p0);
+	Ionflux::GeoUtils::Vec3 e1(p2 - p1);
+	Ionflux::GeoUtils::Vec3 e2(p0 - p2);
+	Ionflux::GeoUtils::Vec3 d0(e0.normalize());
+	Ionflux::GeoUtils::Vec3 d1(e1.normalize());
+	Ionflux::GeoUtils::Vec3 d2(e2.normalize());
 	// edge cylinder (0)
-	target.cylE0.center = (target.tri.v1 + target.tri.v0) * 0.5;
-	target.cylE0.direction = (target.tri.v1 - target.tri.v0).normalize();
-	target.cylE0.length = (target.tri.v1 - target.tri.v0).length();
+	((p1 + p0) * 0.5).get(target.cylE0.center);
+	d0.get(target.cylE0.direction);
+	target.cylE0.length = e0.length();
 	target.cylE0.radius = target.r_c;
 	// edge cylinder (1)
-	target.cylE1.center = (target.tri.v2 + target.tri.v1) * 0.5;
-	target.cylE1.direction = (target.tri.v2 - target.tri.v1).normalize();
-	target.cylE1.length = (target.tri.v2 - target.tri.v1).length();
+	((p2 + p1) * 0.5).get(target.cylE1.center);
+	d1.get(target.cylE1.direction);
+	target.cylE1.length = e1.length();
 	target.cylE1.radius = target.r_c;
 	// edge cylinder (2)
-	target.cylE2.center = (target.tri.v0 + target.tri.v2) * 0.5;
-	target.cylE2.direction = (target.tri.v0 - target.tri.v2).normalize();
-	target.cylE2.length = (target.tri.v0 - target.tri.v2).length();
+	((p0 + p2) * 0.5).get(target.cylE2.center);
+	d2.get(target.cylE2.direction);
+	target.cylE2.length = e2.length();
 	target.cylE2.radius = target.r_c;
 	// edge plane (0)
-	target.planeE0.p = target.tri.v0;
-	target.planeE0.normal = target.cylE0.direction.cross(
-	    n0).normalize();
+	p0.get(target.planeE0.p);
+	d0.cross(n0).normalize().get(target.planeE0.normal);
 	// edge plane (1)
-	target.planeE1.p = target.tri.v1;
-	target.planeE1.normal = target.cylE1.direction.cross(
-	    n0).normalize();
+	p1.get(target.planeE1.p);
+	d1.cross(n0).normalize().get(target.planeE1.normal);
 	// edge plane (2)
-	target.planeE2.p = target.tri.v2;
-	target.planeE2.normal = target.cylE2.direction.cross(
-	    n0).normalize();
+	p2.get(target.planeE2.p);
+	d2.cross(n0).normalize().get(target.planeE2.normal);
 	// containing node
 	Ionflux::GeoUtils::Range3 bb0;
 	bb0.setBounds(target.tri.v0);
@@ -1336,6 +1345,16 @@ double Context::getScale() const
     return scale;
 }
 
+void Context::setFrozen(bool newFrozen)
+{
+	frozen = newFrozen;
+}
+
+bool Context::getFrozen() const
+{
+    return frozen;
+}
+
 Ionflux::VolGfx::Context& Context::operator=(const 
 Ionflux::VolGfx::Context& other)
 {
@@ -25,6 +25,8 @@
 #include "ifvg/NodeProcessor.hpp"
 #include "ifvg/NodeFilter.hpp"
 #include "ifvg/NodeIntersectionProcessor.hpp"
+#include "ifvg/staticprocessors.hpp"
+#include "ifvg/stats.hpp"
 
 using namespace std;
 
@@ -69,7 +71,7 @@ const NodeClassInfo Node::nodeClassInfo;
 const Ionflux::ObjectBase::IFClassInfo* Node::CLASS_INFO = &Node::nodeClassInfo;
 
 Node::Node()
-: impl(0), context(0)
+: implRef(false), contextRef(false), impl(0), context(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -77,7 +79,7 @@ Node::Node()
 }
 
 Node::Node(const Ionflux::VolGfx::Node& other)
-: impl(0), context(0)
+: implRef(false), contextRef(false), impl(0), context(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
@@ -86,12 +88,23 @@ Node::Node(const Ionflux::VolGfx::Node& other)
 
 Node::Node(Ionflux::VolGfx::Context* initContext, 
 Ionflux::VolGfx::NodeImpl* initImpl)
-: impl(0), context(0)
+: implRef(false), contextRef(false), impl(0), context(0)
 {
 	// NOTE: The following line is required for run-time type information.
 	theClass = CLASS_INFO;
 	if (initContext != 0)
-	    setContext(initContext);
+	{
+	    if ((initImpl != 0) 
+	        && (initImpl->parent != 0) 
+	        && initContext->getFrozen())
+	    {
+	        /* Wrappers for nodes within a frozen tree do not reference 
+	           the context, which is shared by all threads querying the 
+	           tree (see setImpl()). */
+	        context = initContext;
+	    } else
+	        setContext(initContext);
+	}
 	if (initImpl != 0)
 	    setImpl(initImpl);
 	else
@@ -104,10 +117,21 @@ Node::~Node()
 	    setImpl(0);
 }
 
+void Node::checkMutable(const std::string& source) const
+{
+	if ((context != 0) 
+	    && context->getFrozen())
+	{
+	    throw IFVGError(getErrorString("Attempt to modify a node "
+	        "of a frozen tree.", source));
+	}
+}
+
 void Node::clear() const
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "clear", "Node implementation");
+	checkMutable("clear");
 	clearImpl(impl, true, true, true);
 }
 
@@ -124,6 +148,7 @@ void Node::setChildNodes(const Ionflux::VolGfx::NodeVector& newNodes) const
 	    "setChildNodes", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "setChildNodes", "Context");
+	checkMutable("setChildNodes");
 	int n0 = context->getMaxNumLeafChildNodesPerNode();
 	if (newNodes.size() < static_cast<unsigned int>(n0))
 	{
@@ -155,6 +180,7 @@ bool fill0) const
 	    "mergeChildNodes", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "mergeChildNodes", "Context");
+	checkMutable("mergeChildNodes");
 	mergeImplChildNodes(impl, context, newNodes, fill0);
 }
 
@@ -165,6 +191,7 @@ bool fill0) const
 	    "mergeChildNodes", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "mergeChildNodes", "Context");
+	checkMutable("mergeChildNodes");
 	int n0 = context->getMaxNumLeafChildNodesPerNode();
 	if (newNodes.size() < static_cast<unsigned int>(n0))
 	{
@@ -196,6 +223,7 @@ orderIndex) const
 	    "setChildNodeByOrderIndex", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "setChildNodeByOrderIndex", "Context");
+	checkMutable("setChildNodeByOrderIndex");
 	Ionflux::ObjectBase::nullPointerCheck(newNode, this, 
 	    "setChildNodeByOrderIndex", "Node");
 	NodeImpl* nImpl = newNode->getImpl();
@@ -211,6 +239,7 @@ clearNodes) const
 	    "clearChildNodes", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "clearChildNodes", "Context");
+	checkMutable("clearChildNodes");
 	clearImplChildNodes(impl, context, clearNodes);
 }
 
@@ -220,6 +249,7 @@ unsigned int Node::pruneEmpty(bool recursive) const
 	    "pruneEmpty", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "pruneEmpty", "Context");
+	checkMutable("pruneEmpty");
 	return pruneEmptyImpl(impl, context, recursive);;
 }
 
@@ -227,6 +257,7 @@ void Node::clearData() const
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "clearData", "Node implementation");
+	checkMutable("clearData");
 	clearImpl(impl, true, true, false);
 }
 
@@ -234,6 +265,7 @@ void Node::clearChildNodes() const
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "clearChildNodes", "Node implementation");
+	checkMutable("clearChildNodes");
 	if (isImplLeaf(impl))
 	    return;
 	clearImpl(impl, true, false, true);
@@ -246,6 +278,7 @@ void Node::setData(Ionflux::VolGfx::NodeDataImpl* newData) const
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "setData", "Node implementation");
+	checkMutable("setData");
 	clearImpl(impl, false, true, false);
 	impl->data = newData;
 }
@@ -255,6 +288,7 @@ Ionflux::ObjectBase::DoubleVector* newData) const
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "setData", "Node implementation");
+	checkMutable("setData");
 	NodeDataImpl* d0 = createDataImpl(newType, newData);
 	clearImpl(impl, false, true, false);
 	impl->data = d0;
@@ -264,6 +298,7 @@ void Node::clearLeafData() const
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "clearLeafData", "Node implementation");
+	checkMutable("clearLeafData");
 	if (!isLeaf())
 	    return;
 	clearImpl(impl, false, true, false);
@@ -282,6 +317,7 @@ int Node::fill(bool clearExisting, bool recursive, int maxDepth) const
 	    "fill", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "fill", "Context");
+	checkMutable("fill");
 	return fillImpl(impl, context, clearExisting, recursive, maxDepth);;
 }
 
@@ -371,6 +407,7 @@ void Node::update()
 	    "update", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "update", "Context");
+	checkMutable("update");
 	updateImpl(impl, context);
 }
 
@@ -401,6 +438,7 @@ Ionflux::VolGfx::NodeDataType createDataType)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "setVoxelClass", "Node implementation");
+	checkMutable("setVoxelClass");
 	return setImplVoxelClass(impl, mask, enable, createDataType);
 }
 
@@ -412,6 +450,7 @@ Ionflux::VolGfx::NodeDataType createDataType)
 	    "setVoxelClass", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "setVoxelClass", "Context");
+	checkMutable("setVoxelClass0");
 	return setImplVoxelClass(impl, context, mask, enable, filter, 
     recursive, createDataType);
 }
@@ -435,6 +474,7 @@ color, Ionflux::VolGfx::NodeDataType createDataType)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "setColorIndex", "Node implementation");
+	checkMutable("setColorIndex");
 	return setImplColorIndex(impl, color, createDataType);
 }
 
@@ -446,6 +486,7 @@ Ionflux::VolGfx::NodeDataType createDataType)
 	    "setColorIndex", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "setColorIndex", "Context");
+	checkMutable("setColorIndex0");
 	return setImplColorIndex(impl, context, color, filter, recursive, 
     createDataType);
 }
@@ -457,6 +498,8 @@ autoCreate) const
 	    "getChildByOrderIndex", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "getChildByOrderIndex", "Context");
+	if (autoCreate)
+	    checkMutable("getChildByOrderIndex");
 	NodeImpl* ni = getImplChildByOrderIndex(impl, context, orderIndex, 
 	    autoCreate);
 	return wrapImpl(ni, context);
@@ -468,41 +511,45 @@ Ionflux::VolGfx::Node* Node::getChildByValidIndex(int index) const
 	return wrapImpl(ni, context);
 }
 
-Ionflux::VolGfx::Node* Node::locateChild(const Ionflux::VolGfx::NodeLoc3& 
-loc, int maxDepth)
+Ionflux::VolGfx::Node* Node::locateChild(const 
+Ionflux::VolGfx::NodeLoc3& loc, int maxDepth, Ionflux::VolGfx::Node* 
+target)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "locateChild", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "locateChild", "Context");
 	NodeImpl* ni = locateImplChild(impl, context, loc, maxDepth);
-	return wrapImpl(ni, context);
+	return wrapImpl(ni, context, target);
 }
 
-Ionflux::VolGfx::Node* Node::locateChild(const Ionflux::GeoUtils::Vector3& 
-p, int maxDepth)
+Ionflux::VolGfx::Node* Node::locateChild(const 
+Ionflux::GeoUtils::Vector3& p, int maxDepth, Ionflux::VolGfx::Node* 
+target)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "locateChild", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "locateChild", "Context");
 	NodeImpl* ni = locateImplChild(impl, context, p, maxDepth);
-	return wrapImpl(ni, context);
+	return wrapImpl(ni, context, target);
 }
 
-Ionflux::VolGfx::Node* Node::locateRegion(const Ionflux::VolGfx::Region3& 
-region, int maxDepth)
+Ionflux::VolGfx::Node* Node::locateRegion(const 
+Ionflux::VolGfx::Region3& region, int maxDepth, Ionflux::VolGfx::Node* 
+target)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "locateRegion", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "locateRegion", "Context");
 	NodeImpl* ni = locateImplRegion(impl, context, region, maxDepth);
-	return wrapImpl(ni, context);
+	return wrapImpl(ni, context, target);
 }
 
-Ionflux::VolGfx::Node* Node::locateRegion(const Ionflux::GeoUtils::Range3& 
-range, int maxDepth)
+Ionflux::VolGfx::Node* Node::locateRegion(const 
+Ionflux::GeoUtils::Range3& range, int maxDepth, Ionflux::VolGfx::Node* 
+target)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "locateRegion", "Node implementation");
@@ -510,18 +557,18 @@ range, int maxDepth)
 	    "locateRegion", "Context");
 	Region3 r0 = context->createRegion(range);
 	NodeImpl* ni = locateImplRegion(impl, context, r0, maxDepth);
-	return wrapImpl(ni, context);
+	return wrapImpl(ni, context, target);
 }
 
 Ionflux::VolGfx::Node* Node::locateNode(const Ionflux::VolGfx::NodeLoc3& 
-loc, int maxDepth)
+loc, int maxDepth, Ionflux::VolGfx::Node* target)
 {
 	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
 	    "locateNode", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "locateNode", "Context");
 	NodeImpl* ni = locateImplNode(impl, context, loc, maxDepth);
-	return wrapImpl(ni, context);
+	return wrapImpl(ni, context, target);
 }
 
 int Node::getDepth() const
@@ -549,6 +596,7 @@ loc, int depth, bool fill0, bool fillTargetDepth0)
 	    "insertChild", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "insertChild", "Context");
+	checkMutable("insertChild");
 	NodeImpl* ni = insertImplChild(impl, context, loc, depth, fill0, 
 	    fillTargetDepth0);
 	return wrapImpl(ni, context);
@@ -561,6 +609,7 @@ p, int depth, bool fill0)
 	    "insertChild", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "insertChild", "Context");
+	checkMutable("insertChild");
 	NodeImpl* ni = insertImplChild(impl, context, p, depth, fill0);
 	return wrapImpl(ni, context);
 }
@@ -572,6 +621,7 @@ nodeID, bool fill0)
 	    "insertChild", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "insertChild", "Context");
+	checkMutable("insertChild");
 	NodeImpl* ni = insertImplChild(impl, context, nodeID, fill0);
 	return wrapImpl(ni, context);
 }
@@ -729,6 +779,7 @@ Ionflux::VolGfx::SeparabilityID sep, bool fill0)
 	    "voxelizeInsertFace", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "voxelizeInsertFace", "Context");
+	checkMutable("voxelizeInsertFace");
 	return voxelizeImplInsertFace(impl, context, face, sep, fill0);
 }
 
@@ -739,9 +790,22 @@ Ionflux::VolGfx::SeparabilityID sep, bool fill0)
 	    "Node::voxelizeInsertImplFaces", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "Node::voxelizeInsertImplFaces", "Context");
+	checkMutable("voxelizeInsertFaces");
 	return voxelizeImplInsertFaces(impl, context, mesh, sep, fill0);
 }
 
+unsigned int Node::voxelizeInsertFaces(const
+Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh& target,
+Ionflux::VolGfx::SeparabilityID sep, bool fill0)
+{
+	Ionflux::ObjectBase::nullPointerCheck(impl, this, 
+	    "Node::voxelizeInsertImplFaces", "Node implementation");
+	Ionflux::ObjectBase::nullPointerCheck(context, this, 
+	    "Node::voxelizeInsertImplFaces", "Context");
+	checkMutable("voxelizeInsertFaces");
+	return voxelizeImplInsertFaces(impl, context, mesh, target, sep, fill0);
+}
+
 unsigned int Node::voxelizeFaces(Ionflux::VolGfx::NodeProcessor* processor,
 int targetDepth, Ionflux::VolGfx::SeparabilityID sep, bool fillTargetDepth,
 bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
@@ -750,6 +814,7 @@ bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	    "voxelizeFaces", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "voxelizeFaces", "Context");
+	checkMutable("voxelizeFaces");
 	return voxelizeImplFaces(impl, context, processor, targetDepth, sep, 
     fillTargetDepth, pruneEmpty0, faces0);;
 }
@@ -796,6 +861,7 @@ zeroParentPointer)
 	    "deserialize", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "deserialize", "Context");
+	checkMutable("deserialize");
 	deserializeImpl(impl, context, ioContext, offset, magicSyllable, 
 	    deserializeData, zeroChildPointer, zeroParentPointer);
 }
@@ -810,6 +876,7 @@ int maxDepth)
 	    "deserializeImplHierarchy", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "deserializeImplHierarchy", "Context");
+	checkMutable("deserializeHierarchy");
 	deserializeImplHierarchy(impl, context, source, header, targetNode, 
 	    poMap, poMapCurrent, deserializeData, maxDepth);
 }
@@ -821,6 +888,7 @@ deserializeData, int maxDepth)
 	    "deserializeImplHierarchy", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "deserializeImplHierarchy", "Context");
+	checkMutable("deserializeHierarchy");
 	deserializeImplHierarchy(impl, context, ioContext, deserializeData, 
 	    maxDepth);
 }
@@ -845,6 +913,8 @@ pruneEmpty0)
 	    "intersectRay", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "intersectRay", "Context");
+	if (fill0 || pruneEmpty0)
+	    checkMutable("intersectRay");
 	return intersectRayImpl(impl, context, ray, processor, filter, 
     recursive, t, pcIntersection, fill0, pruneEmpty0);
 }
@@ -861,6 +931,8 @@ bool pruneEmpty0)
 	    "castRayGrid", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "castRayGrid", "Context");
+	if (fill0 || pruneEmpty0)
+	    checkMutable("castRayGrid");
 	return castRayGridImpl(impl, context, rayOrigin, rayDirection, originStepX, 
     originStepY, numRaysX, numRaysY, processor, filter, recursive, t, 
     fill0, pruneEmpty0);
@@ -876,6 +948,8 @@ bool pruneEmpty0)
 	    "castRayGrid", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, this, 
 	    "castRayGrid", "Context");
+	if (fill0 || pruneEmpty0)
+	    checkMutable("castRayGrid");
 	return castRayGridImpl(impl, context, axis, targetDepth, planeOffset, 
     processor, filter, recursive, t, fill0, pruneEmpty0);
 }
@@ -893,6 +967,7 @@ sourceMergeFilter, bool recursive, bool fill0)
 	    "merge", "Node implementation (target)");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "merge", "Context");
+	checkMutable("merge");
 	return mergeImpl(sourceImpl, impl, context, childPolicy, dataPolicy, 
     sourceFilter, targetFilter, sourceMergeFilter, recursive, fill0);
 }
@@ -1039,6 +1114,8 @@ Ionflux::VolGfx::NodeImpl* Node::createImpl()
 {
 	NodeImpl* newImpl = Ionflux::ObjectBase::create<NodeImpl>(
 	    "Node::createImpl", "node implementation");
+	addStatsCount(STATS_COUNTER_NODES_CREATED);
+	addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, sizeof(NodeImpl));
 	newImpl->refCount = 0;
 	newImpl->loc.x = 0;
 	newImpl->loc.y = 0;
@@ -1081,11 +1158,17 @@ otherImpl)
 {
 	Ionflux::ObjectBase::nullPointerCheck(otherImpl, 
 	    "Node::refImpl", "Node implementation");
-	if (otherImpl->refCount < MAX_REF_COUNT)
-	    otherImpl->refCount++;
-	else
-	    throw IFVGError("[Node::refImpl] Reference count overflow.");
-	return otherImpl->refCount;
+	/* The reference count is updated atomically, so node wrappers may be 
+	   created and destroyed from several threads concurrently. */
+	Ionflux::ObjectBase::UInt16 rc0 = 
+	    __atomic_load_n(&(otherImpl->refCount), __ATOMIC_RELAXED);
+	do
+	{
+	    if (rc0 >= MAX_REF_COUNT)
+	        throw IFVGError("[Node::refImpl] Reference count overflow.");
+	} while (!__atomic_compare_exchange_n(&(otherImpl->refCount), &rc0, 
+	    rc0 + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	return rc0 + 1;
 }
 
 void Node::clearDataImpl(Ionflux::VolGfx::NodeDataImpl* dataImpl)
@@ -1194,32 +1277,47 @@ Ionflux::ObjectBase::UInt16 Node::unrefImpl(Ionflux::VolGfx::NodeImpl*
 otherImpl)
 {
 	Ionflux::ObjectBase::nullPointerCheck(otherImpl, 
-	    "Node::refImpl", "Node implementation");
-	if (otherImpl->refCount > 0)
+	    "Node::unrefImpl", "Node implementation");
+	Ionflux::ObjectBase::UInt16 rc0 = 
+	    __atomic_load_n(&(otherImpl->refCount), __ATOMIC_RELAXED);
+	do
 	{
-	    otherImpl->refCount--;
-	    if (otherImpl->refCount == 0)
+	    if (rc0 == 0)
 	    {
-	        clearImpl(otherImpl, true, true, true);
-	        delete otherImpl;
+	        throw IFVGError("[Node::unrefImpl] Attempt to remove "
+	            "reference from node implementation with zero "
+	            "references.");
 	    }
-	    return 0;
-	} else
+	} while (!__atomic_compare_exchange_n(&(otherImpl->refCount), &rc0, 
+	    rc0 - 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+	if (rc0 == 1)
 	{
-	    throw IFVGError("[Node::unrefImpl] Attempt to remove "
-	        "reference from node implementation with zero "
-	        "references.");
+	    // This was the last reference.
+	    clearImpl(otherImpl, true, true, true);
+	    delete otherImpl;
 	}
-	return otherImpl->refCount;
+	return rc0 - 1;
 }
 
-Ionflux::VolGfx::Node* Node::wrapImpl(Ionflux::VolGfx::NodeImpl* otherImpl,
-Ionflux::VolGfx::Context* context)
+Ionflux::ObjectBase::UInt16 
+Node::getImplRefCount(Ionflux::VolGfx::NodeImpl* otherImpl)
 {
-	Node* result = 0;
-	if (otherImpl != 0)
-	    result = Node::create(context, otherImpl);
-	return result;
+	Ionflux::ObjectBase::nullPointerCheck(otherImpl, 
+	    "Node::getImplRefCount", "Node implementation");
+	return __atomic_load_n(&(otherImpl->refCount), __ATOMIC_ACQUIRE);
+}
+
+Ionflux::VolGfx::Node* Node::wrapImpl(Ionflux::VolGfx::NodeImpl* 
+otherImpl, Ionflux::VolGfx::Context* context, Ionflux::VolGfx::Node* 
+target)
+{
+	if (otherImpl == 0)
+	    return 0;
+	if (target == 0)
+	    return Node::create(context, otherImpl);
+	target->setContext(context);
+	target->setImpl(otherImpl);
+	return target;
 }
 
 void Node::setImplParent(Ionflux::VolGfx::NodeImpl* otherImpl)
@@ -1280,6 +1378,7 @@ Ionflux::ObjectBase::DoubleVector* newData)
 	Ionflux::VolGfx::NodeDataImpl* newImpl = 
 	    Ionflux::ObjectBase::create<NodeDataImpl>("Node::createDataImpl", 
 	        "node data implementation");
+	addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, sizeof(NodeDataImpl));
 	newImpl->type = t;
 	if (t == DATA_TYPE_NULL)
 	    newImpl->data = 0;
@@ -2514,6 +2613,8 @@ newNodes, bool fill0)
 	    throw IFVGError("Node::mergeImplChildNodes"
 	        "Could not allocate child node implementations.");
 	}
+	addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, 
+	    numValid * sizeof(NodeImpl));
 	int k = 0;
 	int l = 0;
 	for (int i = 0; i < n0; i++)
@@ -2682,6 +2783,8 @@ newNodes)
 	    throw IFVGError("Node::setImplChildNodes"
 	        "Could not allocate child node implementations.");
 	}
+	addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, 
+	    numValid * sizeof(NodeImpl));
 	int k = 0;
 	for (int i = 0; i < n0; i++)
 	{
@@ -2749,6 +2852,8 @@ clearNodes)
 	    throw IFVGError("Node::clearImplChildNodes"
 	        "Could not allocate child node implementations.");
 	}
+	addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, 
+	    numValid * sizeof(NodeImpl));
 	int k = 0;
 	int l = 0;
 	for (int i = 0; i < n0; i++)
@@ -2812,7 +2917,10 @@ Ionflux::VolGfx::Context* context, bool recursive)
 	    }
 	}
 	if (cm0.any())
+	{
+	    addStatsCount(STATS_COUNTER_NODES_PRUNED, cm0.count());
 	    clearImplChildNodes(otherImpl, context, cm0);
+	}
 	return numPruned;
 }
 
@@ -3126,34 +3234,14 @@ Ionflux::VolGfx::NodeFilter* filter, bool recursive)
 	    "Node::findImpl", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::findImpl", "Context");
-	if (filter != 0)
-	{
-	    int maxDepth = filter->getMaxDepth();
-	    int depth = getImplDepth(otherImpl, context);
-	    if (!context->checkDepthRange(depth, 0, maxDepth))
-	        return 0;
-	}
-	unsigned int numNodes = 0;
-	if ((filter == 0) 
-	    || NodeProcessor::checkFlags(
-	        filter->process(otherImpl), NodeFilter::RESULT_PASS))
+	if (isStaticNodeFilter(filter))
 	{
-	    // add this node implementation
-	    if (target != 0)
-	        target->push_back(otherImpl);
-	    numNodes++;
-	}
-	if (!recursive)
-	    return numNodes;
-	// find nodes recursively
-	int n0 = getImplNumChildNodes(otherImpl);
-	for (int i = 0; i < n0; i++)
-	{
-	    NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
-	        getImplChildByValidIndex(otherImpl, i), 
-	        "Node::findImplByDepthRange", "Child node implementation");
-	    numNodes += findImpl(cn0, context, target, filter, true);
+	    StaticNodeFilterChain f1 = makeStaticNodeFilterChain(*filter);
+	    return findImplStatic(otherImpl, context, target, f1, recursive);
 	}
+	StaticFilterRef f0(filter);
+	unsigned int numNodes = findImplStatic(otherImpl, context, target, 
+	    f0, recursive);
 	return numNodes;
 }
 
@@ -3166,46 +3254,16 @@ Ionflux::VolGfx::NodeProcessor* postProcessor, bool recursive)
 	    "Node::processImpl", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::processImpl", "Context");
-	if (filter != 0)
-	{
-	    int maxDepth = filter->getMaxDepth();
-	    int depth = getImplDepth(otherImpl, context);
-	    if (!context->checkDepthRange(depth, 0, maxDepth))
-	        return 0;
-	}
-	unsigned int numNodes = 0;
-	NodeProcessingResultID result = NodeProcessor::RESULT_OK;
-	bool process0 = false;
-	if ((filter == 0) 
-	    || NodeProcessor::checkFlags(
-	        filter->process(otherImpl), NodeFilter::RESULT_PASS))
-	{
-	    // process this node (pre)
-	    if (preProcessor != 0)
-	        result = preProcessor->process(otherImpl);
-	    numNodes++;
-	    process0 = true;
-	}
-	if (!recursive 
-	    || NodeProcessor::checkFlags(result, 
-	        ChainableNodeProcessor::RESULT_FINISHED))
-	    return numNodes;
-	// process nodes recursively
-	int n0 = getImplNumChildNodes(otherImpl);
-	for (int i = 0; i < n0; i++)
+	StaticProcessorRef p0(preProcessor);
+	StaticProcessorRef p1(postProcessor);
+	if (isStaticNodeFilter(filter))
 	{
-	    NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
-	        getImplChildByValidIndex(otherImpl, i), 
-	        "Node::processImpl", "Child node implementation");
-	    numNodes += processImpl(cn0, context, preProcessor, filter, 
-	        postProcessor, true);
-	}
-	if (process0)
-	{
-	    // process this node (post)
-	    if (postProcessor != 0)
-	        result = postProcessor->process(otherImpl);
+	    StaticNodeFilterChain f1 = makeStaticNodeFilterChain(*filter);
+	    return processImplStatic(otherImpl, context, p0, f1, p1, recursive);
 	}
+	StaticFilterRef f0(filter);
+	unsigned int numNodes = processImplStatic(otherImpl, context, p0, f0, 
+	    p1, recursive);
 	return numNodes;
 }
 
@@ -3593,7 +3651,9 @@ fill0)
 	    "Node::voxelizeInsertImplFaces", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::voxelizeInsertImplFaces", "Context");
+	StatsPhaseTimer timer0(STATS_PHASE_VOXELIZE_INSERT_FACES);
 	unsigned int numFaces = mesh.getNumFaces();
+	addStatsCount(STATS_COUNTER_FACES_TESTED, numFaces);
 	unsigned int nf0 = 0;
 	for (unsigned int i = 0; i < numFaces; i++)
 	{
@@ -3607,6 +3667,15 @@ fill0)
 	return nf0;
 }
 
+unsigned int Node::voxelizeImplInsertFaces(Ionflux::VolGfx::NodeImpl*
+otherImpl, Ionflux::VolGfx::Context* context, const
+Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh& target,
+Ionflux::VolGfx::SeparabilityID sep, bool fill0)
+{
+	mesh.getMesh(target, false);
+	return voxelizeImplInsertFaces(otherImpl, context, target, sep, fill0);
+}
+
 unsigned int Node::voxelizeImplFaces(Ionflux::VolGfx::NodeImpl* otherImpl, 
 Ionflux::VolGfx::Context* context, Ionflux::VolGfx::NodeProcessor* 
 processor, int targetDepth, Ionflux::VolGfx::SeparabilityID sep, bool 
@@ -3616,6 +3685,7 @@ fillTargetDepth, bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	    "Node::voxelizeImplFaces", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::voxelizeImplFaces", "Context");
+	StatsPhaseTimer timer0(STATS_PHASE_VOXELIZE_FACES);
 	int maxNumLevels = context->getMaxNumLevels();
 	if ((targetDepth < 0) 
 	    || (targetDepth >= maxNumLevels))
@@ -3646,6 +3716,7 @@ fillTargetDepth, bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	// voxelize faces
 	unsigned int numFaces = fv0.size();
 	unsigned int numVoxels = 0;
+	addStatsCount(STATS_COUNTER_FACES_TESTED, numFaces);
 	/* <---- DEBUG ----- //
 	std::cerr << "[Node::voxelizeImplFaces] DEBUG: "
 	    "node: [" << getImplValueString(otherImpl, context, false) << "], "
@@ -3690,6 +3761,8 @@ fillTargetDepth, bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	        throw IFVGError("[Node::voxelizeImplFaces] "
 	            "Could not allocate triangle voxelization data.");
 	    }
+	    addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, 
+	        numFaces * sizeof(TriangleVoxelizationData));
 	    for (unsigned int k = 0; k < numFaces; k++)
 	    {
 	        Ionflux::GeoUtils::Face* cf = 
@@ -3707,6 +3780,7 @@ fillTargetDepth, bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	    // iterate over all child nodes by order index
 	    unsigned int n0 = context->getMaxNumLeafChildNodesPerNode();
 	    Ionflux::GeoUtils::Range3 r0;
+	    unsigned int numPointTestHits = 0;
 	    for (unsigned int i = 0; i < n0; i++)
 	    {
 	        NodeLoc3 cl0 = getImplChildLoc(otherImpl, context, i);
@@ -3742,6 +3816,7 @@ fillTargetDepth, bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	                    "voxelize point test: true" << std::endl;
 	                // ----- DEBUG ----> */
 	                fv2.push_back(cf);
+	                numPointTestHits++;
 	                /* create child node if it does not exist if there is 
 	                   at least one potential face intersection */
 	                createCN = true;
@@ -3772,6 +3847,8 @@ fillTargetDepth, bool pruneEmpty0, Ionflux::GeoUtils::FaceVector* faces0)
 	                targetDepth, sep, fill0, pruneEmpty0, &fv2);
 	        }
 	    }
+	    addStatsCount(STATS_COUNTER_POINT_TESTS, n0 * numFaces);
+	    addStatsCount(STATS_COUNTER_POINT_TEST_HITS, numPointTestHits);
 	    // clean up
 	    delete[] tvd0;
 	    clearImpl(otherImpl, false, true, false);
@@ -4356,6 +4433,7 @@ recursive, bool deserializeData)
 	    throw IFVGError("Node::deserializeImplChildNodes"
 	        "Could not allocate child node implementations.");
 	}
+	addStatsCount(STATS_COUNTER_BYTES_ALLOCATED, n0 * sizeof(NodeImpl));
 	Ionflux::ObjectBase::UInt64 cpi0 = 
 	    reinterpret_cast<Ionflux::ObjectBase::UInt64>(cp0);
 	for (int i = 0; i < n0; i++)
@@ -4674,128 +4752,16 @@ pruneEmpty0)
 	    "Node::intersectRayImpl", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::intersectRayImpl", "Context");
-	int depth = getImplDepth(otherImpl, context);
-	int maxDepth = DEPTH_UNSPECIFIED;
-	bool atMaxDepth = false;
-	if (filter != 0)
-	{
-	    maxDepth = filter->getMaxDepth();
-	    if (!context->checkDepthRange(depth, 0, maxDepth))
-	        return 0;
-	    if ((maxDepth != DEPTH_UNSPECIFIED) 
-	        && (depth == maxDepth))
-	        atMaxDepth = true;
-	}
-	// get intersections for this node
-	NodeIntersection ni0;
-	if (pcIntersection != 0)
-	{
-	    ni0 = *pcIntersection;
-	} else
-	    intersectRayImpl(otherImpl, context, ray, ni0, t);
-	if (!ni0.intersection.valid)
-	    return 0;
-	if (fill0 && !atMaxDepth)
-	    fillImpl(otherImpl, context);
-	unsigned int numNodes = 0;
-	NodeProcessingResultID result = NodeProcessor::RESULT_OK;
-	if ((filter == 0) 
-	    || NodeProcessor::checkFlags(
-	        filter->process(otherImpl), NodeFilter::RESULT_PASS))
-	{
-	    // process this node intersection
-	    if (processor != 0)
-	        result = processor->processIntersection(ni0);
-	    numNodes++;
-	}
-	if (!recursive 
-	    || atMaxDepth 
-	    || NodeProcessor::checkFlags(result, 
-	        ChainableNodeProcessor::RESULT_FINISHED))
-	    return numNodes;
-	// get intersection order for child nodes
-	/* <---- DEBUG ----- //
-	int n1 = getImplNumChildNodes(otherImpl);
-	unsigned int cni1 = 0;
-	for (int i = 0; i < n1; i++)
-	{
-	    NodeImpl& cn = otherImpl->child[i];
-	    if (hasImplVoxelClass(&cn, VOXEL_CLASS_FILLED))
-	        cni1++;
-	}
-	if (cni1 != 0)
-	{
-	    std::cerr << "[Node::intersectRayImpl] DEBUG: " 
-	        "Node before filling:" << std::endl;
-	    printImplDebugInfo(otherImpl, context, true);
-	}
-	// ----- DEBUG ----> */
-	/* <---- DEBUG ----- //
-	if (cni1 != 0)
-	{
-	    std::cerr << "[Node::intersectRayImpl] DEBUG: " 
-	        "Node after filling:" << std::endl;
-	    printImplDebugInfo(otherImpl, context, true);
-	}
-	// ----- DEBUG ----> */
-	NodeIntersectionVector niv0;
-	int n0 = getImplNumChildNodes(otherImpl);
-	for (int i = 0; i < n0; i++)
-	{
-	    NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
-	        getImplChildByValidIndex(otherImpl, i), 
-	        "Node::intersectRayImpl", "Child node implementation");
-	    if (intersectRayImpl(cn0, context, ray, ni0, t))
-	    {
-	        /* <---- DEBUG ----- //
-	        if (cni1 != 0)
-	        {
-	            std::cerr << "[Node::intersectRayImpl] DEBUG: " 
-	                "child node intersection: " << ni0.nodeImpl << " [" 
-	                << getNodeIntersectionValueString(*context, ni0) << "]"
-	                << std::endl;
-	        }
-	        // ----- DEBUG ----> */
-	        niv0.push_back(ni0);
-	    }
-	}
-	NodeIntersectionCompare cmp0;
-	std::sort(niv0.begin(), niv0.end(), cmp0);
-	// intersect nodes recursively
-	/* <---- DEBUG ----- //
-	if (cni1 != 0)
+	StaticIntersectionProcessorRef p0(processor);
+	if (isStaticNodeFilter(filter))
 	{
-	    std::cerr << "[Node::intersectRayImpl] DEBUG: " 
-	        "Node before child intersections:" << std::endl;
-	    printImplDebugInfo(otherImpl, context, true);
+	    StaticNodeFilterChain f1 = makeStaticNodeFilterChain(*filter);
+	    return intersectRayImplStatic(otherImpl, context, ray, p0, f1, 
+	        recursive, t, pcIntersection, fill0, pruneEmpty0);
 	}
-	// ----- DEBUG ----> */
-	
-	for (NodeIntersectionVector::iterator i = niv0.begin(); 
-	    i != niv0.end(); i++)
-	{
-	    NodeIntersection& ci = *i;
-	    numNodes += intersectRayImpl(ci.nodeImpl, context, ray, 
-	        processor, filter, true, t, &ci, fill0, pruneEmpty0);
-	}
-	/* <---- DEBUG ----- //
-	if (cni1 != 0)
-	{
-	    std::cerr << "[Node::intersectRayImpl] DEBUG: " 
-	        "Node before pruning:" << std::endl;
-	    printImplDebugInfo(otherImpl, context, true);
-	}
-	// ----- DEBUG ----> */
-	if (pruneEmpty0)
-	    pruneEmptyImpl(otherImpl, context);
-	/* <---- DEBUG ----- //
-	if (cni1 != 0)
-	{
-	    std::cerr << "[Node::intersectRayImpl] DEBUG: " 
-	        "Node after pruning:" << std::endl;
-	    printImplDebugInfo(otherImpl, context, true);
-	}
-	// ----- DEBUG ----> */
+	StaticFilterRef f0(filter);
+	unsigned int numNodes = intersectRayImplStatic(otherImpl, context, ray, 
+	    p0, f0, recursive, t, pcIntersection, fill0, pruneEmpty0);
 	return numNodes;
 }
 
@@ -4812,6 +4778,7 @@ bool pruneEmpty0)
 	    "Node::castRayGridImpl", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::castRayGridImpl", "Context");
+	StatsPhaseTimer timer0(STATS_PHASE_CAST_RAY_GRID);
 	unsigned int numNodes = 0;
 	Ionflux::ObjectBase::IFObject mm;
 	Ionflux::GeoUtils::Line3* ray0 = 
@@ -4835,8 +4802,11 @@ bool pruneEmpty0)
 	        ray0->setP(rayOrigin + ox + oy);
 	        if (processor != 0)
 	            processor->begin();
-	        numNodes += intersectRayImpl(otherImpl, context, *ray0, 
+	        unsigned int ni0 = intersectRayImpl(otherImpl, context, *ray0, 
 	            processor, filter, recursive, t, 0, fill0, pruneEmpty0);
+	        addStatsCount(STATS_COUNTER_RAYS_CAST);
+	        addStatsCount(STATS_COUNTER_INTERSECTIONS_PROCESSED, ni0);
+	        numNodes += ni0;
 	        if (processor != 0)
 	            processor->finish();
 	        oy.addIP(originStepY);
@@ -4858,6 +4828,7 @@ bool pruneEmpty0)
 	    "Node::castRayGridImpl", "Node implementation");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::castRayGridImpl", "Context");
+	StatsPhaseTimer timer0(STATS_PHASE_CAST_RAY_GRID);
 	int maxNumLevels = context->getMaxNumLevels();
 	if ((targetDepth < 0) 
 	    || (targetDepth >= maxNumLevels))
@@ -4910,6 +4881,7 @@ sourceMergeFilter, bool recursive, bool fill0)
 	    "Node::mergeImpl", "Node implementation (target)");
 	Ionflux::ObjectBase::nullPointerCheck(context, 
 	    "Node::mergeImpl", "Context");
+	StatsPhaseTimer timer0(STATS_PHASE_MERGE);
 	// check filters
 	if ((sourceFilter != 0) 
 	    && !NodeProcessor::checkFlags(sourceFilter->process(sourceImpl), 
@@ -5148,10 +5120,11 @@ void Node::setImpl(Ionflux::VolGfx::NodeImpl* newImpl)
 {
 	if (impl == newImpl)
 	    return;
+	bool newImplRef = false;
 	if (newImpl != 0)
 	{
 	    if ((newImpl->parent != 0) 
-	        && (newImpl->refCount < 1))
+	        && (getImplRefCount(newImpl) < 1))
 	    {
 	        /* Node implementation must have a reference from its 
 	           parent. */
@@ -5159,12 +5132,21 @@ void Node::setImpl(Ionflux::VolGfx::NodeImpl* newImpl)
 	            "node implementation that has a parent and no "
 	            "reference.", "setImpl"));
 	    }
-	    refImpl(newImpl);
+	    if ((newImpl->parent == 0) 
+	        || (context == 0) 
+	        || !context->getFrozen())
+	    {
+	        /* Nodes within a frozen tree are kept alive by their parent, 
+	           so wrappers for these nodes do not take a reference. */
+	        refImpl(newImpl);
+	        newImplRef = true;
+	    }
 	}
-	if (impl != 0)
+	if ((impl != 0) 
+	    && implRef)
 	{
 	    if ((impl->parent != 0) 
-	        && (impl->refCount < 2))
+	        && (getImplRefCount(impl) < 2))
 	    {
 	        /* Node implementation must have a reference from its 
 	           parent and this node. */
@@ -5175,6 +5157,7 @@ void Node::setImpl(Ionflux::VolGfx::NodeImpl* newImpl)
 	    unrefImpl(impl);
 	}
 	impl = newImpl;
+	implRef = newImplRef;
 }
 
 Ionflux::VolGfx::NodeImpl* Node::getImpl() const
@@ -5185,12 +5168,14 @@ Ionflux::VolGfx::NodeImpl* Node::getImpl() const
 void Node::setContext(Ionflux::VolGfx::Context* newContext)
 {
 	if (context == newContext)
-		return;
-    if (newContext != 0)
-        addLocalRef(newContext);
-	if (context != 0)
-		removeLocalRef(context);
+	    return;
+	if (newContext != 0)
+	    addLocalRef(newContext);
+	if ((context != 0) 
+	    && contextRef)
+	    removeLocalRef(context);
 	context = newContext;
+	contextRef = (newContext != 0);
 }
 
 Ionflux::VolGfx::Context* Node::getContext() const
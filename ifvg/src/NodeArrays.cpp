@@ -0,0 +1,255 @@
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * NodeArrays.cpp                  Node arrays (implementation).
+ * ========================================================================== */
+
+#include "ifvg/NodeArrays.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <iomanip>
+#include "ifobject/utils.hpp"
+#include "ifobject/objectutils.hpp"
+#include "ifvg/utils.hpp"
+#include "ifvg/IFVGError.hpp"
+#include "ifvg/Context.hpp"
+#include "ifvg/Node.hpp"
+#include "ifvg/NodeFilter.hpp"
+
+using namespace std;
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+NodeArraysClassInfo::NodeArraysClassInfo()
+{
+	name = "NodeArrays";
+	desc = "Node arrays";
+	baseClassInfo.push_back(Ionflux::ObjectBase::IFObject::CLASS_INFO);
+}
+
+NodeArraysClassInfo::~NodeArraysClassInfo()
+{
+}
+
+// run-time type information instance constants
+const NodeArraysClassInfo NodeArrays::nodeArraysClassInfo;
+const Ionflux::ObjectBase::IFClassInfo* NodeArrays::CLASS_INFO = &NodeArrays::nodeArraysClassInfo;
+
+NodeArrays::NodeArrays()
+: numBufferRefs(0)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	// TODO: Nothing ATM. ;-)
+}
+
+NodeArrays::NodeArrays(const Ionflux::VolGfx::NodeArrays& other)
+: numBufferRefs(0)
+{
+	// NOTE: The following line is required for run-time type information.
+	theClass = CLASS_INFO;
+	*this = other;
+}
+
+NodeArrays::~NodeArrays()
+{
+	// TODO: Nothing ATM. ;-)
+}
+
+unsigned int NodeArrays::appendImpl(Ionflux::VolGfx::NodeImpl* otherImpl,
+Ionflux::VolGfx::Context* context, Ionflux::VolGfx::NodeFilter* filter,
+bool recursive, int depth)
+{
+	int maxDepth = DEPTH_UNSPECIFIED;
+	if (filter != 0)
+	    maxDepth = filter->getMaxDepth();
+	if ((maxDepth != DEPTH_UNSPECIFIED)
+	    && (depth > maxDepth))
+	    return 0;
+	unsigned int numNodes = 0;
+	bool pass0 = false;
+	if (filter != 0)
+	    pass0 = filter->filter(otherImpl);
+	else
+	    pass0 = Node::isImplLeaf(otherImpl);
+	if (pass0)
+	{
+	    const NodeLoc3& l0 = otherImpl->loc;
+	    locs.push_back(static_cast<Ionflux::ObjectBase::UInt16>(
+	        l0.x.to_ulong()));
+	    locs.push_back(static_cast<Ionflux::ObjectBase::UInt16>(
+	        l0.y.to_ulong()));
+	    locs.push_back(static_cast<Ionflux::ObjectBase::UInt16>(
+	        l0.z.to_ulong()));
+	    depths.push_back(static_cast<Ionflux::ObjectBase::UInt8>(depth));
+	    voxelClasses.push_back(Node::getImplVoxelClass(otherImpl));
+	    ColorIndex c0 = COLOR_INDEX_UNSPECIFIED;
+	    if (Node::hasImplColorIndex(otherImpl))
+	        c0 = Node::getImplColorIndex(otherImpl);
+	    colorIndices.push_back(c0);
+	    numNodes++;
+	}
+	if (!recursive)
+	    return numNodes;
+	int n0 = Node::getImplNumChildNodes(otherImpl);
+	for (int i = 0; i < n0; i++)
+	{
+	    NodeImpl* cn0 = Ionflux::ObjectBase::nullPointerCheck(
+	        Node::getImplChildByValidIndex(otherImpl, i), this,
+	        "appendImpl", "Child node implementation");
+	    numNodes += appendImpl(cn0, context, filter, true, depth + 1);
+	}
+	return numNodes;
+}
+
+void NodeArrays::checkBufferRefs(const std::string& source) const
+{
+	if (numBufferRefs > 0)
+	{
+	    std::ostringstream status;
+	    status << "Data is referenced by " << numBufferRefs 
+	        << " exported buffer(s).";
+	    throw IFVGError(getErrorString(status.str(), source));
+	}
+}
+
+void NodeArrays::clear()
+{
+	checkBufferRefs("clear");
+	locs.clear();
+	depths.clear();
+	voxelClasses.clear();
+	colorIndices.clear();
+}
+
+unsigned int NodeArrays::update(Ionflux::VolGfx::Node* node,
+Ionflux::VolGfx::NodeFilter* filter, bool recursive)
+{
+	Ionflux::ObjectBase::nullPointerCheck(node, this,
+	    "update", "Node");
+	NodeImpl* ni0 = Ionflux::ObjectBase::nullPointerCheck(node->getImpl(),
+	    this, "update", "Node implementation");
+	Context* ctx = Ionflux::ObjectBase::nullPointerCheck(node->getContext(),
+	    this, "update", "Context");
+	clear();
+	unsigned int numNodes = appendImpl(ni0, ctx, filter, recursive,
+	    Node::getImplDepth(ni0, ctx));
+	return numNodes;
+}
+
+unsigned int NodeArrays::getNumNodes() const
+{
+	// TODO: Implementation.
+	return depths.size();
+}
+
+void NodeArrays::addBufferRef()
+{
+	numBufferRefs++;
+}
+
+void NodeArrays::removeBufferRef()
+{
+	if (numBufferRefs > 0)
+	    numBufferRefs--;
+}
+
+unsigned int NodeArrays::getNumBufferRefs() const
+{
+	// TODO: Implementation.
+	return numBufferRefs;
+}
+
+Ionflux::ObjectBase::UInt16* NodeArrays::getLocData()
+{
+	if (locs.size() == 0)
+	    return 0;
+	return &(locs[0]);
+}
+
+Ionflux::ObjectBase::UInt8* NodeArrays::getDepthData()
+{
+	if (depths.size() == 0)
+	    return 0;
+	return &(depths[0]);
+}
+
+Ionflux::VolGfx::VoxelClassID* NodeArrays::getVoxelClassData()
+{
+	if (voxelClasses.size() == 0)
+	    return 0;
+	return &(voxelClasses[0]);
+}
+
+Ionflux::VolGfx::ColorIndex* NodeArrays::getColorIndexData()
+{
+	if (colorIndices.size() == 0)
+	    return 0;
+	return &(colorIndices[0]);
+}
+
+std::string NodeArrays::getValueString() const
+{
+	ostringstream status;
+	status << "numNodes = " << getNumNodes();
+	return status.str();
+}
+
+Ionflux::VolGfx::NodeArrays& NodeArrays::operator=(const
+Ionflux::VolGfx::NodeArrays& other)
+{
+    if (this == &other)
+        return *this;
+    checkBufferRefs("operator=");
+    locs = other.locs;
+    depths = other.depths;
+    voxelClasses = other.voxelClasses;
+    colorIndices = other.colorIndices;
+	return *this;
+}
+
+Ionflux::VolGfx::NodeArrays* NodeArrays::copy() const
+{
+    NodeArrays* newNodeArrays = create();
+    *newNodeArrays = *this;
+    return newNodeArrays;
+}
+
+Ionflux::VolGfx::NodeArrays*
+NodeArrays::upcast(Ionflux::ObjectBase::IFObject* other)
+{
+    return dynamic_cast<NodeArrays*>(other);
+}
+
+Ionflux::VolGfx::NodeArrays*
+NodeArrays::create(Ionflux::ObjectBase::IFObject* parentObject)
+{
+    NodeArrays* newObject = new NodeArrays();
+    if (newObject == 0)
+    {
+        throw IFVGError("Could not allocate object");
+    }
+    if (parentObject != 0)
+        parentObject->addLocalRef(newObject);
+    return newObject;
+}
+
+unsigned int NodeArrays::getMemSize() const
+{
+    return sizeof *this;
+}
+
+}
+
+}
+
+/** \file NodeArrays.cpp
+ * \brief Node arrays implementation.
+ */
@@ -0,0 +1,400 @@
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * stats.cpp                     Pipeline statistics (implementation).
+ * =========================================================================
+ *
+ * This file is part of IFVG - Ionflux' Volumetric Graphics Library.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with IFVG - Ionflux' Volumetric Graphics Library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+ *
+ * ========================================================================== */
+#include <cstring>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <time.h>
+#include <pthread.h>
+#include "ifvg/stats.hpp"
+#include "ifvg/IFVGError.hpp"
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+int statsEnabledFlag = 0;
+
+namespace
+{
+
+/// Statistics record for a single thread.
+struct StatsThreadRecord
+{
+    /// Current phase.
+    StatsPhaseID currentPhase;
+    /// Nesting level for each phase.
+    int level[NUM_STATS_PHASES];
+    /// Start time of the outermost call for each phase.
+    double startTime[NUM_STATS_PHASES];
+    /// Number of calls for each phase.
+    Ionflux::ObjectBase::UInt64 numCalls[NUM_STATS_PHASES];
+    /// Accumulated time for each phase.
+    double time[NUM_STATS_PHASES];
+    /// Counters for each phase.
+    Ionflux::ObjectBase::UInt64
+        counters[NUM_STATS_PHASES][NUM_STATS_COUNTERS];
+};
+
+/// Statistics records for all threads.
+std::vector<StatsThreadRecord*> statsThreadRecords;
+
+/// Mutex for the statistics record vector.
+pthread_mutex_t statsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/// Statistics record for the current thread.
+__thread StatsThreadRecord* statsThreadRecord = 0;
+
+/// Statistics phase names.
+const char* STATS_PHASE_NAMES[NUM_STATS_PHASES] = {
+    "other",
+    "voxelizeInsertFaces",
+    "voxelizeFaces",
+    "castRayGrid",
+    "merge"
+};
+
+/// Statistics counter names.
+const char* STATS_COUNTER_NAMES[NUM_STATS_COUNTERS] = {
+    "nodesCreated",
+    "facesTested",
+    "pointTests",
+    "pointTestHits",
+    "raysCast",
+    "intersectionsProcessed",
+    "nodesPruned",
+    "bytesAllocated"
+};
+
+double getStatsTime()
+{
+    timespec t0;
+    ::clock_gettime(CLOCK_MONOTONIC, &t0);
+    return t0.tv_sec + 1e-9 * t0.tv_nsec;
+}
+
+void clearStatsThreadRecord(StatsThreadRecord& r)
+{
+    // NOTE: The current phase and nesting levels are kept.
+    for (int i = 0; i < NUM_STATS_PHASES; i++)
+    {
+        r.numCalls[i] = 0;
+        r.time[i] = 0.;
+        for (int k = 0; k < NUM_STATS_COUNTERS; k++)
+            r.counters[i][k] = 0;
+    }
+}
+
+StatsThreadRecord* getStatsThreadRecord()
+{
+    if (statsThreadRecord != 0)
+        return statsThreadRecord;
+    StatsThreadRecord* r = new StatsThreadRecord;
+    if (r == 0)
+    {
+        throw IFVGError("[getStatsThreadRecord] "
+            "Could not allocate statistics record.");
+    }
+    r->currentPhase = STATS_PHASE_OTHER;
+    for (int i = 0; i < NUM_STATS_PHASES; i++)
+    {
+        r->level[i] = 0;
+        r->startTime[i] = 0.;
+    }
+    clearStatsThreadRecord(*r);
+    /* Records are never deleted, so statistics of threads that have
+       finished remain available. */
+    pthread_mutex_lock(&statsMutex);
+    statsThreadRecords.push_back(r);
+    pthread_mutex_unlock(&statsMutex);
+    statsThreadRecord = r;
+    return r;
+}
+
+void checkStatsPhase(StatsPhaseID phase, const std::string& source)
+{
+    if ((phase < 0) || (phase >= NUM_STATS_PHASES))
+    {
+        std::ostringstream status;
+        status << "[" << source << "] Invalid phase ID: " << phase;
+        throw IFVGError(status.str());
+    }
+}
+
+void addStatsThreadRecord(const StatsThreadRecord& r, StatsPhaseID phase,
+    PhaseStats& target)
+{
+    target.numCalls += r.numCalls[phase];
+    target.time += r.time[phase];
+    const Ionflux::ObjectBase::UInt64* c0 = r.counters[phase];
+    target.nodesCreated += c0[STATS_COUNTER_NODES_CREATED];
+    target.facesTested += c0[STATS_COUNTER_FACES_TESTED];
+    target.pointTests += c0[STATS_COUNTER_POINT_TESTS];
+    target.pointTestHits += c0[STATS_COUNTER_POINT_TEST_HITS];
+    target.raysCast += c0[STATS_COUNTER_RAYS_CAST];
+    target.intersectionsProcessed +=
+        c0[STATS_COUNTER_INTERSECTIONS_PROCESSED];
+    target.nodesPruned += c0[STATS_COUNTER_NODES_PRUNED];
+    target.bytesAllocated += c0[STATS_COUNTER_BYTES_ALLOCATED];
+}
+
+void appendStatsJSON(std::ostream& target, int threadIndex,
+    const std::string& indent)
+{
+    target << "{" << std::endl;
+    for (int i = 0; i < NUM_STATS_PHASES; i++)
+    {
+        PhaseStats s0 = getStats(i, threadIndex);
+        target << indent << "    \"" << STATS_PHASE_NAMES[i] << "\": {"
+            << std::endl << indent << "        \"numCalls\": "
+            << s0.numCalls << "," << std::endl << indent
+            << "        \"time\": " << s0.time;
+        for (int k = 0; k < NUM_STATS_COUNTERS; k++)
+        {
+            target << "," << std::endl << indent << "        \""
+                << STATS_COUNTER_NAMES[k] << "\": "
+                << getStatsCounter(s0, k);
+        }
+        target << std::endl << indent << "    }";
+        if (i < (NUM_STATS_PHASES - 1))
+            target << ",";
+        target << std::endl;
+    }
+    target << indent << "}";
+}
+
+}
+
+void setStatsEnabled(bool enable)
+{
+    __atomic_store_n(&statsEnabledFlag, enable ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+bool getStatsEnabled()
+{
+    return isStatsEnabled();
+}
+
+void resetStats()
+{
+    pthread_mutex_lock(&statsMutex);
+    for (std::vector<StatsThreadRecord*>::iterator i =
+        statsThreadRecords.begin(); i != statsThreadRecords.end(); i++)
+        clearStatsThreadRecord(*(*i));
+    pthread_mutex_unlock(&statsMutex);
+}
+
+void addStatsCountImpl(Ionflux::VolGfx::StatsCounterID counter,
+    Ionflux::ObjectBase::UInt64 value)
+{
+    if ((counter < 0) || (counter >= NUM_STATS_COUNTERS))
+    {
+        std::ostringstream status;
+        status << "[addStatsCountImpl] Invalid counter ID: " << counter;
+        throw IFVGError(status.str());
+    }
+    StatsThreadRecord* r = getStatsThreadRecord();
+    r->counters[r->currentPhase][counter] += value;
+}
+
+Ionflux::VolGfx::StatsPhaseID beginStatsPhase(
+    Ionflux::VolGfx::StatsPhaseID phase)
+{
+    checkStatsPhase(phase, "beginStatsPhase");
+    StatsThreadRecord* r = getStatsThreadRecord();
+    StatsPhaseID p0 = r->currentPhase;
+    if (r->level[phase] == 0)
+    {
+        r->startTime[phase] = getStatsTime();
+        r->numCalls[phase]++;
+    }
+    r->level[phase]++;
+    r->currentPhase = phase;
+    return p0;
+}
+
+void endStatsPhase(Ionflux::VolGfx::StatsPhaseID phase,
+    Ionflux::VolGfx::StatsPhaseID previousPhase)
+{
+    checkStatsPhase(phase, "endStatsPhase");
+    StatsThreadRecord* r = getStatsThreadRecord();
+    if (r->level[phase] > 0)
+    {
+        r->level[phase]--;
+        if (r->level[phase] == 0)
+            r->time[phase] += (getStatsTime() - r->startTime[phase]);
+    }
+    r->currentPhase = previousPhase;
+}
+
+unsigned int getNumStatsThreads()
+{
+    pthread_mutex_lock(&statsMutex);
+    unsigned int n0 = statsThreadRecords.size();
+    pthread_mutex_unlock(&statsMutex);
+    return n0;
+}
+
+Ionflux::VolGfx::PhaseStats getStats(Ionflux::VolGfx::StatsPhaseID phase,
+    int threadIndex)
+{
+    checkStatsPhase(phase, "getStats");
+    PhaseStats s0;
+    std::memset(&s0, 0, sizeof(PhaseStats));
+    pthread_mutex_lock(&statsMutex);
+    unsigned int n0 = statsThreadRecords.size();
+    if (threadIndex >= static_cast<int>(n0))
+    {
+        pthread_mutex_unlock(&statsMutex);
+        std::ostringstream status;
+        status << "[getStats] Thread index out of range: " << threadIndex;
+        throw IFVGError(status.str());
+    }
+    for (unsigned int i = 0; i < n0; i++)
+    {
+        if ((threadIndex < 0)
+            || (i == static_cast<unsigned int>(threadIndex)))
+            addStatsThreadRecord(*(statsThreadRecords[i]), phase, s0);
+    }
+    pthread_mutex_unlock(&statsMutex);
+    return s0;
+}
+
+Ionflux::ObjectBase::UInt64 getStatsCounter(
+    const Ionflux::VolGfx::PhaseStats& stats,
+    Ionflux::VolGfx::StatsCounterID counter)
+{
+    if (counter == STATS_COUNTER_NODES_CREATED)
+        return stats.nodesCreated;
+    if (counter == STATS_COUNTER_FACES_TESTED)
+        return stats.facesTested;
+    if (counter == STATS_COUNTER_POINT_TESTS)
+        return stats.pointTests;
+    if (counter == STATS_COUNTER_POINT_TEST_HITS)
+        return stats.pointTestHits;
+    if (counter == STATS_COUNTER_RAYS_CAST)
+        return stats.raysCast;
+    if (counter == STATS_COUNTER_INTERSECTIONS_PROCESSED)
+        return stats.intersectionsProcessed;
+    if (counter == STATS_COUNTER_NODES_PRUNED)
+        return stats.nodesPruned;
+    if (counter == STATS_COUNTER_BYTES_ALLOCATED)
+        return stats.bytesAllocated;
+    std::ostringstream status;
+    status << "[getStatsCounter] Invalid counter ID: " << counter;
+    throw IFVGError(status.str());
+    return 0;
+}
+
+std::string getStatsPhaseName(Ionflux::VolGfx::StatsPhaseID phase)
+{
+    checkStatsPhase(phase, "getStatsPhaseName");
+    return STATS_PHASE_NAMES[phase];
+}
+
+std::string getStatsCounterName(Ionflux::VolGfx::StatsCounterID counter)
+{
+    if ((counter < 0) || (counter >= NUM_STATS_COUNTERS))
+    {
+        std::ostringstream status;
+        status << "[getStatsCounterName] Invalid counter ID: " << counter;
+        throw IFVGError(status.str());
+    }
+    return STATS_COUNTER_NAMES[counter];
+}
+
+std::string getStatsString()
+{
+    std::ostringstream status;
+    status << "Pipeline statistics (" << getNumStatsThreads()
+        << " threads):";
+    for (int i = 0; i < NUM_STATS_PHASES; i++)
+    {
+        PhaseStats s0 = getStats(i);
+        status << std::endl << "  " << STATS_PHASE_NAMES[i]
+            << ": numCalls = " << s0.numCalls << ", time = "
+            << std::setprecision(6) << s0.time << " s";
+        for (int k = 0; k < NUM_STATS_COUNTERS; k++)
+        {
+            Ionflux::ObjectBase::UInt64 c0 = getStatsCounter(s0, k);
+            if (c0 > 0)
+                status << ", " << STATS_COUNTER_NAMES[k] << " = " << c0;
+        }
+    }
+    return status.str();
+}
+
+std::string getStatsJSON(bool perThread)
+{
+    std::ostringstream status;
+    status << std::setprecision(9);
+    unsigned int n0 = getNumStatsThreads();
+    status << "{" << std::endl
+        << "    \"enabled\": " << (isStatsEnabled() ? "true" : "false")
+        << "," << std::endl
+        << "    \"numThreads\": " << n0 << "," << std::endl
+        << "    \"phases\": ";
+    appendStatsJSON(status, -1, "    ");
+    if (perThread)
+    {
+        status << "," << std::endl << "    \"threads\": [";
+        for (unsigned int i = 0; i < n0; i++)
+        {
+            if (i > 0)
+                status << ",";
+            status << std::endl << "        ";
+            appendStatsJSON(status, i, "        ");
+        }
+        status << std::endl << "    ]";
+    }
+    status << std::endl << "}" << std::endl;
+    return status.str();
+}
+
+void writeStatsJSON(const std::string& fileName, bool perThread)
+{
+    std::ofstream f0;
+    f0.open(fileName.c_str(), std::ios_base::out);
+    if (!f0)
+    {
+        std::ostringstream status;
+        status << "[writeStatsJSON] Could not open file: " << fileName;
+        throw IFVGError(status.str());
+    }
+    f0 << getStatsJSON(perThread);
+}
+
+}
+
+}
+
+/** \file stats.cpp
+ * \brief Pipeline statistics (implementation).
+ */
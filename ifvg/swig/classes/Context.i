@@ -162,6 +162,8 @@ class Context
         virtual int getMaxNumLeafChildNodesPerDimension() const;
         virtual void setScale(double newScale);
         virtual double getScale() const;
+        virtual void setFrozen(bool newFrozen);
+        virtual bool getFrozen() const;
 };
 
 }
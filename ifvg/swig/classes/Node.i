@@ -115,17 +115,20 @@ class Node
         virtual Ionflux::VolGfx::Node* getChildByValidIndex(int index) 
         const;
         virtual Ionflux::VolGfx::Node* locateChild(const 
-        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED);
+        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateChild(const 
-        Ionflux::GeoUtils::Vector3& p, int maxDepth = DEPTH_UNSPECIFIED);
+        Ionflux::GeoUtils::Vector3& p, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateRegion(const 
-        Ionflux::VolGfx::Region3& region, int maxDepth = 
-        DEPTH_UNSPECIFIED);
+        Ionflux::VolGfx::Region3& region, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateRegion(const 
-        Ionflux::GeoUtils::Range3& range, int maxDepth = 
-        DEPTH_UNSPECIFIED);
+        Ionflux::GeoUtils::Range3& range, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateNode(const 
-        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED);
+        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual int getDepth() const;
         virtual int getMaxDepth() const;
         virtual Ionflux::VolGfx::Node* insertChild(const 
@@ -184,6 +187,9 @@ class Node
         virtual unsigned int voxelizeInsertFaces(const 
         Ionflux::GeoUtils::Mesh& mesh, Ionflux::VolGfx::SeparabilityID sep,
         bool fill0 = false);
+        virtual unsigned int voxelizeInsertFaces(const
+        Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh&
+        target, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
         virtual unsigned int voxelizeFaces(Ionflux::VolGfx::NodeProcessor* 
         processor, int targetDepth, Ionflux::VolGfx::SeparabilityID sep, 
         bool fillTargetDepth = false, bool pruneEmpty0 = false, 
@@ -252,8 +258,11 @@ class Node
         true);
         static Ionflux::ObjectBase::UInt16 
         unrefImpl(Ionflux::VolGfx::NodeImpl* otherImpl);
+        static Ionflux::ObjectBase::UInt16 
+        getImplRefCount(Ionflux::VolGfx::NodeImpl* otherImpl);
         static Ionflux::VolGfx::Node* wrapImpl(Ionflux::VolGfx::NodeImpl* 
-        otherImpl, Ionflux::VolGfx::Context* context);
+        otherImpl, Ionflux::VolGfx::Context* context, Ionflux::VolGfx::Node* 
+        target = 0);
         static void setImplParent(Ionflux::VolGfx::NodeImpl* otherImpl);
         static void updateImpl(Ionflux::VolGfx::NodeImpl* otherImpl, 
         Ionflux::VolGfx::Context* context);
@@ -460,6 +469,11 @@ class Node
         voxelizeImplInsertFaces(Ionflux::VolGfx::NodeImpl* otherImpl, 
         Ionflux::VolGfx::Context* context, const Ionflux::GeoUtils::Mesh& 
         mesh, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
+        static unsigned int
+        voxelizeImplInsertFaces(Ionflux::VolGfx::NodeImpl* otherImpl,
+        Ionflux::VolGfx::Context* context, const
+        Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh&
+        target, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
         static unsigned int voxelizeImplFaces(Ionflux::VolGfx::NodeImpl* 
         otherImpl, Ionflux::VolGfx::Context* context, 
         Ionflux::VolGfx::NodeProcessor* processor, int targetDepth, 
@@ -0,0 +1,56 @@
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * NodeArrays.i                    Node arrays (interface).
+ * ========================================================================== */
+%{
+#include "ifvg/NodeArrays.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+class Node;
+class NodeFilter;
+class Context;
+
+class NodeArraysClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        NodeArraysClassInfo();
+        virtual ~NodeArraysClassInfo();
+};
+
+class NodeArrays
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        NodeArrays();
+		NodeArrays(const Ionflux::VolGfx::NodeArrays& other);
+        virtual ~NodeArrays();
+        virtual void clear();
+        virtual unsigned int update(Ionflux::VolGfx::Node* node, 
+        Ionflux::VolGfx::NodeFilter* filter = 0, bool recursive = true);
+        virtual unsigned int getNumNodes() const;
+        virtual void addBufferRef();
+        virtual void removeBufferRef();
+        virtual unsigned int getNumBufferRefs() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::VolGfx::NodeArrays* copy() const;
+		static Ionflux::VolGfx::NodeArrays* 
+		upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::VolGfx::NodeArrays* 
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
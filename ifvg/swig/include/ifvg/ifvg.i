@@ -200,6 +200,23 @@ struct VoxelDataIOB
 typedef Ionflux::ObjectBase::UInt8 LeafStatusID;
 typedef Ionflux::ObjectBase::UInt8 MergePolicyID;
 
+typedef int StatsPhaseID;
+typedef int StatsCounterID;
+
+struct PhaseStats
+{
+    Ionflux::ObjectBase::UInt64 numCalls;
+    double time;
+    Ionflux::ObjectBase::UInt64 nodesCreated;
+    Ionflux::ObjectBase::UInt64 facesTested;
+    Ionflux::ObjectBase::UInt64 pointTests;
+    Ionflux::ObjectBase::UInt64 pointTestHits;
+    Ionflux::ObjectBase::UInt64 raysCast;
+    Ionflux::ObjectBase::UInt64 intersectionsProcessed;
+    Ionflux::ObjectBase::UInt64 nodesPruned;
+    Ionflux::ObjectBase::UInt64 bytesAllocated;
+};
+
 struct NodeIntersectionProcessingFlags
 {
     bool directionBackward;
@@ -252,6 +269,24 @@ const Ionflux::VolGfx::LeafStatusID NODE_NON_LEAF = 2;
 const Ionflux::VolGfx::MergePolicyID MERGE_POLICY_KEEP_TARGET = 0;
 const Ionflux::VolGfx::MergePolicyID MERGE_POLICY_TAKE_OVER_SOURCE = 1;
 
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_OTHER = 0;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_VOXELIZE_INSERT_FACES = 1;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_VOXELIZE_FACES = 2;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_CAST_RAY_GRID = 3;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_MERGE = 4;
+const int NUM_STATS_PHASES = 5;
+
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_NODES_CREATED = 0;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_FACES_TESTED = 1;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_POINT_TESTS = 2;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_POINT_TEST_HITS = 3;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_RAYS_CAST = 4;
+const Ionflux::VolGfx::StatsCounterID 
+    STATS_COUNTER_INTERSECTIONS_PROCESSED = 5;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_NODES_PRUNED = 6;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_BYTES_ALLOCATED = 7;
+const int NUM_STATS_COUNTERS = 8;
+
 // utils.hpp
 
 Ionflux::VolGfx::NodeLoc3 createLoc(Ionflux::VolGfx::NodeLoc x, 
@@ -423,6 +458,23 @@ Ionflux::ObjectBase::DataSize unpack(const std::string& source,
     Ionflux::VolGfx::VoxelDataIOB& target, 
     Ionflux::ObjectBase::DataSize offset = 0);
 
+// stats.hpp
+
+void setStatsEnabled(bool enable = true);
+bool getStatsEnabled();
+void resetStats();
+unsigned int getNumStatsThreads();
+Ionflux::VolGfx::PhaseStats getStats(Ionflux::VolGfx::StatsPhaseID phase, 
+    int threadIndex = -1);
+Ionflux::ObjectBase::UInt64 getStatsCounter(
+    const Ionflux::VolGfx::PhaseStats& stats, 
+    Ionflux::VolGfx::StatsCounterID counter);
+std::string getStatsPhaseName(Ionflux::VolGfx::StatsPhaseID phase);
+std::string getStatsCounterName(Ionflux::VolGfx::StatsCounterID counter);
+std::string getStatsString();
+std::string getStatsJSON(bool perThread = false);
+void writeStatsJSON(const std::string& fileName, bool perThread = false);
+
 }
 
 }
@@ -587,6 +639,8 @@ class Context
         virtual int getMaxNumLeafChildNodesPerDimension() const;
         virtual void setScale(double newScale);
         virtual double getScale() const;
+        virtual void setFrozen(bool newFrozen);
+        virtual bool getFrozen() const;
 };
 
 }
@@ -753,17 +807,20 @@ class Node
         virtual Ionflux::VolGfx::Node* getChildByValidIndex(int index) 
         const;
         virtual Ionflux::VolGfx::Node* locateChild(const 
-        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED);
+        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateChild(const 
-        Ionflux::GeoUtils::Vector3& p, int maxDepth = DEPTH_UNSPECIFIED);
+        Ionflux::GeoUtils::Vector3& p, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateRegion(const 
-        Ionflux::VolGfx::Region3& region, int maxDepth = 
-        DEPTH_UNSPECIFIED);
+        Ionflux::VolGfx::Region3& region, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateRegion(const 
-        Ionflux::GeoUtils::Range3& range, int maxDepth = 
-        DEPTH_UNSPECIFIED);
+        Ionflux::GeoUtils::Range3& range, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual Ionflux::VolGfx::Node* locateNode(const 
-        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED);
+        Ionflux::VolGfx::NodeLoc3& loc, int maxDepth = DEPTH_UNSPECIFIED, 
+        Ionflux::VolGfx::Node* target = 0);
         virtual int getDepth() const;
         virtual int getMaxDepth() const;
         virtual Ionflux::VolGfx::Node* insertChild(const 
@@ -822,6 +879,9 @@ class Node
         virtual unsigned int voxelizeInsertFaces(const 
         Ionflux::GeoUtils::Mesh& mesh, Ionflux::VolGfx::SeparabilityID sep,
         bool fill0 = false);
+        virtual unsigned int voxelizeInsertFaces(const
+        Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh&
+        target, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
         virtual unsigned int voxelizeFaces(Ionflux::VolGfx::NodeProcessor* 
         processor, int targetDepth, Ionflux::VolGfx::SeparabilityID sep, 
         bool fillTargetDepth = false, bool pruneEmpty0 = false, 
@@ -890,8 +950,11 @@ class Node
         true);
         static Ionflux::ObjectBase::UInt16 
         unrefImpl(Ionflux::VolGfx::NodeImpl* otherImpl);
+        static Ionflux::ObjectBase::UInt16 
+        getImplRefCount(Ionflux::VolGfx::NodeImpl* otherImpl);
         static Ionflux::VolGfx::Node* wrapImpl(Ionflux::VolGfx::NodeImpl* 
-        otherImpl, Ionflux::VolGfx::Context* context);
+        otherImpl, Ionflux::VolGfx::Context* context, Ionflux::VolGfx::Node* 
+        target = 0);
         static void setImplParent(Ionflux::VolGfx::NodeImpl* otherImpl);
         static void updateImpl(Ionflux::VolGfx::NodeImpl* otherImpl, 
         Ionflux::VolGfx::Context* context);
@@ -1098,6 +1161,11 @@ class Node
         voxelizeImplInsertFaces(Ionflux::VolGfx::NodeImpl* otherImpl, 
         Ionflux::VolGfx::Context* context, const Ionflux::GeoUtils::Mesh& 
         mesh, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
+        static unsigned int
+        voxelizeImplInsertFaces(Ionflux::VolGfx::NodeImpl* otherImpl,
+        Ionflux::VolGfx::Context* context, const
+        Ionflux::GeoUtils::CompactMesh& mesh, Ionflux::GeoUtils::Mesh&
+        target, Ionflux::VolGfx::SeparabilityID sep, bool fill0 = false);
         static unsigned int voxelizeImplFaces(Ionflux::VolGfx::NodeImpl* 
         otherImpl, Ionflux::VolGfx::Context* context, 
         Ionflux::VolGfx::NodeProcessor* processor, int targetDepth, 
@@ -1289,6 +1357,57 @@ class NodeSet
 }
 
 
+%{
+#include "ifvg/NodeArrays.hpp"
+%}
+
+namespace Ionflux
+{
+
+namespace VolGfx
+{
+
+class Node;
+class NodeFilter;
+class Context;
+
+class NodeArraysClassInfo
+: public Ionflux::ObjectBase::IFClassInfo
+{
+    public:
+        NodeArraysClassInfo();
+        virtual ~NodeArraysClassInfo();
+};
+
+class NodeArrays
+: public Ionflux::ObjectBase::IFObject
+{
+    public:
+        
+        NodeArrays();
+		NodeArrays(const Ionflux::VolGfx::NodeArrays& other);
+        virtual ~NodeArrays();
+        virtual void clear();
+        virtual unsigned int update(Ionflux::VolGfx::Node* node, 
+        Ionflux::VolGfx::NodeFilter* filter = 0, bool recursive = true);
+        virtual unsigned int getNumNodes() const;
+        virtual void addBufferRef();
+        virtual void removeBufferRef();
+        virtual unsigned int getNumBufferRefs() const;
+        virtual std::string getValueString() const;
+		virtual Ionflux::VolGfx::NodeArrays* copy() const;
+		static Ionflux::VolGfx::NodeArrays* 
+		upcast(Ionflux::ObjectBase::IFObject* other);
+		static Ionflux::VolGfx::NodeArrays* 
+		create(Ionflux::ObjectBase::IFObject* parentObject = 0);
+		virtual unsigned int getMemSize() const;
+};
+
+}
+
+}
+
+
 %{
 #include "ifvg/Mesh.hpp"
 %}
@@ -1966,3 +2085,64 @@ class NodeIOBWallThicknessProcessor
 %template(VoxelClassColorVector) 
     std::vector<Ionflux::VolGfx::VoxelClassColor>;
 
+// Buffer access
+
+%include "geoutils/buffer.i"
+
+%buffer_exporter(IFVG, Ionflux::VolGfx::NodeArrays, SWIGTYPE_p_Ionflux__VolGfx__NodeArrays, "NodeArrays", "CIFVG.Buffer", 0)
+
+%{
+PyObject* getNodeArraysLocBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getLocData(), 
+        na0->getNumNodes(), 3, sizeof(Ionflux::ObjectBase::UInt16), "H");
+}
+
+PyObject* getNodeArraysDepthBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getDepthData(), 
+        na0->getNumNodes(), 1, sizeof(Ionflux::ObjectBase::UInt8), "B");
+}
+
+PyObject* getNodeArraysVoxelClassBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getVoxelClassData(), 
+        na0->getNumNodes(), 1, sizeof(Ionflux::VolGfx::VoxelClassID), "B");
+}
+
+PyObject* getNodeArraysColorIndexBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getColorIndexData(), 
+        na0->getNumNodes(), 1, sizeof(Ionflux::VolGfx::ColorIndex), "h");
+}
+%}
+
+PyObject* getNodeArraysLocBuffer(PyObject* nodeArrays);
+PyObject* getNodeArraysDepthBuffer(PyObject* nodeArrays);
+PyObject* getNodeArraysVoxelClassBuffer(PyObject* nodeArrays);
+PyObject* getNodeArraysColorIndexBuffer(PyObject* nodeArrays);
+
+%extend Ionflux::VolGfx::NodeArrays {
+%pythoncode %{
+    def getLocBuffer(self):
+        return getNodeArraysLocBuffer(self)
+    def getDepthBuffer(self):
+        return getNodeArraysDepthBuffer(self)
+    def getVoxelClassBuffer(self):
+        return getNodeArraysVoxelClassBuffer(self)
+    def getColorIndexBuffer(self):
+        return getNodeArraysColorIndexBuffer(self)
+%}
+}
@@ -200,6 +200,23 @@ struct VoxelDataIOB
 typedef Ionflux::ObjectBase::UInt8 LeafStatusID;
 typedef Ionflux::ObjectBase::UInt8 MergePolicyID;
 
+typedef int StatsPhaseID;
+typedef int StatsCounterID;
+
+struct PhaseStats
+{
+    Ionflux::ObjectBase::UInt64 numCalls;
+    double time;
+    Ionflux::ObjectBase::UInt64 nodesCreated;
+    Ionflux::ObjectBase::UInt64 facesTested;
+    Ionflux::ObjectBase::UInt64 pointTests;
+    Ionflux::ObjectBase::UInt64 pointTestHits;
+    Ionflux::ObjectBase::UInt64 raysCast;
+    Ionflux::ObjectBase::UInt64 intersectionsProcessed;
+    Ionflux::ObjectBase::UInt64 nodesPruned;
+    Ionflux::ObjectBase::UInt64 bytesAllocated;
+};
+
 struct NodeIntersectionProcessingFlags
 {
     bool directionBackward;
@@ -252,6 +269,24 @@ const Ionflux::VolGfx::LeafStatusID NODE_NON_LEAF = 2;
 const Ionflux::VolGfx::MergePolicyID MERGE_POLICY_KEEP_TARGET = 0;
 const Ionflux::VolGfx::MergePolicyID MERGE_POLICY_TAKE_OVER_SOURCE = 1;
 
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_OTHER = 0;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_VOXELIZE_INSERT_FACES = 1;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_VOXELIZE_FACES = 2;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_CAST_RAY_GRID = 3;
+const Ionflux::VolGfx::StatsPhaseID STATS_PHASE_MERGE = 4;
+const int NUM_STATS_PHASES = 5;
+
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_NODES_CREATED = 0;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_FACES_TESTED = 1;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_POINT_TESTS = 2;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_POINT_TEST_HITS = 3;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_RAYS_CAST = 4;
+const Ionflux::VolGfx::StatsCounterID 
+    STATS_COUNTER_INTERSECTIONS_PROCESSED = 5;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_NODES_PRUNED = 6;
+const Ionflux::VolGfx::StatsCounterID STATS_COUNTER_BYTES_ALLOCATED = 7;
+const int NUM_STATS_COUNTERS = 8;
+
 // utils.hpp
 
 Ionflux::VolGfx::NodeLoc3 createLoc(Ionflux::VolGfx::NodeLoc x, 
@@ -423,6 +458,23 @@ Ionflux::ObjectBase::DataSize unpack(const std::string& source,
     Ionflux::VolGfx::VoxelDataIOB& target, 
     Ionflux::ObjectBase::DataSize offset = 0);
 
+// stats.hpp
+
+void setStatsEnabled(bool enable = true);
+bool getStatsEnabled();
+void resetStats();
+unsigned int getNumStatsThreads();
+Ionflux::VolGfx::PhaseStats getStats(Ionflux::VolGfx::StatsPhaseID phase, 
+    int threadIndex = -1);
+Ionflux::ObjectBase::UInt64 getStatsCounter(
+    const Ionflux::VolGfx::PhaseStats& stats, 
+    Ionflux::VolGfx::StatsCounterID counter);
+std::string getStatsPhaseName(Ionflux::VolGfx::StatsPhaseID phase);
+std::string getStatsCounterName(Ionflux::VolGfx::StatsCounterID counter);
+std::string getStatsString();
+std::string getStatsJSON(bool perThread = false);
+void writeStatsJSON(const std::string& fileName, bool perThread = false);
+
 }
 
 }
@@ -433,6 +485,7 @@ $Context
 $IOContext
 $Node
 $NodeSet
+$NodeArrays
 $Mesh
 $NodeProcessor
 $ChainableNodeProcessor
@@ -453,3 +506,64 @@ $NodeIOBWallThicknessProcessor
 %template(VoxelClassColorVector) 
     std::vector<Ionflux::VolGfx::VoxelClassColor>;
 
+// Buffer access
+
+%include "geoutils/buffer.i"
+
+%buffer_exporter(IFVG, Ionflux::VolGfx::NodeArrays, SWIGTYPE_p_Ionflux__VolGfx__NodeArrays, "NodeArrays", "CIFVG.Buffer", 0)
+
+%{
+PyObject* getNodeArraysLocBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getLocData(), 
+        na0->getNumNodes(), 3, sizeof(Ionflux::ObjectBase::UInt16), "H");
+}
+
+PyObject* getNodeArraysDepthBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getDepthData(), 
+        na0->getNumNodes(), 1, sizeof(Ionflux::ObjectBase::UInt8), "B");
+}
+
+PyObject* getNodeArraysVoxelClassBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getVoxelClassData(), 
+        na0->getNumNodes(), 1, sizeof(Ionflux::VolGfx::VoxelClassID), "B");
+}
+
+PyObject* getNodeArraysColorIndexBuffer(PyObject* nodeArrays)
+{
+    Ionflux::VolGfx::NodeArrays* na0 = getIFVGBufferOwner(nodeArrays);
+    if (na0 == 0)
+        return 0;
+    return createIFVGBuffer(nodeArrays, na0, na0->getColorIndexData(), 
+        na0->getNumNodes(), 1, sizeof(Ionflux::VolGfx::ColorIndex), "h");
+}
+%}
+
+PyObject* getNodeArraysLocBuffer(PyObject* nodeArrays);
+PyObject* getNodeArraysDepthBuffer(PyObject* nodeArrays);
+PyObject* getNodeArraysVoxelClassBuffer(PyObject* nodeArrays);
+PyObject* getNodeArraysColorIndexBuffer(PyObject* nodeArrays);
+
+%extend Ionflux::VolGfx::NodeArrays {
+%pythoncode %{
+    def getLocBuffer(self):
+        return getNodeArraysLocBuffer(self)
+    def getDepthBuffer(self):
+        return getNodeArraysDepthBuffer(self)
+    def getVoxelClassBuffer(self):
+        return getNodeArraysVoxelClassBuffer(self)
+    def getColorIndexBuffer(self):
+        return getNodeArraysColorIndexBuffer(self)
+%}
+}
@@ -0,0 +1,281 @@
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * test_concurrency_01.cpp         IFVG test: Concurrent node tree queries.
+ * ==========================================================================
+ *
+ * This file is part of IFVG - Ionflux' Volumetric Graphics Library.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with IFVG - Ionflux' Volumetric Graphics Library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+
+ * ========================================================================== */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <pthread.h>
+#include "ifobject/utils.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Line3.hpp"
+#include "ifvg/utils.hpp"
+#include "ifvg/Context.hpp"
+#include "ifvg/Node.hpp"
+#include "ifvg/IFVGError.hpp"
+
+using namespace Ionflux::VolGfx;
+
+// Name of the test.
+const std::string TEST_NAME = "IFVG test: Concurrent node tree queries";
+
+// Number of worker threads.
+const unsigned int NUM_THREADS = 16;
+// Number of iterations per thread.
+const unsigned int NUM_ITERATIONS = 20000;
+// Number of rays.
+const unsigned int NUM_RAYS = 64;
+
+// Worker thread data.
+struct WorkerData
+{
+    // Root node.
+    Node* root;
+    // Voxel tree context.
+    Context* context;
+    // Fill depth of the tree.
+    int fillDepth;
+    // Rays.
+    std::vector<Ionflux::GeoUtils::Line3*>* rays;
+    // Expected number of intersected nodes for each ray.
+    std::vector<unsigned int>* expectedHits;
+    // Random seed.
+    unsigned int seed;
+    // Number of errors.
+    unsigned int numErrors;
+    // Error message.
+    std::string error;
+};
+
+double randomCoord(unsigned int& seed, double scale)
+{
+    // Stay clear of the boundary of the root node.
+    return (0.01 + 0.98 * rand_r(&seed) / RAND_MAX) * scale;
+}
+
+void* runQueries(void* arg)
+{
+    WorkerData* wd = static_cast<WorkerData*>(arg);
+    Node* root = wd->root;
+    Context* ctx = wd->context;
+    NodeImpl* rootImpl = root->getImpl();
+    double s0 = ctx->getScale();
+    unsigned int numRays = wd->rays->size();
+    /* Node wrappers take references to the shared context unless the
+       tree is frozen. */
+    bool frozen = ctx->getFrozen();
+    Node* w0 = 0;
+    try
+    {
+        for (unsigned int i = 0; i < NUM_ITERATIONS; i++)
+        {
+            Ionflux::GeoUtils::Vector3 p(randomCoord(wd->seed, s0),
+                randomCoord(wd->seed, s0), randomCoord(wd->seed, s0));
+            // Locate via node implementation.
+            NodeImpl* ni0 = Node::locateImplChild(rootImpl, ctx, p);
+            if ((ni0 == 0)
+                || (Node::getImplDepth(ni0, ctx) != wd->fillDepth))
+                wd->numErrors++;
+            if (frozen)
+            {
+                // Locate via node wrapper.
+                Node* n0 = root->locateChild(p);
+                if ((n0 == 0)
+                    || (n0->getImpl() != ni0))
+                    wd->numErrors++;
+                if (n0 != 0)
+                    delete n0;
+                // Locate via reused node wrapper.
+                Node* n1 = root->locateChild(p, DEPTH_UNSPECIFIED, w0);
+                if ((n1 == 0)
+                    || (n1->getImpl() != ni0))
+                    wd->numErrors++;
+                else
+                if (w0 == 0)
+                    w0 = n1;
+                else
+                if (n1 != w0)
+                    wd->numErrors++;
+            }
+            // Intersect ray.
+            unsigned int k = i % numRays;
+            unsigned int numHits = root->intersectRay(*((*wd->rays)[k]));
+            if (numHits != (*wd->expectedHits)[k])
+                wd->numErrors++;
+        }
+    } catch (IFVGError& e)
+    {
+        wd->numErrors++;
+        wd->error = e.what();
+    }
+    if (w0 != 0)
+        delete w0;
+    return 0;
+}
+
+unsigned int runWorkers(Node* root, Context* ctx, int fillDepth,
+    std::vector<Ionflux::GeoUtils::Line3*>& rays,
+    std::vector<unsigned int>& expectedHits)
+{
+    pthread_t threads[NUM_THREADS];
+    WorkerData data[NUM_THREADS];
+    for (unsigned int i = 0; i < NUM_THREADS; i++)
+    {
+        WorkerData& wd = data[i];
+        wd.root = root;
+        wd.context = ctx;
+        wd.fillDepth = fillDepth;
+        wd.rays = &rays;
+        wd.expectedHits = &expectedHits;
+        wd.seed = 1000 + i;
+        wd.numErrors = 0;
+        if (pthread_create(&(threads[i]), 0, runQueries, &wd) != 0)
+            throw IFVGError("Could not create worker thread.");
+    }
+    unsigned int numErrors = 0;
+    for (unsigned int i = 0; i < NUM_THREADS; i++)
+    {
+        pthread_join(threads[i], 0);
+        numErrors += data[i].numErrors;
+        if (data[i].error.size() > 0)
+            std::cout << "    Thread #" << i << ": " << data[i].error
+                << std::endl;
+    }
+    return numErrors;
+}
+
+unsigned int checkRefCounts(Node* root)
+{
+    // After all wrappers are gone, each child is referenced by its parent.
+    unsigned int numErrors = 0;
+    NodeImplVector niv;
+    Node::findImpl(root->getImpl(), root->getContext(), &niv);
+    for (NodeImplVector::iterator i = niv.begin(); i != niv.end(); i++)
+    {
+        NodeImpl* ni = *i;
+        if ((ni->parent != 0)
+            && (Node::getImplRefCount(ni) != 1))
+            numErrors++;
+    }
+    return numErrors;
+}
+
+int main(int argc, char* argv[])
+{
+    std::cout << "IFVG test: " << TEST_NAME << std::endl;
+    // memory management
+    Ionflux::ObjectBase::IFObject mm;
+
+    std::cout << "  Creating context..." << std::endl;
+
+    const unsigned int octreeMaxNumLevels = 7;
+    const unsigned int octreeOrder = 2;
+    const double octreeScale = 4.;
+    const int fillDepth = 4;
+
+    Context* ctx = Context::create(octreeMaxNumLevels,
+        octreeOrder, octreeScale);
+    mm.addLocalRef(ctx);
+
+    std::cout << "  Creating node tree..." << std::endl;
+
+    Node* root0 = Node::create(ctx);
+    mm.addLocalRef(root0);
+    root0->fill(false, true, fillDepth);
+
+    std::cout << "  Creating rays..." << std::endl;
+
+    std::vector<Ionflux::GeoUtils::Line3*> rays;
+    std::vector<unsigned int> expectedHits;
+    unsigned int seed = 42;
+    for (unsigned int i = 0; i < NUM_RAYS; i++)
+    {
+        Ionflux::GeoUtils::Vector3 p0(randomCoord(seed, octreeScale),
+            randomCoord(seed, octreeScale), -1.);
+        Ionflux::GeoUtils::Vector3 p1(randomCoord(seed, octreeScale),
+            randomCoord(seed, octreeScale), octreeScale + 1.);
+        Ionflux::GeoUtils::Line3* r0 = Ionflux::GeoUtils::Line3::create(
+            p0, (p1 - p0).normalize());
+        mm.addLocalRef(r0);
+        rays.push_back(r0);
+        expectedHits.push_back(root0->intersectRay(*r0));
+    }
+
+    unsigned int numErrors = 0;
+
+    std::cout << "  Running concurrent queries (mutable tree, "
+        << NUM_THREADS << " threads)..." << std::endl;
+
+    unsigned int e0 = runWorkers(root0, ctx, fillDepth, rays,
+        expectedHits);
+    unsigned int e1 = checkRefCounts(root0);
+    std::cout << "    query errors: " << e0
+        << ", reference count errors: " << e1 << std::endl;
+    numErrors += e0 + e1;
+
+    std::cout << "  Running concurrent queries (frozen tree, "
+        << NUM_THREADS << " threads)..." << std::endl;
+
+    ctx->setFrozen(true);
+    e0 = runWorkers(root0, ctx, fillDepth, rays, expectedHits);
+    e1 = checkRefCounts(root0);
+    std::cout << "    query errors: " << e0
+        << ", reference count errors: " << e1 << std::endl;
+    numErrors += e0 + e1;
+
+    std::cout << "  Checking modification of frozen tree..." << std::endl;
+
+    bool caught = false;
+    try
+    {
+        root0->fill(true, true, fillDepth + 1);
+    } catch (IFVGError& e)
+    {
+        caught = true;
+    }
+    if (!caught)
+    {
+        std::cout << "    Frozen tree was modified." << std::endl;
+        numErrors++;
+    }
+    ctx->setFrozen(false);
+
+    if (numErrors > 0)
+    {
+        std::cout << "Test failed (" << numErrors << " errors)!"
+            << std::endl;
+        return 1;
+    }
+
+	std::cout << "All done!" << std::endl;
+	return 0;
+}
+
+/** \file test_concurrency_01.cpp
+ * \brief IFVG test: Concurrent node tree queries.
+ */
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""IFVG test: Node arrays #1."""
+import IFObjectBase as ib
+import CGeoUtils as cg
+import CIFVG as vg
+import numpy as np
+
+testName = "Node arrays #1"
+
+# memory management
+mm = ib.IFObject()
+
+print("IFVG test: %s" % testName)
+
+maxNumLevels = 6
+order = 2
+scale = 4.
+fillDepth = 4
+
+print("Creating context...")
+
+ctx = vg.Context.create(maxNumLevels, order, scale)
+mm.addLocalRef(ctx)
+
+print("Creating node tree...")
+
+root0 = vg.Node.create(ctx)
+mm.addLocalRef(root0)
+root0.fill(False, True, fillDepth)
+root0.setVoxelClass0(vg.VOXEL_CLASS_FILLED, True, None, True, 
+    vg.Node.DATA_TYPE_VOXEL_CLASS)
+
+print("Exporting leaf nodes...")
+
+na0 = vg.NodeArrays.create()
+mm.addLocalRef(na0)
+
+clock0 = cg.Clock()
+clock0.start()
+numNodes = na0.update(root0)
+clock0.stop()
+
+t0 = clock0.getElapsedTime()
+
+print("  %d nodes exported in %f secs" % (numNodes, t0))
+
+locs = np.asarray(na0.getLocBuffer())
+depths = np.asarray(na0.getDepthBuffer())
+voxelClasses = np.asarray(na0.getVoxelClassBuffer())
+colorIndices = np.asarray(na0.getColorIndexBuffer())
+
+n0 = ctx.getMaxNumLeafChildNodesPerNode()
+numLeafs = n0 ** fillDepth
+
+numErrors = 0
+if (numNodes != numLeafs):
+    print("  Unexpected number of nodes: %d (expected %d)" 
+        % (numNodes, numLeafs))
+    numErrors += 1
+if (locs.shape != (numNodes, 3)):
+    print("  Unexpected location code array shape: %s" % str(locs.shape))
+    numErrors += 1
+if (np.any(depths != fillDepth)):
+    print("  Unexpected depths: %s" % str(np.unique(depths)))
+    numErrors += 1
+if (np.any((voxelClasses & vg.VOXEL_CLASS_FILLED) == 0)):
+    print("  Unexpected voxel classes: %s" % str(np.unique(voxelClasses)))
+    numErrors += 1
+if (np.any(colorIndices != vg.COLOR_INDEX_UNSPECIFIED)):
+    print("  Unexpected color indices: %s" % str(np.unique(colorIndices)))
+    numErrors += 1
+# leaf location codes must be unique
+lu0 = np.unique(locs, axis = 0)
+if (lu0.shape[0] != numNodes):
+    print("  Location codes are not unique.")
+    numErrors += 1
+
+print("Checking zero-copy access...")
+
+# writes through the buffer are visible in subsequent reads
+colorIndices[0] = 7
+ci1 = np.asarray(na0.getColorIndexBuffer())
+if (ci1[0] != 7):
+    print("  Buffer does not refer to array data.")
+    numErrors += 1
+
+if (numErrors > 0):
+    print("Test failed (%d errors)!" % numErrors)
+else:
+    print("All done!")
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""IFVG test: Node arrays #2."""
+import gc
+import IFObjectBase as ib
+import CIFVG as vg
+import numpy as np
+
+testName = "Node arrays #2"
+
+# memory management
+mm = ib.IFObject()
+
+print("IFVG test: %s" % testName)
+
+maxNumLevels = 6
+order = 2
+scale = 4.
+fillDepth = 3
+
+print("Creating node tree...")
+
+ctx = vg.Context.create(maxNumLevels, order, scale)
+mm.addLocalRef(ctx)
+
+root0 = vg.Node.create(ctx)
+mm.addLocalRef(root0)
+root0.fill(False, True, fillDepth)
+
+numErrors = 0
+
+print("Checking buffer lifetime...")
+
+na0 = vg.NodeArrays.create()
+mm.addLocalRef(na0)
+numNodes = na0.update(root0)
+locs = np.asarray(na0.getLocBuffer())
+depths = na0.getDepthBuffer()
+if (na0.getNumBufferRefs() != 2):
+    print("  Unexpected number of buffer references: %d" 
+        % na0.getNumBufferRefs())
+    numErrors += 1
+
+# the arrays must not be reallocated while a buffer refers to them
+try:
+    na0.update(root0)
+    print("  Arrays updated while referenced by a buffer.")
+    numErrors += 1
+except RuntimeError:
+    pass
+try:
+    na0.clear()
+    print("  Arrays cleared while referenced by a buffer.")
+    numErrors += 1
+except RuntimeError:
+    pass
+if (na0.getNumNodes() != numNodes):
+    print("  Arrays modified while referenced by a buffer.")
+    numErrors += 1
+
+del locs
+del depths
+gc.collect()
+if (na0.getNumBufferRefs() != 0):
+    print("  Buffer references not released: %d" % na0.getNumBufferRefs())
+    numErrors += 1
+if (na0.update(root0) != numNodes):
+    print("  Arrays could not be updated after the buffers were released.")
+    numErrors += 1
+
+# the buffer keeps its owner alive
+mm1 = ib.IFObject()
+na1 = vg.NodeArrays.create()
+mm1.addLocalRef(na1)
+na1.update(root0)
+locs = np.asarray(na1.getLocBuffer())
+locs0 = locs.copy()
+mm1.removeLocalRef(na1)
+del na1
+gc.collect()
+if (not np.array_equal(locs, locs0)):
+    print("  Buffer data changed after the owner was released.")
+    numErrors += 1
+del locs
+gc.collect()
+
+if (numErrors > 0):
+    print("Test failed (%d errors)!" % numErrors)
+else:
+    print("All done!")
@@ -0,0 +1,249 @@
+/* ==========================================================================
+ * IFVG - Ionflux' Volumetric Graphics Library
+ * Copyright © 2014 Jörn P. Meier
+ * mail@ionflux.org
+ * --------------------------------------------------------------------------
+ * test_static_processors_01.cpp   IFVG test: Static node processors.
+ * ==========================================================================
+ *
+ * This file is part of IFVG - Ionflux' Volumetric Graphics Library.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is free software; you can
+ * redistribute it and/or modify it under the terms of the GNU General
+ * Public License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * IFVG - Ionflux' Volumetric Graphics Library is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with IFVG - Ionflux' Volumetric Graphics Library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307 USA
+
+ * ========================================================================== */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "ifobject/utils.hpp"
+#include "geoutils/Vector3.hpp"
+#include "geoutils/Line3.hpp"
+#include "ifvg/utils.hpp"
+#include "ifvg/Context.hpp"
+#include "ifvg/Node.hpp"
+#include "ifvg/NodeProcessor.hpp"
+#include "ifvg/NodeFilter.hpp"
+#include "ifvg/staticprocessors.hpp"
+#include "ifvg/IFVGError.hpp"
+
+using namespace Ionflux::VolGfx;
+
+// Name of the test.
+const std::string TEST_NAME = "IFVG test: Static node processors";
+
+// Number of rays.
+const unsigned int NUM_RAYS = 32;
+
+// Node processor that finishes processing for leaf nodes.
+class LeafStop
+: public NodeProcessor
+{
+    public:
+        // Number of nodes processed.
+        unsigned int numNodes;
+
+        LeafStop()
+        : numNodes(0)
+        { }
+
+    protected:
+        NodeProcessingResultID processImpl(NodeImpl* nodeImpl,
+            void* userData = 0)
+        {
+            numNodes++;
+            if (Node::getImplLeafStatus(nodeImpl) == NODE_LEAF)
+                return RESULT_OK | ChainableNodeProcessor::RESULT_FINISHED;
+            return RESULT_OK;
+        }
+};
+
+// Static processor that checks the depth passed by the traversal.
+struct DepthCheck
+{
+    // Voxel tree context.
+    Context* context;
+    // Number of nodes processed.
+    unsigned int numNodes;
+    // Number of errors.
+    unsigned int numErrors;
+
+    DepthCheck(Context* initContext = 0)
+    : context(initContext), numNodes(0), numErrors(0)
+    { }
+
+    NodeProcessingResultID operator()(NodeImpl* nodeImpl,
+        void* userData = 0, int depth = DEPTH_UNSPECIFIED)
+    {
+        numNodes++;
+        if (depth != Node::getImplDepth(nodeImpl, context))
+            numErrors++;
+        return NodeProcessor::RESULT_OK;
+    }
+};
+
+double randomCoord(unsigned int& seed, double scale)
+{
+    // Stay clear of the boundary of the root node.
+    return (0.01 + 0.98 * rand_r(&seed) / RAND_MAX) * scale;
+}
+
+unsigned int checkCount(const std::string& label, unsigned int value,
+    unsigned int expected)
+{
+    std::cout << "    " << label << ": " << value << " (expected: "
+        << expected << ")" << std::endl;
+    if (value != expected)
+        return 1;
+    return 0;
+}
+
+unsigned int checkFind(NodeImpl* rootImpl, Context* ctx, NodeFilter* filter,
+    const std::string& label, unsigned int expected)
+{
+    // Node::findImpl() uses the static filter chain for a plain NodeFilter.
+    unsigned int n0 = Node::findImpl(rootImpl, ctx, 0, filter);
+    // Virtual filter for comparison.
+    StaticFilterRef f0(filter);
+    unsigned int n1 = findImplStatic(rootImpl, ctx, 0, f0);
+    unsigned int numErrors = checkCount(label + " (static)", n0, expected);
+    numErrors += checkCount(label + " (virtual)", n1, expected);
+    return numErrors;
+}
+
+int main(int argc, char* argv[])
+{
+    std::cout << "IFVG test: " << TEST_NAME << std::endl;
+    // memory management
+    Ionflux::ObjectBase::IFObject mm;
+
+    std::cout << "  Creating context..." << std::endl;
+
+    const unsigned int octreeMaxNumLevels = 7;
+    const unsigned int octreeOrder = 2;
+    const double octreeScale = 4.;
+    const int fillDepth = 3;
+    // Number of nodes at depth 0, 1, 2, 3.
+    const unsigned int numNodes[] = { 1, 8, 64, 512 };
+
+    Context* ctx = Context::create(octreeMaxNumLevels,
+        octreeOrder, octreeScale);
+    mm.addLocalRef(ctx);
+
+    std::cout << "  Creating node tree..." << std::endl;
+
+    Node* root0 = Node::create(ctx);
+    mm.addLocalRef(root0);
+    root0->fill(false, true, fillDepth);
+    NodeImpl* rootImpl = root0->getImpl();
+
+    unsigned int numErrors = 0;
+
+    std::cout << "  Finding nodes (NodeFilter)..." << std::endl;
+
+    NodeFilter* nf0 = NodeFilter::create(ctx, 2, 3);
+    mm.addLocalRef(nf0);
+    numErrors += checkFind(rootImpl, ctx, nf0, "depth 2..3",
+        numNodes[2] + numNodes[3]);
+    NodeFilter* nf1 = NodeFilter::create(ctx, DEPTH_UNSPECIFIED, 1);
+    mm.addLocalRef(nf1);
+    numErrors += checkFind(rootImpl, ctx, nf1, "depth 0..1",
+        numNodes[0] + numNodes[1]);
+    NodeFilter* nf2 = NodeFilter::create(ctx, DEPTH_UNSPECIFIED,
+        DEPTH_UNSPECIFIED, NODE_LEAF);
+    mm.addLocalRef(nf2);
+    numErrors += checkFind(rootImpl, ctx, nf2, "leaf", numNodes[3]);
+
+    std::cout << "  Finding nodes (NodeFilter with source)..." << std::endl;
+
+    LeafStop* ls0 = new LeafStop();
+    mm.addLocalRef(ls0);
+    nf0->setSource(ls0);
+    numErrors += checkFind(rootImpl, ctx, nf0, "depth 2..3, no leaves",
+        numNodes[2]);
+    // Both traversals visit all nodes up to the maximum depth.
+    numErrors += checkCount("source invocations", ls0->numNodes,
+        2 * (numNodes[0] + numNodes[1] + numNodes[2] + numNodes[3]));
+
+    std::cout << "  Processing nodes (NodeFilter)..." << std::endl;
+
+    unsigned int n0 = Node::processImpl(rootImpl, ctx, 0, nf1);
+    numErrors += checkCount("processed", n0, numNodes[0] + numNodes[1]);
+
+    std::cout << "  Processing nodes (static chain)..." << std::endl;
+
+    DepthCheck dc0(ctx);
+    StaticChain<StaticPassFilter, StaticNodeFilter> f0 = makeStaticChain(
+        StaticPassFilter(), StaticNodeFilter(ctx, 1, 2));
+    StaticNullProcessor p0;
+    n0 = processImplStatic(rootImpl, ctx, dc0, f0, p0);
+    numErrors += checkCount("processed", n0, numNodes[1] + numNodes[2]);
+    numErrors += checkCount("processor invocations", dc0.numNodes,
+        numNodes[1] + numNodes[2]);
+    numErrors += checkCount("depth errors", dc0.numErrors, 0);
+
+    StaticChain<StaticChain<DepthCheck, StaticNodeFilter>,
+        StaticNodeFilter> f1 = makeStaticChain(DepthCheck(ctx),
+        StaticNodeFilter(ctx, DEPTH_UNSPECIFIED, 2),
+        StaticNodeFilter(ctx, 2, 2));
+    n0 = findImplStatic(rootImpl, ctx, 0, f1);
+    numErrors += checkCount("found", n0, numNodes[2]);
+    numErrors += checkCount("source invocations", f1.source.source.numNodes,
+        numNodes[0] + numNodes[1] + numNodes[2]);
+    numErrors += checkCount("depth errors", f1.source.source.numErrors, 0);
+
+    std::cout << "  Intersecting rays (NodeFilter)..." << std::endl;
+
+    unsigned int seed = 42;
+    unsigned int numRayErrors = 0;
+    for (unsigned int i = 0; i < NUM_RAYS; i++)
+    {
+        Ionflux::GeoUtils::Vector3 v0(randomCoord(seed, octreeScale),
+            randomCoord(seed, octreeScale), -1.);
+        Ionflux::GeoUtils::Vector3 v1(randomCoord(seed, octreeScale),
+            randomCoord(seed, octreeScale), octreeScale + 1.);
+        Ionflux::GeoUtils::Line3 r0(v0, (v1 - v0).normalize());
+        NodeFilter* filters[] = { nf1, nf2 };
+        for (unsigned int k = 0; k < 2; k++)
+        {
+            unsigned int h0 = Node::intersectRayImpl(rootImpl, ctx, r0, 0,
+                filters[k]);
+            StaticIntersectionProcessorRef ip0;
+            StaticFilterRef fr0(filters[k]);
+            unsigned int h1 = intersectRayImplStatic(rootImpl, ctx, r0,
+                ip0, fr0);
+            if ((h0 == 0)
+                || (h0 != h1))
+                numRayErrors++;
+        }
+    }
+    numErrors += checkCount("ray errors", numRayErrors, 0);
+
+    if (numErrors > 0)
+    {
+        std::cout << "Test failed (" << numErrors << " errors)!"
+            << std::endl;
+        return 1;
+    }
+
+	std::cout << "All done!" << std::endl;
+	return 0;
+}
+
+/** \file test_static_processors_01.cpp
+ * \brief IFVG test: Static node processors.
+ */
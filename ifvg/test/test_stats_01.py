@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""IFVG test: Pipeline statistics #1."""
+import json
+import IFObjectBase as ib
+import CGeoUtils as cg
+import CIFVG as vg
+
+testName = "Pipeline statistics #1"
+
+# memory management
+mm = ib.IFObject()
+
+print("IFVG test: %s" % testName)
+
+octreeMaxNumLevels = 7
+octreeOrder = 2
+octreeScale = 4.
+fillDepth = 2
+rayDepth = 2
+
+ctx = vg.Context.create(octreeMaxNumLevels, octreeOrder, octreeScale)
+mm.addLocalRef(ctx)
+
+def createRoot():
+    root = vg.Node.create(ctx)
+    mm.addLocalRef(root)
+    return root
+
+print("  Checking disabled statistics...")
+
+vg.setStatsEnabled(False)
+vg.resetStats()
+assert not vg.getStatsEnabled()
+createRoot().fill(False, True, fillDepth)
+for i in range(0, vg.NUM_STATS_PHASES):
+    s0 = vg.getStats(i)
+    assert s0.numCalls == 0
+    for k in range(0, vg.NUM_STATS_COUNTERS):
+        assert vg.getStatsCounter(s0, k) == 0
+
+print("  Filling nodes...")
+
+vg.setStatsEnabled(True)
+assert vg.getStatsEnabled()
+root0 = createRoot()
+numNodes = root0.fill(False, True, fillDepth)
+# Two levels of child nodes below the root.
+n0 = octreeOrder * octreeOrder * octreeOrder
+assert numNodes == n0 + n0 * n0
+s0 = vg.getStats(vg.STATS_PHASE_OTHER)
+assert s0.nodesCreated == numNodes
+assert s0.bytesAllocated > 0
+assert s0.raysCast == 0
+
+print("  Casting rays...")
+
+numHits = root0.castRayGrid(cg.AXIS_Z, rayDepth)
+assert numHits > 0
+s1 = vg.getStats(vg.STATS_PHASE_CAST_RAY_GRID)
+# The nested castRayGrid() call counts as part of the outer call.
+assert s1.numCalls == 1
+assert s1.time >= 0.
+n1 = octreeOrder ** rayDepth
+assert s1.raysCast == n1 * n1
+assert s1.intersectionsProcessed == numHits
+# Nodes are not created during ray casting without fill.
+assert s1.nodesCreated == 0
+assert vg.getStats(vg.STATS_PHASE_OTHER).nodesCreated == numNodes
+
+print("  Checking reports...")
+
+d0 = json.loads(vg.getStatsJSON())
+assert d0["enabled"] == True
+assert d0["numThreads"] == vg.getNumStatsThreads()
+assert "threads" not in d0
+assert len(d0["phases"]) == vg.NUM_STATS_PHASES
+for i in range(0, vg.NUM_STATS_PHASES):
+    p0 = d0["phases"][vg.getStatsPhaseName(i)]
+    s3 = vg.getStats(i)
+    assert p0["numCalls"] == s3.numCalls
+    for k in range(0, vg.NUM_STATS_COUNTERS):
+        assert p0[vg.getStatsCounterName(k)] == vg.getStatsCounter(s3, k)
+p1 = d0["phases"]["castRayGrid"]
+assert p1["raysCast"] == n1 * n1
+assert p1["intersectionsProcessed"] == numHits
+assert d0["phases"]["other"]["nodesCreated"] == numNodes
+d1 = json.loads(vg.getStatsJSON(True))
+assert len(d1["threads"]) == d1["numThreads"]
+assert sum([ it["castRayGrid"]["raysCast"]
+    for it in d1["threads"] ]) == n1 * n1
+assert len(vg.getStatsString()) > 0
+
+print("  Resetting statistics...")
+
+vg.resetStats()
+for i in range(0, vg.NUM_STATS_PHASES):
+    s0 = vg.getStats(i)
+    assert s0.numCalls == 0
+    for k in range(0, vg.NUM_STATS_COUNTERS):
+        assert vg.getStatsCounter(s0, k) == 0
+vg.setStatsEnabled(False)
+
+print("All tests passed.")